@@ -99,6 +99,35 @@ inline void Sub(volatile int32 *p, int32 value) {
     __atomic_sub_fetch(p, value, MEMMODEL);
 }
 
+inline void Pause() {
+    /* or 27,27,27 lowers the priority of the hardware thread while spinning */
+    asm volatile ("or 27,27,27" ::: "memory");
+}
+
+inline uint32 LoadAcquire(volatile const uint32 *p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline uint8 LoadAcquire(volatile const uint8 *p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline void StoreRelease(volatile uint32 *p, uint32 v) {
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+inline void StoreRelease(volatile uint8 *p, uint8 v) {
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+inline bool CompareAndSwap(volatile uint32 *p, uint32 expected, uint32 desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, false, MEMMODEL, MEMMODEL);
+}
+
+inline void MemoryFence() {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
 }
 
 }
@@ -114,6 +114,45 @@ inline void Sub(volatile int32 *p,
     _InterlockedExchangeAdd(pp, -value);
 }
 
+inline void Pause() {
+    _mm_pause();
+}
+
+/* x86 does not reorder loads with other loads nor stores with other stores, so that only the compiler must be prevented from doing so */
+inline uint32 LoadAcquire(volatile const uint32 *p) {
+    uint32 v = *p;
+    _ReadWriteBarrier();
+    return v;
+}
+
+inline uint8 LoadAcquire(volatile const uint8 *p) {
+    uint8 v = *p;
+    _ReadWriteBarrier();
+    return v;
+}
+
+inline void StoreRelease(volatile uint32 *p, uint32 v) {
+    _ReadWriteBarrier();
+    *p = v;
+}
+
+inline void StoreRelease(volatile uint8 *p, uint8 v) {
+    _ReadWriteBarrier();
+    *p = v;
+}
+
+inline bool CompareAndSwap(volatile uint32 *p, uint32 expected, uint32 desired) {
+    volatile long* pp = (volatile long *) p;
+    //returns the initial value of *pp
+    return _InterlockedCompareExchange(pp, (long) desired, (long) expected) == (long) expected;
+}
+
+inline void MemoryFence() {
+    _ReadWriteBarrier();
+    _mm_mfence();
+    _ReadWriteBarrier();
+}
+
 }
 }
 #endif /* ATOMICA_H_ */
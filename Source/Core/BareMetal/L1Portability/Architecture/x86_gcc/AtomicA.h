@@ -176,6 +176,61 @@ inline void Sub(volatile int32 *p, int32 value) {
 #endif
 }
 
+inline void Pause() {
+    asm volatile ("pause" ::: "memory");
+}
+
+/* x86 does not reorder loads with other loads nor stores with other stores, so that only the compiler must be prevented from doing so */
+inline uint32 LoadAcquire(volatile const uint32 *p) {
+#if GCC_VERSION > 40700
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#else
+    uint32 v = *p;
+    asm volatile ("" ::: "memory");
+    return v;
+#endif
+}
+
+inline uint8 LoadAcquire(volatile const uint8 *p) {
+#if GCC_VERSION > 40700
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#else
+    uint8 v = *p;
+    asm volatile ("" ::: "memory");
+    return v;
+#endif
+}
+
+inline void StoreRelease(volatile uint32 *p, uint32 v) {
+#if GCC_VERSION > 40700
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#else
+    asm volatile ("" ::: "memory");
+    *p = v;
+#endif
+}
+
+inline void StoreRelease(volatile uint8 *p, uint8 v) {
+#if GCC_VERSION > 40700
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#else
+    asm volatile ("" ::: "memory");
+    *p = v;
+#endif
+}
+
+inline bool CompareAndSwap(volatile uint32 *p, uint32 expected, uint32 desired) {
+#if GCC_VERSION > 40700
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    return __sync_bool_compare_and_swap(p, expected, desired);
+#endif
+}
+
+inline void MemoryFence() {
+    asm volatile ("mfence" ::: "memory");
+}
+
 }
 
 }
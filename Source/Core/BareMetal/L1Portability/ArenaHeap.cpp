@@ -0,0 +1,286 @@
+/**
+ * @file ArenaHeap.cpp
+ * @brief Source file for class ArenaHeap
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ArenaHeap.h"
+#include "ErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Rounds \a size up to a multiple of ArenaHeap::ALIGNMENT.
+ */
+static inline uint32 AlignSize(const uint32 size) {
+    return ((size + (ArenaHeap::ALIGNMENT - 1u)) / ArenaHeap::ALIGNMENT) * ArenaHeap::ALIGNMENT;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+const uint32 ArenaHeap::DEFAULT_CHUNK_SIZE;
+const uint32 ArenaHeap::ALIGNMENT;
+const uint32 ArenaHeap::MAX_NAME_LENGTH;
+
+ArenaHeap::ArenaHeap(const char8 * const heapName,
+                     const uint32 chunkSizeIn) :
+        HeapI() {
+    name[0] = '\0';
+    if (heapName != NULL_PTR(const char8 *)) {
+        (void) StringHelper::CopyN(&name[0], heapName, MAX_NAME_LENGTH - 1u);
+        name[MAX_NAME_LENGTH - 1u] = '\0';
+    }
+    const uint32 minChunkSize = 1024u;
+    chunkSize = (chunkSizeIn < minChunkSize) ? (minChunkSize) : (chunkSizeIn);
+    currentChunk = NULL_PTR(ChunkHeader *);
+    lastBlock = NULL_PTR(void *);
+    reservedSize = 0u;
+    usedSize = 0u;
+    firstAddress = 0U;
+    lastAddress = 0U;
+}
+
+/*lint -e{1551} the destructor must release all the chunks.*/
+ArenaHeap::~ArenaHeap() {
+    Release();
+}
+
+uint8 *ArenaHeap::GetChunkMemory(ChunkHeader * const chunk) {
+    const uint32 headerSize = AlignSize(static_cast<uint32>(sizeof(ChunkHeader)));
+    /*lint -e{927} -e{826} the chunk memory starts just after the (aligned) header*/
+    return &(reinterpret_cast<uint8 *>(chunk)[headerSize]);
+}
+
+ArenaHeap::ChunkHeader *ArenaHeap::AllocateChunk(const uint32 size) {
+    const uint32 headerSize = AlignSize(static_cast<uint32>(sizeof(ChunkHeader)));
+    uint32 capacity = chunkSize - headerSize;
+    if (size > capacity) {
+        capacity = size;
+    }
+    ChunkHeader *chunk = NULL_PTR(ChunkHeader *);
+    bool ok = (capacity <= (0xFFFFFFFFu - headerSize));
+    if (ok) {
+        void *rawAddress = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(capacity + headerSize);
+        ok = (rawAddress != NULL);
+        if (ok) {
+            /*lint -e{925} the header is stored at the beginning of the chunk*/
+            chunk = static_cast<ChunkHeader *>(rawAddress);
+            chunk->previous = NULL_PTR(ChunkHeader *);
+            chunk->capacity = capacity;
+            chunk->used = 0u;
+            reservedSize += (capacity + headerSize);
+            /*lint -e{9091} -e{923} the casting from pointer type to integer type is required
+             * in order to be able to update the range of addresses provided by this heap*/
+            uintp address = reinterpret_cast<uintp>(rawAddress);
+            if ((firstAddress > address) || (firstAddress == 0U)) {
+                firstAddress = address;
+            }
+            address += (capacity + headerSize);
+            if (lastAddress < address) {
+                lastAddress = address;
+            }
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "ArenaHeap: Failed to allocate a new chunk");
+    }
+    return chunk;
+}
+
+void *ArenaHeap::Malloc(const uint32 size) {
+    void *pointer = NULL_PTR(void *);
+    bool ok = ((size > 0u) && (size <= (0xFFFFFFFFu - ALIGNMENT)));
+    uint32 alignedSize = 0u;
+    if (ok) {
+        alignedSize = AlignSize(size);
+        bool fits = (currentChunk != NULL_PTR(ChunkHeader *));
+        if (fits) {
+            fits = (alignedSize <= (currentChunk->capacity - currentChunk->used));
+        }
+        if (!fits) {
+            ChunkHeader *chunk = AllocateChunk(alignedSize);
+            ok = (chunk != NULL_PTR(ChunkHeader *));
+            if (ok) {
+                if (currentChunk == NULL_PTR(ChunkHeader *)) {
+                    currentChunk = chunk;
+                }
+                else if (chunk->capacity > (chunkSize - AlignSize(static_cast<uint32>(sizeof(ChunkHeader))))) {
+                    //Large block. Keep allocating in the current chunk, which is likely to still have space.
+                    chunk->previous = currentChunk->previous;
+                    currentChunk->previous = chunk;
+                }
+                else {
+                    chunk->previous = currentChunk;
+                    currentChunk = chunk;
+                }
+                chunk->used = alignedSize;
+                pointer = GetChunkMemory(chunk);
+            }
+        }
+        else {
+            pointer = &(GetChunkMemory(currentChunk)[currentChunk->used]);
+            currentChunk->used += alignedSize;
+        }
+    }
+    if (ok) {
+        usedSize += alignedSize;
+        lastBlock = pointer;
+    }
+    return pointer;
+}
+
+void ArenaHeap::Free(void *&data) {
+    data = NULL_PTR(void *);
+}
+
+void *ArenaHeap::Realloc(void *&data,
+                         const uint32 newSize) {
+    if (data == NULL) {
+        data = ArenaHeap::Malloc(newSize);
+    }
+    else if (newSize == 0u) {
+        ArenaHeap::Free(data);
+    }
+    else {
+        ChunkHeader *chunk = FindChunk(data);
+        if (chunk != NULL_PTR(ChunkHeader *)) {
+            /*lint -e{9091} -e{923} -e{946} -e{947} pointer arithmetic required to compute the offset of the block in the chunk*/
+            uint32 offset = static_cast<uint32>(reinterpret_cast<uintp>(data) - reinterpret_cast<uintp>(GetChunkMemory(chunk)));
+            uint32 oldSize = chunk->used - offset;
+            bool isLast = (data == lastBlock);
+            bool grown = false;
+            if (isLast) {
+                uint32 alignedSize = AlignSize(newSize);
+                grown = (alignedSize <= (chunk->capacity - offset));
+                if (grown) {
+                    usedSize -= oldSize;
+                    usedSize += alignedSize;
+                    chunk->used = offset + alignedSize;
+                }
+            }
+            if (!grown) {
+                //The old block lies in [data, data + oldSize[ (for blocks which are not the last, oldSize also includes the blocks that follow).
+                void *newData = ArenaHeap::Malloc(newSize);
+                if (newData != NULL) {
+                    uint32 toCopy = (oldSize < newSize) ? (oldSize) : (newSize);
+                    (void) MemoryOperationsHelper::Copy(newData, data, toCopy);
+                }
+                data = newData;
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "ArenaHeap: Realloc of a block which does not belong to this heap");
+            data = NULL_PTR(void *);
+        }
+    }
+    return data;
+}
+
+void *ArenaHeap::Duplicate(const void * const data,
+                           uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = ArenaHeap::Malloc(size);
+        if (duplicate != NULL) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp ArenaHeap::FirstAddress() const {
+    return firstAddress;
+}
+
+uintp ArenaHeap::LastAddress() const {
+    return lastAddress;
+}
+
+ArenaHeap::ChunkHeader *ArenaHeap::FindChunk(void const * const data) const {
+    ChunkHeader *found = NULL_PTR(ChunkHeader *);
+    ChunkHeader *chunk = currentChunk;
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required to compare addresses*/
+    uintp address = reinterpret_cast<uintp>(data);
+    while ((chunk != NULL_PTR(ChunkHeader *)) && (found == NULL_PTR(ChunkHeader *))) {
+        /*lint -e{9091} -e{923} the casting from pointer type to integer type is required to compare addresses*/
+        uintp begin = reinterpret_cast<uintp>(GetChunkMemory(chunk));
+        if ((address >= begin) && (address < (begin + chunk->used))) {
+            found = chunk;
+        }
+        chunk = chunk->previous;
+    }
+    return found;
+}
+
+bool ArenaHeap::Owns(void const * const data) const {
+    return (FindChunk(data) != NULL_PTR(ChunkHeader *));
+}
+
+const char8 *ArenaHeap::Name() const {
+    return &name[0];
+}
+
+void ArenaHeap::Release() {
+    while (currentChunk != NULL_PTR(ChunkHeader *)) {
+        ChunkHeader *previous = currentChunk->previous;
+        void *rawAddress = currentChunk;
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(rawAddress);
+        currentChunk = previous;
+    }
+    lastBlock = NULL_PTR(void *);
+    reservedSize = 0u;
+    usedSize = 0u;
+    firstAddress = 0U;
+    lastAddress = 0U;
+}
+
+uint32 ArenaHeap::GetReservedSize() const {
+    return reservedSize;
+}
+
+uint32 ArenaHeap::GetUsedSize() const {
+    return usedSize;
+}
+
+}
@@ -0,0 +1,248 @@
+/**
+ * @file ArenaHeap.h
+ * @brief Header file for class ArenaHeap
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENAHEAP_H_
+#define ARENAHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "HeapI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief HeapI implementation that allocates blocks by advancing a pointer in large chunks of memory (bump allocator).
+ * @details The chunks are allocated from the standard heap and are only returned, all at once, by Release (or by the destructor).
+ * Free does not return any memory. This makes Malloc very cheap and keeps memory that is used together (e.g. all the nodes and values
+ * of a configuration database) contiguous, at the price of never reusing the memory of the blocks that are freed.
+ *
+ * This heap is thus meant for memory with a common lifetime, which is allocated in bulk and then released as a unit (e.g. by the
+ * ArenaConfigurationDatabase) and not for long lived objects that are individually created and destroyed.
+ *
+ * The blocks are aligned to ALIGNMENT bytes. Allocations larger than the chunk size are given a chunk of their own.
+ * @warning This heap is not thread safe. All the memory allocated from it is invalid after Release.
+ */
+class DLL_API ArenaHeap: public HeapI {
+public:
+
+    /**
+     * Default chunk size in bytes.
+     */
+    static const uint32 DEFAULT_CHUNK_SIZE = 65536u;
+
+    /**
+     * Alignment of the blocks in bytes.
+     */
+    static const uint32 ALIGNMENT = 8u;
+
+    /**
+     * Maximum length of the heap name.
+     */
+    static const uint32 MAX_NAME_LENGTH = 64u;
+
+    /**
+     * @brief Constructor.
+     * @param[in] heapName the name of the heap (truncated to MAX_NAME_LENGTH - 1 characters).
+     * @param[in] chunkSizeIn the size of the chunks in bytes. If it is smaller than 1024, 1024 is used.
+     * @post
+     *   GetReservedSize() == 0 &&
+     *   GetUsedSize() == 0
+     */
+    ArenaHeap(const char8 * const heapName,
+              const uint32 chunkSizeIn = DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Destructor. Calls Release.
+     */
+    virtual ~ArenaHeap();
+
+    /**
+     * @see HeapI::Malloc
+     * @details The returned address is aligned to ALIGNMENT.
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @brief Does not return any memory (see Release).
+     * @param[in,out] data the block to free. It is set to NULL.
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @see HeapI::Realloc
+     * @details The last allocated block is grown in place if it still fits in its chunk. Otherwise a new block is allocated
+     * and the contents copied.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @see HeapI::Duplicate
+     */
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @see HeapI::FirstAddress
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @see HeapI::LastAddress
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Checks if \a data belongs to one of the chunks of this heap.
+     * @param[in] data the address to check.
+     * @return true if \a data is inside one of the chunks.
+     */
+    virtual bool Owns(void const * const data) const;
+
+    /**
+     * @see HeapI::Name
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Returns all the chunks to the standard heap.
+     * @post
+     *   GetReservedSize() == 0 &&
+     *   GetUsedSize() == 0
+     */
+    void Release();
+
+    /**
+     * @brief Gets the number of bytes that were reserved (i.e. the sum of the size of all the chunks).
+     * @return the number of bytes that were reserved.
+     */
+    uint32 GetReservedSize() const;
+
+    /**
+     * @brief Gets the number of bytes that were allocated (including the alignment padding).
+     * @return the number of bytes that were allocated.
+     */
+    uint32 GetUsedSize() const;
+
+private:
+
+    /**
+     * Information stored at the beginning of each chunk.
+     */
+    struct ChunkHeader {
+        /**
+         * The previously allocated chunk.
+         */
+        ChunkHeader *previous;
+
+        /**
+         * Number of bytes that can be allocated in this chunk (excluding the header).
+         */
+        uint32 capacity;
+
+        /**
+         * Number of bytes already allocated in this chunk.
+         */
+        uint32 used;
+    };
+
+    /**
+     * @brief Allocates a new chunk with at least \a size bytes of capacity.
+     * @param[in] size the minimum capacity of the chunk.
+     * @return the new chunk or NULL if it could not be allocated.
+     */
+    ChunkHeader *AllocateChunk(const uint32 size);
+
+    /**
+     * @brief Gets the address of the first byte that can be allocated in a chunk.
+     * @param[in] chunk the chunk.
+     * @return the address of the first byte that can be allocated in \a chunk.
+     */
+    static uint8 *GetChunkMemory(ChunkHeader * const chunk);
+
+    /**
+     * @brief Finds the chunk which contains \a data.
+     * @param[in] data the address to search.
+     * @return the chunk which contains \a data or NULL if \a data does not belong to this heap.
+     */
+    ChunkHeader *FindChunk(void const * const data) const;
+
+    /**
+     * The heap name.
+     */
+    char8 name[MAX_NAME_LENGTH];
+
+    /**
+     * The size of the chunks.
+     */
+    uint32 chunkSize;
+
+    /**
+     * The chunk where the blocks are currently being allocated.
+     */
+    ChunkHeader *currentChunk;
+
+    /**
+     * The last allocated block (which can be grown in place).
+     */
+    void *lastBlock;
+
+    /**
+     * Sum of the size of all the chunks.
+     */
+    uint32 reservedSize;
+
+    /**
+     * Number of bytes allocated.
+     */
+    uint32 usedSize;
+
+    /**
+     * Start of range of memory addresses served by this heap.
+     */
+    uintp firstAddress;
+
+    /**
+     * End of range of memory addresses served by this heap.
+     */
+    uintp lastAddress;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENAHEAP_H_ */
@@ -135,6 +135,58 @@ namespace MARTe {
          */
         inline void Sub (volatile int32 *p, int32 value);
 
+        /**
+         * @brief Hints the processor that the caller is busy waiting on a memory location (e.g. in a spin-lock).
+         * @details On architectures that support it (e.g. the x86 pause instruction) this reduces the power
+         * consumption and the memory order violation penalty when the spin-loop exits.
+         */
+        inline void Pause ();
+
+        /**
+         * @brief Reads a 32 bit memory location with acquire semantics.
+         * @details No memory access that follows this call (in program order) can be reordered before it.
+         * @param[in] p the pointer to the 32 bit variable to read.
+         * @return the value of *p.
+         * @pre p != NULL.
+         */
+        inline uint32 LoadAcquire (volatile const uint32 *p);
+
+        /**
+         * @see LoadAcquire for an 8 bit memory location.
+         */
+        inline uint8 LoadAcquire (volatile const uint8 *p);
+
+        /**
+         * @brief Writes a 32 bit memory location with release semantics.
+         * @details No memory access that precedes this call (in program order) can be reordered after it.
+         * @param[out] p the pointer to the 32 bit variable to write.
+         * @param[in] v the value to write.
+         * @pre p != NULL.
+         */
+        inline void StoreRelease (volatile uint32 *p, uint32 v);
+
+        /**
+         * @see StoreRelease for an 8 bit memory location.
+         */
+        inline void StoreRelease (volatile uint8 *p, uint8 v);
+
+        /**
+         * @brief Atomically sets a 32 bit memory location to \a desired if it currently holds \a expected.
+         * @details Acts as a full memory barrier.
+         * @param[in,out] p the pointer to the 32 bit variable to update.
+         * @param[in] expected the value that *p must hold for the update to take place.
+         * @param[in] desired the value to write.
+         * @return true if *p was equal to \a expected and was set to \a desired.
+         * @pre p != NULL.
+         */
+        inline bool CompareAndSwap (volatile uint32 *p, uint32 expected, uint32 desired);
+
+        /**
+         * @brief Full memory barrier.
+         * @details No memory access (load or store) can be reordered across this call, neither by the compiler nor by the processor.
+         */
+        inline void MemoryFence ();
+
     }
 
 }
@@ -0,0 +1,221 @@
+/**
+ * @file CacheAlignedHeap.cpp
+ * @brief Source file for class CacheAlignedHeap
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CacheAlignedHeap (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "Atomic.h"
+#include "CacheAlignedHeap.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+const uint32 CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE;
+const uint32 CacheAlignedHeap::MAX_NAME_LENGTH;
+
+CacheAlignedHeap::CacheAlignedHeap(const char8 * const heapName,
+                                   const uint32 cacheLineSizeIn,
+                                   const uint32 nodeIn) :
+        HeapI() {
+    name[0] = '\0';
+    if (heapName != NULL_PTR(const char8 *)) {
+        (void) StringHelper::CopyN(&name[0], heapName, MAX_NAME_LENGTH - 1u);
+        name[MAX_NAME_LENGTH - 1u] = '\0';
+    }
+    bool isPowerOfTwo = ((cacheLineSizeIn & (cacheLineSizeIn - 1u)) == 0u);
+    if ((cacheLineSizeIn >= DEFAULT_CACHE_LINE_SIZE) && (isPowerOfTwo)) {
+        cacheLineSize = cacheLineSizeIn;
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "CacheAlignedHeap: the cache line size shall be a power of two >= 64. Using the default value");
+        cacheLineSize = DEFAULT_CACHE_LINE_SIZE;
+    }
+    node = nodeIn;
+    numberOfAllocations = 0;
+    released = false;
+    firstAddress = 0U;
+    lastAddress = 0U;
+}
+
+CacheAlignedHeap::~CacheAlignedHeap() {
+    if (numberOfAllocations != 0) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "CacheAlignedHeap: destroyed with memory still allocated");
+    }
+    firstAddress = 0U;
+    lastAddress = 0U;
+}
+
+void *CacheAlignedHeap::Malloc(const uint32 size) {
+    void *pointer = NULL_PTR(void *);
+    const uint32 headerSize = static_cast<uint32>(sizeof(BlockHeader));
+    //Reserve space for the header and for the alignment. Lines are reserved in full so that no other block shares them.
+    const uint32 maxSize = 0xFFFFFFFFu - (headerSize + (2u * cacheLineSize));
+    if ((size > 0u) && (size <= maxSize)) {
+        uint32 capacity = ((size + (cacheLineSize - 1u)) / cacheLineSize) * cacheLineSize;
+        uint32 rawSize = capacity + headerSize + (cacheLineSize - 1u);
+        void *rawAddress = NUMAMemory::Allocate(rawSize, node);
+        if (rawAddress != NULL) {
+            /*lint -e{9091} -e{923} the casting from pointer type to integer type is required in order to align the address*/
+            uintp address = reinterpret_cast<uintp>(rawAddress) + headerSize;
+            address = ((address + (cacheLineSize - 1u)) / cacheLineSize) * cacheLineSize;
+            /*lint -e{9091} -e{923} the casting from integer type to pointer type is required in order to align the address*/
+            pointer = reinterpret_cast<void *>(address);
+            BlockHeader *header = GetHeader(pointer);
+            header->rawAddress = rawAddress;
+            header->rawSize = rawSize;
+            header->capacity = capacity;
+            header->owner = this;
+            Atomic::Increment(&numberOfAllocations);
+            UpdateAddressRange(address, capacity);
+        }
+        else {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "CacheAlignedHeap: Failed to allocate memory");
+        }
+    }
+    return pointer;
+}
+
+void CacheAlignedHeap::Free(void *&data) {
+    if (data != NULL) {
+        BlockHeader *header = GetHeader(data);
+        void *rawAddress = header->rawAddress;
+        header->owner = NULL_PTR(const CacheAlignedHeap *);
+        NUMAMemory::Free(rawAddress, header->rawSize, node);
+        Atomic::Decrement(&numberOfAllocations);
+        if ((released) && (numberOfAllocations == 0)) {
+            /*lint -e{1924} the heap was created with new (see Release)*/
+            delete this;
+        }
+    }
+    data = NULL_PTR(void *);
+}
+
+void *CacheAlignedHeap::Realloc(void *&data,
+                                const uint32 newSize) {
+    if (data == NULL) {
+        data = CacheAlignedHeap::Malloc(newSize);
+    }
+    else if (newSize == 0u) {
+        CacheAlignedHeap::Free(data);
+    }
+    else {
+        uint32 capacity = GetHeader(data)->capacity;
+        if (newSize > capacity) {
+            void *newData = CacheAlignedHeap::Malloc(newSize);
+            if (newData != NULL) {
+                (void) MemoryOperationsHelper::Copy(newData, data, capacity);
+                CacheAlignedHeap::Free(data);
+            }
+            data = newData;
+        }
+    }
+    return data;
+}
+
+void *CacheAlignedHeap::Duplicate(const void * const data,
+                                  uint32 size) {
+    void *duplicate = NULL_PTR(void *);
+    if (data != NULL) {
+        if (size == 0U) {
+            size = StringHelper::Length(static_cast<const char8 *>(data)) + 1u;
+        }
+        duplicate = CacheAlignedHeap::Malloc(size);
+        if (duplicate != NULL) {
+            (void) MemoryOperationsHelper::Copy(duplicate, data, size);
+        }
+    }
+    return duplicate;
+}
+
+uintp CacheAlignedHeap::FirstAddress() const {
+    return firstAddress;
+}
+
+uintp CacheAlignedHeap::LastAddress() const {
+    return lastAddress;
+}
+
+bool CacheAlignedHeap::Owns(void const * const data) const {
+    bool ret = HeapI::Owns(data);
+    if (ret) {
+        ret = (GetHeader(data)->owner == this);
+    }
+    return ret;
+}
+
+const char8 *CacheAlignedHeap::Name() const {
+    return &name[0];
+}
+
+uint32 CacheAlignedHeap::GetCacheLineSize() const {
+    return cacheLineSize;
+}
+
+uint32 CacheAlignedHeap::GetNode() const {
+    return node;
+}
+
+uint32 CacheAlignedHeap::GetNumberOfAllocations() const {
+    return static_cast<uint32>(numberOfAllocations);
+}
+
+void CacheAlignedHeap::Release() {
+    released = true;
+    if (numberOfAllocations == 0) {
+        delete this;
+    }
+}
+
+CacheAlignedHeap::BlockHeader *CacheAlignedHeap::GetHeader(const void * const data) {
+    /*lint -e{9091} -e{923} the header is stored just before the block*/
+    uintp address = reinterpret_cast<uintp>(data) - static_cast<uintp>(sizeof(BlockHeader));
+    /*lint -e{923} the header is stored just before the block*/
+    return reinterpret_cast<BlockHeader *>(address);
+}
+
+void CacheAlignedHeap::UpdateAddressRange(const uintp address,
+                                          const uint32 size) {
+    if ((firstAddress > address) || (firstAddress == 0U)) {
+        firstAddress = address;
+    }
+    uintp endAddress = address + size;
+    if ((lastAddress < endAddress) || (lastAddress == 0U)) {
+        lastAddress = endAddress;
+    }
+}
+
+}
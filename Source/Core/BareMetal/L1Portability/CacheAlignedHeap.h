@@ -0,0 +1,254 @@
+/**
+ * @file CacheAlignedHeap.h
+ * @brief Header file for class CacheAlignedHeap
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CacheAlignedHeap
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CACHEALIGNEDHEAP_H_
+#define CACHEALIGNEDHEAP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "HeapI.h"
+#include "NUMAMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief HeapI implementation that allocates cache-line aligned blocks, optionally on a given NUMA node.
+ * @details Every block starts at a cache line boundary and its size is rounded up to a whole number of cache lines.
+ * As a consequence, two blocks allocated from this heap never share a cache line, so that the signal memory of
+ * components that are executed by different threads cannot suffer from false sharing.
+ *
+ * If a node is specified (see NUMAMemory::GetNode) each block is allocated with page granularity and placed on that
+ * node. This heap is thus meant for memory which is allocated once, during the configuration, and accessed from the
+ * real-time threads (e.g. the GAM and DataSource signal memory) and not for small, frequent, allocations.
+ *
+ * The heap can be selected by name (see HeapManager::FindHeap) after being registered with HeapManager::AddHeap.
+ * @warning The heap must outlive all the memory allocated from it (see GetNumberOfAllocations and Release).
+ */
+class DLL_API CacheAlignedHeap: public HeapI {
+public:
+
+    /**
+     * Default cache line size in bytes.
+     */
+    static const uint32 DEFAULT_CACHE_LINE_SIZE = 64u;
+
+    /**
+     * Maximum length of the heap name.
+     */
+    static const uint32 MAX_NAME_LENGTH = 64u;
+
+    /**
+     * @brief Constructor.
+     * @param[in] heapName the name of the heap (truncated to MAX_NAME_LENGTH - 1 characters).
+     * @param[in] cacheLineSizeIn the cache line size in bytes. If it is not a power of two, or if it is smaller
+     * than DEFAULT_CACHE_LINE_SIZE, DEFAULT_CACHE_LINE_SIZE is used.
+     * @param[in] nodeIn the NUMA node where the memory should be placed (see NUMAMemory::GetNode).
+     * @post
+     *   GetNumberOfAllocations() == 0
+     */
+    CacheAlignedHeap(const char8 * const heapName,
+                     const uint32 cacheLineSizeIn = DEFAULT_CACHE_LINE_SIZE,
+                     const uint32 nodeIn = NUMAMemory::ANY_NODE);
+
+    /**
+     * @brief Destructor.
+     * @pre
+     *   GetNumberOfAllocations() == 0
+     */
+    virtual ~CacheAlignedHeap();
+
+    /**
+     * @see HeapI::Malloc
+     * @details The returned address is aligned to GetCacheLineSize() and the block is padded to a multiple of
+     * GetCacheLineSize().
+     */
+    virtual void *Malloc(const uint32 size);
+
+    /**
+     * @see HeapI::Free
+     */
+    virtual void Free(void *&data);
+
+    /**
+     * @see HeapI::Realloc
+     * @details The block is only moved if \a newSize does not fit in the cache lines that were already reserved.
+     */
+    virtual void *Realloc(void *&data,
+                          const uint32 newSize);
+
+    /**
+     * @see HeapI::Duplicate
+     */
+    virtual void *Duplicate(const void * const data,
+                            uint32 size = 0U);
+
+    /**
+     * @see HeapI::FirstAddress
+     */
+    virtual uintp FirstAddress() const;
+
+    /**
+     * @see HeapI::LastAddress
+     */
+    virtual uintp LastAddress() const;
+
+    /**
+     * @brief Checks if \a data was allocated by this heap.
+     * @details Besides being in the range [FirstAddress(), LastAddress()], the block header must have been written by this heap. The
+     * blocks are allocated with the standard heap or with mmap, so that the range of addresses may also contain blocks of other heaps.
+     * @param[in] data the address to check.
+     * @return true if \a data was returned by Malloc (or Realloc) and not yet freed.
+     */
+    virtual bool Owns(void const * const data) const;
+
+    /**
+     * @see HeapI::Name
+     */
+    virtual const char8 *Name() const;
+
+    /**
+     * @brief Gets the cache line size.
+     * @return the cache line size in bytes.
+     */
+    uint32 GetCacheLineSize() const;
+
+    /**
+     * @brief Gets the NUMA node where the memory is placed.
+     * @return the NUMA node where the memory is placed or NUMAMemory::ANY_NODE.
+     */
+    uint32 GetNode() const;
+
+    /**
+     * @brief Gets the number of blocks which were allocated and not yet freed.
+     * @return the number of blocks which were allocated and not yet freed.
+     */
+    uint32 GetNumberOfAllocations() const;
+
+    /**
+     * @brief Destroys the heap as soon as all the memory allocated from it is freed.
+     * @details Allows the owner of the heap to give it up while other components still hold memory allocated from it.
+     * If GetNumberOfAllocations() == 0 the heap is immediately destroyed.
+     * @pre
+     *   The heap was created with new and is no longer registered in the HeapManager.
+     * @post
+     *   The heap shall no longer be used by the caller.
+     */
+    void Release();
+
+private:
+
+    /**
+     * Information stored just before each block.
+     */
+    struct BlockHeader {
+        /**
+         * Address returned by NUMAMemory::Allocate.
+         */
+        void *rawAddress;
+
+        /**
+         * Size given to NUMAMemory::Allocate.
+         */
+        uint32 rawSize;
+
+        /**
+         * Number of usable bytes (multiple of the cache line size).
+         */
+        uint32 capacity;
+
+        /**
+         * The heap which allocated the block (NULL once freed). It is the last member so that, for a block of the
+         * standard heap, it overlaps with the allocator bookkeeping and never matches a heap address.
+         */
+        const CacheAlignedHeap *owner;
+    };
+
+    /**
+     * @brief Gets the header of a block returned by Malloc.
+     * @param[in] data the address returned by Malloc.
+     * @return the header of the block.
+     */
+    static BlockHeader *GetHeader(const void * const data);
+
+    /**
+     * @brief Updates the range of addresses served by this heap.
+     * @param[in] address the first address of a block.
+     * @param[in] size the size of the block.
+     */
+    void UpdateAddressRange(const uintp address,
+                            const uint32 size);
+
+    /**
+     * The heap name.
+     */
+    char8 name[MAX_NAME_LENGTH];
+
+    /**
+     * The cache line size.
+     */
+    uint32 cacheLineSize;
+
+    /**
+     * The NUMA node.
+     */
+    uint32 node;
+
+    /**
+     * The number of blocks which were allocated and not yet freed.
+     */
+    volatile int32 numberOfAllocations;
+
+    /**
+     * True if Release was called.
+     */
+    bool released;
+
+    /**
+     * Start of range of memory addresses served by this heap.
+     */
+    uintp firstAddress;
+
+    /**
+     * End of range of memory addresses served by this heap.
+     */
+    uintp lastAddress;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CACHEALIGNEDHEAP_H_ */
@@ -0,0 +1,62 @@
+/**
+ * @file FastPollingMutexSem.cpp
+ * @brief Source file for class FastPollingMutexSem
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastPollingMutexSem (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void FastPollingMutexSem::OsWait(volatile int32 * const address,
+                                 const int32 value,
+                                 const TimeoutType &timeout) {
+    //No support to wait on a memory location. Release the CPU as the default polling mode would do.
+    if (*address == value) {
+        if (timeout.GetTimeoutUSec() > 1000u) {
+            Sleep::Sec(1e-3F);
+        }
+        else {
+            Sleep::Sec(static_cast<float32>(timeout.GetTimeoutUSec()) * 1e-6F);
+        }
+    }
+}
+
+/*lint -e{715} address is not used as the waiting threads poll the spin-lock*/
+void FastPollingMutexSem::OsWake(volatile int32 * const address) {
+}
+
+}
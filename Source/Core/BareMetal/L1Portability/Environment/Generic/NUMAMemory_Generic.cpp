@@ -0,0 +1,77 @@
+/**
+ * @file NUMAMemory_Generic.cpp
+ * @brief Source file for module NUMAMemory
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module NUMAMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <stdlib.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "../../NUMAMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace NUMAMemory {
+
+/*lint -e{715} this implementation does not know about memory nodes.*/
+uint32 GetNode(const ProcessorType &cpus) {
+    return ANY_NODE;
+}
+
+/*lint -e{586} -e{715} use of malloc function. The node is ignored in this implementation.*/
+void *Allocate(const uint32 size,
+               const uint32 node) {
+    void *address = NULL_PTR(void *);
+    if (size > 0u) {
+        address = malloc(static_cast<osulong>(size));
+    }
+    return address;
+}
+
+/*lint -e{586} -e{715} use of free function. The size and the node are ignored in this implementation.*/
+void Free(void *&address,
+          const uint32 size,
+          const uint32 node) {
+    if (address != NULL) {
+        free(address);
+    }
+    address = NULL_PTR(void *);
+}
+
+}
+
+}
@@ -0,0 +1,72 @@
+/**
+ * @file SharedMemory_Generic.cpp
+ * @brief Source file for module SharedMemory
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module SharedMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "../../SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace SharedMemory {
+
+/*lint -e{715} shared memory is not supported by this implementation.*/
+void *Create(const char8 * const name,
+             const uint32 size) {
+    return NULL_PTR(void *);
+}
+
+/*lint -e{715} shared memory is not supported by this implementation.*/
+void *Open(const char8 * const name,
+           uint32 &size,
+           const bool readOnly) {
+    return NULL_PTR(void *);
+}
+
+/*lint -e{715} shared memory is not supported by this implementation.*/
+void Close(void *&address,
+           const uint32 size) {
+    address = NULL_PTR(void *);
+}
+
+/*lint -e{715} shared memory is not supported by this implementation.*/
+bool Remove(const char8 * const name) {
+    return false;
+}
+
+}
+
+}
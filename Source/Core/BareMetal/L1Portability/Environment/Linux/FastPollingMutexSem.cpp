@@ -0,0 +1,71 @@
+/**
+ * @file FastPollingMutexSem.cpp
+ * @brief Source file for class FastPollingMutexSem
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FastPollingMutexSem (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#ifndef LINT
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+void FastPollingMutexSem::OsWait(volatile int32 * const address,
+                                 const int32 value,
+                                 const TimeoutType &timeout) {
+    struct timespec timeoutSpec;
+    struct timespec *timeoutSpecPtr = static_cast<struct timespec *>(NULL);
+    if (timeout.IsFinite()) {
+        uint64 usecTimeout = timeout.GetTimeoutUSec();
+        timeoutSpec.tv_sec = static_cast<time_t>(usecTimeout / 1000000u);
+        timeoutSpec.tv_nsec = static_cast<long>((usecTimeout % 1000000u) * 1000u);
+        timeoutSpecPtr = &timeoutSpec;
+    }
+    /*lint -e{923} -e{9130} the futex address is an int32*/
+    (void) syscall(SYS_futex, const_cast<int32 *>(address), FUTEX_WAIT_PRIVATE, value, timeoutSpecPtr, NULL, 0);
+}
+
+void FastPollingMutexSem::OsWake(volatile int32 * const address) {
+    /*lint -e{923} -e{9130} the futex address is an int32*/
+    (void) syscall(SYS_futex, const_cast<int32 *>(address), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+}
@@ -0,0 +1,179 @@
+/**
+ * @file NUMAMemory.cpp
+ * @brief Source file for module NUMAMemory
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module NUMAMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "NUMAMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Maximum number of nodes that can be addressed by the mbind node mask.
+ */
+const MARTe::uint32 NUMA_MAX_NODES = 1024u;
+
+/**
+ * Number of bits in each word of the mbind node mask.
+ */
+const MARTe::uint32 NUMA_MASK_WORD_BITS = static_cast<MARTe::uint32>(sizeof(unsigned long) * 8u);
+
+/**
+ * @brief Gets the node of a single CPU by looking for the nodeN entry in /sys/devices/system/cpu/cpuM.
+ * @param[in] cpu the CPU number (zero based).
+ * @return the node of the CPU or NUMAMemory::ANY_NODE if it cannot be determined.
+ */
+MARTe::uint32 GetCPUNode(const MARTe::uint32 cpu) {
+    MARTe::uint32 node = MARTe::NUMAMemory::ANY_NODE;
+    MARTe::char8 path[64];
+    if (snprintf(&path[0], sizeof(path), "/sys/devices/system/cpu/cpu%u", cpu) > 0) {
+        DIR *dir = opendir(&path[0]);
+        if (dir != NULL) {
+            struct dirent *entry = readdir(dir);
+            while ((entry != NULL) && (node == MARTe::NUMAMemory::ANY_NODE)) {
+                const MARTe::char8 *entryName = &entry->d_name[0];
+                if ((strncmp(entryName, "node", 4u) == 0) && (entryName[4] >= '0') && (entryName[4] <= '9')) {
+                    node = static_cast<MARTe::uint32>(strtoul(&entryName[4], NULL_PTR(MARTe::char8 **), 10));
+                }
+                entry = readdir(dir);
+            }
+            (void) closedir(dir);
+        }
+    }
+    return node;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace NUMAMemory {
+
+uint32 GetNode(const ProcessorType &cpus) {
+    uint32 node = ANY_NODE;
+    bool ok = true;
+    bool found = false;
+    uint32 j;
+    for (j = 0u; (j < cpus.GetCPUsNumber()) && (ok); j++) {
+        if (cpus.CPUEnabled(j + 1u)) {
+            uint32 cpuNode = GetCPUNode(j);
+            if (cpuNode == ANY_NODE) {
+                ok = false;
+            }
+            else if (!found) {
+                node = cpuNode;
+                found = true;
+            }
+            else {
+                ok = (cpuNode == node);
+            }
+        }
+    }
+    if (!ok) {
+        node = ANY_NODE;
+    }
+    return node;
+}
+
+/*lint -e{586} use of malloc function*/
+void *Allocate(const uint32 size,
+               const uint32 node) {
+    void *address = NULL_PTR(void *);
+    if (size > 0u) {
+        if (node == ANY_NODE) {
+            address = malloc(static_cast<osulong>(size));
+            if (address == NULL) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "NUMAMemory: Failed malloc()");
+            }
+        }
+        else if (node >= NUMA_MAX_NODES) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::ParametersError, "NUMAMemory: invalid node");
+        }
+        else {
+            address = mmap(NULL_PTR(void *), static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (address == MAP_FAILED) {
+                address = NULL_PTR(void *);
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "NUMAMemory: Failed mmap()");
+            }
+            else {
+                //The pages are not yet touched, so that the policy decides where they are placed.
+                unsigned long nodeMask[NUMA_MAX_NODES / NUMA_MASK_WORD_BITS];
+                (void) memset(&nodeMask[0], 0, sizeof(nodeMask));
+                nodeMask[node / NUMA_MASK_WORD_BITS] = (1ul << (node % NUMA_MASK_WORD_BITS));
+                if (syscall(SYS_mbind, address, static_cast<unsigned long>(size), MPOL_PREFERRED, &nodeMask[0], static_cast<unsigned long>(NUMA_MAX_NODES), 0u) != 0) {
+                    //The memory is still usable. It will just be placed by the default policy.
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "NUMAMemory: Failed mbind(). The memory will be placed by the default policy");
+                }
+            }
+        }
+    }
+    return address;
+}
+
+/*lint -e{586} use of free function*/
+void Free(void *&address,
+          const uint32 size,
+          const uint32 node) {
+    if (address != NULL) {
+        if (node == ANY_NODE) {
+            free(address);
+        }
+        else {
+            if (munmap(address, static_cast<size_t>(size)) != 0) {
+                REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "NUMAMemory: Failed munmap()");
+            }
+        }
+    }
+    address = NULL_PTR(void *);
+}
+
+}
+
+}
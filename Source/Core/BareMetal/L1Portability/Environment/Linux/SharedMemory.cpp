@@ -0,0 +1,126 @@
+/**
+ * @file SharedMemory.cpp
+ * @brief Source file for module SharedMemory
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module SharedMemory (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifndef LINT
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#include "lint-linux.h"
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ErrorManagement.h"
+#include "SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace SharedMemory {
+
+void *Create(const char8 * const name,
+             const uint32 size) {
+    void *address = NULL_PTR(void *);
+    int32 fd = shm_open(name, O_CREAT | O_RDWR, static_cast<mode_t>(0666));
+    bool ok = (fd >= 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: shm_open failed");
+    }
+    if (ok) {
+        ok = (ftruncate(fd, static_cast<off_t>(size)) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: ftruncate failed");
+        }
+    }
+    if (ok) {
+        address = mmap(NULL_PTR(void *), static_cast<osulong>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: mmap failed");
+            address = NULL_PTR(void *);
+        }
+    }
+    if (fd >= 0) {
+        //The mapping remains valid after closing the descriptor.
+        (void) close(fd);
+    }
+    return address;
+}
+
+void *Open(const char8 * const name,
+           uint32 &size,
+           const bool readOnly) {
+    void *address = NULL_PTR(void *);
+    int32 fd = shm_open(name, readOnly ? O_RDONLY : O_RDWR, static_cast<mode_t>(0));
+    bool ok = (fd >= 0);
+    struct stat segmentStatus;
+    if (ok) {
+        ok = (fstat(fd, &segmentStatus) == 0);
+    }
+    if (ok) {
+        ok = (segmentStatus.st_size > 0) && (static_cast<uint64>(segmentStatus.st_size) <= 0xFFFFFFFFu);
+    }
+    if (ok) {
+        size = static_cast<uint32>(segmentStatus.st_size);
+        int32 protection = readOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+        address = mmap(NULL_PTR(void *), static_cast<osulong>(size), protection, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "SharedMemory: mmap failed");
+            address = NULL_PTR(void *);
+        }
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    return address;
+}
+
+void Close(void *&address,
+           const uint32 size) {
+    if (address != NULL) {
+        (void) munmap(address, static_cast<osulong>(size));
+    }
+    address = NULL_PTR(void *);
+}
+
+bool Remove(const char8 * const name) {
+    return (shm_unlink(name) == 0);
+}
+
+}
+
+}
@@ -46,11 +46,15 @@ namespace MARTe {
 FastPollingMutexSem::FastPollingMutexSem() {
     internalFlag = 0;
     flag = &internalFlag;
+    adaptive = false;
+    spinCycles = 100u;
 }
 
 FastPollingMutexSem::FastPollingMutexSem(volatile int32 &externalFlag) {
     internalFlag = 0;
     flag = &externalFlag;
+    adaptive = false;
+    spinCycles = 100u;
 }
 
 void FastPollingMutexSem::Create(const bool locked) {
@@ -63,44 +67,118 @@ void FastPollingMutexSem::Create(const bool locked) {
 }
 
 bool FastPollingMutexSem::Locked() const {
-    return *flag == 1;
+    return *flag != 0;
+}
+
+void FastPollingMutexSem::SetAdaptive(const bool adaptiveIn,
+                                      const uint32 spinCyclesIn) {
+    adaptive = adaptiveIn;
+    spinCycles = spinCyclesIn;
+}
+
+bool FastPollingMutexSem::IsAdaptive() const {
+    return adaptive;
 }
 
 ErrorManagement::ErrorType FastPollingMutexSem::FastLock(const TimeoutType &timeout,
                                                          float32 sleepTime ) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    if (adaptive) {
+        err = AdaptiveLock(timeout);
+    }
+    else {
+        uint64 ticksStop = timeout.HighResolutionTimerTicks();
+        ticksStop += HighResolutionTimer::Counter();
+
+        // sets the default if it is negative
+        if (sleepTime < 0.0F) {
+            sleepTime = 1e-3F;
+        }
+        bool noSleep = IsEqual(sleepTime, 0.0);
+
+        while (!Atomic::TestAndSet(flag)) {
+            if (timeout != TTInfiniteWait) {
+                uint64 ticks = HighResolutionTimer::Counter();
+                if (ticks > ticksStop) {
+                    err = ErrorManagement::Timeout;
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
+                    break;
+                }
+            }
+
+            if (!noSleep) {
+                Sleep::Sec(sleepTime);
+            }
+        }
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType FastPollingMutexSem::AdaptiveLock(const TimeoutType &timeout) {
     uint64 ticksStop = timeout.HighResolutionTimerTicks();
     ticksStop += HighResolutionTimer::Counter();
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
 
-    // sets the default if it is negative
-    if (sleepTime < 0.0F) {
-        sleepTime = 1e-3F;
+    //Bounded spin. Only try to take the lock when it looks free, so that the cache line is not continuously written.
+    int32 state = 1;
+    for (uint32 i = 0u; (i < spinCycles) && (state == 1); i++) {
+        if (*flag == 0) {
+            state = Atomic::Exchange(flag, 1);
+        }
+        else {
+            Atomic::Pause();
+        }
     }
-    bool noSleep = IsEqual(sleepTime, 0.0);
-
-    while (!Atomic::TestAndSet(flag)) {
+    //Block on the operating system. The value 2 signals the FastUnLock that there might be waiting threads.
+    //Note that the Exchange above may have overwritten a 2 with a 1, which is restored here before blocking.
+    if (state != 0) {
+        state = Atomic::Exchange(flag, 2);
+    }
+    while ((state != 0) && (err == ErrorManagement::NoError)) {
+        TimeoutType remaining = TTInfiniteWait;
         if (timeout != TTInfiniteWait) {
             uint64 ticks = HighResolutionTimer::Counter();
             if (ticks > ticksStop) {
                 err = ErrorManagement::Timeout;
                 REPORT_ERROR_STATIC_0(ErrorManagement::Timeout, "FastPollingMutexSem: Timeout expired");
-                break;
+            }
+            else {
+                remaining.SetTimeoutHighResolutionTimerTicks(ticksStop - ticks);
             }
         }
-
-        if (!noSleep) {
-            Sleep::Sec(sleepTime);
+        if (err == ErrorManagement::NoError) {
+            OsWait(flag, 2, remaining);
+            state = Atomic::Exchange(flag, 2);
         }
     }
     return err;
 }
 
 bool FastPollingMutexSem::FastTryLock() {
-    return (Atomic::TestAndSet(flag));
+    bool ret;
+    if (adaptive) {
+        int32 state = Atomic::Exchange(flag, 1);
+        if (state == 2) {
+            //Restore the waiters information. If in the meanwhile the semaphore was unlocked, it is now owned by this thread.
+            state = Atomic::Exchange(flag, 2);
+        }
+        ret = (state == 0);
+    }
+    else {
+        ret = (Atomic::TestAndSet(flag));
+    }
+    return ret;
 }
 
 void FastPollingMutexSem::FastUnLock() {
-    *flag = 0;
+    if (adaptive) {
+        if (Atomic::Exchange(flag, 0) == 2) {
+            OsWake(flag);
+        }
+    }
+    else {
+        *flag = 0;
+    }
 }
 
 }
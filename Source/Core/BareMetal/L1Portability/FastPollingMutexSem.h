@@ -51,6 +51,14 @@ namespace MARTe {
  *
  * @details This semaphore is not recursive i.e is the same thread locks two times sequentially causes a deadlock.
  * Moreover a thread can unlock the semaphore locked by another thread.
+ *
+ * By default the semaphore is purely polled, i.e. FastLock spins on the spin-lock and (optionally) releases the CPU
+ * for a fixed sleepTime in-between each polling cycle. Instances which are not used in real-time paths may be
+ * set to the adaptive mode (see SetAdaptive), where FastLock spins for a bounded number of cycles (with a processor
+ * pause hint) and then blocks on the operating system (e.g. a futex on Linux) until the semaphore is unlocked or the
+ * timeout expires. In this mode the spin-lock takes the values 0 (unlocked), 1 (locked) and 2 (locked with threads
+ * potentially waiting) and the sleepTime parameter is ignored. All the semaphores sharing the same external spin-lock
+ * shall use the same mode and the adaptive mode is only meant to synchronise threads of the same process.
  */
 class DLL_API FastPollingMutexSem {
 
@@ -108,8 +116,51 @@ public:
      */
     void FastUnLock();
 
+    /**
+     * @brief Selects between the polling (default) and the adaptive locking mode.
+     * @details This method is not thread safe and shall be called before the semaphore is used.
+     * @param[in] adaptiveIn if true FastLock spins for \a spinCyclesIn polling cycles and then waits on the operating system.
+     * If false FastLock keeps polling the spin-lock as described in FastLock.
+     * @param[in] spinCyclesIn the maximum number of polling cycles before blocking on the operating system.
+     * @post
+     *   IsAdaptive() == adaptiveIn
+     */
+    void SetAdaptive(const bool adaptiveIn,
+                     const uint32 spinCyclesIn = 100u);
+
+    /**
+     * @brief Returns true if the semaphore is in the adaptive mode.
+     * @return true if the semaphore is in the adaptive mode.
+     */
+    bool IsAdaptive() const;
+
 private:
 
+    /**
+     * @brief Implements FastLock in the adaptive mode.
+     * @param[in] timeout is the desired timeout.
+     * @return ErrorManagement::Timeout if the semaphore could not be locked within the \a timeout, ErrorManagement::NoError otherwise.
+     */
+    ErrorManagement::ErrorType AdaptiveLock(const TimeoutType &timeout);
+
+    /**
+     * @brief Blocks the calling thread while *address == value, until it is woken by OsWake or the \a timeout expires.
+     * @details The function may return spuriously and the caller is expected to re-check the spin-lock. Environments that do not
+     * offer the possibility to wait on a memory location release the CPU for the shortest sleep period instead.
+     * @param[in] address the spin-lock.
+     * @param[in] value the value of the spin-lock for which the thread is to be blocked.
+     * @param[in] timeout the maximum amount of time to wait.
+     */
+    static void OsWait(volatile int32 * const address,
+                       const int32 value,
+                       const TimeoutType &timeout);
+
+    /**
+     * @brief Wakes one thread which is blocked in OsWait on \a address.
+     * @param[in] address the spin-lock.
+     */
+    static void OsWake(volatile int32 * const address);
+
     /**
      * The internal spin-lock
      */
@@ -120,6 +171,16 @@ private:
      */
     volatile int32 *flag;
 
+    /**
+     * True if the semaphore is in the adaptive mode.
+     */
+    bool adaptive;
+
+    /**
+     * Maximum number of polling cycles before blocking on the operating system (adaptive mode).
+     */
+    uint32 spinCycles;
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -34,6 +34,7 @@
 
 //#include "ErrorManagement.h"
 #include "GeneralDefinitions.h"
+#include "HighResolutionTimerConverter.h"
 #include "TimeStamp.h"
 #include INCLUDE_FILE_ARCHITECTURE(BareMetal,L1Portability,ARCHITECTURE,HighResolutionTimerA.h)
 #include INCLUDE_FILE_ENVIRONMENT(BareMetal,L1Portability,ENVIRONMENT,HighResolutionTimer.h)
@@ -79,6 +80,24 @@ namespace MARTe {
          */
         inline float64 TicksToTime(uint64 tStop, uint64 tStart = 0u);
 
+        /**
+         * @brief Converts HighResolutionTimer ticks to time in nanoseconds using only integer arithmetic.
+         * @details See HighResolutionTimerConverter.
+         * @param[in] tStop is the final ticks number.
+         * @param[in] tStart is the initial ticks number.
+         * @return the time elapsed in nanoseconds.
+         */
+        inline uint64 TicksToNanoseconds(const uint64 tStop, const uint64 tStart = 0u);
+
+        /**
+         * @brief Converts HighResolutionTimer ticks to time in microseconds using only integer arithmetic.
+         * @details See HighResolutionTimerConverter.
+         * @param[in] tStop is the final ticks number.
+         * @param[in] tStart is the initial ticks number.
+         * @return the time elapsed in microseconds.
+         */
+        inline uint64 TicksToMicroseconds(const uint64 tStop, const uint64 tStart = 0u);
+
         /**
          * @brief Gets the current time stamp [microseconds, seconds, minutes, hour, day, month, year].
          * @see TimeValues.
@@ -93,4 +112,19 @@ namespace MARTe {
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+    namespace HighResolutionTimer {
+
+        inline uint64 TicksToNanoseconds(const uint64 tStop, const uint64 tStart) {
+            return HighResolutionTimerConverter::Instance().TicksToNanoseconds(tStop - tStart);
+        }
+
+        inline uint64 TicksToMicroseconds(const uint64 tStop, const uint64 tStart) {
+            return HighResolutionTimerConverter::Instance().TicksToMicroseconds(tStop - tStart);
+        }
+    }
+
+}
+
 #endif /* HIGHRESOLUTIONTIME_H_ */
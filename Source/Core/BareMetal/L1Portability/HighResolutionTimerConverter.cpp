@@ -0,0 +1,103 @@
+/**
+ * @file HighResolutionTimerConverter.cpp
+ * @brief Source file for class HighResolutionTimerConverter
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HighResolutionTimerConverter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
+#include "HighResolutionTimerConverter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HighResolutionTimerConverter::HighResolutionTimerConverter() {
+    frequency = HighResolutionTimer::Frequency();
+    ComputeFactors(1000000000ull, frequency, nanosecondsMultiplier, nanosecondsShift);
+    ComputeFactors(1000000ull, frequency, microsecondsMultiplier, microsecondsShift);
+    ComputeFactors(frequency, 1000000ull, ticksMultiplier, ticksShift);
+}
+
+HighResolutionTimerConverter::HighResolutionTimerConverter(const uint64 frequencyIn) {
+    frequency = frequencyIn;
+    ComputeFactors(1000000000ull, frequency, nanosecondsMultiplier, nanosecondsShift);
+    ComputeFactors(1000000ull, frequency, microsecondsMultiplier, microsecondsShift);
+    ComputeFactors(frequency, 1000000ull, ticksMultiplier, ticksShift);
+}
+
+HighResolutionTimerConverter::~HighResolutionTimerConverter() {
+
+}
+
+const HighResolutionTimerConverter &HighResolutionTimerConverter::Instance() {
+    static HighResolutionTimerConverter instance;
+    return instance;
+}
+
+uint64 HighResolutionTimerConverter::GetFrequency() const {
+    return frequency;
+}
+
+void HighResolutionTimerConverter::ComputeFactors(const uint64 numerator,
+                                                  const uint64 denominator,
+                                                  uint64 &multiplier,
+                                                  uint32 &shift) {
+    multiplier = 0u;
+    shift = 0u;
+    if ((denominator > 0u) && (numerator > 0u)) {
+        //Binary long division: one more bit of (numerator << shift) / denominator for each shift increment
+        multiplier = numerator / denominator;
+        uint64 remainder = numerator % denominator;
+        while ((multiplier < 0x8000000000000000ull) && (shift < 127u)) {
+            //2 * remainder >= denominator (written so that it cannot overflow)
+            bool bit = (remainder >= (denominator - remainder));
+            if (bit) {
+                remainder -= (denominator - remainder);
+            }
+            else {
+                remainder += remainder;
+            }
+            multiplier <<= 1u;
+            if (bit) {
+                multiplier |= 1u;
+            }
+            shift++;
+        }
+        //Round up, so that exact multiples are not truncated to the unit below
+        if ((remainder != 0u) && (multiplier != 0xFFFFFFFFFFFFFFFFull)) {
+            multiplier++;
+        }
+    }
+}
+
+}
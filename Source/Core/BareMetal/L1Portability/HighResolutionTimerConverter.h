@@ -0,0 +1,227 @@
+/**
+ * @file HighResolutionTimerConverter.h
+ * @brief Header file for class HighResolutionTimerConverter
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HighResolutionTimerConverter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HIGHRESOLUTIONTIMERCONVERTER_H_
+#define HIGHRESOLUTIONTIMERCONVERTER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Fixed-point conversion between HighResolutionTimer ticks and time.
+ * @details The ratio between the time unit and the HighResolutionTimer frequency is precomputed (on construction)
+ * as a normalised 64 bit multiplier and a shift, so that each conversion is computed as (ticks * multiplier) >> shift
+ * using only integer operations (four 32x32 bit multiplications and no divisions).
+ * Results that do not fit in a uint64 saturate at 0xFFFFFFFFFFFFFFFF.
+ *
+ * The multiplier is rounded up, so that times that are an exact multiple of the unit are not truncated to the
+ * unit below (e.g. 100000000 ticks at 1 GHz are exactly 100000 microseconds). Otherwise the relative error of the
+ * conversion is below 2^-63.
+ *
+ * The Instance() converter uses the HighResolutionTimer::Frequency(). Classes that convert ticks in a real-time loop
+ * should keep their own copy, so that the conversion does not have to go through the singleton.
+ */
+class DLL_API HighResolutionTimerConverter {
+public:
+
+    /**
+     * @brief Constructor. Precomputes the conversion factors for the HighResolutionTimer::Frequency().
+     */
+    HighResolutionTimerConverter();
+
+    /**
+     * @brief Constructor. Precomputes the conversion factors for a given \a frequency.
+     * @param[in] frequency the frequency of the ticks to be converted (in Hz).
+     */
+    explicit HighResolutionTimerConverter(const uint64 frequency);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~HighResolutionTimerConverter();
+
+    /**
+     * @brief Gets a converter for the HighResolutionTimer::Frequency().
+     * @return a converter for the HighResolutionTimer::Frequency().
+     */
+    static const HighResolutionTimerConverter &Instance();
+
+    /**
+     * @brief Converts ticks to nanoseconds.
+     * @param[in] ticks the number of ticks to convert.
+     * @return \a ticks in nanoseconds.
+     */
+    inline uint64 TicksToNanoseconds(const uint64 ticks) const;
+
+    /**
+     * @brief Converts ticks to microseconds.
+     * @param[in] ticks the number of ticks to convert.
+     * @return \a ticks in microseconds.
+     */
+    inline uint64 TicksToMicroseconds(const uint64 ticks) const;
+
+    /**
+     * @brief Converts microseconds to ticks.
+     * @param[in] microseconds the time to convert.
+     * @return \a microseconds in ticks.
+     */
+    inline uint64 MicrosecondsToTicks(const uint64 microseconds) const;
+
+    /**
+     * @brief Gets the frequency used to compute the conversion factors.
+     * @return the frequency used to compute the conversion factors.
+     */
+    uint64 GetFrequency() const;
+
+private:
+
+    /**
+     * @brief Computes the multiplier and the shift that best approximate numerator / denominator.
+     * @details The multiplier is normalised (i.e. its most significant bit is set) and rounded up.
+     * @param[in] numerator the numerator of the ratio.
+     * @param[in] denominator the denominator of the ratio.
+     * @param[out] multiplier the 64 bit multiplier.
+     * @param[out] shift the shift (< 128).
+     */
+    static void ComputeFactors(const uint64 numerator,
+                               const uint64 denominator,
+                               uint64 &multiplier,
+                               uint32 &shift);
+
+    /**
+     * @brief Computes (value * multiplier) >> shift on the full 128 bit product.
+     * @param[in] value the value to convert.
+     * @param[in] multiplier the 64 bit multiplier.
+     * @param[in] shift the shift (< 128).
+     * @return (value * multiplier) >> shift or 0xFFFFFFFFFFFFFFFF if the result does not fit in a uint64.
+     */
+    static inline uint64 MultiplyShift(const uint64 value,
+                                       const uint64 multiplier,
+                                       const uint32 shift);
+
+    /**
+     * The frequency used to compute the conversion factors.
+     */
+    uint64 frequency;
+
+    /**
+     * Ticks to nanoseconds multiplier.
+     */
+    uint64 nanosecondsMultiplier;
+
+    /**
+     * Ticks to nanoseconds shift.
+     */
+    uint32 nanosecondsShift;
+
+    /**
+     * Ticks to microseconds multiplier.
+     */
+    uint64 microsecondsMultiplier;
+
+    /**
+     * Ticks to microseconds shift.
+     */
+    uint32 microsecondsShift;
+
+    /**
+     * Microseconds to ticks multiplier.
+     */
+    uint64 ticksMultiplier;
+
+    /**
+     * Microseconds to ticks shift.
+     */
+    uint32 ticksShift;
+};
+
+}
+
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+uint64 HighResolutionTimerConverter::MultiplyShift(const uint64 value,
+                                                   const uint64 multiplier,
+                                                   const uint32 shift) {
+    //128 bit product computed from the four 32x32 bit partial products
+    uint64 a0 = (value & 0xFFFFFFFFull);
+    uint64 a1 = (value >> 32u);
+    uint64 b0 = (multiplier & 0xFFFFFFFFull);
+    uint64 b1 = (multiplier >> 32u);
+    uint64 p00 = a0 * b0;
+    uint64 p01 = a0 * b1;
+    uint64 p10 = a1 * b0;
+    uint64 p11 = a1 * b1;
+    uint64 middle = (p00 >> 32u) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+    uint64 low = (middle << 32u) | (p00 & 0xFFFFFFFFull);
+    uint64 high = p11 + (p01 >> 32u) + (p10 >> 32u) + (middle >> 32u);
+
+    uint64 result = 0xFFFFFFFFFFFFFFFFull;
+    if (shift >= 64u) {
+        result = (high >> (shift - 64u));
+    }
+    else if (shift == 0u) {
+        if (high == 0u) {
+            result = low;
+        }
+    }
+    else {
+        if ((high >> shift) == 0u) {
+            result = (high << (64u - shift)) | (low >> shift);
+        }
+    }
+    return result;
+}
+
+uint64 HighResolutionTimerConverter::TicksToNanoseconds(const uint64 ticks) const {
+    return MultiplyShift(ticks, nanosecondsMultiplier, nanosecondsShift);
+}
+
+uint64 HighResolutionTimerConverter::TicksToMicroseconds(const uint64 ticks) const {
+    return MultiplyShift(ticks, microsecondsMultiplier, microsecondsShift);
+}
+
+uint64 HighResolutionTimerConverter::MicrosecondsToTicks(const uint64 microseconds) const {
+    return MultiplyShift(microseconds, ticksMultiplier, ticksShift);
+}
+
+}
+
+#endif /* HIGHRESOLUTIONTIMERCONVERTER_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file NUMAMemory.h
+ * @brief Header file for module NUMAMemory
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module NUMAMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef NUMAMEMORY_H_
+#define NUMAMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "ProcessorType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Placement of memory on the nodes of a NUMA machine.
+ * @details On environments without NUMA support (or where it is not implemented) GetNode always returns ANY_NODE
+ * and the memory is allocated with the standard C library.
+ */
+namespace NUMAMemory {
+
+/**
+ * Identifies memory that can be placed on any node.
+ */
+const uint32 ANY_NODE = 0xFFFFFFFFu;
+
+/**
+ * @brief Gets the memory node that is local to a set of CPUs.
+ * @param[in] cpus the CPU mask (e.g. the one of the thread that will access the memory).
+ * @return the node to which all the CPUs in \a cpus belong or ANY_NODE if the CPUs span more than one node,
+ * if \a cpus is empty or if the node cannot be determined.
+ */
+DLL_API uint32 GetNode(const ProcessorType &cpus);
+
+/**
+ * @brief Allocates memory on a given node.
+ * @details If \a node != ANY_NODE the memory is allocated with page granularity and the pages are preferably placed
+ * on \a node, independently of the thread that first touches them. This is meant for memory that is allocated once
+ * and not for small, frequent, allocations.
+ * @param[in] size the number of bytes to allocate.
+ * @param[in] node the node where the memory should be placed.
+ * @return a pointer to the allocated memory or NULL if the allocation fails.
+ */
+DLL_API void *Allocate(const uint32 size,
+                       const uint32 node);
+
+/**
+ * @brief Frees memory allocated with Allocate.
+ * @param[in,out] address the address returned by Allocate.
+ * @param[in] size the \a size that was given to Allocate.
+ * @param[in] node the \a node that was given to Allocate.
+ * @post
+ *   address == NULL
+ */
+DLL_API void Free(void *&address,
+                  const uint32 size,
+                  const uint32 node);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* NUMAMEMORY_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file SharedMemory.h
+ * @brief Header file for module SharedMemory
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module SharedMemory
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORY_H_
+#define SHAREDMEMORY_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Module declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Named memory segments that can be mapped by more than one process.
+ * @details On Linux the segments are POSIX shared-memory objects (shm_open), so that the \a name shall start with a '/' and
+ * shall not contain any other '/'. On environments without shared memory support (or where it is not implemented) Create and Open
+ * always fail.
+ */
+namespace SharedMemory {
+
+/**
+ * @brief Creates (or resizes, if it already exists) a named segment and maps it for reading and writing.
+ * @param[in] name the name of the segment.
+ * @param[in] size the size of the segment in bytes.
+ * @return the address where the segment was mapped or NULL if the segment could not be created or mapped.
+ */
+DLL_API void *Create(const char8 * const name,
+                     const uint32 size);
+
+/**
+ * @brief Maps an existing named segment.
+ * @param[in] name the name of the segment.
+ * @param[out] size the size of the segment in bytes.
+ * @param[in] readOnly if true the segment is mapped read-only.
+ * @return the address where the segment was mapped or NULL if the segment does not exist or could not be mapped.
+ */
+DLL_API void *Open(const char8 * const name,
+                   uint32 &size,
+                   const bool readOnly);
+
+/**
+ * @brief Unmaps a segment mapped with Create or Open. The segment itself is not removed.
+ * @param[in,out] address the address returned by Create or Open.
+ * @param[in] size the size of the mapped segment.
+ * @post
+ *   address == NULL
+ */
+DLL_API void Close(void *&address,
+                   const uint32 size);
+
+/**
+ * @brief Removes a named segment. The processes which have the segment mapped can continue to use it until they Close it.
+ * @param[in] name the name of the segment.
+ * @return true if the segment existed and was removed.
+ */
+DLL_API bool Remove(const char8 * const name);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORY_H_ */
@@ -234,20 +234,12 @@ void TimeoutType::SetTimeoutSec(float64 secs) {
 }
 
 void TimeoutType::SetTimeoutHighResolutionTimerTicks(const uint64 ticks) {
-    float64 TimeoutSecFromTicks = (static_cast<float64>(ticks) * HighResolutionTimer::Period());
-    float64 TimeoutMSecFromTicks = 1000.0 * TimeoutSecFromTicks;
-    msecTimeout = static_cast<uint32>(TimeoutMSecFromTicks);
-    float64 auxResult = 1000000.0 * TimeoutSecFromTicks;
-    usecTimeout = static_cast<uint64>(auxResult);
+    usecTimeout = HighResolutionTimerConverter::Instance().TicksToMicroseconds(ticks);
+    msecTimeout = static_cast<uint32>(usecTimeout / 1000u);
 }
 
 uint64 TimeoutType::HighResolutionTimerTicks() const {
-    float64 deltaT = static_cast<float64>(usecTimeout);
-    deltaT = deltaT * 1e-6;
-    float64 frequency = static_cast<float64>(HighResolutionTimer::Frequency());
-    deltaT = deltaT * frequency;
-    uint64 ticks = static_cast<uint64>(deltaT);
-    return ticks;
+    return HighResolutionTimerConverter::Instance().MicrosecondsToTicks(usecTimeout);
 }
 
 TimeoutType& TimeoutType::operator-=(const uint32 &mSecs) {
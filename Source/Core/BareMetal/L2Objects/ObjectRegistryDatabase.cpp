@@ -110,13 +110,11 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
     // now search from the domain forward
     Reference ret;
     if (ok) {
-        ReferenceContainerFilterObjectName filterName(1, ReferenceContainerFilterMode::SHALLOW, &path[backSteps]);
-        ReferenceContainer resultSingle;
-
+        //The path is resolved by name on each level (see ReferenceContainer::Find)
         if (isSearchDomain) {
             if (domain.IsValid()) {
                 // already safe
-                domain->Find(resultSingle, filterName);
+                ret = domain->Find(&path[backSteps]);
             }
             else {
                 REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "Find: Invalid domain");
@@ -124,13 +122,7 @@ Reference ObjectRegistryDatabase::Find(const char8 * const path,
         }
         else {
             // search from the beginning
-            ReferenceContainer::Find(resultSingle, filterName);
-        }
-
-        ok = (resultSingle.Size() > 0u);
-        if (ok) {
-            //Invalidate move to leafs
-            ret = resultSingle.Get(resultSingle.Size() - 1u);
+            ret = ReferenceContainer::Find(&path[backSteps]);
         }
     }
     return ret;
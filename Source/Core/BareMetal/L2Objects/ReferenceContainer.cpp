@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "Atomic.h"
 #include "ClassRegistryItemT.h"
 #include "ReferenceContainer.h"
 #include "ReferenceContainerNode.h"
@@ -48,6 +49,8 @@
 namespace MARTe {
 DLL_API_EXPLICIT_EXPORT char8 ReferenceContainer::buildTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS] = { '+', '\0', '\0', '\0', '\0' };
 DLL_API_EXPLICIT_EXPORT char8 ReferenceContainer::domainTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS] = { '$', '\0', '\0', '\0', '\0' };
+DLL_API_EXPLICIT_EXPORT volatile uint32 ReferenceContainer::generationSequence = 0u;
+DLL_API_EXPLICIT_EXPORT volatile uint32 ReferenceContainer::lastChangeNotification = 0u;
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -57,11 +60,16 @@ namespace MARTe {
 ReferenceContainer::ReferenceContainer() :
         Object() {
     mux.Create();
+    //Not used in real-time paths: do not burn the CPU (or sleep for a fixed time) while contending for the lock.
+    mux.SetAdaptive(true);
     muxTimeout = TTInfiniteWait;
+    generation = NextGeneration();
 }
 
 ReferenceContainer::ReferenceContainer(ReferenceContainer &copy) :
         Object(copy) {
+    mux.SetAdaptive(true);
+    generation = NextGeneration();
     SetTimeout(copy.GetTimeout());
     uint32 nChildren = copy.Size();
     for (uint32 i = 0u; i < nChildren; i++) {
@@ -104,6 +112,27 @@ Reference ReferenceContainer::Get(const uint32 idx) {
     return ref;
 }
 
+uint32 ReferenceContainer::GetGeneration() const {
+    return Atomic::LoadAcquire(&generation);
+}
+
+void ReferenceContainer::NotifyChange() {
+    Atomic::StoreRelease(&lastChangeNotification, NextGeneration());
+}
+
+uint32 ReferenceContainer::GetLastChangeNotification() {
+    return Atomic::LoadAcquire(&lastChangeNotification);
+}
+
+uint32 ReferenceContainer::NextGeneration() {
+    uint32 stamp;
+    do {
+        stamp = Atomic::LoadAcquire(&generationSequence);
+    }
+    while (!Atomic::CompareAndSwap(&generationSequence, stamp, stamp + 1u));
+    return (stamp + 1u);
+}
+
 TimeoutType ReferenceContainer::GetTimeout() const {
     return muxTimeout;
 }
@@ -136,6 +165,23 @@ bool ReferenceContainer::Insert(Reference ref, const int32 &position) {
             else {
                 list.ListInsert(newItem, static_cast<uint32>(position));
             }
+            if (nameIndex.IsActive()) {
+                //If the index cannot grow it is reset and the lookups walk the list
+                if (!nameIndex.Add(newItem)) {
+                    REPORT_ERROR_STATIC_0(ErrorManagement::Warning, "ReferenceContainer: Failed to index the element by name");
+                }
+            }
+            else if (list.ListSize() == REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD) {
+                bool indexed = true;
+                ReferenceContainerNode *node = list.List();
+                while ((node != NULL) && (indexed)) {
+                    indexed = nameIndex.Add(node);
+                    node = static_cast<ReferenceContainerNode *>(node->Next());
+                }
+            }
+            else {
+            }
+            generation = NextGeneration();
         }
         else {
             delete newItem;
@@ -273,6 +319,8 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                     if (filter.IsSearchAll() || filter.IsFinished()) {
                         if (result.Insert(currentNodeReference)) {
                             if (filter.IsRemove()) {
+                                nameIndex.Remove(currentNode);
+                                generation = NextGeneration();
                                 //Only delete the exact node index
                                 if (list.ListDelete(currentNode)) {
                                     //Given that the index will be incremented, but we have removed an element, the index should stay in the same position
@@ -312,7 +360,8 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                             //Recursion was aborted. Remove all the elements from the test results
                             if (!filter.IsRecursive()) {
                                 while (result.list.ListSize() > 0u) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    ReferenceContainerNode *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    result.nameIndex.Remove(node);
                                     delete node;
                                 }
                             }
@@ -320,7 +369,8 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
                             else if (sizeBeforeBranching == result.list.ListSize()) {
                                 //Nothing found. Remove the stored path (which led to nowhere).
                                 if (filter.IsStorePath()) {
-                                    LinkedListable *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    ReferenceContainerNode *node = result.list.ListExtract(result.list.ListSize() - 1u);
+                                    result.nameIndex.Remove(node);
                                     delete node;
                                 }
                             }
@@ -353,19 +403,103 @@ void ReferenceContainer::Find(ReferenceContainer &result, ReferenceContainerFilt
 
 Reference ReferenceContainer::Find(const char8 * const path, const bool recursive) {
     Reference ret;
-    uint32 mode = ReferenceContainerFilterMode::SHALLOW;
-    if (recursive) {
-        mode = ReferenceContainerFilterMode::RECURSIVE;
+    bool resolved = false;
+    if (!recursive) {
+        resolved = FindPath(path, ret);
     }
-    ReferenceContainerFilterObjectName filter(1, mode, path);
-    ReferenceContainer resultSingle;
-    Find(resultSingle, filter);
-    if (resultSingle.Size() > 0u) {
-        ret = resultSingle.Get(resultSingle.Size() - 1u);
+    if (!resolved) {
+        uint32 mode = ReferenceContainerFilterMode::SHALLOW;
+        if (recursive) {
+            mode = ReferenceContainerFilterMode::RECURSIVE;
+        }
+        ReferenceContainerFilterObjectName filter(1, mode, path);
+        ReferenceContainer resultSingle;
+        Find(resultSingle, filter);
+        if (resultSingle.Size() > 0u) {
+            ret = resultSingle.Get(resultSingle.Size() - 1u);
+        }
     }
     return ret;
 }
 
+uint32 ReferenceContainer::FindChild(const char8 * const name, const uint32 nameLength, Reference &ref) {
+    uint32 matches = 0u;
+    if (Lock()) {
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        if (nameIndex.Find(name, nameLength, node)) {
+            ref = node->GetReference();
+            matches = 1u;
+        }
+        else {
+            //Not indexed, not found in the index (e.g. renamed) or repeated: walk the list
+            node = list.List();
+            while ((node != NULL) && (matches < 2u)) {
+                Reference const & nodeReference = node->GetReference();
+                const char8 *nodeName = NULL_PTR(const char8 *);
+                if (nodeReference.IsValid()) {
+                    nodeName = nodeReference->GetName();
+                }
+                if (nodeName != NULL) {
+                    if (StringHelper::CompareN(nodeName, name, nameLength) == 0) {
+                        if (nodeName[nameLength] == '\0') {
+                            if (matches == 0u) {
+                                ref = nodeReference;
+                            }
+                            matches++;
+                        }
+                    }
+                }
+                node = static_cast<ReferenceContainerNode *>(node->Next());
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainer: Failed FastLock()");
+    }
+    UnLock();
+    return matches;
+}
+
+bool ReferenceContainer::FindPath(const char8 * const path, Reference &ref) {
+    bool ok = (path != NULL);
+    const char8 *token = path;
+    if (ok) {
+        //The first dot is ignored
+        if (token[0] == '.') {
+            token = &token[1];
+        }
+        ok = (token[0] != '\0');
+    }
+    Reference found;
+    Reference container;
+    ReferenceContainer *currentContainer = this;
+    bool notFound = false;
+    while ((ok) && (!notFound) && (token[0] != '\0')) {
+        uint32 tokenLength = static_cast<uint32>(StringHelper::SearchIndex(token, "."));
+        //Consecutive dots or a path through an element which is not a container are left to the filter
+        ok = ((tokenLength > 0u) && (currentContainer != NULL));
+        if (ok) {
+            /*lint -e{613} currentContainer cannot be NULL as checked above*/
+            uint32 matches = currentContainer->FindChild(token, tokenLength, found);
+            ok = (matches < 2u);
+            notFound = (matches == 0u);
+        }
+        if ((ok) && (!notFound)) {
+            token = &token[tokenLength];
+            //The last dot is ignored
+            if (token[0] == '.') {
+                token = &token[1];
+            }
+            container = found;
+            currentContainer = dynamic_cast<ReferenceContainer *>(container.operator->());
+        }
+    }
+    if ((ok) && (!notFound)) {
+        ref = found;
+    }
+    return ok;
+}
+
 uint32 ReferenceContainer::Size() {
     uint32 size = 0u;
     if (Lock()) {
@@ -37,6 +37,7 @@
 #include "Object.h"
 #include "Reference.h"
 #include "ReferenceContainerFilter.h"
+#include "ReferenceContainerNameIndex.h"
 #include "ReferenceContainerNode.h"
 #include "TimeoutType.h"
 
@@ -50,11 +51,19 @@ namespace MARTe {
  * lint -esym(551, MARTe::REFERENCE_CONTAINER_NUMBER_OF_TOKENS) the symbol is used to define the size of the token arrays
  */
 const uint32 REFERENCE_CONTAINER_NUMBER_OF_TOKENS = 5u;
+
+/**
+ * Number of elements from which a ReferenceContainer indexes its elements by name.
+ */
+const uint32 REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD = 16u;
 /**
  * @brief Container of references.
  * @details One of the basilar classes of the framework. Linear container of references which may also
  * include other containers of references (generating a tree). The access to the container is protected
  * by an internal FastPollingMutexSem whose timeout can be specified.
+ *
+ * Once the container holds REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD elements, the elements are also indexed by name
+ * (see ReferenceContainerNameIndex), so that Find(path) resolves each level of the path without walking the list.
  */
 /*lint -e{9109} forward declaration in ReferenceContainerFilter.h is required to define the class*/
 /*lint -e{763} forward declaration in ReferenceContainerFilter.h is required to define the class*/
@@ -140,6 +149,8 @@ public:
 
     /**
      * @brief Finds the first element identified by \a path in RECURSIVE mode.
+     * @details When \a recursive is false, each level of the path is resolved by name (using the name index if
+     * available) and the filter based search is only used if a level has more than one element with the same name.
      * @param[in] path is the name of the element to be found or its full path.
      * @param[in] recursive is the flag for recursive search
      * @return the element if it is found or an invalid reference if not.
@@ -166,6 +177,28 @@ public:
      */
     Reference Get(const uint32 idx);
 
+    /**
+     * @brief Returns the generation of the container, i.e. a stamp of the last time that an element was inserted into or removed from it.
+     * @details The stamps are taken from a process-wide sequence which only increases (a new container also takes a new stamp). As a consequence,
+     * a change in any of a set of containers (including one being replaced by another) can be detected by comparing the maximum of their generations.
+     * This allows caching information which depends on the structure of the tree (e.g. an exported listing) at the cost of reading a few integers.
+     * @return the generation of the container.
+     */
+    uint32 GetGeneration() const;
+
+    /**
+     * @brief Notifies that the data exported by an Object (see Object::ExportData) has changed without any container being modified.
+     * @details Takes a new stamp from the same sequence as GetGeneration, which is returned by GetLastChangeNotification.
+     * Caches built on the generations shall also compare against this value.
+     */
+    static void NotifyChange();
+
+    /**
+     * @brief Returns the stamp of the last call to NotifyChange.
+     * @return the stamp of the last call to NotifyChange (zero if it was never called).
+     */
+    static uint32 GetLastChangeNotification();
+
     /**
      * @brief Returns the semaphore timeout time.
      * @return the semaphore timeout time.
@@ -286,6 +319,22 @@ private:
      */
     static char8 domainTokensList[REFERENCE_CONTAINER_NUMBER_OF_TOKENS];
 
+    /**
+     * @brief The last stamp given by NextGeneration.
+     */
+    static volatile uint32 generationSequence;
+
+    /**
+     * @brief The stamp of the last call to NotifyChange.
+     */
+    static volatile uint32 lastChangeNotification;
+
+    /**
+     * @brief Atomically takes a new stamp from the generationSequence.
+     * @return the new stamp.
+     */
+    static uint32 NextGeneration();
+
     /**
      * @brief Checks if the input token is one of the tokens in the input token list.
      * @param[in] tokenList the token list to verify.
@@ -309,11 +358,33 @@ private:
      */
     static void RemoveToken(char8 * const tokenList, char8 token);
 
+    /**
+     * @brief Looks for the elements of this container named \a name.
+     * @param[in] name the name to search. It does not need to be zero terminated.
+     * @param[in] nameLength the number of characters of \a name.
+     * @param[out] ref the first element with this name.
+     * @return the number of elements with this name (0, 1 or 2 if there is more than one).
+     */
+    uint32 FindChild(const char8 * const name, const uint32 nameLength, Reference &ref);
+
+    /**
+     * @brief Resolves \a path level by level with FindChild.
+     * @param[in] path the path to resolve.
+     * @param[out] ref the element that was found (invalid if it does not exist).
+     * @return false if the path could not be resolved this way (e.g. repeated names or malformed path)
+     * and the filter based search is to be used instead.
+     */
+    bool FindPath(const char8 * const path, Reference &ref);
+
     /**
      * The list of references
      */
     LinkedListHolderT<ReferenceContainerNode> list;
 
+    /**
+     * Index of the elements by name
+     */
+    ReferenceContainerNameIndex nameIndex;
     
     /**
      * Protects multiple access to the internal resources
@@ -325,6 +396,11 @@ private:
      */
     TimeoutType muxTimeout;
 
+    /**
+     * The stamp of the last modification (see GetGeneration)
+     */
+    volatile uint32 generation;
+
 };
 
 }
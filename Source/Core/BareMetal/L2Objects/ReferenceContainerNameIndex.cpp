@@ -0,0 +1,228 @@
+/**
+ * @file ReferenceContainerNameIndex.cpp
+ * @brief Source file for class ReferenceContainerNameIndex
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceContainerNameIndex (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "Fnv1aHashFunction.h"
+#include "HeapManager.h"
+#include "Object.h"
+#include "ReferenceContainerNameIndex.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Number of entries allocated by the first Add.
+ */
+const MARTe::uint32 initialTableSize = 16u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ReferenceContainerNameIndex::ReferenceContainerNameIndex() {
+    table = NULL_PTR(Entry *);
+    tableSize = 0u;
+    numberOfElements = 0u;
+    numberOfUsedEntries = 0u;
+}
+
+ReferenceContainerNameIndex::~ReferenceContainerNameIndex() {
+    Reset();
+}
+
+void ReferenceContainerNameIndex::Reset() {
+    if (table != NULL_PTR(Entry *)) {
+        /*lint -e{929} cast required to be able to use HeapManager::Free interface.*/
+        if (!HeapManager::Free(reinterpret_cast<void *&>(table))) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainerNameIndex: Failed HeapManager::Free()");
+        }
+    }
+    table = NULL_PTR(Entry *);
+    tableSize = 0u;
+    numberOfElements = 0u;
+    numberOfUsedEntries = 0u;
+}
+
+bool ReferenceContainerNameIndex::IsActive() const {
+    return (tableSize > 0u);
+}
+
+uint32 ReferenceContainerNameIndex::GetNumberOfElements() const {
+    return numberOfElements;
+}
+
+uint32 ReferenceContainerNameIndex::HashNode(const ReferenceContainerNode * const node) {
+    Fnv1aHashFunction hashFunction;
+    const char8 *name = "";
+    Reference const & ref = node->GetReference();
+    if (ref.IsValid()) {
+        if (ref->GetName() != NULL_PTR(const char8 *)) {
+            name = ref->GetName();
+        }
+    }
+    return hashFunction.Compute(name, StringHelper::Length(name));
+}
+
+bool ReferenceContainerNameIndex::Resize(const uint32 newSize) {
+    Entry *oldTable = table;
+    uint32 oldSize = tableSize;
+    table = static_cast<Entry *>(HeapManager::Malloc(static_cast<uint32>(sizeof(Entry)) * newSize));
+    bool ok = (table != NULL_PTR(Entry *));
+    if (ok) {
+        tableSize = newSize;
+        numberOfUsedEntries = 0u;
+        for (uint32 i = 0u; i < tableSize; i++) {
+            table[i].node = NULL_PTR(ReferenceContainerNode *);
+            table[i].hash = 0u;
+            table[i].removed = false;
+        }
+        for (uint32 i = 0u; i < oldSize; i++) {
+            if (oldTable[i].node != NULL_PTR(ReferenceContainerNode *)) {
+                Insert(oldTable[i].node, oldTable[i].hash);
+            }
+        }
+    }
+    if (oldTable != NULL_PTR(Entry *)) {
+        /*lint -e{929} cast required to be able to use HeapManager::Free interface.*/
+        if (!HeapManager::Free(reinterpret_cast<void *&>(oldTable))) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "ReferenceContainerNameIndex: Failed HeapManager::Free()");
+        }
+    }
+    if (!ok) {
+        tableSize = 0u;
+        numberOfElements = 0u;
+        numberOfUsedEntries = 0u;
+    }
+    return ok;
+}
+
+void ReferenceContainerNameIndex::Insert(ReferenceContainerNode * const node, const uint32 hash) {
+    const uint32 mask = tableSize - 1u;
+    uint32 i = hash & mask;
+    //Removed entries are not reused so that the probing sequences of the remaining entries are kept
+    while ((table[i].node != NULL_PTR(ReferenceContainerNode *)) || (table[i].removed)) {
+        i = (i + 1u) & mask;
+    }
+    table[i].node = node;
+    table[i].hash = hash;
+    numberOfUsedEntries++;
+}
+
+bool ReferenceContainerNameIndex::Add(ReferenceContainerNode * const node) {
+    bool ok = true;
+    if (tableSize == 0u) {
+        ok = Resize(initialTableSize);
+    }
+    //Keep the table at most half full (counting the removed entries)
+    else if (((numberOfUsedEntries + 1u) * 2u) > tableSize) {
+        uint32 newSize = tableSize;
+        if (((numberOfElements + 1u) * 2u) > (tableSize / 2u)) {
+            newSize *= 2u;
+        }
+        ok = Resize(newSize);
+    }
+    else {
+    }
+    if (ok) {
+        Insert(node, HashNode(node));
+        numberOfElements++;
+    }
+    else {
+        Reset();
+    }
+    return ok;
+}
+
+void ReferenceContainerNameIndex::Remove(const ReferenceContainerNode * const node) {
+    if (tableSize > 0u) {
+        const uint32 mask = tableSize - 1u;
+        uint32 i = HashNode(node) & mask;
+        bool found = false;
+        bool end = false;
+        for (uint32 n = 0u; (n < tableSize) && (!found) && (!end); n++) {
+            found = (table[i].node == node);
+            end = ((table[i].node == NULL_PTR(ReferenceContainerNode *)) && (!table[i].removed));
+            if (!found) {
+                i = (i + 1u) & mask;
+            }
+        }
+        //The object might have been renamed
+        for (uint32 n = 0u; (n < tableSize) && (!found); n++) {
+            found = (table[n].node == node);
+            if (found) {
+                i = n;
+            }
+        }
+        if (found) {
+            table[i].node = NULL_PTR(ReferenceContainerNode *);
+            table[i].removed = true;
+            numberOfElements--;
+        }
+    }
+}
+
+bool ReferenceContainerNameIndex::Find(const char8 * const name, const uint32 nameLength, ReferenceContainerNode *&node) const {
+    uint32 matches = 0u;
+    if (tableSize > 0u) {
+        Fnv1aHashFunction hashFunction;
+        uint32 hash = hashFunction.Compute(name, nameLength);
+        const uint32 mask = tableSize - 1u;
+        uint32 i = hash & mask;
+        bool end = false;
+        //The probing sequence ends on a free entry. Continue after the first match to detect duplicated names.
+        for (uint32 n = 0u; (n < tableSize) && (!end) && (matches < 2u); n++) {
+            ReferenceContainerNode *candidate = table[i].node;
+            end = ((candidate == NULL_PTR(ReferenceContainerNode *)) && (!table[i].removed));
+            if ((candidate != NULL_PTR(ReferenceContainerNode *)) && (table[i].hash == hash)) {
+                Reference const & ref = candidate->GetReference();
+                const char8 *candidateName = NULL_PTR(const char8 *);
+                if (ref.IsValid()) {
+                    candidateName = ref->GetName();
+                }
+                if (candidateName != NULL_PTR(const char8 *)) {
+                    if (StringHelper::CompareN(candidateName, name, nameLength) == 0) {
+                        if (candidateName[nameLength] == '\0') {
+                            node = candidate;
+                            matches++;
+                        }
+                    }
+                }
+            }
+            i = (i + 1u) & mask;
+        }
+    }
+    return (matches == 1u);
+}
+
+}
@@ -0,0 +1,186 @@
+/**
+ * @file ReferenceContainerNameIndex.h
+ * @brief Header file for class ReferenceContainerNameIndex
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReferenceContainerNameIndex
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REFERENCECONTAINERNAMEINDEX_H_
+#define REFERENCECONTAINERNAMEINDEX_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "GeneralDefinitions.h"
+#include "ReferenceContainerNode.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Open-addressing hash table that indexes the nodes of a ReferenceContainer by the name of the referenced objects.
+ * @details The nodes are hashed (FNV-1a) by the name that the object has when the node is added. The table uses linear
+ * probing, is kept at most half full and grows by doubling its size.
+ *
+ * The index does not own the nodes and is not thread-safe: the ReferenceContainer that holds it
+ * shall add and remove the nodes while holding its lock.
+ *
+ * Objects that are renamed after being added are only found by their previous name. Find only reports
+ * a node when exactly one indexed node has the requested name, so that the caller can fall back to a linear search
+ * in any other case.
+ */
+class DLL_API ReferenceContainerNameIndex {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   !IsActive() &&
+     *   GetNumberOfElements() == 0
+     */
+    ReferenceContainerNameIndex();
+
+    /**
+     * @brief Destructor. Frees the table (the nodes are not deleted).
+     */
+    ~ReferenceContainerNameIndex();
+
+    /**
+     * @brief Adds a node to the index.
+     * @details The first call allocates the table.
+     * @param[in] node the node to add.
+     * @return true if the node was added. On failure (no memory) the index is reset.
+     * @pre
+     *   node != NULL
+     */
+    bool Add(ReferenceContainerNode * const node);
+
+    /**
+     * @brief Removes a node from the index.
+     * @details If the node is not found by its name (e.g. because the object was renamed) the whole table is searched.
+     * @param[in] node the node to remove.
+     */
+    void Remove(const ReferenceContainerNode * const node);
+
+    /**
+     * @brief Looks for the node whose object is named \a name.
+     * @param[in] name the name to search. It does not need to be zero terminated.
+     * @param[in] nameLength the number of characters of \a name.
+     * @param[out] node the node that was found.
+     * @return true if exactly one indexed node has this name.
+     */
+    bool Find(const char8 * const name, const uint32 nameLength, ReferenceContainerNode *&node) const;
+
+    /**
+     * @brief Removes all the nodes and frees the table.
+     * @post
+     *   !IsActive()
+     */
+    void Reset();
+
+    /**
+     * @brief Checks if the table is allocated.
+     * @return true if the table is allocated.
+     */
+    bool IsActive() const;
+
+    /**
+     * @brief Gets the number of indexed nodes.
+     * @return the number of indexed nodes.
+     */
+    uint32 GetNumberOfElements() const;
+
+private:
+
+    /**
+     * @brief Rebuilds the table with \a newSize entries, dropping the removed entries.
+     * @param[in] newSize the new number of entries (power of two).
+     * @return true if the table could be allocated.
+     */
+    bool Resize(const uint32 newSize);
+
+    /**
+     * @brief Inserts a node in the table, which is known to have free entries.
+     * @param[in] node the node to insert.
+     * @param[in] hash the hash of the node name.
+     */
+    void Insert(ReferenceContainerNode * const node, const uint32 hash);
+
+    /**
+     * @brief Computes the hash of the name of the object referenced by \a node.
+     * @param[in] node the node.
+     * @return the hash of the object name (or of the empty string if the object has no name).
+     */
+    static uint32 HashNode(const ReferenceContainerNode * const node);
+
+    /**
+     * @brief An entry of the table.
+     */
+    struct Entry {
+        /**
+         * The indexed node (NULL if the entry is free).
+         */
+        ReferenceContainerNode *node;
+
+        /**
+         * The hash of the object name when the node was added.
+         */
+        uint32 hash;
+
+        /**
+         * true if the node was removed (so that probing continues past this entry).
+         */
+        bool removed;
+    };
+
+    /**
+     * The table.
+     */
+    Entry *table;
+
+    /**
+     * Number of entries in the table (zero or a power of two).
+     */
+    uint32 tableSize;
+
+    /**
+     * Number of indexed nodes.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Number of entries that are either used or removed.
+     */
+    uint32 numberOfUsedEntries;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REFERENCECONTAINERNAMEINDEX_H_ */
@@ -0,0 +1,407 @@
+/**
+ * @file DeflateEncoder.cpp
+ * @brief Source file for class DeflateEncoder
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DeflateEncoder (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "DeflateEncoder.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum distance of a repeated string.
+ */
+static const uint32 DEFLATE_ENCODER_WINDOW_SIZE = 32768u;
+
+/**
+ * Size of the DeflateEncoder::window.
+ */
+static const uint32 DEFLATE_ENCODER_BUFFER_SIZE = 2u * DEFLATE_ENCODER_WINDOW_SIZE;
+
+/**
+ * Number of bits of the hash of three bytes.
+ */
+static const uint32 DEFLATE_ENCODER_HASH_BITS = 15u;
+
+/**
+ * Size of the DeflateEncoder::hashHead.
+ */
+static const uint32 DEFLATE_ENCODER_HASH_SIZE = (1u << DEFLATE_ENCODER_HASH_BITS);
+
+/**
+ * Minimum length of a repeated string.
+ */
+static const uint32 DEFLATE_ENCODER_MIN_MATCH = 3u;
+
+/**
+ * Maximum length of a repeated string.
+ */
+static const uint32 DEFLATE_ENCODER_MAX_MATCH = 258u;
+
+/**
+ * Size of the DeflateEncoder::outputBuffer.
+ */
+static const uint32 DEFLATE_ENCODER_OUTPUT_BUFFER_SIZE = 4096u;
+
+/**
+ * The Adler-32 modulo.
+ */
+static const uint32 DEFLATE_ENCODER_ADLER_MOD = 65521u;
+
+/**
+ * Maximum number of bytes which can be added to the Adler-32 components before the modulo is needed (so that they do not overflow).
+ */
+static const uint32 DEFLATE_ENCODER_ADLER_NMAX = 5552u;
+
+/**
+ * Number of length codes.
+ */
+static const uint32 DEFLATE_ENCODER_NUMBER_OF_LENGTH_CODES = 29u;
+
+/**
+ * Number of distance codes.
+ */
+static const uint32 DEFLATE_ENCODER_NUMBER_OF_DISTANCE_CODES = 30u;
+
+/**
+ * Base length of the length codes 257 to 285 (RFC 1951, section 3.2.5).
+ */
+static const uint16 deflateLengthBase[DEFLATE_ENCODER_NUMBER_OF_LENGTH_CODES] = { 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 13u, 15u, 17u, 19u, 23u, 27u, 31u, 35u,
+        43u, 51u, 59u, 67u, 83u, 99u, 115u, 131u, 163u, 195u, 227u, 258u };
+
+/**
+ * Number of extra bits of the length codes 257 to 285.
+ */
+static const uint8 deflateLengthExtraBits[DEFLATE_ENCODER_NUMBER_OF_LENGTH_CODES] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u, 3u,
+        3u, 3u, 4u, 4u, 4u, 4u, 5u, 5u, 5u, 5u, 0u };
+
+/**
+ * Base distance of the distance codes 0 to 29 (RFC 1951, section 3.2.5).
+ */
+static const uint16 deflateDistanceBase[DEFLATE_ENCODER_NUMBER_OF_DISTANCE_CODES] = { 1u, 2u, 3u, 4u, 5u, 7u, 9u, 13u, 17u, 25u, 33u, 49u, 65u, 97u, 129u,
+        193u, 257u, 385u, 513u, 769u, 1025u, 1537u, 2049u, 3073u, 4097u, 6145u, 8193u, 12289u, 16385u, 24577u };
+
+/**
+ * Number of extra bits of the distance codes 0 to 29.
+ */
+static const uint8 deflateDistanceExtraBits[DEFLATE_ENCODER_NUMBER_OF_DISTANCE_CODES] = { 0u, 0u, 0u, 0u, 1u, 1u, 2u, 2u, 3u, 3u, 4u, 4u, 5u, 5u, 6u, 6u, 7u,
+        7u, 8u, 8u, 9u, 9u, 10u, 10u, 11u, 11u, 12u, 12u, 13u, 13u };
+
+/**
+ * @brief Reverses the order of the \a numberOfBits less significant bits of \a code.
+ * @details The Huffman codes are packed starting with the most significant bit while all the other values start with the less significant bit.
+ */
+static uint32 DeflateEncoderReverseBits(uint32 code,
+                                        const uint32 numberOfBits) {
+    uint32 reversed = 0u;
+    for (uint32 i = 0u; i < numberOfBits; i++) {
+        reversed = (reversed << 1u) | (code & 1u);
+        code >>= 1u;
+    }
+    return reversed;
+}
+
+/**
+ * @brief Computes the fixed Huffman code of a literal/length \a symbol (RFC 1951, section 3.2.6).
+ */
+static void DeflateEncoderFixedCode(const uint32 symbol,
+                                    uint32 &code,
+                                    uint32 &numberOfBits) {
+    if (symbol <= 143u) {
+        code = 0x30u + symbol;
+        numberOfBits = 8u;
+    }
+    else if (symbol <= 255u) {
+        code = 0x190u + (symbol - 144u);
+        numberOfBits = 9u;
+    }
+    else if (symbol <= 279u) {
+        code = symbol - 256u;
+        numberOfBits = 7u;
+    }
+    else {
+        code = 0xC0u + (symbol - 280u);
+        numberOfBits = 8u;
+    }
+    code = DeflateEncoderReverseBits(code, numberOfBits);
+}
+
+/**
+ * @brief Hash of the three bytes starting at \a data.
+ */
+static inline uint32 DeflateEncoderHash(const uint8 * const data) {
+    uint32 value = (static_cast<uint32>(data[0]) << 16u) | (static_cast<uint32>(data[1]) << 8u) | static_cast<uint32>(data[2]);
+    return ((value * 2654435761u) >> (32u - DEFLATE_ENCODER_HASH_BITS));
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+DeflateEncoder::DeflateEncoder(BufferedStreamI &outputStreamIn) {
+    outputStream = &outputStreamIn;
+    window = new uint8[DEFLATE_ENCODER_BUFFER_SIZE];
+    windowSize = 0u;
+    windowPosition = 0u;
+    hashHead = new uint32[DEFLATE_ENCODER_HASH_SIZE];
+    for (uint32 i = 0u; i < DEFLATE_ENCODER_HASH_SIZE; i++) {
+        hashHead[i] = 0u;
+    }
+    outputBuffer = new uint8[DEFLATE_ENCODER_OUTPUT_BUFFER_SIZE];
+    outputBufferSize = 0u;
+    bitBuffer = 0u;
+    bitCount = 0u;
+    adlerA = 1u;
+    adlerB = 0u;
+    inputSize = 0ull;
+    outputSize = 0ull;
+    started = false;
+    finished = false;
+}
+
+DeflateEncoder::~DeflateEncoder() {
+    delete[] window;
+    delete[] hashHead;
+    delete[] outputBuffer;
+    outputStream = NULL_PTR(BufferedStreamI *);
+}
+
+bool DeflateEncoder::Write(const char8 * const input,
+                           const uint32 size) {
+    bool ok = !finished;
+    if ((ok) && (!started)) {
+        ok = Start();
+    }
+    uint32 written = 0u;
+    while ((ok) && (written < size)) {
+        if (windowSize == DEFLATE_ENCODER_BUFFER_SIZE) {
+            ok = Slide();
+        }
+        if (ok) {
+            uint32 toCopy = (DEFLATE_ENCODER_BUFFER_SIZE - windowSize);
+            if (toCopy > (size - written)) {
+                toCopy = (size - written);
+            }
+            ok = MemoryOperationsHelper::Copy(&window[windowSize], &input[written], toCopy);
+            //Update the Adler-32 with the new data, applying the modulo as seldom as possible.
+            uint32 i = 0u;
+            while (i < toCopy) {
+                uint32 blockEnd = i + DEFLATE_ENCODER_ADLER_NMAX;
+                if (blockEnd > toCopy) {
+                    blockEnd = toCopy;
+                }
+                for (; i < blockEnd; i++) {
+                    adlerA += window[windowSize + i];
+                    adlerB += adlerA;
+                }
+                adlerA %= DEFLATE_ENCODER_ADLER_MOD;
+                adlerB %= DEFLATE_ENCODER_ADLER_MOD;
+            }
+            windowSize += toCopy;
+            written += toCopy;
+            inputSize += toCopy;
+        }
+    }
+    return ok;
+}
+
+bool DeflateEncoder::Finish() {
+    bool ok = !finished;
+    if ((ok) && (!started)) {
+        ok = Start();
+    }
+    if (ok) {
+        ok = Encode(windowSize);
+    }
+    //End of the block (symbol 256).
+    uint32 code;
+    uint32 numberOfBits;
+    DeflateEncoderFixedCode(256u, code, numberOfBits);
+    if (ok) {
+        ok = PutBits(code, numberOfBits);
+    }
+    //As the data is compressed as it arrives the first block cannot be marked as final. Finish with an empty final block (BFINAL = 1, BTYPE = 01).
+    if (ok) {
+        ok = PutBits(3u, 3u);
+    }
+    if (ok) {
+        ok = PutBits(code, numberOfBits);
+    }
+    if ((ok) && (bitCount > 0u)) {
+        ok = PutBits(0u, 8u - bitCount);
+    }
+    //The Adler-32 is written with the most significant byte first.
+    uint32 adler = ((adlerB << 16u) | adlerA);
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = PutBits((adler >> (24u - (8u * i))) & 0xFFu, 8u);
+    }
+    if (ok) {
+        ok = FlushOutput();
+    }
+    finished = true;
+    return ok;
+}
+
+uint64 DeflateEncoder::GetInputSize() const {
+    return inputSize;
+}
+
+uint64 DeflateEncoder::GetOutputSize() const {
+    return outputSize;
+}
+
+bool DeflateEncoder::Start() {
+    //zlib header: deflate with a 32 KB window and the fastest compression level (the check bits make it a multiple of 31).
+    bool ok = PutBits(0x78u, 8u);
+    if (ok) {
+        ok = PutBits(0x01u, 8u);
+    }
+    //Block header: BFINAL = 0, BTYPE = 01 (fixed Huffman codes).
+    if (ok) {
+        ok = PutBits(2u, 3u);
+    }
+    started = true;
+    return ok;
+}
+
+bool DeflateEncoder::Encode(const uint32 limit) {
+    bool ok = true;
+    while ((ok) && (windowPosition < limit)) {
+        uint32 available = (windowSize - windowPosition);
+        uint32 maxLength = (available < DEFLATE_ENCODER_MAX_MATCH) ? (available) : (DEFLATE_ENCODER_MAX_MATCH);
+        uint32 matchLength = 0u;
+        uint32 matchDistance = 0u;
+        if (maxLength >= DEFLATE_ENCODER_MIN_MATCH) {
+            uint32 hash = DeflateEncoderHash(&window[windowPosition]);
+            uint32 candidate = hashHead[hash];
+            hashHead[hash] = (windowPosition + 1u);
+            if (candidate > 0u) {
+                candidate--;
+                matchDistance = (windowPosition - candidate);
+                if (matchDistance <= DEFLATE_ENCODER_WINDOW_SIZE) {
+                    while ((matchLength < maxLength) && (window[candidate + matchLength] == window[windowPosition + matchLength])) {
+                        matchLength++;
+                    }
+                }
+            }
+        }
+        uint32 code;
+        uint32 numberOfBits;
+        if (matchLength >= DEFLATE_ENCODER_MIN_MATCH) {
+            uint32 lengthCode = (DEFLATE_ENCODER_NUMBER_OF_LENGTH_CODES - 1u);
+            while (deflateLengthBase[lengthCode] > matchLength) {
+                lengthCode--;
+            }
+            DeflateEncoderFixedCode(257u + lengthCode, code, numberOfBits);
+            ok = PutBits(code, numberOfBits);
+            if (ok) {
+                ok = PutBits(matchLength - deflateLengthBase[lengthCode], deflateLengthExtraBits[lengthCode]);
+            }
+            uint32 distanceCode = (DEFLATE_ENCODER_NUMBER_OF_DISTANCE_CODES - 1u);
+            while (deflateDistanceBase[distanceCode] > matchDistance) {
+                distanceCode--;
+            }
+            if (ok) {
+                ok = PutBits(DeflateEncoderReverseBits(distanceCode, 5u), 5u);
+            }
+            if (ok) {
+                ok = PutBits(matchDistance - deflateDistanceBase[distanceCode], deflateDistanceExtraBits[distanceCode]);
+            }
+            //Index the strings starting inside the match so that they can be found later.
+            for (uint32 i = 1u; i < matchLength; i++) {
+                uint32 position = (windowPosition + i);
+                if ((position + DEFLATE_ENCODER_MIN_MATCH) <= windowSize) {
+                    hashHead[DeflateEncoderHash(&window[position])] = (position + 1u);
+                }
+            }
+            windowPosition += matchLength;
+        }
+        else {
+            DeflateEncoderFixedCode(static_cast<uint32>(window[windowPosition]), code, numberOfBits);
+            ok = PutBits(code, numberOfBits);
+            windowPosition++;
+        }
+    }
+    return ok;
+}
+
+bool DeflateEncoder::Slide() {
+    //Keep enough data ahead to find the longest matches.
+    bool ok = Encode(windowSize - DEFLATE_ENCODER_MAX_MATCH);
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&window[0], &window[DEFLATE_ENCODER_WINDOW_SIZE], windowSize - DEFLATE_ENCODER_WINDOW_SIZE);
+    }
+    if (ok) {
+        windowSize -= DEFLATE_ENCODER_WINDOW_SIZE;
+        windowPosition -= DEFLATE_ENCODER_WINDOW_SIZE;
+        for (uint32 i = 0u; i < DEFLATE_ENCODER_HASH_SIZE; i++) {
+            hashHead[i] = (hashHead[i] > DEFLATE_ENCODER_WINDOW_SIZE) ? (hashHead[i] - DEFLATE_ENCODER_WINDOW_SIZE) : (0u);
+        }
+    }
+    return ok;
+}
+
+bool DeflateEncoder::PutBits(const uint32 value,
+                             const uint32 numberOfBits) {
+    bool ok = true;
+    bitBuffer |= (value << bitCount);
+    bitCount += numberOfBits;
+    while ((ok) && (bitCount >= 8u)) {
+        outputBuffer[outputBufferSize] = static_cast<uint8>(bitBuffer & 0xFFu);
+        outputBufferSize++;
+        bitBuffer >>= 8u;
+        bitCount -= 8u;
+        if (outputBufferSize == DEFLATE_ENCODER_OUTPUT_BUFFER_SIZE) {
+            ok = FlushOutput();
+        }
+    }
+    return ok;
+}
+
+bool DeflateEncoder::FlushOutput() {
+    bool ok = true;
+    if (outputBufferSize > 0u) {
+        uint32 size = outputBufferSize;
+        ok = outputStream->Write(reinterpret_cast<char8 *>(outputBuffer), size);
+        if (ok) {
+            ok = (size == outputBufferSize);
+        }
+        outputSize += size;
+        outputBufferSize = 0u;
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,219 @@
+/**
+ * @file DeflateEncoder.h
+ * @brief Header file for class DeflateEncoder
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DeflateEncoder
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DEFLATEENCODER_H_
+#define DEFLATEENCODER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BufferedStreamI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Compresses a stream of bytes in the zlib format (RFC 1950) using the deflate algorithm (RFC 1951).
+ * @details The data is compressed as it is written, keeping only the last 32 KB of input (the deflate window) in memory, and the
+ * compressed bytes are written into the output stream given in the constructor. This allows to compress data which is larger than the available memory
+ * (e.g. while it is being sent to an HTTP client with Content-Encoding: deflate).
+ *
+ * The encoder favours speed over compression ratio: the repeated strings are searched with a single hash lookup (greedy matching) and
+ * are encoded with the fixed Huffman codes of the deflate specification. The output can be decoded by any zlib compliant decoder.
+ *
+ * Once all the data has been written, Finish shall be called to write the end of the compressed data and the zlib checksum (Adler-32).
+ */
+class DLL_API DeflateEncoder {
+public:
+
+    /**
+     * @brief Constructor. Allocates the compression window.
+     * @param[in] outputStreamIn the stream where the compressed data is written.
+     * @post
+     *   GetInputSize() == 0 &&
+     *   GetOutputSize() == 0
+     */
+    DeflateEncoder(BufferedStreamI &outputStreamIn);
+
+    /**
+     * @brief Destructor. Frees the compression window.
+     * @details Finish is not called. Data which was not yet compressed is lost.
+     */
+    ~DeflateEncoder();
+
+    /**
+     * @brief Compresses \a size bytes from \a input.
+     * @details Part of the data may be kept in the window until more data is written or Finish is called.
+     * @param[in] input the data to be compressed.
+     * @param[in] size the number of bytes to be compressed.
+     * @return true if the compressed data was successfully written into the output stream and Finish was not yet called.
+     */
+    bool Write(const char8 * const input,
+               const uint32 size);
+
+    /**
+     * @brief Compresses all the pending data and writes the end of the compressed data and the zlib checksum.
+     * @details The output stream is not flushed.
+     * @return true if the data was successfully written into the output stream and Finish was not yet called.
+     */
+    bool Finish();
+
+    /**
+     * @brief Gets the number of bytes written with Write.
+     * @return the number of bytes written with Write.
+     */
+    uint64 GetInputSize() const;
+
+    /**
+     * @brief Gets the number of compressed bytes written into the output stream.
+     * @return the number of compressed bytes written into the output stream.
+     */
+    uint64 GetOutputSize() const;
+
+private:
+
+    /**
+     * @brief Encodes the data in the window from the current position until \a limit.
+     * @param[in] limit encoding stops at the first position which is not lower than \a limit.
+     * @return true if the encoded data was successfully written.
+     */
+    bool Encode(const uint32 limit);
+
+    /**
+     * @brief Moves the last part of the window to its beginning so that more data can be written.
+     * @details The data which is still ahead of the current position is encoded first (except for the bytes which are needed to look for matches).
+     * @return true if the encoded data was successfully written.
+     */
+    bool Slide();
+
+    /**
+     * @brief Writes the \a numberOfBits less significant bits of \a value (the first bit is the less significant one).
+     * @param[in] value the bits to write.
+     * @param[in] numberOfBits the number of bits to write (<= 16).
+     * @return true if the output buffer was successfully written into the output stream (when full).
+     */
+    bool PutBits(const uint32 value,
+                 const uint32 numberOfBits);
+
+    /**
+     * @brief Writes the encoded bytes that are in the output buffer into the output stream.
+     * @return true if the bytes were successfully written.
+     */
+    bool FlushOutput();
+
+    /**
+     * @brief Writes the zlib header and the header of the (non final) compressed block.
+     * @return true if the bytes were successfully written.
+     */
+    bool Start();
+
+    /**
+     * Where the compressed data is written.
+     */
+    BufferedStreamI *outputStream;
+
+    /**
+     * The data being compressed. Holds the last 32 KB which were encoded (to look for repeated strings) and the data which was not yet encoded.
+     */
+    uint8 *window;
+
+    /**
+     * Number of bytes in the window.
+     */
+    uint32 windowSize;
+
+    /**
+     * Position in the window of the next byte to be encoded.
+     */
+    uint32 windowPosition;
+
+    /**
+     * For each hash of three bytes, the last position in the window (+ 1) where these bytes were found (0 if never).
+     */
+    uint32 *hashHead;
+
+    /**
+     * The encoded bytes waiting to be written into the output stream.
+     */
+    uint8 *outputBuffer;
+
+    /**
+     * Number of bytes in outputBuffer.
+     */
+    uint32 outputBufferSize;
+
+    /**
+     * The bits which are waiting to complete a byte.
+     */
+    uint32 bitBuffer;
+
+    /**
+     * Number of bits in bitBuffer.
+     */
+    uint32 bitCount;
+
+    /**
+     * The Adler-32 checksum components.
+     */
+    uint32 adlerA;
+
+    /**
+     * The Adler-32 checksum components.
+     */
+    uint32 adlerB;
+
+    /**
+     * Number of bytes written with Write.
+     */
+    uint64 inputSize;
+
+    /**
+     * Number of compressed bytes written into the output stream.
+     */
+    uint64 outputSize;
+
+    /**
+     * True if the zlib and block headers were written.
+     */
+    bool started;
+
+    /**
+     * True after Finish.
+     */
+    bool finished;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DEFLATEENCODER_H_ */
@@ -0,0 +1,692 @@
+/**
+ * @file ArenaConfigurationDatabase.cpp
+ * @brief Source file for class ArenaConfigurationDatabase
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaConfigurationDatabase (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ArenaConfigurationDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Initial size of the index.
+ */
+static const uint32 ARENA_CDB_INITIAL_INDEX_SIZE = 64u;
+
+/**
+ * Initial size of the children arrays.
+ */
+static const uint32 ARENA_CDB_INITIAL_NUMBER_OF_CHILDREN = 4u;
+
+/**
+ * @brief Computes the hash (FNV-1a) of a name, seeded with the address of the parent node.
+ */
+static uint32 ArenaConfigurationDatabaseHash(const void * const parentEntry,
+                                             const char8 * const name,
+                                             const uint32 nameLength) {
+    /*lint -e{9091} -e{923} the casting from pointer type to integer type is required to seed the hash with the parent address*/
+    uintp parentAddress = reinterpret_cast<uintp>(parentEntry);
+    uint32 hash = 2166136261u;
+    hash ^= static_cast<uint32>(parentAddress);
+    hash *= 16777619u;
+    for (uint32 i = 0u; i < nameLength; i++) {
+        hash ^= static_cast<uint32>(static_cast<uint8>(name[i]));
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Copies a string into the \a heap.
+ */
+static char8 *ArenaConfigurationDatabaseDuplicate(ArenaHeap &heap,
+                                                  const char8 * const str) {
+    const char8 *toCopy = (str != NULL_PTR(const char8 *)) ? (str) : ("");
+    return static_cast<char8 *>(heap.Duplicate(toCopy, StringHelper::Length(toCopy) + 1u));
+}
+
+/**
+ * @brief Gets the string of an element of a value which is either an array of StreamString or an array of C strings.
+ */
+static const char8 *ArenaConfigurationDatabaseGetString(void * const sourcePointer,
+                                                        const uint32 idx,
+                                                        const bool isString) {
+    const char8 *token = NULL_PTR(const char8 *);
+    if (isString) {
+        token = (static_cast<StreamString *>(sourcePointer)[idx]).Buffer();
+    }
+    else {
+        token = static_cast<const char8 **>(sourcePointer)[idx];
+    }
+    return token;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+ArenaConfigurationDatabase::ArenaConfigurationDatabase(const uint32 chunkSize) :
+        StructuredDataI(),
+        heap("ArenaConfigurationDatabase", chunkSize) {
+    root = NULL_PTR(Entry *);
+    current = NULL_PTR(Entry *);
+    index = NULL_PTR(Entry **);
+    indexSize = 0u;
+    numberOfIndexedEntries = 0u;
+    if (!CreateRoot()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to create the root node");
+    }
+}
+
+/*lint -e{1551} the destructor must release all the memory.*/
+ArenaConfigurationDatabase::~ArenaConfigurationDatabase() {
+    root = NULL_PTR(Entry *);
+    current = NULL_PTR(Entry *);
+    index = NULL_PTR(Entry **);
+    heap.Release();
+}
+
+bool ArenaConfigurationDatabase::CreateRoot() {
+    root = static_cast<Entry *>(heap.Malloc(static_cast<uint32>(sizeof(Entry))));
+    bool ok = (root != NULL_PTR(Entry *));
+    if (ok) {
+        root->name = NULL_PTR(const char8 *);
+        root->nameLength = 0u;
+        root->hash = 0u;
+        root->parent = NULL_PTR(Entry *);
+        root->children = NULL_PTR(Entry **);
+        root->numberOfChildren = 0u;
+        root->maxNumberOfChildren = 0u;
+        root->isLeaf = false;
+        root->dataPointer = NULL_PTR(void *);
+        root->typeDescriptor = VoidType;
+        root->bitAddress = 0u;
+        root->numberOfDimensions = 0u;
+        root->numberOfElements[0] = 0u;
+        root->numberOfElements[1] = 0u;
+        root->numberOfElements[2] = 0u;
+        root->staticDeclared = false;
+        indexSize = ARENA_CDB_INITIAL_INDEX_SIZE;
+        index = static_cast<Entry **>(heap.Malloc(static_cast<uint32>(sizeof(Entry *)) * indexSize));
+        ok = (index != NULL_PTR(Entry **));
+    }
+    if (ok) {
+        for (uint32 i = 0u; i < indexSize; i++) {
+            index[i] = NULL_PTR(Entry *);
+        }
+        numberOfIndexedEntries = 0u;
+    }
+    current = root;
+    return ok;
+}
+
+void ArenaConfigurationDatabase::Purge() {
+    heap.Release();
+    if (!CreateRoot()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to create the root node");
+    }
+}
+
+ArenaConfigurationDatabase::Entry *ArenaConfigurationDatabase::FindChild(const Entry * const parentEntry,
+                                                                         const char8 * const name,
+                                                                         const uint32 nameLength) const {
+    Entry *found = NULL_PTR(Entry *);
+    if (index != NULL_PTR(Entry **)) {
+        uint32 hash = ArenaConfigurationDatabaseHash(parentEntry, name, nameLength);
+        uint32 mask = indexSize - 1u;
+        uint32 i = hash & mask;
+        while ((index[i] != NULL_PTR(Entry *)) && (found == NULL_PTR(Entry *))) {
+            Entry *candidate = index[i];
+            if ((candidate->hash == hash) && (candidate->parent == parentEntry) && (candidate->nameLength == nameLength)) {
+                if (StringHelper::CompareN(candidate->name, name, nameLength) == 0) {
+                    found = candidate;
+                }
+            }
+            i = (i + 1u) & mask;
+        }
+    }
+    return found;
+}
+
+bool ArenaConfigurationDatabase::InsertInIndex(Entry * const entry) {
+    bool ok = true;
+    //Keep the load factor below 1/2
+    if (((numberOfIndexedEntries + 1u) * 2u) > indexSize) {
+        uint32 newIndexSize = indexSize * 2u;
+        Entry **newIndex = static_cast<Entry **>(heap.Malloc(static_cast<uint32>(sizeof(Entry *)) * newIndexSize));
+        ok = (newIndex != NULL_PTR(Entry **));
+        if (ok) {
+            uint32 newMask = newIndexSize - 1u;
+            for (uint32 i = 0u; i < newIndexSize; i++) {
+                newIndex[i] = NULL_PTR(Entry *);
+            }
+            for (uint32 i = 0u; i < indexSize; i++) {
+                if (index[i] != NULL_PTR(Entry *)) {
+                    uint32 j = index[i]->hash & newMask;
+                    while (newIndex[j] != NULL_PTR(Entry *)) {
+                        j = (j + 1u) & newMask;
+                    }
+                    newIndex[j] = index[i];
+                }
+            }
+            //The old index is only recovered by Purge.
+            index = newIndex;
+            indexSize = newIndexSize;
+        }
+    }
+    if (ok) {
+        uint32 mask = indexSize - 1u;
+        uint32 i = entry->hash & mask;
+        while (index[i] != NULL_PTR(Entry *)) {
+            i = (i + 1u) & mask;
+        }
+        index[i] = entry;
+        numberOfIndexedEntries++;
+    }
+    return ok;
+}
+
+void ArenaConfigurationDatabase::RemoveFromIndex(Entry * const entry) {
+    for (uint32 c = 0u; c < entry->numberOfChildren; c++) {
+        RemoveFromIndex(entry->children[c]);
+    }
+    uint32 mask = indexSize - 1u;
+    uint32 i = entry->hash & mask;
+    bool found = false;
+    while ((index[i] != NULL_PTR(Entry *)) && (!found)) {
+        found = (index[i] == entry);
+        if (!found) {
+            i = (i + 1u) & mask;
+        }
+    }
+    if (found) {
+        //Backward shift deletion, so that no tombstones are needed
+        index[i] = NULL_PTR(Entry *);
+        numberOfIndexedEntries--;
+        uint32 j = (i + 1u) & mask;
+        while (index[j] != NULL_PTR(Entry *)) {
+            uint32 k = index[j]->hash & mask;
+            bool move = false;
+            if (j > i) {
+                move = ((k <= i) || (k > j));
+            }
+            else {
+                move = ((k <= i) && (k > j));
+            }
+            if (move) {
+                index[i] = index[j];
+                index[j] = NULL_PTR(Entry *);
+                i = j;
+            }
+            j = (j + 1u) & mask;
+        }
+    }
+}
+
+ArenaConfigurationDatabase::Entry *ArenaConfigurationDatabase::AddChild(Entry * const parentEntry,
+                                                                        const char8 * const name,
+                                                                        const uint32 nameLength) {
+    Entry *child = static_cast<Entry *>(heap.Malloc(static_cast<uint32>(sizeof(Entry))));
+    char8 *childName = static_cast<char8 *>(heap.Malloc(nameLength + 1u));
+    bool ok = ((child != NULL_PTR(Entry *)) && (childName != NULL_PTR(char8 *)));
+    if (ok) {
+        (void) MemoryOperationsHelper::Copy(childName, name, nameLength);
+        childName[nameLength] = '\0';
+        child->name = childName;
+        child->nameLength = nameLength;
+        child->hash = ArenaConfigurationDatabaseHash(parentEntry, name, nameLength);
+        child->parent = parentEntry;
+        child->children = NULL_PTR(Entry **);
+        child->numberOfChildren = 0u;
+        child->maxNumberOfChildren = 0u;
+        child->isLeaf = false;
+        child->dataPointer = NULL_PTR(void *);
+        child->typeDescriptor = VoidType;
+        child->bitAddress = 0u;
+        child->numberOfDimensions = 0u;
+        child->numberOfElements[0] = 0u;
+        child->numberOfElements[1] = 0u;
+        child->numberOfElements[2] = 0u;
+        child->staticDeclared = false;
+        if (parentEntry->numberOfChildren == parentEntry->maxNumberOfChildren) {
+            uint32 newMaxNumberOfChildren = ARENA_CDB_INITIAL_NUMBER_OF_CHILDREN;
+            if (parentEntry->maxNumberOfChildren > 0u) {
+                newMaxNumberOfChildren = parentEntry->maxNumberOfChildren * 2u;
+            }
+            void *children = parentEntry->children;
+            children = heap.Realloc(children, static_cast<uint32>(sizeof(Entry *)) * newMaxNumberOfChildren);
+            ok = (children != NULL_PTR(void *));
+            if (ok) {
+                parentEntry->children = static_cast<Entry **>(children);
+                parentEntry->maxNumberOfChildren = newMaxNumberOfChildren;
+            }
+        }
+    }
+    if (ok) {
+        ok = InsertInIndex(child);
+    }
+    if (ok) {
+        parentEntry->children[parentEntry->numberOfChildren] = child;
+        parentEntry->numberOfChildren++;
+    }
+    return (ok) ? (child) : (NULL_PTR(Entry *));
+}
+
+bool ArenaConfigurationDatabase::MoveToPath(Entry * const start,
+                                            const char8 * const path,
+                                            const bool create) {
+    bool ok = ((path != NULL_PTR(const char8 *)) && (start != NULL_PTR(Entry *)));
+    if (ok) {
+        ok = (path[0] != '\0');
+    }
+    Entry *entry = start;
+    bool created = false;
+    uint32 begin = 0u;
+    bool last = false;
+    while ((ok) && (!last)) {
+        uint32 end = begin;
+        while ((path[end] != '\0') && (path[end] != '.')) {
+            end++;
+        }
+        last = (path[end] == '\0');
+        uint32 nameLength = end - begin;
+        ok = (nameLength > 0u);
+        if (ok) {
+            Entry *child = FindChild(entry, &path[begin], nameLength);
+            if (child != NULL_PTR(Entry *)) {
+                //As in the ConfigurationDatabase, the last node in the path is always created
+                ok = ((!child->isLeaf) && ((!create) || (!last)));
+                entry = child;
+            }
+            else {
+                ok = create;
+                if (ok) {
+                    entry = AddChild(entry, &path[begin], nameLength);
+                    ok = (entry != NULL_PTR(Entry *));
+                    created = true;
+                }
+            }
+        }
+        begin = end + 1u;
+    }
+    if (ok) {
+        ok = ((!create) || (created));
+    }
+    if (ok) {
+        current = entry;
+    }
+    return ok;
+}
+
+AnyType ArenaConfigurationDatabase::GetValue(const Entry * const leaf) {
+    AnyType value(leaf->typeDescriptor, leaf->bitAddress, leaf->dataPointer);
+    value.SetNumberOfDimensions(leaf->numberOfDimensions);
+    value.SetNumberOfElements(0u, leaf->numberOfElements[0]);
+    value.SetNumberOfElements(1u, leaf->numberOfElements[1]);
+    value.SetNumberOfElements(2u, leaf->numberOfElements[2]);
+    value.SetStaticDeclared(leaf->staticDeclared);
+    return value;
+}
+
+/*lint -e{9025} [MISRA C++ Rule 5-0-19]. Justification: Three pointer indirection levels required for matrices of char *. */
+bool ArenaConfigurationDatabase::SetValue(Entry * const leaf,
+                                          const AnyType &value) {
+    TypeDescriptor sourceDescriptor = value.GetTypeDescriptor();
+    void *sourcePointer = value.GetDataPointer();
+    uint8 nOfDimensions = value.GetNumberOfDimensions();
+    uint32 numberOfColumns = value.GetNumberOfElements(0u);
+    uint32 numberOfRows = value.GetNumberOfElements(1u);
+    uint32 numberOfPages = value.GetNumberOfElements(2u);
+    bool isString = (sourceDescriptor.type == SString);
+    bool isCCString = (sourceDescriptor.type == BT_CCString);
+    bool isCArrayOnHeap = ((sourceDescriptor.type == CArray) && (!value.IsStaticDeclared()));
+    bool isPointer = (sourceDescriptor.type == Pointer);
+    bool isStaticDeclared = value.IsStaticDeclared();
+    uint32 elementSize = value.GetByteSize();
+    void *destPointer = NULL_PTR(void *);
+
+    bool ok = (sourcePointer != NULL_PTR(void *));
+    if (ok) {
+        if (nOfDimensions == 0u) {
+            if ((isString) || (isCCString) || (isCArrayOnHeap)) {
+                const char8 *token = (isString) ? (static_cast<StreamString *>(sourcePointer)->Buffer()) : (static_cast<const char8 *>(sourcePointer));
+                destPointer = ArenaConfigurationDatabaseDuplicate(heap, token);
+            }
+            else if (isPointer) {
+                destPointer = sourcePointer;
+            }
+            else {
+                destPointer = heap.Duplicate(sourcePointer, elementSize);
+            }
+            ok = (destPointer != NULL_PTR(void *));
+        }
+        else if (nOfDimensions == 1u) {
+            if ((isString) || (isCCString) || (isCArrayOnHeap)) {
+                char8 **destBegin = static_cast<char8 **>(heap.Malloc(static_cast<uint32>(sizeof(char8 *)) * numberOfColumns));
+                ok = (destBegin != NULL_PTR(char8 **));
+                for (uint32 i = 0u; (i < numberOfColumns) && (ok); i++) {
+                    if (isCArrayOnHeap) {
+                        destBegin[i] = static_cast<char8 *>(heap.Duplicate(static_cast<const char8 * const *>(sourcePointer)[i], elementSize * numberOfColumns));
+                    }
+                    else {
+                        destBegin[i] = ArenaConfigurationDatabaseDuplicate(heap, ArenaConfigurationDatabaseGetString(sourcePointer, i, isString));
+                    }
+                    ok = (destBegin[i] != NULL_PTR(char8 *));
+                }
+                destPointer = destBegin;
+            }
+            else {
+                destPointer = heap.Duplicate(sourcePointer, elementSize * numberOfColumns);
+                ok = (destPointer != NULL_PTR(void *));
+            }
+        }
+        else if ((nOfDimensions == 2u) && (isStaticDeclared)) {
+            uint32 numberOfElements = numberOfRows * numberOfColumns;
+            if ((isString) || (isCCString)) {
+                char8 **destBegin = static_cast<char8 **>(heap.Malloc(static_cast<uint32>(sizeof(char8 *)) * numberOfElements));
+                ok = (destBegin != NULL_PTR(char8 **));
+                for (uint32 i = 0u; (i < numberOfElements) && (ok); i++) {
+                    destBegin[i] = ArenaConfigurationDatabaseDuplicate(heap, ArenaConfigurationDatabaseGetString(sourcePointer, i, isString));
+                    ok = (destBegin[i] != NULL_PTR(char8 *));
+                }
+                destPointer = destBegin;
+            }
+            else {
+                destPointer = heap.Duplicate(sourcePointer, elementSize * numberOfElements);
+                ok = (destPointer != NULL_PTR(void *));
+            }
+        }
+        else if (nOfDimensions == 2u) {
+            void **sourceRows = static_cast<void **>(sourcePointer);
+            void **destRows = static_cast<void **>(heap.Malloc(static_cast<uint32>(sizeof(void *)) * numberOfRows));
+            ok = (destRows != NULL_PTR(void **));
+            for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+                if ((isString) || (isCCString)) {
+                    char8 **destBegin = static_cast<char8 **>(heap.Malloc(static_cast<uint32>(sizeof(char8 *)) * numberOfColumns));
+                    ok = (destBegin != NULL_PTR(char8 **));
+                    for (uint32 c = 0u; (c < numberOfColumns) && (ok); c++) {
+                        destBegin[c] = ArenaConfigurationDatabaseDuplicate(heap, ArenaConfigurationDatabaseGetString(sourceRows[r], c, isString));
+                        ok = (destBegin[c] != NULL_PTR(char8 *));
+                    }
+                    destRows[r] = destBegin;
+                }
+                else {
+                    destRows[r] = heap.Duplicate(sourceRows[r], elementSize * numberOfColumns);
+                    ok = (destRows[r] != NULL_PTR(void *));
+                }
+            }
+            destPointer = destRows;
+        }
+        else if ((nOfDimensions == 3u) && (isStaticDeclared) && (!isString) && (!isCCString)) {
+            destPointer = heap.Duplicate(sourcePointer, elementSize * numberOfRows * numberOfColumns * numberOfPages);
+            ok = (destPointer != NULL_PTR(void *));
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "Serialisation of AnyType with these dimensions is not supported");
+            ok = false;
+        }
+    }
+    if (ok) {
+        leaf->isLeaf = true;
+        leaf->dataPointer = destPointer;
+        leaf->bitAddress = value.GetBitAddress();
+        leaf->numberOfDimensions = nOfDimensions;
+        leaf->numberOfElements[0] = numberOfColumns;
+        leaf->numberOfElements[1] = numberOfRows;
+        leaf->numberOfElements[2] = numberOfPages;
+        leaf->staticDeclared = isStaticDeclared;
+        //Strings are stored as C strings (see AnyObject::Serialise)
+        leaf->typeDescriptor = (isString) ? (AnyType(static_cast<char8 *>(NULL)).GetTypeDescriptor()) : (sourceDescriptor);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::Read(const char8 * const name,
+                                      const AnyType &value) {
+    bool ok = false;
+    bool isRegisteredObject = (value.GetTypeDescriptor().isStructuredData);
+    bool isStructuredDataI = (value.GetTypeDescriptor() == StructuredDataInterfaceType);
+    if ((isRegisteredObject) || (isStructuredDataI)) {
+        Entry *storeCurrent = current;
+        if (MoveRelative(name)) {
+            ok = TypeConvert(value, (*this).operator MARTe::AnyType());
+        }
+        current = storeCurrent;
+    }
+    else if (name != NULL_PTR(const char8 *)) {
+        Entry *leaf = FindChild(current, name, StringHelper::Length(name));
+        ok = (leaf != NULL_PTR(Entry *));
+        if (ok) {
+            ok = leaf->isLeaf;
+        }
+        if (ok) {
+            ok = TypeConvert(value, GetValue(leaf));
+        }
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+AnyType ArenaConfigurationDatabase::GetType(const char8 * const name) {
+    AnyType retType;
+    if (name != NULL_PTR(const char8 *)) {
+        Entry *leaf = FindChild(current, name, StringHelper::Length(name));
+        if (leaf != NULL_PTR(Entry *)) {
+            if (leaf->isLeaf) {
+                retType = GetValue(leaf);
+            }
+        }
+    }
+    return retType;
+}
+
+bool ArenaConfigurationDatabase::Write(const char8 * const name,
+                                       const AnyType &value) {
+    bool ok = false;
+    bool isRegisteredObject = (value.GetTypeDescriptor().isStructuredData);
+    bool isStructuredDataI = (value.GetTypeDescriptor() == StructuredDataInterfaceType);
+    if ((isRegisteredObject) || (isStructuredDataI)) {
+        Entry *storeCurrent = current;
+        if (CreateRelative(name)) {
+            ok = TypeConvert((*this).operator MARTe::AnyType(), value);
+        }
+        current = storeCurrent;
+    }
+    else {
+        uint32 nameLength = (name != NULL_PTR(const char8 *)) ? (StringHelper::Length(name)) : (0u);
+        ok = (nameLength > 0u);
+        Entry *leaf = NULL_PTR(Entry *);
+        if (ok) {
+            leaf = FindChild(current, name, nameLength);
+            if (leaf != NULL_PTR(Entry *)) {
+                //Overwrite, keeping the position. The previous value (and any children) is only recovered by Purge.
+                for (uint32 c = 0u; c < leaf->numberOfChildren; c++) {
+                    RemoveFromIndex(leaf->children[c]);
+                }
+                leaf->numberOfChildren = 0u;
+            }
+            else {
+                leaf = AddChild(current, name, nameLength);
+                ok = (leaf != NULL_PTR(Entry *));
+            }
+        }
+        if (ok) {
+            ok = SetValue(leaf, value);
+        }
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::Copy(StructuredDataI &destination) {
+    bool ok = true;
+    Entry *node = current;
+    for (uint32 i = 0u; (i < node->numberOfChildren) && (ok); i++) {
+        Entry *child = node->children[i];
+        if (child->isLeaf) {
+            ok = destination.Write(child->name, GetValue(child));
+        }
+        else {
+            ok = destination.CreateRelative(child->name);
+            if (ok) {
+                current = child;
+                // go recursively !
+                ok = Copy(destination);
+                current = node;
+            }
+            if ((!destination.MoveToAncestor(1u)) && ok) {
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} the node is not used as this feature is not supported*/
+bool ArenaConfigurationDatabase::AddToCurrentNode(Reference node) {
+    REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "AddToCurrentNode is not supported by the ArenaConfigurationDatabase");
+    return false;
+}
+
+bool ArenaConfigurationDatabase::MoveToRoot() {
+    bool ok = (root != NULL_PTR(Entry *));
+    if (ok) {
+        current = root;
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveToAncestor(const uint32 generations) {
+    bool ok = ((generations != 0u) && (current != NULL_PTR(Entry *)));
+    Entry *entry = current;
+    for (uint32 i = 0u; (i < generations) && (ok); i++) {
+        Entry *father = entry->parent;
+        ok = (father != NULL_PTR(Entry *));
+        if (ok) {
+            if (father == root) {
+                ok = (generations == (i + 1u));
+            }
+            entry = father;
+        }
+    }
+    if (ok) {
+        current = entry;
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::MoveAbsolute(const char8 * const path) {
+    return MoveToPath(root, path, false);
+}
+
+bool ArenaConfigurationDatabase::MoveRelative(const char8 * const path) {
+    return MoveToPath(current, path, false);
+}
+
+bool ArenaConfigurationDatabase::MoveToChild(const uint32 childIdx) {
+    bool ok = (childIdx < current->numberOfChildren);
+    if (ok) {
+        ok = !current->children[childIdx]->isLeaf;
+        if (ok) {
+            current = current->children[childIdx];
+        }
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabase::CreateAbsolute(const char8 * const path) {
+    current = root;
+    return MoveToPath(root, path, true);
+}
+
+bool ArenaConfigurationDatabase::CreateRelative(const char8 * const path) {
+    return MoveToPath(current, path, true);
+}
+
+bool ArenaConfigurationDatabase::Delete(const char8 * const name) {
+    bool ok = (name != NULL_PTR(const char8 *));
+    Entry *entry = NULL_PTR(Entry *);
+    if (ok) {
+        entry = FindChild(current, name, StringHelper::Length(name));
+        ok = (entry != NULL_PTR(Entry *));
+    }
+    if (ok) {
+        RemoveFromIndex(entry);
+        bool found = false;
+        for (uint32 i = 0u; i < current->numberOfChildren; i++) {
+            if (found) {
+                current->children[i - 1u] = current->children[i];
+            }
+            else {
+                found = (current->children[i] == entry);
+            }
+        }
+        current->numberOfChildren--;
+    }
+    return ok;
+}
+
+const char8 *ArenaConfigurationDatabase::GetName() {
+    return (current != NULL_PTR(Entry *)) ? (current->name) : (NULL_PTR(const char8 *));
+}
+
+const char8 *ArenaConfigurationDatabase::GetChildName(const uint32 index) {
+    const char8 *childName = NULL_PTR(const char8 *);
+    if (index < current->numberOfChildren) {
+        childName = current->children[index]->name;
+    }
+    return childName;
+}
+
+uint32 ArenaConfigurationDatabase::GetNumberOfChildren() {
+    return (current != NULL_PTR(Entry *)) ? (current->numberOfChildren) : (0u);
+}
+
+uint32 ArenaConfigurationDatabase::GetReservedSize() const {
+    return heap.GetReservedSize();
+}
+
+uint32 ArenaConfigurationDatabase::GetUsedSize() const {
+    return heap.GetUsedSize();
+}
+
+}
@@ -0,0 +1,372 @@
+/**
+ * @file ArenaConfigurationDatabase.h
+ * @brief Header file for class ArenaConfigurationDatabase
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaConfigurationDatabase
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef ARENACONFIGURATIONDATABASE_H_
+#define ARENACONFIGURATIONDATABASE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "AnyType.h"
+#include "ArenaHeap.h"
+#include "Reference.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief StructuredDataI implementation where all the nodes, names and values are allocated from an ArenaHeap.
+ * @details Parsing a large configuration into a ConfigurationDatabase requires, for every node and for every leaf, the allocation of an
+ * Object (ConfigurationDatabaseNode or AnyObject), of its name and of its value. This database allocates all of these from an ArenaHeap,
+ * so that building the database is a sequence of pointer increments on a few large chunks of memory, which are released as a unit
+ * when the database is destroyed (or purged).
+ *
+ * Any of the parsers (e.g. StandardParser, JsonParser and XMLParser) can stream directly into this database:
+ * <pre>
+ * ArenaConfigurationDatabase adb;
+ * StandardParser parser(configStream, adb, &errStream);
+ * bool ok = parser.Parse();
+ * //e.g. ObjectRegistryDatabase::Instance()->Initialise(adb) or adb.Copy(cdb);
+ * </pre>
+ *
+ * The names are indexed with a single hash table (keyed by the parent node and the name), so that all the lookups are O(1) irrespectively
+ * of the number of children of a node.
+ *
+ * Nodes and leafs that are deleted, or leafs that are overwritten, are only unlinked from the tree and their memory is only recovered by Purge.
+ * This database is thus meant to be built once and then read (or copied), not to be continuously modified.
+ * @warning Math expressions are only supported by the parsers when the output is a ConfigurationDatabase (see ConfigurationParserI).
+ * @warning AddToCurrentNode is not supported.
+ * @warning This class is not thread safe.
+ */
+class DLL_API ArenaConfigurationDatabase: public StructuredDataI {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param[in] chunkSize the size of the ArenaHeap chunks.
+     * @post
+     *   GetNumberOfChildren() == 0 &&
+     *   GetName() == NULL
+     */
+    ArenaConfigurationDatabase(const uint32 chunkSize = ArenaHeap::DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Destructor. Releases all the memory.
+     */
+    virtual ~ArenaConfigurationDatabase();
+
+    /**
+     * @brief Removes all the nodes and leafs and releases all the memory.
+     * @post
+     *   GetReservedSize() == 0 &&
+     *   GetNumberOfChildren() == 0
+     */
+    void Purge();
+
+    /**
+     * @see StructuredDataI::Read
+     */
+    virtual bool Read(const char8 * const name,
+                      const AnyType &value);
+
+    /**
+     * @see StructuredDataI::GetType
+     */
+    virtual AnyType GetType(const char8 * const name);
+
+    /**
+     * @see StructuredDataI::Write
+     * @details The \a value is copied into the ArenaHeap. Strings are stored as C strings (see AnyObject::Serialise).
+     */
+    virtual bool Write(const char8 * const name,
+                       const AnyType &value);
+
+    /**
+     * @see StructuredDataI::Copy
+     */
+    virtual bool Copy(StructuredDataI &destination);
+
+    /**
+     * @brief Not supported.
+     * @return false.
+     */
+    virtual bool AddToCurrentNode(Reference node);
+
+    /**
+     * @see StructuredDataI::MoveToRoot
+     */
+    virtual bool MoveToRoot();
+
+    /**
+     * @see StructuredDataI::MoveToAncestor
+     */
+    virtual bool MoveToAncestor(const uint32 generations);
+
+    /**
+     * @see StructuredDataI::MoveAbsolute
+     */
+    virtual bool MoveAbsolute(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::MoveRelative
+     */
+    virtual bool MoveRelative(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::MoveToChild
+     */
+    virtual bool MoveToChild(const uint32 childIdx);
+
+    /**
+     * @see StructuredDataI::CreateAbsolute
+     */
+    virtual bool CreateAbsolute(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::CreateRelative
+     */
+    virtual bool CreateRelative(const char8 * const path);
+
+    /**
+     * @see StructuredDataI::Delete
+     */
+    virtual bool Delete(const char8 * const name);
+
+    /**
+     * @see StructuredDataI::GetName
+     */
+    virtual const char8 *GetName();
+
+    /**
+     * @see StructuredDataI::GetChildName
+     */
+    virtual const char8 *GetChildName(const uint32 index);
+
+    /**
+     * @see StructuredDataI::GetNumberOfChildren
+     */
+    virtual uint32 GetNumberOfChildren();
+
+    /**
+     * @brief Gets the number of bytes reserved by the ArenaHeap (see ArenaHeap::GetReservedSize).
+     * @return the number of bytes reserved by the ArenaHeap.
+     */
+    uint32 GetReservedSize() const;
+
+    /**
+     * @brief Gets the number of bytes allocated from the ArenaHeap (see ArenaHeap::GetUsedSize).
+     * @return the number of bytes allocated from the ArenaHeap.
+     */
+    uint32 GetUsedSize() const;
+
+private:
+
+    /**
+     * A node or a leaf of the database.
+     */
+    struct Entry {
+        /**
+         * The name of the node or leaf.
+         */
+        const char8 *name;
+
+        /**
+         * Length of the name.
+         */
+        uint32 nameLength;
+
+        /**
+         * Hash of the parent and of the name (see the index).
+         */
+        uint32 hash;
+
+        /**
+         * The parent node (NULL for the root).
+         */
+        Entry *parent;
+
+        /**
+         * The children (ordered by creation).
+         */
+        Entry **children;
+
+        /**
+         * Number of children.
+         */
+        uint32 numberOfChildren;
+
+        /**
+         * Number of children that fit in the children array.
+         */
+        uint32 maxNumberOfChildren;
+
+        /**
+         * True if this entry is a leaf.
+         */
+        bool isLeaf;
+
+        /**
+         * The leaf value.
+         */
+        void *dataPointer;
+
+        /**
+         * The leaf type.
+         */
+        TypeDescriptor typeDescriptor;
+
+        /**
+         * The leaf bit address.
+         */
+        uint8 bitAddress;
+
+        /**
+         * The leaf number of dimensions.
+         */
+        uint8 numberOfDimensions;
+
+        /**
+         * The leaf number of elements in each dimension.
+         */
+        uint32 numberOfElements[3];
+
+        /**
+         * True if the leaf is static declared.
+         */
+        bool staticDeclared;
+    };
+
+    /**
+     * @brief Disallow the usage of the copy constructor.
+     */
+    ArenaConfigurationDatabase(const ArenaConfigurationDatabase &toCopy);
+
+    /**
+     * @brief Disallow the usage of the assignment operator.
+     */
+    ArenaConfigurationDatabase &operator=(const ArenaConfigurationDatabase &toCopy);
+
+    /**
+     * @brief Creates the root node and the index.
+     * @return true if the memory could be allocated.
+     */
+    bool CreateRoot();
+
+    /**
+     * @brief Finds the child of \a parentEntry named \a name (with \a nameLength characters).
+     * @return the child or NULL if it does not exist.
+     */
+    Entry *FindChild(const Entry * const parentEntry,
+                     const char8 * const name,
+                     const uint32 nameLength) const;
+
+    /**
+     * @brief Adds a new child named \a name (with \a nameLength characters) to \a parentEntry.
+     * @return the new child or NULL if the memory could not be allocated.
+     * @pre
+     *   FindChild(parentEntry, name, nameLength) == NULL
+     */
+    Entry *AddChild(Entry * const parentEntry,
+                    const char8 * const name,
+                    const uint32 nameLength);
+
+    /**
+     * @brief Removes \a entry and all its descendants from the index.
+     */
+    void RemoveFromIndex(Entry * const entry);
+
+    /**
+     * @brief Inserts \a entry in the index, growing the index if required.
+     * @return true if the memory could be allocated.
+     */
+    bool InsertInIndex(Entry * const entry);
+
+    /**
+     * @brief Moves to the node with a given \a path starting from \a start.
+     * @param[in] create if true, the nodes that do not exist are created and the last node in the path must not exist.
+     * @return true if the node was found (or created).
+     */
+    bool MoveToPath(Entry * const start,
+                    const char8 * const path,
+                    const bool create);
+
+    /**
+     * @brief Copies \a value into the ArenaHeap and stores it in \a leaf.
+     * @return true if the value is supported and could be copied.
+     */
+    bool SetValue(Entry * const leaf,
+                  const AnyType &value);
+
+    /**
+     * @brief Gets the value of a leaf.
+     * @return the value of the \a leaf.
+     */
+    static AnyType GetValue(const Entry * const leaf);
+
+    /**
+     * The memory of the database.
+     */
+    ArenaHeap heap;
+
+    /**
+     * The root node.
+     */
+    Entry *root;
+
+    /**
+     * The current node.
+     */
+    Entry *current;
+
+    /**
+     * Open addressing hash table of all the entries (with the exception of the root).
+     */
+    Entry **index;
+
+    /**
+     * Size of the index (power of two).
+     */
+    uint32 indexSize;
+
+    /**
+     * Number of entries in the index.
+     */
+    uint32 numberOfIndexedEntries;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* ARENACONFIGURATIONDATABASE_H_ */
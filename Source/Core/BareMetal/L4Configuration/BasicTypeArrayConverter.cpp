@@ -0,0 +1,337 @@
+/**
+ * @file BasicTypeArrayConverter.cpp
+ * @brief Source file for module BasicTypeArrayConverter
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module BasicTypeArrayConverter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GeneralDefinitions.h"
+#include "MemoryOperationsHelper.h"
+#include "TypeCharacteristics.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Copies arrays of the same type.
+ * @see BasicTypeArrayConverter.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename Type>
+static bool CopyArray(void * const destination,
+                      const void * const source,
+                      const uint32 numberOfElements) {
+    return MemoryOperationsHelper::Copy(destination, source, static_cast<uint32>(numberOfElements * sizeof(Type)));
+}
+
+/**
+ * @brief Converts arrays of integers into arrays of integers.
+ * @details Saturates to the range of the destination type (as BitSetToBitSet).
+ * @see BasicTypeArrayConverter.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename SourceType, typename DestinationType>
+static bool IntegerToIntegerArray(void * const destination,
+                                  const void * const source,
+                                  const uint32 numberOfElements) {
+    const SourceType *sourceArray = static_cast<const SourceType *>(source);
+    DestinationType *destinationArray = static_cast<DestinationType *>(destination);
+    const bool isSourceSigned = TypeCharacteristics<SourceType>::IsSigned();
+    const DestinationType maxValue = TypeCharacteristics<DestinationType>::MaxValue();
+    const DestinationType minValue = TypeCharacteristics<DestinationType>::MinValue();
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        SourceType value = sourceArray[i];
+        bool isNegative = (isSourceSigned) && (static_cast<int64>(value) < 0);
+        if (isNegative) {
+            if (static_cast<int64>(value) < static_cast<int64>(minValue)) {
+                destinationArray[i] = minValue;
+            }
+            else {
+                destinationArray[i] = static_cast<DestinationType>(value);
+            }
+        }
+        else {
+            if (static_cast<uint64>(value) > static_cast<uint64>(maxValue)) {
+                destinationArray[i] = maxValue;
+            }
+            else {
+                destinationArray[i] = static_cast<DestinationType>(value);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Converts arrays of integers into arrays of floats.
+ * @see BasicTypeArrayConverter.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename SourceType, typename DestinationType>
+static bool IntegerToFloatArray(void * const destination,
+                                const void * const source,
+                                const uint32 numberOfElements) {
+    const SourceType *sourceArray = static_cast<const SourceType *>(source);
+    DestinationType *destinationArray = static_cast<DestinationType *>(destination);
+    //No 64 bit integer overflows a float32, so that the conversion never fails.
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        destinationArray[i] = static_cast<DestinationType>(sourceArray[i]);
+    }
+    return true;
+}
+
+/**
+ * @brief Converts arrays of floats into arrays of integers.
+ * @details Rounds to the nearest integer and saturates to the range of the destination type (as FloatToInteger).
+ * @see BasicTypeArrayConverter.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename SourceType, typename DestinationType>
+static bool FloatToIntegerArray(void * const destination,
+                                const void * const source,
+                                const uint32 numberOfElements) {
+    const SourceType *sourceArray = static_cast<const SourceType *>(source);
+    DestinationType *destinationArray = static_cast<DestinationType *>(destination);
+    const bool isDestinationSigned = TypeCharacteristics<DestinationType>::IsSigned();
+    const DestinationType maxValue = TypeCharacteristics<DestinationType>::MaxValue();
+    const DestinationType minValue = TypeCharacteristics<DestinationType>::MinValue();
+    const SourceType maxValueFloat = static_cast<SourceType>(maxValue);
+    const SourceType minValueFloat = static_cast<SourceType>(minValue);
+    const SourceType half = static_cast<SourceType>(0.5);
+    bool saturated = false;
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        SourceType value = sourceArray[i];
+        DestinationType result = static_cast<DestinationType>(0);
+        bool isSourcePositive = (value > static_cast<SourceType>(0.0));
+        if ((isDestinationSigned) || (isSourcePositive)) {
+            if (value >= maxValueFloat) {
+                result = maxValue;
+                saturated = true;
+            }
+            else if (value <= minValueFloat) {
+                result = minValue;
+                saturated = true;
+            }
+            else {
+                result = static_cast<DestinationType>(value);
+                SourceType remainder = value - static_cast<SourceType>(result);
+                if (remainder >= half) {
+                    if (result < maxValue) {
+                        result++;
+                    }
+                }
+                else if (remainder <= -half) {
+                    if (result > minValue) {
+                        result--;
+                    }
+                }
+                else {
+                    //NOOP
+                }
+            }
+        }
+        else {
+            //Negative floats saturate to 0 in unsigned integers
+            saturated = (saturated) || (value < static_cast<SourceType>(0.0));
+        }
+        destinationArray[i] = result;
+    }
+    if (saturated) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "FloatToInteger: Saturation of one or more elements to the range of the destination type");
+    }
+    return true;
+}
+
+/**
+ * @brief Converts arrays of floats into arrays of floats of a different size.
+ * @details NaN and Inf cannot be converted (the destination element is set to zero) and the conversion to float32
+ * saturates to the largest float32 (as FloatToFloat).
+ * @see BasicTypeArrayConverter.
+ */
+/*lint -e{1573} [MISRA C++ Rule 14-5-1]. Justification: MARTe::HighResolutionTimerCalibrator is not a possible argument for this function template.*/
+template<typename SourceType, typename DestinationType>
+static bool FloatToFloatArray(void * const destination,
+                              const void * const source,
+                              const uint32 numberOfElements) {
+    const SourceType *sourceArray = static_cast<const SourceType *>(source);
+    DestinationType *destinationArray = static_cast<DestinationType *>(destination);
+    const uint32 maxFloat32Mask = 0x7f7fffffu;
+    float32 maxFloat32 = 0.0F;
+    bool ok = MemoryOperationsHelper::Copy(&maxFloat32, &maxFloat32Mask, static_cast<uint32>(sizeof(float32)));
+    //The remaining elements are still converted if one of them fails.
+    bool saturated = false;
+    for (uint32 i = 0u; i < numberOfElements; i++) {
+        SourceType value = sourceArray[i];
+        DestinationType result = static_cast<DestinationType>(0.0);
+        bool isSourceNaN = IsNaN(value);
+        bool isSourceInf = IsInf(value);
+        if ((isSourceNaN) || (isSourceInf)) {
+            ok = false;
+        }
+        else {
+            DestinationType test = static_cast<DestinationType>(value);
+            bool isTestNaN = IsNaN(test);
+            bool isTestInf = IsInf(test);
+            if ((isTestNaN) || (isTestInf)) {
+                if (sizeof(DestinationType) < sizeof(SourceType)) {
+                    result = (value > static_cast<SourceType>(0.0)) ? (static_cast<DestinationType>(maxFloat32)) : (-static_cast<DestinationType>(maxFloat32));
+                    saturated = true;
+                }
+                else {
+                    ok = false;
+                }
+            }
+            else {
+                result = test;
+            }
+        }
+        destinationArray[i] = result;
+    }
+    if (saturated) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "FloatToFloat: Saturation of one or more elements to the maximum or minimum float");
+    }
+    return ok;
+}
+
+/**
+ * Number of basic types that have a converter.
+ */
+static const uint32 NUMBER_OF_ARRAY_CONVERTER_TYPES = 10u;
+
+/**
+ * @brief Declares the converters from \a sourceType to all the other types with the \a integerConverter (for
+ * integer destinations) and with the \a floatConverter (for float destinations).
+ */
+#define BASIC_TYPE_ARRAY_CONVERTERS_ROW(sourceType, integerConverter, floatConverter) \
+    { &integerConverter<sourceType, uint8>, &integerConverter<sourceType, int8>, \
+      &integerConverter<sourceType, uint16>, &integerConverter<sourceType, int16>, \
+      &integerConverter<sourceType, uint32>, &integerConverter<sourceType, int32>, \
+      &integerConverter<sourceType, uint64>, &integerConverter<sourceType, int64>, \
+      &floatConverter<sourceType, float32>, &floatConverter<sourceType, float64> }
+
+/**
+ * The converters indexed by [source][destination] (see GetArrayConverterTypeIndex).
+ * Equal types are handled separately (see GetBasicTypeArrayConverter).
+ */
+static const BasicTypeArrayConverter arrayConverters[NUMBER_OF_ARRAY_CONVERTER_TYPES][NUMBER_OF_ARRAY_CONVERTER_TYPES] = {
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(uint8, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(int8, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(uint16, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(int16, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(uint32, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(int32, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(uint64, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(int64, IntegerToIntegerArray, IntegerToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(float32, FloatToIntegerArray, FloatToFloatArray),
+        BASIC_TYPE_ARRAY_CONVERTERS_ROW(float64, FloatToIntegerArray, FloatToFloatArray) };
+
+/**
+ * The copy functions indexed as arrayConverters.
+ */
+static const BasicTypeArrayConverter arrayCopiers[NUMBER_OF_ARRAY_CONVERTER_TYPES] = { &CopyArray<uint8>, &CopyArray<int8>, &CopyArray<uint16>, &CopyArray<int16>,
+        &CopyArray<uint32>, &CopyArray<int32>, &CopyArray<uint64>, &CopyArray<int64>, &CopyArray<float32>, &CopyArray<float64> };
+
+/**
+ * @brief Gets the index of a type in the arrayConverters table.
+ * @param[in] descriptor the type.
+ * @param[out] index the index of the type.
+ * @return true if the type has a converter.
+ */
+static bool GetArrayConverterTypeIndex(const TypeDescriptor &descriptor,
+                                       uint32 &index) {
+    bool found = true;
+    //lint -e{9007} no read side-effects on the type comparisons below*/
+    if (descriptor == UnsignedInteger8Bit) {
+        index = 0u;
+    }
+    else if (descriptor == SignedInteger8Bit) {
+        index = 1u;
+    }
+    else if (descriptor == UnsignedInteger16Bit) {
+        index = 2u;
+    }
+    else if (descriptor == SignedInteger16Bit) {
+        index = 3u;
+    }
+    else if (descriptor == UnsignedInteger32Bit) {
+        index = 4u;
+    }
+    else if (descriptor == SignedInteger32Bit) {
+        index = 5u;
+    }
+    else if (descriptor == UnsignedInteger64Bit) {
+        index = 6u;
+    }
+    else if (descriptor == SignedInteger64Bit) {
+        index = 7u;
+    }
+    else if (descriptor == Float32Bit) {
+        index = 8u;
+    }
+    else if (descriptor == Float64Bit) {
+        index = 9u;
+    }
+    else {
+        found = false;
+    }
+    return found;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+BasicTypeArrayConverter GetBasicTypeArrayConverter(const TypeDescriptor &destinationDescriptor,
+                                                   const TypeDescriptor &sourceDescriptor) {
+    BasicTypeArrayConverter converter = NULL_PTR(BasicTypeArrayConverter);
+    uint32 sourceIndex = 0u;
+    uint32 destinationIndex = 0u;
+    bool ok = GetArrayConverterTypeIndex(sourceDescriptor, sourceIndex);
+    if (ok) {
+        ok = GetArrayConverterTypeIndex(destinationDescriptor, destinationIndex);
+    }
+    if (ok) {
+        if (sourceIndex == destinationIndex) {
+            converter = arrayCopiers[sourceIndex];
+        }
+        else {
+            converter = arrayConverters[sourceIndex][destinationIndex];
+        }
+    }
+    return converter;
+}
+
+}
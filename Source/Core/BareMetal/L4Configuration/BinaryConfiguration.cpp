@@ -0,0 +1,605 @@
+/**
+ * @file BinaryConfiguration.cpp
+ * @brief Source file for module BinaryConfiguration
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the module BinaryConfiguration (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "AnyType.h"
+#include "BinaryConfiguration.h"
+#include "CRC.h"
+#include "Matrix.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace BinaryConfiguration {
+
+/**
+ * Record tags.
+ */
+static const uint8 TAG_NODE_BEGIN = 1u;
+static const uint8 TAG_NODE_END = 2u;
+static const uint8 TAG_LEAF_NUMERIC = 3u;
+static const uint8 TAG_LEAF_STRING = 4u;
+
+/**
+ * Size of the header: magic, version, payload size and payload CRC.
+ */
+static const uint32 HEADER_SIZE = 4u * static_cast<uint32>(sizeof(uint32));
+
+/**
+ * Alignment of the numeric values in the payload.
+ */
+static const uint32 VALUE_ALIGNMENT = 8u;
+
+/**
+ * CRC32 polynomial.
+ */
+static const uint32 CRC_POLYNOMIAL = 0x04C11DB7u;
+
+/**
+ * @brief Writes \a size bytes to a stream.
+ */
+static bool WriteBytes(StreamI &stream,
+                       const void * const data,
+                       const uint32 size) {
+    uint32 writeSize = size;
+    bool ok = stream.Write(static_cast<const char8 *>(data), writeSize);
+    if (ok) {
+        ok = (writeSize == size);
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes zeros to \a payload until its size is a multiple of VALUE_ALIGNMENT.
+ */
+static bool WritePadding(StreamString &payload) {
+    const uint8 zeros[VALUE_ALIGNMENT] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u };
+    uint32 remainder = static_cast<uint32>(payload.Size() % VALUE_ALIGNMENT);
+    bool ok = true;
+    if (remainder > 0u) {
+        ok = WriteBytes(payload, &zeros[0], VALUE_ALIGNMENT - remainder);
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes a record tag followed by the record name.
+ */
+static bool WriteTagAndName(StreamString &payload,
+                            const uint8 tag,
+                            const char8 * const name) {
+    uint32 nameLength = StringHelper::Length(name);
+    bool ok = WriteBytes(payload, &tag, static_cast<uint32>(sizeof(uint8)));
+    if (ok) {
+        ok = WriteBytes(payload, &nameLength, static_cast<uint32>(sizeof(uint32)));
+    }
+    if (ok) {
+        //Including the terminator, so that the name can be used directly from the import buffer.
+        ok = WriteBytes(payload, name, nameLength + 1u);
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes the number of dimensions and the number of elements of a leaf.
+ */
+static bool WriteDimensions(StreamString &payload,
+                            const uint8 numberOfDimensions,
+                            const uint32 (&numberOfElements)[3]) {
+    bool ok = WriteBytes(payload, &numberOfDimensions, static_cast<uint32>(sizeof(uint8)));
+    for (uint32 d = 0u; (d < 3u) && (ok); d++) {
+        ok = WriteBytes(payload, &numberOfElements[d], static_cast<uint32>(sizeof(uint32)));
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes a string (including the terminator).
+ */
+static bool WriteString(StreamString &payload,
+                        StreamString &str) {
+    const char8 terminator = '\0';
+    uint32 length = static_cast<uint32>(str.Size());
+    bool ok = true;
+    if (length > 0u) {
+        ok = WriteBytes(payload, str.Buffer(), length);
+    }
+    if (ok) {
+        ok = WriteBytes(payload, &terminator, 1u);
+    }
+    return ok;
+}
+
+/**
+ * @brief Serialises the leaf \a name of the current node of \a source.
+ */
+static bool ExportLeaf(StructuredDataI &source,
+                       const char8 * const name,
+                       StreamString &payload) {
+    AnyType leafType = source.GetType(name);
+    TypeDescriptor td = leafType.GetTypeDescriptor();
+    uint8 numberOfDimensions = leafType.GetNumberOfDimensions();
+    uint32 numberOfElements[3] = { leafType.GetNumberOfElements(0u), leafType.GetNumberOfElements(1u), leafType.GetNumberOfElements(2u) };
+    if ((td.type == CArray) && (numberOfDimensions > 0u)) {
+        //The first dimension of a CArray is the one of the characters of each string (e.g. a scalar string is a CArray with one dimension).
+        numberOfDimensions--;
+        numberOfElements[0] = numberOfElements[1];
+        numberOfElements[1] = numberOfElements[2];
+        numberOfElements[2] = 1u;
+    }
+    bool ok = (numberOfDimensions <= 2u);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "BinaryConfiguration: %s has more than two dimensions", name);
+    }
+    uint32 numberOfColumns = numberOfElements[0];
+    uint32 numberOfRows = numberOfElements[1];
+    if (ok) {
+        if (td.IsNumericType()) {
+            td.isConstant = false;
+            uint16 tdAll = td.all;
+            ok = WriteTagAndName(payload, TAG_LEAF_NUMERIC, name);
+            if (ok) {
+                ok = WriteBytes(payload, &tdAll, static_cast<uint32>(sizeof(uint16)));
+            }
+            if (ok) {
+                ok = WriteDimensions(payload, numberOfDimensions, numberOfElements);
+            }
+            if (ok) {
+                ok = WritePadding(payload);
+            }
+            uint64 dataSize = static_cast<uint64>(numberOfColumns) * numberOfRows * numberOfElements[2] * (td.numberOfBits / 8u);
+            if (ok) {
+                ok = (dataSize < 0xFFFFFFFFu);
+            }
+            if (ok) {
+                //Read into contiguous memory (the leaf could, e.g., be a matrix stored as an array of rows).
+                uint8 *data = new uint8[dataSize];
+                AnyType dataType(td, 0u, data);
+                dataType.SetNumberOfDimensions(numberOfDimensions);
+                dataType.SetNumberOfElements(0u, numberOfColumns);
+                dataType.SetNumberOfElements(1u, numberOfRows);
+                dataType.SetNumberOfElements(2u, numberOfElements[2]);
+                dataType.SetStaticDeclared(true);
+                ok = source.Read(name, dataType);
+                if (ok) {
+                    ok = WriteBytes(payload, data, static_cast<uint32>(dataSize));
+                }
+                delete[] data;
+            }
+        }
+        else {
+            ok = WriteTagAndName(payload, TAG_LEAF_STRING, name);
+            if (ok) {
+                ok = WriteDimensions(payload, numberOfDimensions, numberOfElements);
+            }
+            if (ok) {
+                if (numberOfDimensions == 0u) {
+                    StreamString value;
+                    ok = source.Read(name, value);
+                    if (ok) {
+                        ok = WriteString(payload, value);
+                    }
+                }
+                else if (numberOfDimensions == 1u) {
+                    Vector<StreamString> values(numberOfColumns);
+                    ok = source.Read(name, values);
+                    for (uint32 c = 0u; (c < numberOfColumns) && (ok); c++) {
+                        ok = WriteString(payload, values[c]);
+                    }
+                }
+                else {
+                    Matrix<StreamString> values(numberOfRows, numberOfColumns);
+                    ok = source.Read(name, values);
+                    for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+                        for (uint32 c = 0u; (c < numberOfColumns) && (ok); c++) {
+                            ok = WriteString(payload, values[r][c]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "BinaryConfiguration: failed to export %s", name);
+    }
+    return ok;
+}
+
+/**
+ * @brief Serialises all the children of the current node of \a source.
+ */
+static bool ExportNode(StructuredDataI &source,
+                       StreamString &payload) {
+    bool ok = true;
+    uint32 numberOfChildren = source.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        StreamString childName = source.GetChildName(i);
+        if (source.MoveRelative(childName.Buffer())) {
+            ok = WriteTagAndName(payload, TAG_NODE_BEGIN, childName.Buffer());
+            if (ok) {
+                ok = ExportNode(source, payload);
+            }
+            if (ok) {
+                const uint8 tag = TAG_NODE_END;
+                ok = WriteBytes(payload, &tag, static_cast<uint32>(sizeof(uint8)));
+            }
+            if (!source.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+        else {
+            ok = ExportLeaf(source, childName.Buffer(), payload);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Reports an import error both with REPORT_ERROR and in the err stream.
+ */
+static void ImportError(BufferedStreamI * const err,
+                        const char8 * const message,
+                        const uint32 offset) {
+    REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "BinaryConfiguration: %s (at payload offset %d)", message, offset);
+    if (err != NULL_PTR(BufferedStreamI *)) {
+        (void) err->Printf("%s (at payload offset %d)\n", message, offset);
+    }
+}
+
+/**
+ * @brief Copies \a size bytes from the payload at \a offset into \a field, checking that they lie in the payload.
+ */
+static bool ReadField(const uint8 * const payload,
+                      const uint32 payloadSize,
+                      uint32 &offset,
+                      void * const field,
+                      const uint32 size) {
+    bool ok = (size <= (payloadSize - offset));
+    if (ok) {
+        //Copy, since the fields are not aligned.
+        ok = MemoryOperationsHelper::Copy(field, &payload[offset], size);
+        offset += size;
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets a null terminated string from the payload at \a offset, checking that it lies in the payload.
+ */
+static const char8 *ReadString(const uint8 * const payload,
+                               const uint32 payloadSize,
+                               uint32 &offset) {
+    const char8 *str = NULL_PTR(const char8 *);
+    uint32 end = offset;
+    while ((end < payloadSize) && (payload[end] != 0u)) {
+        end++;
+    }
+    if (end < payloadSize) {
+        /*lint -e{927} -e{9176} the payload is a sequence of null terminated strings*/
+        str = reinterpret_cast<const char8 *>(&payload[offset]);
+        offset = end + 1u;
+    }
+    return str;
+}
+
+/**
+ * @brief Gets a record name from the payload at \a offset.
+ */
+static const char8 *ReadName(const uint8 * const payload,
+                             const uint32 payloadSize,
+                             uint32 &offset) {
+    uint32 nameLength = 0u;
+    const char8 *name = NULL_PTR(const char8 *);
+    if (ReadField(payload, payloadSize, offset, &nameLength, static_cast<uint32>(sizeof(uint32)))) {
+        name = ReadString(payload, payloadSize, offset);
+        if (name != NULL_PTR(const char8 *)) {
+            if ((StringHelper::Length(name) != nameLength) || (nameLength == 0u)) {
+                name = NULL_PTR(const char8 *);
+            }
+        }
+    }
+    return name;
+}
+
+/**
+ * @brief Reads the number of dimensions and the number of elements of a leaf and computes the total number of elements.
+ */
+static bool ReadDimensions(const uint8 * const payload,
+                           const uint32 payloadSize,
+                           uint32 &offset,
+                           uint8 &numberOfDimensions,
+                           uint32 (&numberOfElements)[3],
+                           uint64 &totalNumberOfElements) {
+    bool ok = ReadField(payload, payloadSize, offset, &numberOfDimensions, static_cast<uint32>(sizeof(uint8)));
+    totalNumberOfElements = 1u;
+    for (uint32 d = 0u; (d < 3u) && (ok); d++) {
+        ok = ReadField(payload, payloadSize, offset, &numberOfElements[d], static_cast<uint32>(sizeof(uint32)));
+        totalNumberOfElements *= numberOfElements[d];
+    }
+    if (ok) {
+        ok = (numberOfDimensions <= 2u) && (totalNumberOfElements > 0u) && (totalNumberOfElements <= payloadSize);
+    }
+    if (ok) {
+        if (numberOfDimensions == 0u) {
+            ok = (totalNumberOfElements == 1u);
+        }
+        else if (numberOfDimensions == 1u) {
+            ok = (numberOfElements[1] == 1u) && (numberOfElements[2] == 1u);
+        }
+        else {
+            ok = (numberOfElements[2] == 1u);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Deserialises all the records of the payload into the current node of \a destination.
+ */
+static bool ImportPayload(const uint8 * const payload,
+                          const uint32 payloadSize,
+                          StructuredDataI &destination,
+                          BufferedStreamI * const err) {
+    bool ok = true;
+    uint32 offset = 0u;
+    uint32 depth = 0u;
+    //Scratch array for the pointers to the strings, only reallocated when a larger array of strings is found.
+    const char8 **strings = NULL_PTR(const char8 **);
+    uint32 stringsCapacity = 0u;
+    while ((offset < payloadSize) && (ok)) {
+        uint32 recordOffset = offset;
+        uint8 tag = payload[offset];
+        offset++;
+        if (tag == TAG_NODE_END) {
+            ok = (depth > 0u);
+            if (ok) {
+                ok = destination.MoveToAncestor(1u);
+                depth--;
+            }
+            if (!ok) {
+                ImportError(err, "Unbalanced node end", recordOffset);
+            }
+        }
+        else {
+            const char8 * const name = ReadName(payload, payloadSize, offset);
+            ok = (name != NULL_PTR(const char8 *));
+            if (!ok) {
+                ImportError(err, "Invalid name", recordOffset);
+            }
+            else if (tag == TAG_NODE_BEGIN) {
+                ok = destination.CreateRelative(name);
+                if (ok) {
+                    depth++;
+                }
+                else {
+                    ImportError(err, "Failed to create node", recordOffset);
+                }
+            }
+            else if (tag == TAG_LEAF_NUMERIC) {
+                uint16 tdAll = 0u;
+                uint8 numberOfDimensions = 0u;
+                uint32 numberOfElements[3];
+                uint64 totalNumberOfElements = 0u;
+                ok = ReadField(payload, payloadSize, offset, &tdAll, static_cast<uint32>(sizeof(uint16)));
+                TypeDescriptor td(tdAll);
+                if (ok) {
+                    ok = td.IsNumericType();
+                }
+                if (ok) {
+                    ok = ReadDimensions(payload, payloadSize, offset, numberOfDimensions, numberOfElements, totalNumberOfElements);
+                }
+                if (ok) {
+                    uint32 remainder = (offset % VALUE_ALIGNMENT);
+                    if (remainder > 0u) {
+                        offset += (VALUE_ALIGNMENT - remainder);
+                    }
+                    uint64 dataSize = totalNumberOfElements * (td.numberOfBits / 8u);
+                    ok = (offset <= payloadSize);
+                    if (ok) {
+                        ok = (dataSize <= (payloadSize - offset));
+                    }
+                    if (ok) {
+                        //The values are written directly from the read buffer.
+                        AnyType leafType(td, 0u, &payload[offset]);
+                        leafType.SetNumberOfDimensions(numberOfDimensions);
+                        leafType.SetNumberOfElements(0u, numberOfElements[0]);
+                        leafType.SetNumberOfElements(1u, numberOfElements[1]);
+                        leafType.SetNumberOfElements(2u, numberOfElements[2]);
+                        leafType.SetStaticDeclared(true);
+                        ok = destination.Write(name, leafType);
+                        offset += static_cast<uint32>(dataSize);
+                    }
+                }
+                if (!ok) {
+                    ImportError(err, "Invalid numeric leaf", recordOffset);
+                }
+            }
+            else if (tag == TAG_LEAF_STRING) {
+                uint8 numberOfDimensions = 0u;
+                uint32 numberOfElements[3];
+                uint64 totalNumberOfElements = 0u;
+                ok = ReadDimensions(payload, payloadSize, offset, numberOfDimensions, numberOfElements, totalNumberOfElements);
+                if (ok) {
+                    if (totalNumberOfElements > stringsCapacity) {
+                        if (strings != NULL_PTR(const char8 **)) {
+                            delete[] strings;
+                        }
+                        stringsCapacity = static_cast<uint32>(totalNumberOfElements);
+                        strings = new const char8 *[stringsCapacity];
+                    }
+                }
+                for (uint32 s = 0u; (s < totalNumberOfElements) && (ok); s++) {
+                    strings[s] = ReadString(payload, payloadSize, offset);
+                    ok = (strings[s] != NULL_PTR(const char8 *));
+                }
+                if (ok) {
+                    if (numberOfDimensions == 0u) {
+                        ok = destination.Write(name, strings[0]);
+                    }
+                    else if (numberOfDimensions == 1u) {
+                        Vector<const char8 *> values(strings, numberOfElements[0]);
+                        ok = destination.Write(name, values);
+                    }
+                    else {
+                        Matrix<const char8 *> values(strings, numberOfElements[1], numberOfElements[0]);
+                        ok = destination.Write(name, values);
+                    }
+                }
+                if (!ok) {
+                    ImportError(err, "Invalid string leaf", recordOffset);
+                }
+            }
+            else {
+                ok = false;
+                ImportError(err, "Unknown record", recordOffset);
+            }
+        }
+    }
+    if (ok) {
+        ok = (depth == 0u);
+        if (!ok) {
+            ImportError(err, "Missing node end", offset);
+        }
+    }
+    //Restore the node that was current before the import
+    if (depth > 0u) {
+        (void) destination.MoveToAncestor(depth);
+    }
+    if (strings != NULL_PTR(const char8 **)) {
+        delete[] strings;
+    }
+    return ok;
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace BinaryConfiguration {
+
+bool Export(StructuredDataI &source,
+            StreamI &destination) {
+    StreamString payload;
+    bool ok = ExportNode(source, payload);
+    uint32 payloadSize = static_cast<uint32>(payload.Size());
+    uint32 payloadCRC = 0u;
+    if (ok) {
+        CRC<uint32> crc;
+        crc.ComputeTable(CRC_POLYNOMIAL);
+        /*lint -e{927} -e{9176} the payload is a sequence of bytes*/
+        payloadCRC = crc.Compute(reinterpret_cast<const uint8 *>(payload.Buffer()), static_cast<int32>(payloadSize), 0u, false);
+    }
+    if (ok) {
+        ok = WriteBytes(destination, &MAGIC, static_cast<uint32>(sizeof(uint32)));
+    }
+    if (ok) {
+        ok = WriteBytes(destination, &VERSION, static_cast<uint32>(sizeof(uint32)));
+    }
+    if (ok) {
+        ok = WriteBytes(destination, &payloadSize, static_cast<uint32>(sizeof(uint32)));
+    }
+    if (ok) {
+        ok = WriteBytes(destination, &payloadCRC, static_cast<uint32>(sizeof(uint32)));
+    }
+    if ((ok) && (payloadSize > 0u)) {
+        ok = WriteBytes(destination, payload.Buffer(), payloadSize);
+    }
+    return ok;
+}
+
+bool Import(StreamI &source,
+            StructuredDataI &destination,
+            BufferedStreamI * const err) {
+    uint32 header[HEADER_SIZE / sizeof(uint32)];
+    uint32 readSize = HEADER_SIZE;
+    /*lint -e{927} -e{9176} the header is read as a sequence of bytes*/
+    bool ok = source.Read(reinterpret_cast<char8 *>(&header[0]), readSize);
+    if (ok) {
+        ok = (readSize == HEADER_SIZE);
+    }
+    if (ok) {
+        ok = (header[0] == MAGIC);
+        if (!ok) {
+            ImportError(err, "Invalid magic (not a binary configuration or exported with a different endianity)", 0u);
+        }
+    }
+    if (ok) {
+        ok = (header[1] == VERSION);
+        if (!ok) {
+            ImportError(err, "Unsupported version", 0u);
+        }
+    }
+    uint32 payloadSize = header[2];
+    uint8 *payload = NULL_PTR(uint8 *);
+    if ((ok) && (payloadSize > 0u)) {
+        //Single read of the whole payload.
+        payload = new uint8[payloadSize];
+        readSize = payloadSize;
+        /*lint -e{927} -e{9176} the payload is read as a sequence of bytes*/
+        ok = source.Read(reinterpret_cast<char8 *>(payload), readSize);
+        if (ok) {
+            ok = (readSize == payloadSize);
+        }
+        if (!ok) {
+            ImportError(err, "Truncated payload", readSize);
+        }
+        if (ok) {
+            CRC<uint32> crc;
+            crc.ComputeTable(CRC_POLYNOMIAL);
+            ok = (crc.Compute(payload, static_cast<int32>(payloadSize), 0u, false) == header[3]);
+            if (!ok) {
+                ImportError(err, "CRC mismatch", 0u);
+            }
+        }
+        if (ok) {
+            ok = ImportPayload(payload, payloadSize, destination, err);
+        }
+        delete[] payload;
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,120 @@
+/**
+ * @file BinaryConfiguration.h
+ * @brief Header file for module BinaryConfiguration
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the module BinaryConfiguration
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BINARYCONFIGURATION_H_
+#define BINARYCONFIGURATION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "BufferedStreamI.h"
+#include "StreamI.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Binary serialisation of a StructuredDataI (e.g. a ConfigurationDatabase).
+ * @details The binary format allows to load a configuration without lexing and parsing a textual (cdb, json or xml) configuration.
+ * The whole serialised database is read with a single read operation and the numeric values are written in the destination database directly
+ * from the read buffer (i.e. without any intermediate conversion from text).
+ *
+ * The format is composed by a header followed by the payload:
+ * <pre>
+ * uint32 MAGIC | uint32 VERSION | uint32 payload size (bytes) | uint32 payload CRC32 (polynomial 0x04C11DB7)
+ * </pre>
+ * The payload is a sequence of records, each starting with a uint8 tag:
+ * - NODE_BEGIN: uint32 name length, name (null terminated). All the following records belong to this node until the matching NODE_END;
+ * - NODE_END: no fields;
+ * - LEAF_NUMERIC: uint32 name length, name (null terminated), uint16 TypeDescriptor, uint8 number of dimensions, 3 x uint32 number of elements,
+ * padding to the next multiple of 8 bytes (with respect to the beginning of the payload), raw values (matrices are stored row by row);
+ * - LEAF_STRING: uint32 name length, name (null terminated), uint8 number of dimensions, 3 x uint32 number of elements,
+ * the strings (null terminated, matrices are stored row by row).
+ *
+ * The numeric types (see TypeDescriptor::IsNumericType) preserve their type and dimensions. All the other leafs are stored as strings
+ * (with the same dimensions).
+ *
+ * All the fields are stored with the endianity of the machine where the database was exported. A database exported with a different endianity is
+ * detected (by the MAGIC) and refused.
+ *
+ * The Loader loads binary configurations when the Parser parameter is set to "bin". Databases can be exported with Export, e.g.:
+ * <pre>
+ * ConfigurationDatabase cdb;
+ * StandardParser parser(configStream, cdb);
+ * bool ok = parser.Parse();
+ * ...
+ * ok = cdb.MoveToRoot();
+ * ok = BinaryConfiguration::Export(cdb, binaryFile);
+ * </pre>
+ */
+namespace BinaryConfiguration {
+
+/**
+ * Identifies the format (and the endianity).
+ */
+static const uint32 MAGIC = 0x3244434Du;
+
+/**
+ * The version of the format.
+ */
+static const uint32 VERSION = 1u;
+
+/**
+ * @brief Serialises all the children of the current node of \a source into \a destination.
+ * @param[in] source the database to export. The current node is restored before returning.
+ * @param[out] destination the stream where to write the serialised database.
+ * @return true if all the nodes and leafs could be serialised and written to \a destination.
+ */
+DLL_API bool Export(StructuredDataI &source,
+                    StreamI &destination);
+
+/**
+ * @brief Deserialises a database, previously exported with Export, into the current node of \a destination.
+ * @details The header is read first and the whole payload is then read, with a single read operation, into one buffer, whose CRC is verified before
+ * any node is created. The position of \a source shall be at the beginning of the header.
+ * @param[in] source the stream where to read the serialised database from.
+ * @param[out] destination the database where to write the deserialised nodes and leafs. The current node is restored before returning.
+ * @param[out] err where to write the error messages (may be NULL).
+ * @return true if the header is valid, the CRC matches and all the nodes and leafs could be written to \a destination.
+ */
+DLL_API bool Import(StreamI &source,
+                    StructuredDataI &destination,
+                    BufferedStreamI * const err = NULL_PTR(BufferedStreamI *));
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* BINARYCONFIGURATION_H_ */
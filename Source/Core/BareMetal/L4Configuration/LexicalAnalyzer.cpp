@@ -304,9 +304,12 @@ static bool EscapeChar(char8 &c) {
 
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 Token* LexicalAnalyzer::GetToken() {
-    // delete the previous token
+    // keep the previous token to be reused
     if (token != NULL) {
-        delete token;
+        if (!consumedTokens.Add(token)) {
+            delete token;
+        }
+        token = static_cast<Token*>(NULL);
     }
     TokenizeInput();
     if (!tokenQueue.Extract(0u, token)) {
@@ -385,12 +388,37 @@ LexicalAnalyzer::~LexicalAnalyzer() {
             REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Extract() of the token from the token stack");
         }
     }
+    uint32 consumedSize = consumedTokens.GetSize();
+    for (uint32 i = 0u; i < consumedSize; i++) {
+        Token *toDelete;
+        if (consumedTokens.Extract((consumedSize - i) - 1u, toDelete)) {
+            delete toDelete;
+        }
+    }
     if (token != NULL) {
         delete token;
     }
     inputStream = static_cast<StreamI*>(NULL);
 }
 
+/*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
+void LexicalAnalyzer::AddToQueue(const TokenInfo &info, const char8 * const data) {
+    Token *toAdd = static_cast<Token*>(NULL);
+    uint32 consumedSize = consumedTokens.GetSize();
+    if (consumedSize > 0u) {
+        if (consumedTokens.Extract(consumedSize - 1u, toAdd)) {
+            toAdd->Set(info, data, lineNumber);
+        }
+    }
+    if (toAdd == NULL) {
+        /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
+        toAdd = new Token(info, data, lineNumber);
+    }
+    if (!tokenQueue.Add(toAdd)) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
+    }
+}
+
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 void LexicalAnalyzer::AddToken(char8 *const tokenBuffer,
                                bool isString) {
@@ -411,11 +439,7 @@ void LexicalAnalyzer::AddToken(char8 *const tokenBuffer,
             // not an integer! Try a float (number)
             float64 possibleFloat = 0.0;
             if (TypeConvert(possibleFloat, tokenBuffer)) {
-                /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-                Token *toAdd = new Token(tokenInfo[NUMBER_TOKEN], &tokenBuffer[0], lineNumber);
-                if (!tokenQueue.Add(toAdd)) {
-                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-                }
+                AddToQueue(tokenInfo[NUMBER_TOKEN], &tokenBuffer[0]);
             }
             else{
                 isString = true;
@@ -434,11 +458,7 @@ void LexicalAnalyzer::AddToken(char8 *const tokenBuffer,
                     tokenBuffer[end] = '\0';
                 }
             }
-            /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-            Token *toAdd = new Token(tokenInfo[STRING_TOKEN], &tokenBuffer[begin], lineNumber);
-            if (!tokenQueue.Add(toAdd)) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-            }
+            AddToQueue(tokenInfo[STRING_TOKEN], &tokenBuffer[begin]);
         }
     }
 
@@ -448,21 +468,13 @@ void LexicalAnalyzer::AddToken(char8 *const tokenBuffer,
 void LexicalAnalyzer::AddTerminal(const char8 terminal) {
 
     char8 terminalBuffer[2] = { terminal, '\0' };
-    /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-    Token *toAdd = new Token(tokenInfo[TERMINAL_TOKEN], &terminalBuffer[0], lineNumber);
-    if (!tokenQueue.Add(toAdd)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-    }
+    AddToQueue(tokenInfo[TERMINAL_TOKEN], &terminalBuffer[0]);
 }
 
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
 void LexicalAnalyzer::AddTerminal(const char8 *const terminalBuffer) {
 
-    /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-    Token *toAdd = new Token(tokenInfo[TERMINAL_TOKEN], terminalBuffer, lineNumber);
-    if (!tokenQueue.Add(toAdd)) {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-    }
+    AddToQueue(tokenInfo[TERMINAL_TOKEN], terminalBuffer);
 }
 
 /*lint -e{429} . Justification: the allocated memory is freed by the class destructor. */
@@ -472,8 +484,8 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
     bool ok = true;
     bool isEOF = false;
 
-    StreamString separatorsUsed = separators.Buffer();
-    StreamString terminalsUsed = terminals.Buffer();
+    const char8 *separatorsUsed = separators.Buffer();
+    const char8 *terminalsUsed = terminals.Buffer();
 
     while (tokenQueue.GetSize() < (level + 1u)) {
         char8 c = '\0';
@@ -509,12 +521,12 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         while (ok) {
 
             //std::cout << tokenString.Buffer() << "\n";
-            if ((StringHelper::SearchChar(separatorsUsed.Buffer(), c) != NULL) && (!escape)) {
+            if ((StringHelper::SearchChar(separatorsUsed, c) != NULL) && (!escape)) {
                 // this means that a string is found! Read everything until another " is found
                 if (isString1) {
                     tokenString += c;
-                    separatorsUsed = separators;
-                    terminalsUsed = terminals;
+                    separatorsUsed = separators.Buffer();
+                    terminalsUsed = terminals.Buffer();
                     ok = false;
                 }
                 else {
@@ -523,7 +535,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
                 }
                 separator = c;
             }
-            else if ((StringHelper::SearchChar(terminalsUsed.Buffer(), c) != NULL) && (!escape)) {
+            else if ((StringHelper::SearchChar(terminalsUsed, c) != NULL) && (!escape)) {
                 terminal = c;
                 if(bufferSize>0u) {
                     AddToken(tokenString.BufferReference(), isString1);
@@ -650,11 +662,7 @@ void LexicalAnalyzer::TokenizeInput(const uint32 level) {
         }
 
         if (isEOF) {
-            /*lint -e{423} .Justification: The pointer is added to a stack and the memory is freed by the class destructor */
-            Token *toAdd = new Token(tokenInfo[EOF_TOKEN], "", lineNumber);
-            if (!tokenQueue.Add(toAdd)) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "StaticList<Token *>: Failed Add() of the token to the token stack");
-            }
+            AddToQueue(tokenInfo[EOF_TOKEN], "");
         }
 
         // if a newline is the separator add it for the next token
@@ -157,12 +157,24 @@ private:
      * @param[in] terminalBuffer is the terminal data.
      */
     void AddTerminal(const char8* const terminalBuffer);
+
+    /**
+     * @brief Gets a token from the list of consumed tokens (or allocates a new one if the list is empty) and adds it to the internal queue.
+     * @param[in] info is the token type.
+     * @param[in] data is the token data.
+     */
+    void AddToQueue(const TokenInfo &info, const char8 * const data);
     
     /**
      * Internal token queue
      */
     StaticList<Token *> tokenQueue;
 
+    /**
+     * Tokens already consumed by GetToken, which are reused by AddToQueue so that no memory is allocated for each token.
+     */
+    StaticList<Token *> consumedTokens;
+
     /**
      * Separator characters
      */
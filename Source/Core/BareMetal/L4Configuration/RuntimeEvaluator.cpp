@@ -29,6 +29,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "MemoryOperationsHelper.h"
 #include "RuntimeEvaluator.h"
 #include "RuntimeEvaluatorFunction.h"
 
@@ -52,6 +53,29 @@ const CCString castToken("CAST");
 const CCString remoteWriteToken("RWRITE");
 const CCString remoteReadToken("RREAD");
 
+/**
+ * Maps the size of a value to the offset of the threaded load/store operation that moves it.
+ */
+static bool ThreadedOperationOffset(const uint32 byteSize, uint32 &offset){
+    bool ok = true;
+    if (byteSize == 1u) {
+        offset = 0u;
+    }
+    else if (byteSize == 2u) {
+        offset = 1u;
+    }
+    else if (byteSize == 4u) {
+        offset = 2u;
+    }
+    else if (byteSize == 8u) {
+        offset = 3u;
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
 
 
 /**
@@ -125,6 +149,8 @@ RuntimeEvaluator::RuntimeEvaluator(StreamString RPNCodeIn){
     codeMemoryPtr = NULL_PTR(CodeMemoryElement*);
     stackPtr = NULL_PTR(DataMemoryElement*);
     startOfVariables = 0u;
+    threadedCodeSize = 0u;
+    numberOfSamples = 0u;
 }
 
 RuntimeEvaluator::~RuntimeEvaluator(){
@@ -958,9 +984,608 @@ ErrorManagement::ErrorType RuntimeEvaluator::Compile()
         }
     }
 
+    if (ret.ErrorsCleared()){
+        ret = CompileThreadedCode();
+    }
+
     return ret;
 }
 
+/*lint -e{946, 947, 9016} codeMemoryMaxPtr is calculated from pointers pointing to the same array */
+ErrorManagement::ErrorType RuntimeEvaluator::CompileThreadedCode(){
+
+    ErrorManagement::ErrorType ret;
+
+    const CodeMemoryElement *codePtr = codeMemory.GetAllocatedMemoryConst();
+    const CodeMemoryElement *codeMaxPtr = codePtr + codeMemory.GetSize();
+    DataMemoryElement *stackBasePtr = static_cast<DataMemoryElement*>(stack.GetDataPointer());
+
+    // each pCode produces at most one instruction. +1 for the end marker
+    threadedCode.SetSize(codeMemory.GetSize() + 1u);
+    ThreadedInstruction *instructions = threadedCode.GetDataPointer();
+    ret.fatalError = (instructions == NULL_PTR(ThreadedInstruction *));
+    threadedCodeSize = 0u;
+
+    // byte size of the value loaded by the previous instruction if it is a (folded) constant, 0 otherwise
+    uint32 constantByteSize = 0u;
+
+    bool noErrors = ret.ErrorsCleared();
+    while ((codePtr < codeMaxPtr) && noErrors){
+        CodeMemoryElement pCode = *codePtr;
+        RuntimeEvaluatorFunction &fr = functionRecords[pCode];
+        codePtr++;
+        StreamString fName = fr.GetName();
+
+        bool isRead   = ((fName == readToken)  || (fName == remoteReadToken));
+        bool isWrite  = ((fName == writeToken) || (fName == remoteWriteToken));
+        bool isRemote = ((fName == remoteReadToken) || (fName == remoteWriteToken));
+        bool folded   = false;
+
+        // try to fold CONST + CAST into a single constant
+        if ((fName == castToken) && (constantByteSize > 0u)){
+            ThreadedInstruction &previous = instructions[threadedCodeSize - 1u];
+            Vector<TypeDescriptor> outputTypes = fr.GetOutputTypes();
+            uint32 outputByteSize = static_cast<uint32>(outputTypes[0u].numberOfBits) / 8u;
+            uint32 offset = 0u;
+
+            // execute the cast on the (still unused) stack
+            stackPtr = stackBasePtr;
+            ret.fatalError = !MemoryOperationsHelper::Copy(stackPtr, &previous.constant, constantByteSize);
+            stackPtr += ByteSizeToDataMemorySize(static_cast<uint16>(constantByteSize));
+            runtimeError = ErrorManagement::ErrorType(true);
+            fr.ExecuteFunction(*this);
+            stackPtr -= ByteSizeToDataMemorySize(static_cast<uint16>(outputByteSize));
+
+            // a cast that fails is left to runtime so that the error is reported by Execute()
+            folded = ((runtimeError.ErrorsCleared()) && (stackPtr == stackBasePtr) && (ret.ErrorsCleared()));
+            if (folded){
+                folded = ThreadedOperationOffset(outputByteSize, offset);
+            }
+            if (folded){
+                previous.constant = 0u;
+                ret.fatalError = !MemoryOperationsHelper::Copy(&previous.constant, stackPtr, outputByteSize);
+                previous.operation = static_cast<uint32>(threadedLoad8) + offset;
+                constantByteSize = outputByteSize;
+            }
+            stackPtr = stackBasePtr;
+        }
+
+        if (!folded){
+            ThreadedInstruction &instruction = instructions[threadedCodeSize];
+            instruction.operation = threadedCall;
+            instruction.function = fr.GetFunction();
+            instruction.parameters = codePtr;
+            instruction.address = NULL_PTR(void *);
+            instruction.pCode = pCode;
+            instruction.location = MAXDataMemoryAddress;
+            instruction.constant = 0u;
+            instruction.isConstant = false;
+            constantByteSize = 0u;
+
+            if (isRead || isWrite){
+                DataMemoryAddress location = *codePtr;
+                codePtr++;
+                instruction.location = location;
+
+                TypeDescriptor stackType;
+                if (isRead){
+                    Vector<TypeDescriptor> outputTypes = fr.GetOutputTypes();
+                    stackType = outputTypes[0u];
+                }
+                else {
+                    Vector<TypeDescriptor> inputTypes = fr.GetInputTypes();
+                    stackType = inputTypes[0u];
+                }
+                uint32 byteSize = static_cast<uint32>(stackType.numberOfBits) / 8u;
+                uint32 offset = 0u;
+
+                // writes that convert the value are left to their function
+                bool direct = isRead;
+                if (isWrite){
+                    VariableInformation *variableInformation = NULL_PTR(VariableInformation *);
+                    if (FindVariable(location, variableInformation).ErrorsCleared()){
+                        direct = (variableInformation->type == stackType);
+                    }
+                }
+
+                if (direct){
+                    direct = ThreadedOperationOffset(byteSize, offset);
+                }
+                if (direct){
+                    if (isRemote){
+                        instruction.address = Variable<void *>(location);
+                    }
+                    else {
+                        instruction.address = &variablesMemoryPtr[location];
+                    }
+                    if (isRead){
+                        instruction.operation = static_cast<uint32>(threadedLoad8) + offset;
+                        // constants are copied into the instruction so that they can be folded
+                        if ((!isRemote) && (location < startOfVariables)){
+                            ret.fatalError = !MemoryOperationsHelper::Copy(&instruction.constant, instruction.address, byteSize);
+                            instruction.isConstant = true;
+                            constantByteSize = byteSize;
+                        }
+                    }
+                    else {
+                        instruction.operation = static_cast<uint32>(threadedStore8) + offset;
+                    }
+                }
+            }
+            threadedCodeSize++;
+        }
+        noErrors = ret.ErrorsCleared();
+    }
+
+    if (ret.ErrorsCleared()){
+        instructions[threadedCodeSize].operation = threadedEnd;
+        instructions[threadedCodeSize].function = NULL_PTR(void (*)(RuntimeEvaluator &));
+        instructions[threadedCodeSize].parameters = codeMaxPtr;
+        instructions[threadedCodeSize].address = NULL_PTR(void *);
+        instructions[threadedCodeSize].pCode = 0u;
+        instructions[threadedCodeSize].location = MAXDataMemoryAddress;
+        instructions[threadedCodeSize].constant = 0u;
+        instructions[threadedCodeSize].isConstant = false;
+
+        // the constants are read directly from the instruction
+        for (uint32 i = 0u; i < threadedCodeSize; i++){
+            if (instructions[i].isConstant){
+                instructions[i].address = &instructions[i].constant;
+            }
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ret, "Failed to generate the threaded code");
+        threadedCodeSize = 0u;
+    }
+
+    stackPtr = stackBasePtr;
+    runtimeError = ErrorManagement::ErrorType(true);
+
+    return ret;
+}
+
+uint32 RuntimeEvaluator::GetThreadedCodeSize() const {
+    return threadedCodeSize;
+}
+
+ErrorManagement::ErrorType RuntimeEvaluator::CompileBatch(const uint32 numberOfSamplesIn){
+    ErrorManagement::ErrorType ret;
+
+    ret.parametersError = (numberOfSamplesIn == 0u);
+    if (!ret.ErrorsCleared()){
+        REPORT_ERROR_STATIC(ret, "The number of samples shall be greater than zero");
+    }
+    if (ret.ErrorsCleared()){
+        ret.internalSetupError = (threadedCode.GetNumberOfElements() == 0u);
+        if (!ret.ErrorsCleared()){
+            REPORT_ERROR_STATIC(ret, "Batch code not available: Compile() shall be called first");
+        }
+    }
+    if (ret.ErrorsCleared()){
+        numberOfSamples = numberOfSamplesIn;
+        batchCode.Clean();
+        batchStack.SetSize(stack.GetNumberOfElements() * numberOfSamples);
+        batchOutputs.SetSize(stack.GetNumberOfElements() * numberOfSamples);
+        batchVariables.SetSize(dataMemory.GetNumberOfElements() * numberOfSamples);
+        variablesMemoryPtr = static_cast<DataMemoryElement *>(dataMemory.GetDataPointer());
+    }
+
+    DataMemoryAddress stackSize = 0u;
+    ThreadedInstruction *instructions = threadedCode.GetDataPointer();
+    bool noErrors = ret.ErrorsCleared();
+    for (uint32 i = 0u; (i < threadedCodeSize) && (noErrors); i++){
+        ThreadedInstruction &instruction = instructions[i];
+        if (instruction.operation == static_cast<uint32>(threadedCall)){
+            RuntimeEvaluatorFunction &fr = functionRecords[instruction.pCode];
+            StreamString fName = fr.GetName();
+            if ((fName == writeToken) || (fName == remoteWriteToken)){
+                // a WRITE that converts the value is split in CAST + WRITE
+                DataMemoryAddress location = *instruction.parameters;
+                VariableInformation *variableInformation = NULL_PTR(VariableInformation *);
+                ret = FindVariable(location, variableInformation);
+                StaticStack<TypeDescriptor,32u> typeStack;
+                CodeMemoryElement castCode = 0u;
+                if (ret.ErrorsCleared()){
+                    Vector<TypeDescriptor> inputTypes = fr.GetInputTypes();
+                    DataMemoryAddress castStackSize = 0u;
+                    ret.fatalError = !typeStack.Push(inputTypes[0u]);
+                    if (ret.ErrorsCleared()){
+                        ret.fatalError = !typeStack.Push(variableInformation->type);
+                    }
+                    if (ret.ErrorsCleared()){
+                        ret.unsupportedFeature = !FindPCodeAndUpdateTypeStack(castCode, castToken, typeStack, true, castStackSize);
+                    }
+                }
+                if (ret.ErrorsCleared()){
+                    ret = AddBatchFunction(functionRecords[castCode], stackSize);
+                }
+                if (ret.ErrorsCleared()){
+                    ret = AddBatchLoadStore(false, location, static_cast<uint32>(variableInformation->type.numberOfBits) / 8u, NULL_PTR(void *), stackSize);
+                }
+            }
+            else {
+                ret.unsupportedFeature = ((fName == readToken) || (fName == remoteReadToken));
+                if (ret.ErrorsCleared()){
+                    ret = AddBatchFunction(fr, stackSize);
+                }
+            }
+        }
+        else {
+            // load and store operations are sorted by size
+            bool isLoad = (instruction.operation < static_cast<uint32>(threadedStore8));
+            uint32 firstOperation = isLoad ? static_cast<uint32>(threadedLoad8) : static_cast<uint32>(threadedStore8);
+            uint32 byteSize = (1u << (instruction.operation - firstOperation));
+            void *constantAddress = NULL_PTR(void *);
+            if (instruction.isConstant){
+                constantAddress = &instruction.constant;
+            }
+            ret = AddBatchLoadStore(isLoad, instruction.location, byteSize, constantAddress, stackSize);
+        }
+        noErrors = ret.ErrorsCleared();
+    }
+
+    if (!ret.ErrorsCleared()){
+        REPORT_ERROR_STATIC(ret, "Failed to generate the batch code");
+        numberOfSamples = 0u;
+        batchCode.Clean();
+    }
+
+    return ret;
+}
+
+ErrorManagement::ErrorType RuntimeEvaluator::AddBatchFunction(RuntimeEvaluatorFunction &functionRecord, DataMemoryAddress &stackSize){
+    ErrorManagement::ErrorType ret;
+
+    Vector<TypeDescriptor> inputTypes = functionRecord.GetInputTypes();
+    Vector<TypeDescriptor> outputTypes = functionRecord.GetOutputTypes();
+
+    BatchInstruction instruction;
+    instruction.operation = static_cast<uint32>(batchCall);
+    instruction.function = functionRecord.GetFunction();
+    instruction.vectorFunction = NULL_PTR(VectorFunction);
+    instruction.address = NULL_PTR(uint8 *);
+    instruction.byteSize = 0u;
+    instruction.numberOfInputs = inputTypes.GetNumberOfElements();
+    instruction.numberOfOutputs = outputTypes.GetNumberOfElements();
+    instruction.inputsSize = 0u;
+    instruction.outputsSize = 0u;
+
+    ret.unsupportedFeature = ((instruction.numberOfInputs > maxBatchOperands) || (instruction.numberOfOutputs > maxBatchOperands));
+    if (!ret.ErrorsCleared()){
+        REPORT_ERROR_STATIC(ret, "Function %s has too many operands for batch execution", functionRecord.GetName().Buffer());
+    }
+
+    if (ret.ErrorsCleared()){
+        // the first input is the top of the stack
+        for (uint32 j = 0u; j < instruction.numberOfInputs; j++){
+            instruction.inputSizes[j] = static_cast<uint32>(inputTypes[j].numberOfBits) / 8u;
+            instruction.inputsSize += ByteSizeToDataMemorySize(static_cast<uint16>(instruction.inputSizes[j]));
+        }
+        instruction.stackOffset = stackSize - instruction.inputsSize;
+        DataMemoryAddress position = instruction.inputsSize;
+        for (uint32 j = 0u; j < instruction.numberOfInputs; j++){
+            position -= ByteSizeToDataMemorySize(static_cast<uint16>(instruction.inputSizes[j]));
+            instruction.inputOffsets[j] = position;
+        }
+        // the outputs are pushed in order
+        for (uint32 k = 0u; k < instruction.numberOfOutputs; k++){
+            instruction.outputSizes[k] = static_cast<uint32>(outputTypes[k].numberOfBits) / 8u;
+            instruction.outputOffsets[k] = instruction.outputsSize;
+            instruction.outputsSize += ByteSizeToDataMemorySize(static_cast<uint16>(instruction.outputSizes[k]));
+        }
+        stackSize = instruction.stackOffset + instruction.outputsSize;
+
+        VectorFunction vectorFunction = GetVectorFunction(instruction.function);
+        if ((vectorFunction != NULL_PTR(VectorFunction)) && (instruction.numberOfInputs == 2u) && (instruction.numberOfOutputs == 1u)){
+            instruction.operation = static_cast<uint32>(batchVector);
+            instruction.vectorFunction = vectorFunction;
+        }
+
+        ret.fatalError = !batchCode.Add(instruction);
+    }
+
+    return ret;
+}
+
+ErrorManagement::ErrorType RuntimeEvaluator::AddBatchLoadStore(const bool isLoad, const DataMemoryAddress location, const uint32 byteSize, void * const constantAddress, DataMemoryAddress &stackSize){
+    ErrorManagement::ErrorType ret;
+
+    BatchInstruction instruction;
+    instruction.function = NULL_PTR(void (*)(RuntimeEvaluator &));
+    instruction.vectorFunction = NULL_PTR(VectorFunction);
+    instruction.byteSize = byteSize;
+    instruction.numberOfInputs = 0u;
+    instruction.numberOfOutputs = 0u;
+    instruction.inputsSize = 0u;
+    instruction.outputsSize = 0u;
+    if (isLoad){
+        instruction.stackOffset = stackSize;
+        stackSize += ByteSizeToDataMemorySize(static_cast<uint16>(byteSize));
+    }
+    else {
+        stackSize -= ByteSizeToDataMemorySize(static_cast<uint16>(byteSize));
+        instruction.stackOffset = stackSize;
+    }
+
+    if (constantAddress != NULL_PTR(void *)){
+        instruction.operation = static_cast<uint32>(batchBroadcast);
+        instruction.address = static_cast<uint8 *>(constantAddress);
+    }
+    else {
+        VariableInformation *variableInformation = NULL_PTR(VariableInformation *);
+        ret = FindVariable(location, variableInformation);
+        bool isOutput = false;
+        if (ret.ErrorsCleared()){
+            VariableInformation *output = NULL_PTR(VariableInformation *);
+            for (uint32 index = 0u; (!isOutput) && (BrowseOutputVariable(index, output).ErrorsCleared()); index++){
+                isOutput = (output == variableInformation);
+            }
+        }
+        if (ret.ErrorsCleared()){
+            instruction.operation = isLoad ? static_cast<uint32>(batchLoad) : static_cast<uint32>(batchStore);
+            if (variableInformation->externalLocation != NULL){
+                instruction.address = static_cast<uint8 *>(variableInformation->externalLocation);
+            }
+            else if (isOutput){
+                instruction.address = reinterpret_cast<uint8 *>(&(batchVariables.GetDataPointer()[location * numberOfSamples]));
+            }
+            else {
+                // internal inputs hold one value for all the samples
+                instruction.operation = static_cast<uint32>(batchBroadcast);
+                instruction.address = reinterpret_cast<uint8 *>(&variablesMemoryPtr[location]);
+                ret.internalSetupError = !isLoad;
+            }
+        }
+    }
+
+    if (ret.ErrorsCleared()){
+        ret.fatalError = !batchCode.Add(instruction);
+    }
+
+    return ret;
+}
+
+/**
+ * Copies one sample of a stack value.
+ */
+static inline void CopySample(void * const destination, const void * const source, const uint32 byteSize){
+    if (byteSize == 8u) {
+        *static_cast<uint64 *>(destination) = *static_cast<const uint64 *>(source);
+    }
+    else if (byteSize == 4u) {
+        *static_cast<uint32 *>(destination) = *static_cast<const uint32 *>(source);
+    }
+    else if (byteSize == 2u) {
+        *static_cast<uint16 *>(destination) = *static_cast<const uint16 *>(source);
+    }
+    else {
+        *static_cast<uint8 *>(destination) = *static_cast<const uint8 *>(source);
+    }
+}
+
+/**
+ * Copies the same value to all the samples.
+ */
+template<typename T>
+static void BroadcastSample(void * const destination, const void * const source, const uint32 numberOfSamples){
+    T *samples = static_cast<T *>(destination);
+    const T value = *static_cast<const T *>(source);
+    for (uint32 i = 0u; i < numberOfSamples; i++) {
+        samples[i] = value;
+    }
+}
+
+ErrorManagement::ErrorType RuntimeEvaluator::ExecuteBatchFunction(const BatchInstruction &instruction){
+    ErrorManagement::ErrorType error;
+
+    const uint32 rowSize = numberOfSamples * static_cast<uint32>(sizeof(DataMemoryElement));
+    uint8 *stackValues = &(reinterpret_cast<uint8 *>(batchStack.GetDataPointer())[instruction.stackOffset * rowSize]);
+    uint8 *outputValues = reinterpret_cast<uint8 *>(batchOutputs.GetDataPointer());
+    DataMemoryElement *scalarStack = static_cast<DataMemoryElement*>(stack.GetDataPointer());
+
+    for (uint32 i = 0u; i < numberOfSamples; i++){
+        for (uint32 j = 0u; j < instruction.numberOfInputs; j++){
+            CopySample(&scalarStack[instruction.inputOffsets[j]], &stackValues[(instruction.inputOffsets[j] * rowSize) + (i * instruction.inputSizes[j])], instruction.inputSizes[j]);
+        }
+        stackPtr = &scalarStack[instruction.inputsSize];
+        // each sample is executed with no previous error
+        runtimeError = ErrorManagement::ErrorType(true);
+        instruction.function(*this);
+        error = (static_cast<ErrorManagement::ErrorIntegerFormat>(error) | static_cast<ErrorManagement::ErrorIntegerFormat>(runtimeError));
+        // the outputs cannot be written to the stack yet as they could overwrite inputs of the next samples
+        for (uint32 k = 0u; k < instruction.numberOfOutputs; k++){
+            CopySample(&outputValues[(instruction.outputOffsets[k] * rowSize) + (i * instruction.outputSizes[k])], &scalarStack[instruction.outputOffsets[k]], instruction.outputSizes[k]);
+        }
+    }
+    stackPtr = scalarStack;
+
+    if (instruction.outputsSize > 0u){
+        if (!MemoryOperationsHelper::Copy(stackValues, outputValues, instruction.outputsSize * rowSize)){
+            error.fatalError = true;
+        }
+    }
+
+    return error;
+}
+
+ErrorManagement::ErrorType RuntimeEvaluator::ExecuteBatch(){
+    ErrorManagement::ErrorType batchError;
+
+    batchError.internalSetupError = (numberOfSamples == 0u);
+    if (!batchError.ErrorsCleared()){
+        REPORT_ERROR_STATIC(batchError, "Batch code not available: CompileBatch() shall be called first");
+    }
+    else {
+        const uint32 rowSize = numberOfSamples * static_cast<uint32>(sizeof(DataMemoryElement));
+        uint8 *stackValues = reinterpret_cast<uint8 *>(batchStack.GetDataPointer());
+        const BatchInstruction *instructions = batchCode.GetAllocatedMemoryConst();
+        const uint32 numberOfInstructions = batchCode.GetSize();
+
+        for (uint32 i = 0u; i < numberOfInstructions; i++){
+            const BatchInstruction &instruction = instructions[i];
+            uint8 *value = &stackValues[instruction.stackOffset * rowSize];
+            switch (instruction.operation){
+            case batchLoad:{
+                if (!MemoryOperationsHelper::Copy(value, instruction.address, instruction.byteSize * numberOfSamples)){
+                    batchError.fatalError = true;
+                }
+            }break;
+            case batchStore:{
+                if (!MemoryOperationsHelper::Copy(instruction.address, value, instruction.byteSize * numberOfSamples)){
+                    batchError.fatalError = true;
+                }
+            }break;
+            case batchBroadcast:{
+                if (instruction.byteSize == 8u){
+                    BroadcastSample<uint64>(value, instruction.address, numberOfSamples);
+                }
+                else if (instruction.byteSize == 4u){
+                    BroadcastSample<uint32>(value, instruction.address, numberOfSamples);
+                }
+                else if (instruction.byteSize == 2u){
+                    BroadcastSample<uint16>(value, instruction.address, numberOfSamples);
+                }
+                else {
+                    BroadcastSample<uint8>(value, instruction.address, numberOfSamples);
+                }
+            }break;
+            case batchVector:{
+                runtimeError = ErrorManagement::ErrorType(true);
+                instruction.vectorFunction(*this, &value[instruction.outputOffsets[0u] * rowSize], &value[instruction.inputOffsets[0u] * rowSize], &value[instruction.inputOffsets[1u] * rowSize], numberOfSamples);
+                batchError = (static_cast<ErrorManagement::ErrorIntegerFormat>(batchError) | static_cast<ErrorManagement::ErrorIntegerFormat>(runtimeError));
+            }break;
+            default:{
+                ErrorManagement::ErrorType functionError = ExecuteBatchFunction(instruction);
+                batchError = (static_cast<ErrorManagement::ErrorIntegerFormat>(batchError) | static_cast<ErrorManagement::ErrorIntegerFormat>(functionError));
+            }
+            }
+        }
+        if (!batchError.ErrorsCleared()){
+            REPORT_ERROR_STATIC(batchError, "Batch execution error");
+        }
+    }
+    runtimeError = batchError;
+
+    return batchError;
+}
+
+uint32 RuntimeEvaluator::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+uint32 RuntimeEvaluator::GetNumberOfVectorInstructions() const {
+    uint32 count = 0u;
+    const BatchInstruction *instructions = batchCode.GetAllocatedMemoryConst();
+    for (uint32 i = 0u; i < batchCode.GetSize(); i++){
+        if (instructions[i].operation == static_cast<uint32>(batchVector)){
+            count++;
+        }
+    }
+    return count;
+}
+
+/*lint -e{9016} the instruction pointer never goes beyond the threadedEnd instruction */
+void RuntimeEvaluator::ExecuteThreadedCode(){
+    const ThreadedInstruction *instruction = threadedCode.GetDataPointer();
+#if defined(__GNUC__)
+    // direct threading: each instruction jumps straight to the code of the next one
+    static const void * const dispatchTable[] = {
+        &&labelCall,
+        &&labelLoad8,
+        &&labelLoad16,
+        &&labelLoad32,
+        &&labelLoad64,
+        &&labelStore8,
+        &&labelStore16,
+        &&labelStore32,
+        &&labelStore64,
+        &&labelEnd
+    };
+#define RUNTIME_EVALUATOR_DISPATCH() goto *dispatchTable[instruction->operation]
+    RUNTIME_EVALUATOR_DISPATCH();
+labelCall:
+    codeMemoryPtr = instruction->parameters;
+    instruction->function(*this);
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelLoad8:
+    Push(*static_cast<uint8 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelLoad16:
+    Push(*static_cast<uint16 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelLoad32:
+    Push(*static_cast<uint32 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelLoad64:
+    Push(*static_cast<uint64 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelStore8:
+    Pop(*static_cast<uint8 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelStore16:
+    Pop(*static_cast<uint16 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelStore32:
+    Pop(*static_cast<uint32 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelStore64:
+    Pop(*static_cast<uint64 *>(instruction->address));
+    instruction++;
+    RUNTIME_EVALUATOR_DISPATCH();
+labelEnd:
+    codeMemoryPtr = instruction->parameters;
+#undef RUNTIME_EVALUATOR_DISPATCH
+#else
+    bool running = true;
+    while (running) {
+        switch (instruction->operation) {
+        case threadedCall:
+            codeMemoryPtr = instruction->parameters;
+            instruction->function(*this);
+            break;
+        case threadedLoad8:
+            Push(*static_cast<uint8 *>(instruction->address));
+            break;
+        case threadedLoad16:
+            Push(*static_cast<uint16 *>(instruction->address));
+            break;
+        case threadedLoad32:
+            Push(*static_cast<uint32 *>(instruction->address));
+            break;
+        case threadedLoad64:
+            Push(*static_cast<uint64 *>(instruction->address));
+            break;
+        case threadedStore8:
+            Pop(*static_cast<uint8 *>(instruction->address));
+            break;
+        case threadedStore16:
+            Pop(*static_cast<uint16 *>(instruction->address));
+            break;
+        case threadedStore32:
+            Pop(*static_cast<uint32 *>(instruction->address));
+            break;
+        case threadedStore64:
+            Pop(*static_cast<uint64 *>(instruction->address));
+            break;
+        default:
+            codeMemoryPtr = instruction->parameters;
+            running = false;
+            break;
+        }
+        instruction++;
+    }
+#endif
+}
+
 ErrorManagement::ErrorType RuntimeEvaluator::FunctionRecordInputs2String(RuntimeEvaluatorFunction &functionInformation,StreamString &cst,const bool peekOnly,const bool showData,const bool showTypes){
     ErrorManagement::ErrorType ret;
 
@@ -1170,6 +1795,15 @@ ErrorManagement::ErrorType RuntimeEvaluator::Execute(const executionMode mode, S
             REPORT_ERROR_STATIC(runtimeError, "Code execution interrupted");
         }
     }break;
+    case threadedMode:{
+        runtimeError.internalSetupError = (threadedCode.GetNumberOfElements() == 0u);
+        if (runtimeError.ErrorsCleared()){
+            ExecuteThreadedCode();
+        }
+        else {
+            REPORT_ERROR_STATIC(runtimeError, "Threaded code not available: Compile() shall be called first");
+        }
+    }break;
     case debugMode:
     default:{
         if (debugStream == NULL_PTR(StreamI *)){
@@ -320,6 +320,48 @@ class RuntimeEvaluatorFunction;
  * Pop(), Push() and Peek() methods. See RuntimeEvaluatorFunction
  * documentation for further details.
  * 
+ * Threaded execution
+ * ------------------
+ * 
+ * After a successful compilation Compile() also lowers the pseudocode
+ * into an array of threaded instructions which is executed by calling
+ * Execute(RuntimeEvaluator::threadedMode):
+ * 
+ * - the function of each pseudocode is resolved once, so that the
+ *   #functionRecords lookup is no longer needed at runtime;
+ * - `READ` and `WRITE` (with no type conversion) of local, remote and
+ *   constant variables are executed directly by the interpreter loop,
+ *   with the variable address already resolved;
+ * - sequences of `CONST` followed by one or more `CAST` are folded
+ *   into a single constant load (unless the cast raises an error, in
+ *   which case the `CAST` is left to be executed at runtime);
+ * - where supported by the compiler (GCC and clang) the instructions
+ *   are dispatched with computed gotos, otherwise with a switch.
+ * 
+ * The threaded code produces exactly the same results as fastMode.
+ * 
+ * Batch execution
+ * ---------------
+ * 
+ * When the variables carry N samples per cycle, the expression can be
+ * evaluated for all the samples with a single call to ExecuteBatch(),
+ * after preparing it with CompileBatch(N):
+ * 
+ * - variables with an external memory location (see SetInputVariableMemory()
+ *   and SetOutputVariableMemory()) are arrays of N samples;
+ * - input variables with no external location and constants hold a single
+ *   value that is used for all the samples;
+ * - output variables with no external location are arrays of N samples
+ *   that are internally allocated (they are meant to hold intermediate results).
+ * 
+ * Each instruction is dispatched once per call and applied to all the samples:
+ * `READ` and `WRITE` are array copies, ADD, SUB, MUL and DIV on float32 and
+ * float64 and ADD, SUB and MUL on int32 are executed by loops that the
+ * compiler can vectorise (see GetVectorFunction()) and all the other functions
+ * are called once per sample.
+ * The error returned by ExecuteBatch() is the combination of the errors raised
+ * by all the samples.
+ * 
  * Supported operators
  * -------------------
  * 
@@ -613,7 +655,12 @@ public:
         /**
          * Produces a step by step evolution of the stack following each function execution
          */
-        debugMode
+        debugMode,
+
+        /**
+         * Executes the threaded code produced by Compile() with minimal checks (same as fastMode)
+         */
+        threadedMode
     };
 
     /**
@@ -631,6 +678,45 @@ public:
      * @brief Reconstruct the RPNCode with type information
      */
     ErrorManagement::ErrorType DeCompile(StreamString &DeCompileRPNCode, const bool showTypes);
+
+    /**
+     * @brief   Gets the number of instructions of the threaded code.
+     * @details Each constant that is folded with the casts that follow it
+     *          saves one instruction per cast.
+     * @returns the number of threaded instructions (not including the end marker).
+     * @pre     Compile() == true
+     */
+    uint32 GetThreadedCodeSize() const;
+
+    /**
+     * @brief   Prepares the expression to be executed over arrays of samples.
+     * @details Lowers the threaded code into batch instructions and allocates
+     *          the stack and the internal output variables for all the samples.
+     * @param[in] numberOfSamplesIn number of samples of each array variable.
+     * @returns ErrorManagement::NoError if the batch code could be generated.
+     * @pre     Compile() == true && numberOfSamplesIn > 0
+     */
+    ErrorManagement::ErrorType CompileBatch(const uint32 numberOfSamplesIn);
+
+    /**
+     * @brief   Executes the expression on all the samples.
+     * @returns the combination of error flags reported by all the samples.
+     * @pre     CompileBatch() == true
+     */
+    ErrorManagement::ErrorType ExecuteBatch();
+
+    /**
+     * @brief   Gets the number of samples set with CompileBatch().
+     * @returns the number of samples (0 if CompileBatch() was not called).
+     */
+    uint32 GetNumberOfSamples() const;
+
+    /**
+     * @brief   Gets the number of batch instructions that are executed by a VectorFunction.
+     * @returns the number of vectorised instructions.
+     * @pre     CompileBatch() == true
+     */
+    uint32 GetNumberOfVectorInstructions() const;
     
     /**
      * @name    Members required by RuntimeEvaluatorFunction
@@ -704,6 +790,235 @@ private:
      *        or how many MemoryElement are used for constants
      */
     DataMemoryAddress                  startOfVariables;
+
+    /**
+     * @brief Operations of the threaded code.
+     * @details The load and store operations are sorted by size so that
+     *          the operation can be computed from the base operation.
+     */
+    enum ThreadedOperation {
+        threadedCall = 0,
+        threadedLoad8,
+        threadedLoad16,
+        threadedLoad32,
+        threadedLoad64,
+        threadedStore8,
+        threadedStore16,
+        threadedStore32,
+        threadedStore64,
+        threadedEnd
+    };
+
+    /**
+     * @brief One instruction of the threaded code.
+     */
+    struct ThreadedInstruction {
+        /**
+         * One of ThreadedOperation.
+         */
+        uint32 operation;
+
+        /**
+         * The function to call (threadedCall only).
+         */
+        void (*function)(RuntimeEvaluator &context);
+
+        /**
+         * The position of the pseudocode that follows the function
+         * code (threadedCall only). Allows the called function to
+         * consume its own parameters with GetPseudoCode().
+         */
+        const CodeMemoryElement *parameters;
+
+        /**
+         * The address of the variable to load or to store.
+         */
+        void *address;
+
+        /**
+         * The pseudocode of the function that was lowered into this instruction.
+         */
+        CodeMemoryElement pCode;
+
+        /**
+         * The variable location (load/store only).
+         */
+        DataMemoryAddress location;
+
+        /**
+         * Holds the (folded) value of a constant.
+         */
+        uint64 constant;
+
+        /**
+         * True if address shall point at constant.
+         */
+        bool isConstant;
+    };
+
+    /**
+     * @brief   Lowers codeMemory into threadedCode.
+     * @details Resolves the functions and the variable addresses and folds
+     *          the CAST of constants.
+     * @pre     codeMemory, dataMemory and stack were successfully allocated by Compile().
+     */
+    ErrorManagement::ErrorType CompileThreadedCode();
+
+    /**
+     * @brief Executes threadedCode.
+     */
+    void ExecuteThreadedCode();
+
+    /**
+     * @brief The threaded code (always terminated by a threadedEnd instruction).
+     */
+    Vector<ThreadedInstruction>        threadedCode;
+
+    /**
+     * @brief Number of valid instructions in threadedCode.
+     */
+    uint32                             threadedCodeSize;
+
+    /**
+     * @brief Operations of the batch code.
+     */
+    enum BatchOperation {
+        batchCall = 0,
+        batchVector,
+        batchLoad,
+        batchBroadcast,
+        batchStore
+    };
+
+    /**
+     * @brief Maximum number of stack inputs or outputs of a function called in batch mode.
+     */
+    static const uint32 maxBatchOperands = 4u;
+
+    /**
+     * @brief   One instruction of the batch code.
+     * @details In the batch stack each value is stored as an array of
+     *          numberOfSamples elements, starting at the position of the
+     *          value in the scalar stack multiplied by numberOfSamples.
+     */
+    struct BatchInstruction {
+        /**
+         * One of BatchOperation.
+         */
+        uint32 operation;
+
+        /**
+         * The function to call once per sample (batchCall).
+         */
+        void (*function)(RuntimeEvaluator &context);
+
+        /**
+         * The function to call once for all the samples (batchVector).
+         */
+        void (*vectorFunction)(RuntimeEvaluator &context, void * const result, const void * const x1, const void * const x2, const uint32 numberOfSamples);
+
+        /**
+         * The address of the variable (batchLoad, batchBroadcast and batchStore).
+         */
+        uint8 *address;
+
+        /**
+         * The size in bytes of the variable (batchLoad, batchBroadcast and batchStore).
+         */
+        uint32 byteSize;
+
+        /**
+         * Position (in the scalar stack) of the variable or of the first function input.
+         */
+        DataMemoryAddress stackOffset;
+
+        /**
+         * Number of stack inputs.
+         */
+        uint32 numberOfInputs;
+
+        /**
+         * Number of stack outputs.
+         */
+        uint32 numberOfOutputs;
+
+        /**
+         * Position of each input, relative to stackOffset.
+         */
+        DataMemoryAddress inputOffsets[maxBatchOperands];
+
+        /**
+         * Size in bytes of each input.
+         */
+        uint32 inputSizes[maxBatchOperands];
+
+        /**
+         * Number of stack elements used by the inputs.
+         */
+        DataMemoryAddress inputsSize;
+
+        /**
+         * Position of each output, relative to stackOffset.
+         */
+        DataMemoryAddress outputOffsets[maxBatchOperands];
+
+        /**
+         * Size in bytes of each output.
+         */
+        uint32 outputSizes[maxBatchOperands];
+
+        /**
+         * Number of stack elements used by the outputs.
+         */
+        DataMemoryAddress outputsSize;
+    };
+
+    /**
+     * @brief   Adds a function (or its VectorFunction) to batchCode.
+     * @param[in,out] stackSize the simulated size of the scalar stack.
+     */
+    ErrorManagement::ErrorType AddBatchFunction(RuntimeEvaluatorFunction &functionRecord, DataMemoryAddress &stackSize);
+
+    /**
+     * @brief   Adds a load or a store of a variable to batchCode.
+     * @param[in] isLoad true for a load (READ), false for a store (WRITE).
+     * @param[in] location the location of the variable.
+     * @param[in] byteSize the size of the variable.
+     * @param[in] constantAddress the address of a constant, or NULL if the value is a variable.
+     * @param[in,out] stackSize the simulated size of the scalar stack.
+     */
+    ErrorManagement::ErrorType AddBatchLoadStore(const bool isLoad, const DataMemoryAddress location, const uint32 byteSize, void * const constantAddress, DataMemoryAddress &stackSize);
+
+    /**
+     * @brief Calls a function once per sample.
+     * @returns the combination of the errors raised by all the samples.
+     */
+    ErrorManagement::ErrorType ExecuteBatchFunction(const BatchInstruction &instruction);
+
+    /**
+     * @brief The batch code.
+     */
+    StaticList<BatchInstruction, 32u>  batchCode;
+
+    /**
+     * @brief Number of samples of the batch code.
+     */
+    uint32                             numberOfSamples;
+
+    /**
+     * @brief The batch stack (each stack element is replicated for each sample).
+     */
+    Vector<DataMemoryElement>          batchStack;
+
+    /**
+     * @brief Holds the function outputs before they are copied to the batchStack.
+     */
+    Vector<DataMemoryElement>          batchOutputs;
+
+    /**
+     * @brief The internal output variables (each dataMemory element is replicated for each sample).
+     */
+    Vector<DataMemoryElement>          batchVariables;
     
     /**
      * @brief Stack is allocated here.
@@ -1085,4 +1085,92 @@ REGISTER_WRITECONV(RWRITE,RWrite,int32 ,uint32)
 REGISTER_WRITECONV(RWRITE,RWrite,int32 ,int8)
 REGISTER_WRITECONV(RWRITE,RWrite,int32 ,int16)
 
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *
+ *                      Vector operators
+ *
+ *********************************************************************************************************
+ **********************************************************************************************************/
+
+/*lint -e{9025} the loops below are written to be auto-vectorised by the compiler */
+#define REGISTER_VECTOR_OPERATOR(oper,fname)                                                 \
+        template <typename T> void Vector ## fname (RuntimeEvaluator &context, void * const result, const void * const x1, const void * const x2, const uint32 numberOfSamples){ \
+            T *y = static_cast<T *>(result);                                                 \
+            const T *a = static_cast<const T *>(x2);                                         \
+            const T *b = static_cast<const T *>(x1);                                         \
+            for (uint32 i = 0u; i < numberOfSamples; i++) {                                  \
+                y[i] = static_cast<T>(a[i] oper b[i]);                                       \
+            }                                                                                \
+        }
+
+REGISTER_VECTOR_OPERATOR(+ ,Addition)
+REGISTER_VECTOR_OPERATOR(- ,Subtraction)
+REGISTER_VECTOR_OPERATOR(* ,Multiplication)
+REGISTER_VECTOR_OPERATOR(/ ,Division)
+
+/**
+ * int32 versions of the SafeMath operators: the result wraps around and
+ * Overflow/Underflow is raised if any of the samples does not fit in an int32.
+ */
+#define REGISTER_VECTOR_SAFE_OPERATOR(oper,fname)                                            \
+        void VectorSafe ## fname ## Int32 (RuntimeEvaluator &context, void * const result, const void * const x1, const void * const x2, const uint32 numberOfSamples){ \
+            int32 *y = static_cast<int32 *>(result);                                         \
+            const int32 *a = static_cast<const int32 *>(x2);                                 \
+            const int32 *b = static_cast<const int32 *>(x1);                                 \
+            const int64 maxValue = static_cast<int64>(TypeCharacteristics<int32>::MaxValue()); \
+            const int64 minValue = static_cast<int64>(TypeCharacteristics<int32>::MinValue()); \
+            uint32 overflow = 0u;                                                            \
+            uint32 underflow = 0u;                                                           \
+            for (uint32 i = 0u; i < numberOfSamples; i++) {                                  \
+                int64 r = static_cast<int64>(a[i]) oper static_cast<int64>(b[i]);            \
+                y[i] = static_cast<int32>(r);                                                \
+                overflow |= static_cast<uint32>(r > maxValue);                               \
+                underflow |= static_cast<uint32>(r < minValue);                              \
+            }                                                                                \
+            if (overflow != 0u) {                                                            \
+                context.runtimeError.overflow = true;                                        \
+            }                                                                                \
+            if (underflow != 0u) {                                                           \
+                context.runtimeError.underflow = true;                                       \
+            }                                                                                \
+        }
+
+REGISTER_VECTOR_SAFE_OPERATOR(+ ,Addition)
+REGISTER_VECTOR_SAFE_OPERATOR(- ,Subtraction)
+REGISTER_VECTOR_SAFE_OPERATOR(* ,Multiplication)
+
+/**
+ * Associates a runtime function to its vector version.
+ */
+struct VectorFunctionRecord {
+    Function       function;
+    VectorFunction vectorFunction;
+};
+
+static const VectorFunctionRecord vectorFunctionRecords[] = {
+    { &functionAdditionication<float32>,                &VectorAddition<float32>       },
+    { &functionAdditionication<float64>,                &VectorAddition<float64>       },
+    { &functionSubtractication<float32>,                &VectorSubtraction<float32>    },
+    { &functionSubtractication<float64>,                &VectorSubtraction<float64>    },
+    { &functionMultiplication<float32>,                 &VectorMultiplication<float32> },
+    { &functionMultiplication<float64>,                 &VectorMultiplication<float64> },
+    { &functionDivisionication<float32>,                &VectorDivision<float32>       },
+    { &functionDivisionication<float64>,                &VectorDivision<float64>       },
+    { &SAddition_3T<int32, int32, int32>,               &VectorSafeAdditionInt32       },
+    { &SSubtraction_3T<int32, int32, int32>,            &VectorSafeSubtractionInt32    },
+    { &SMultiplication_3T<int32, int32, int32>,         &VectorSafeMultiplicationInt32 }
+};
+
+VectorFunction GetVectorFunction(const Function function){
+    VectorFunction vectorFunction = NULL_PTR(VectorFunction);
+    const uint32 numberOfRecords = static_cast<uint32>(sizeof(vectorFunctionRecords) / sizeof(VectorFunctionRecord));
+    for (uint32 i = 0u; (i < numberOfRecords) && (vectorFunction == NULL_PTR(VectorFunction)); i++){
+        if (vectorFunctionRecords[i].function == function){
+            vectorFunction = vectorFunctionRecords[i].vectorFunction;
+        }
+    }
+    return vectorFunction;
+}
+
 } //MARTe
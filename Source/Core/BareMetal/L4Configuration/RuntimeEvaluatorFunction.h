@@ -63,6 +63,17 @@ namespace MARTe {
  */
 typedef void (*Function)(RuntimeEvaluator & context);
 
+/**
+ * @brief   Pointer to the vector version of a runtime function.
+ * @details Applies a binary operation to arrays of samples, as done by
+ *          RuntimeEvaluator::ExecuteBatch(): for each sample
+ *          `result[i] = x2[i] op x1[i]`, where `x1` holds the operand
+ *          that the scalar function pops first (i.e. the top of the stack).
+ *          `result` is allowed to be the same array as `x2`.
+ *          Errors are reported in the RuntimeEvaluator::runtimeError of the context.
+ */
+typedef void (*VectorFunction)(RuntimeEvaluator &context, void * const result, const void * const x1, const void * const x2, const uint32 numberOfSamples);
+
 /**
  * @brief   Function object required by RuntimeEvaluator.
  * 
@@ -168,6 +179,13 @@ public:
      */
     void ExecuteFunction(RuntimeEvaluator &context) const {function(context);}
 
+    /**
+     * @brief   Get the pointer to the actual C++ function.
+     * @details Allows RuntimeEvaluator to call the function directly
+     *          from its threaded code.
+     */
+    Function GetFunction() const {return function;}
+
     /**
      * @brief   Replaces the type on the stack with the result type.
      * @returns `true` if the name and types matches.
@@ -246,6 +264,14 @@ extern RuntimeEvaluatorFunction functionRecords[maxFunctions];
  */
 bool FindPCodeAndUpdateTypeStack(CodeMemoryElement &code, const CCString &nameIn, StaticStack<TypeDescriptor,32u> &typeStack, const bool matchOutput,DataMemoryAddress &dataStackSize);
 
+/**
+ * @brief   Finds the vector version of a runtime function.
+ * @details Vector versions are available for ADD, SUB, MUL and DIV on
+ *          float32 and float64 and for ADD, SUB and MUL on int32.
+ * @returns the vector version of \a function or NULL if there is none.
+ */
+VectorFunction GetVectorFunction(const Function function);
+
 /**
  * @brief   Adds a function to #functionRecord.
  * @details This function is used to add a RuntimeEvaluatorFunction
@@ -70,6 +70,17 @@ Token::~Token() {
 
 }
 
+void Token::Set(TokenInfo tokenInfo,
+                const char8 * const data,
+                const uint32 lineNumber) {
+    tokenId = tokenInfo.GetTokenId();
+    const char8 * const description = tokenInfo.GetDescription();
+    //Assigning NULL would leave the previous content in the strings.
+    tokenDescription = (description != NULL) ? (description) : ("");
+    tokenData = (data != NULL) ? (data) : ("");
+    tokenLineNumber = lineNumber;
+}
+
 uint32 Token::GetId() const {
     return tokenId;
 }
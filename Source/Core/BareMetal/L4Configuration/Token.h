@@ -90,6 +90,21 @@ public:
      */
     ~Token();
 
+    /**
+     * @brief Reinitialises the token, reusing the memory already allocated for its description and data.
+     * @param[in] tokenInfo the token identifier and description.
+     * @param[in] data the token data.
+     * @param[in] lineNumber the token line number.
+     * @post
+     *   GetId() == tokenInfo.GetTokenId() &&
+     *   GetDescription() == tokenInfo.GetDescription() &&
+     *   GetData() == data &&
+     *   GetLineNumber() == lineNumber;
+     */
+    void Set(TokenInfo tokenInfo,
+             const char8 * const data,
+             const uint32 lineNumber);
+
     /**
      * @brief Retrieves the token identifier.
      * @return the token identifier.
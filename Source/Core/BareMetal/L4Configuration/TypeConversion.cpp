@@ -1073,6 +1073,15 @@ static bool VectorBasicTypeConvert(const AnyType &destination, const AnyType &so
     if (source.GetTypeDescriptor() == Character8Bit) {
         numberOfElements = source.GetNumberOfElements(1u);
     }
+    //Numeric arrays are converted in one go
+    BasicTypeArrayConverter converter = NULL_PTR(BasicTypeArrayConverter);
+    if ((source.GetBitAddress() == 0u) && (destination.GetBitAddress() == 0u)) {
+        converter = GetBasicTypeArrayConverter(destination.GetTypeDescriptor(), source.GetTypeDescriptor());
+    }
+    if (converter != NULL_PTR(BasicTypeArrayConverter)) {
+        ok = converter(destination.GetDataPointer(), source.GetDataPointer(), numberOfElements);
+        numberOfElements = 0u;
+    }
     // Assume that the number of dimensions is equal
     for (uint32 idx = 0u; (idx < numberOfElements); idx++) {
         uint32 sourceElementByteSize = static_cast<uint32>(source.GetByteSize());
@@ -1167,7 +1176,16 @@ static bool StaticToStaticMatrix(const AnyType &destination, const AnyType &sour
     void *sourcePointer = source.GetDataPointer();
     void *destinationPointer = destination.GetDataPointer();
 
+    //Numeric static matrices are contiguous and converted in one go
+    BasicTypeArrayConverter converter = NULL_PTR(BasicTypeArrayConverter);
+    if ((source.GetBitAddress() == 0u) && (destination.GetBitAddress() == 0u)) {
+        converter = GetBasicTypeArrayConverter(destinationDescriptor, sourceDescriptor);
+    }
     bool ok = true;
+    if (converter != NULL_PTR(BasicTypeArrayConverter)) {
+        ok = converter(destinationPointer, sourcePointer, numberOfRows * numberOfColumns);
+        numberOfRows = 0u;
+    }
     for (uint32 r = 0u; (r < numberOfRows); r++) {
 
         char8* sourceArray = reinterpret_cast<char8 *>(sourcePointer);
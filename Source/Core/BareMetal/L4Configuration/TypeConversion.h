@@ -84,6 +84,35 @@ namespace MARTe {
 DLL_API bool TypeConvert(const AnyType &destination,
                          const AnyType &source);
 
+/**
+ * @brief Converts \a numberOfElements contiguous elements of a numeric basic type into another numeric basic type.
+ * @param[out] destination the first element of the converted array.
+ * @param[in] source the first element of the array to be converted.
+ * @param[in] numberOfElements the number of elements to convert.
+ * @return true if all the elements were successfully converted. If an element cannot be converted the remaining
+ * elements are still converted and false is returned.
+ */
+typedef bool (*BasicTypeArrayConverter)(void * const destination,
+                                        const void * const source,
+                                        const uint32 numberOfElements);
+
+/**
+ * @brief Gets the function that converts whole arrays between two numeric basic types.
+ * @details The converters are resolved once per (source, destination) pair, so that the type is not re-dispatched for
+ * every element. The results (including saturation) are the same as calling TypeConvert for each element:
+ *   - integer to integer saturates to the range of the destination type;
+ *   - float to integer rounds to the nearest integer and saturates to the range of the destination type;
+ *   - float64 to float32 saturates to the largest float32 and converting a NaN or Inf between different float types fails;
+ *   - equal types are copied.
+ *
+ * The supported types are (u)int{8,16,32,64} and float{32,64}. The constant qualifier is ignored.
+ * @param[in] destinationDescriptor the type of the destination elements.
+ * @param[in] sourceDescriptor the type of the source elements.
+ * @return the converter or NULL if the conversion between the two types is not supported.
+ */
+DLL_API BasicTypeArrayConverter GetBasicTypeArrayConverter(const TypeDescriptor &destinationDescriptor,
+                                                           const TypeDescriptor &sourceDescriptor);
+
 }
 
 /*---------------------------------------------------------------------------*/
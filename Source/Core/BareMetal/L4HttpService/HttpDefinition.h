@@ -83,6 +83,11 @@ static const int32 HSHCReply = 0x10000000;
  */
 static const int32 HSHCReplyOK = (HSHCReply + 200);
 
+/**
+ * HTTP REPLY NOT MODIFIED (conditional GET)
+ */
+static const int32 HSHCReplyNotModified = (HSHCReply + 304);
+
 /**
  * HTTP REPLY BAD REQUEST
  */
@@ -98,6 +103,11 @@ static const int32 HSHCReplyAUTH = (HSHCReply + 401);
  */
 static const int32 HSHCReplyNotFound = (HSHCReply + 404);
 
+/**
+ * HTTP REPLY NOT ACCEPTABLE
+ */
+static const int32 HSHCReplyNotAcceptable = (HSHCReply + 406);
+
 /**
  * HTTP TOO MANY REQUESTS
  */
@@ -218,6 +228,10 @@ const char8 *GetErrorCodeString(const int32 httpErrorCode) {
         ret = "Not found";
     }
         break;
+    case 406: {
+        ret = "Not Acceptable";
+    }
+        break;
     case 500: {
         ret = "Internal Error";
     }
@@ -238,6 +252,10 @@ const char8 *GetErrorCodeString(const int32 httpErrorCode) {
         ret = "Method";
     }
         break;
+    case 304: {
+        ret = "Not Modified";
+    }
+        break;
     default: {
 
     }
@@ -39,7 +39,7 @@
 
 namespace MARTe {
 /**
- * @brief Callback function for the logger. Add the logs to the FastResourceContainer queue.
+ * @brief Callback function for the logger. Add the logs to the lock-free queue.
  * @param[in] errorInfo the error information.
  * @param[in] errorDescription the error textual description.
  */
@@ -68,11 +68,22 @@ Logger *Logger::Instance(const uint32 numberOfPages) {
 }
 
 Logger::Logger(const uint32 numberOfPages) :
-        nOfPages(numberOfPages),
-        logsIndex(nOfPages, true),
-        pagesIndex(nOfPages, false) {
+        nOfPages(2u) {
+    //The sequence arithmetic requires a power of two number of pages
+    while ((nOfPages < numberOfPages) && (nOfPages < 0x80000000u)) {
+        nOfPages <<= 1u;
+    }
+    enqueuePosition = 0u;
+    dequeuePosition = 0u;
+    numberOfDroppedLogs = 0;
     /*lint -e{1732} -e{1733} new in constructor safe as this class can only be used as a singleton*/
     pages = new LoggerPage[nOfPages];
+    sequences = new uint32[nOfPages];
+    uint32 i;
+    for (i = 0u; i < nOfPages; i++) {
+        pages[i].index = i;
+        sequences[i] = i;
+    }
     SetErrorProcessFunction(&LoggerErrorProcessFunction);
 }
 
@@ -80,16 +91,34 @@ Logger::~Logger() {
     if (pages != NULL_PTR(LoggerPage *)) {
         delete [] pages;
     }
-
+    if (sequences != NULL_PTR(volatile uint32 *)) {
+        delete [] sequences;
+    }
 }
 
 LoggerPage *Logger::GetPage() {
     LoggerPage *page = NULL_PTR(LoggerPage *);
     if (pages != NULL_PTR(LoggerPage *)) {
-        uint32 pageNo = pagesIndex.Take();
-        if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
-            page = &pages[pageNo];
-            page->index = pageNo;
+        bool done = false;
+        while (!done) {
+            uint32 position = Atomic::LoadAcquire(&enqueuePosition);
+            uint32 pageNo = (position & (nOfPages - 1u));
+            int32 diff = static_cast<int32>(Atomic::LoadAcquire(&sequences[pageNo]) - position);
+            if (diff == 0) {
+                //The page is free. Retry if another producer claimed it first.
+                done = Atomic::CompareAndSwap(&enqueuePosition, position, position + 1u);
+                if (done) {
+                    page = &pages[pageNo];
+                }
+            }
+            else if (diff < 0) {
+                //The page was not consumed yet, i.e. the queue is full.
+                Atomic::Increment(&numberOfDroppedLogs);
+                done = true;
+            }
+            else {
+                //Another producer has already moved the enqueuePosition.
+            }
         }
     }
     return page;
@@ -97,24 +126,40 @@ LoggerPage *Logger::GetPage() {
 
 void Logger::ReturnPage(const LoggerPage * const page) {
     if (pages != NULL_PTR(LoggerPage *)) {
-        if (page != NULL_PTR(LoggerPage *)) {
-            pagesIndex.Return(page->index);
+        if (page != NULL_PTR(const LoggerPage *)) {
+            uint32 pageNo = page->index;
+            Atomic::StoreRelease(&sequences[pageNo], (sequences[pageNo] - 1u) + nOfPages);
         }
     }
 }
 
 void Logger::AddLogEntry(const LoggerPage * const page) {
     if (pages != NULL_PTR(LoggerPage *)) {
-        logsIndex.Return(page->index);
+        if (page != NULL_PTR(const LoggerPage *)) {
+            uint32 pageNo = page->index;
+            Atomic::StoreRelease(&sequences[pageNo], sequences[pageNo] + 1u);
+        }
     }
 }
 
 LoggerPage *Logger::GetLogEntry() {
     LoggerPage *page = NULL_PTR(LoggerPage *);
     if (pages != NULL_PTR(LoggerPage *)) {
-        uint32 pageNo = logsIndex.Take();
-        if ((pageNo != 0xFFFFFFFFu) && (pageNo < nOfPages)) {
-            page = &pages[pageNo];
+        bool done = false;
+        while (!done) {
+            uint32 position = Atomic::LoadAcquire(&dequeuePosition);
+            uint32 pageNo = (position & (nOfPages - 1u));
+            int32 diff = static_cast<int32>(Atomic::LoadAcquire(&sequences[pageNo]) - (position + 1u));
+            if (diff == 0) {
+                done = Atomic::CompareAndSwap(&dequeuePosition, position, position + 1u);
+                if (done) {
+                    page = &pages[pageNo];
+                }
+            }
+            else {
+                //Empty or the oldest page is still being written. Retry only if another consumer has moved the dequeuePosition.
+                done = (diff < 0);
+            }
         }
     }
     return page;
@@ -125,7 +170,11 @@ uint32 Logger::GetNumberOfPages() const {
 }
 
 uint32 Logger::GetNumberOfLogs() const {
-    return logsIndex.GetSize();
+    return (enqueuePosition - dequeuePosition);
+}
+
+uint32 Logger::GetNumberOfDroppedLogs() const {
+    return static_cast<uint32>(numberOfDroppedLogs);
 }
 
 }
@@ -32,8 +32,8 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "ErrorManagement.h"
-#include "FastResourceContainer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -67,8 +67,19 @@ static const uint32 DEFAULT_NUMBER_OF_LOG_PAGES = 128u;
 
 /**
  * @brief The Logger class registers a callback to the SetErrorProcessFunction and adds
- * the logs to a FastResourceContainer queue. These are expected to be consumed by
+ * the logs to a bounded lock-free queue. These are expected to be consumed by
  * users of this class.
+ * @details The queue is a ring of LoggerPage elements where each page has a sequence number that
+ * encodes its state (free, being written, ready to be consumed or being consumed). Producers (i.e. any
+ * thread calling REPORT_ERROR) claim a page with a single compare-and-swap on the write position and
+ * never wait for the consumer: if the queue is full the log is discarded and the number of dropped
+ * logs is incremented (see GetNumberOfDroppedLogs). The logs are consumed in the same order as they
+ * were added.
+ *
+ * Every page taken with GetPage shall be added with AddLogEntry, and every page taken with GetLogEntry
+ * shall be returned with ReturnPage, otherwise the queue stalls at that page.
+ *
+ * The number of pages is rounded up to the next power of two (with a minimum of two pages).
  */
 class DLL_API Logger {
 public:
@@ -101,6 +112,7 @@ public:
 
     /**
      * @brief Returns a page that is used to write the log message received in the callback function.
+     * @details This method never blocks. If no page is available the number of dropped logs is incremented.
      * @return the a free page to write the log message or NULL if no page is available.
      */
     LoggerPage *GetPage();
@@ -122,6 +134,13 @@ public:
      * @return the number of LoggerPage elements that were not consumed.
      */
     uint32 GetNumberOfLogs() const;
+
+    /**
+     * @brief Gets the number of logs that were discarded because no LoggerPage was available.
+     * @details The counter is never reset and wraps around on overflow, so that users shall compare the difference between two readings.
+     * @return the number of logs that were discarded since the Logger was created.
+     */
+    uint32 GetNumberOfDroppedLogs() const;
 private:
 
     /**
@@ -142,17 +161,26 @@ private:
     LoggerPage *pages;
 
     /**
-     * When a new log arrives a page is returned to this container (which is full in the beginning).
-     * When a log is returned by the consumer a page is taken from this container. So that in the beginning
-     * logsIndex is fully Taken and pagesIndex is fully returned.
+     * The sequence number of each page. For a given position in the queue: if sequence == position the page is free
+     * (or being written); if sequence == position + 1 the page is ready to be consumed (or being consumed).
+     * Returning a page sets its sequence to position + nOfPages, i.e. free for the next turn of the ring.
+     */
+    volatile uint32 *sequences;
+
+    /**
+     * The position where the next log is to be written.
+     */
+    volatile uint32 enqueuePosition;
+
+    /**
+     * The position of the next log to be consumed.
      */
-    FastResourceContainer logsIndex;
+    volatile uint32 dequeuePosition;
 
     /**
-     * When a new log arrives a page is taken from this container.
-     * When a log is returned by the consumer a page is returned to this container.
+     * The number of logs discarded because the queue was full.
      */
-    FastResourceContainer pagesIndex;
+    volatile int32 numberOfDroppedLogs;
 
     /*lint -e{1712} This class does not have a default constructor because
      * the numberOfPages must be defined on construction and remain constant
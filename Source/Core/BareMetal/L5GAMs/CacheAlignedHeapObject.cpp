@@ -0,0 +1,111 @@
+/**
+ * @file CacheAlignedHeapObject.cpp
+ * @brief Source file for class CacheAlignedHeapObject
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+
+ * @details This source file contains the definition of all the methods for
+ * the class CacheAlignedHeapObject (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CacheAlignedHeapObject.h"
+#include "HeapManager.h"
+#include "NUMAMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+CacheAlignedHeapObject::CacheAlignedHeapObject() :
+        Object() {
+    heap = NULL_PTR(CacheAlignedHeap *);
+    registered = false;
+}
+
+/*lint -e{1551} no exception should be thrown*/
+CacheAlignedHeapObject::~CacheAlignedHeapObject() {
+    if (registered) {
+        (void) HeapManager::RemoveHeap(heap);
+    }
+    if (heap != NULL_PTR(CacheAlignedHeap *)) {
+        //The components that use the heap might not yet have been destroyed (e.g. if they were declared after this object).
+        heap->Release();
+    }
+    heap = NULL_PTR(CacheAlignedHeap *);
+}
+
+bool CacheAlignedHeapObject::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = (heap == NULL_PTR(CacheAlignedHeap *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "%s: the heap was already initialised", GetName());
+        }
+    }
+    uint32 cacheLineSize = CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE;
+    uint32 node = NUMAMemory::ANY_NODE;
+    if (ok) {
+        if (data.Read("CacheLineSize", cacheLineSize)) {
+            bool isPowerOfTwo = ((cacheLineSize & (cacheLineSize - 1u)) == 0u);
+            ok = ((cacheLineSize >= CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE) && (isPowerOfTwo));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "%s: the CacheLineSize shall be a power of two >= %u", GetName(),
+                             CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE);
+            }
+        }
+    }
+    if (ok) {
+        uint64 cpuConfig = 0ull;
+        if (data.Read("CPUs", cpuConfig)) {
+            BitSet cpuset(cpuConfig);
+            node = NUMAMemory::GetNode(ProcessorType(cpuset));
+            if (node == NUMAMemory::ANY_NODE) {
+                REPORT_ERROR(ErrorManagement::Warning, "%s: could not find a single memory node for the CPUs. The memory will be placed by the operating system", GetName());
+            }
+        }
+    }
+    if (ok) {
+        heap = new CacheAlignedHeap(GetName(), cacheLineSize, node);
+        registered = HeapManager::AddHeap(heap);
+        ok = registered;
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "%s: could not register the heap in the HeapManager", GetName());
+        }
+    }
+    return ok;
+}
+
+CacheAlignedHeap *CacheAlignedHeapObject::GetHeap() {
+    return heap;
+}
+
+CLASS_REGISTER(CacheAlignedHeapObject, "1.0")
+
+}
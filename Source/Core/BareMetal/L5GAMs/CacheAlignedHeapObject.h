@@ -0,0 +1,117 @@
+/**
+ * @file CacheAlignedHeapObject.h
+ * @brief Header file for class CacheAlignedHeapObject
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+
+ * @details This header file contains the declaration of the class CacheAlignedHeapObject
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CACHEALIGNEDHEAPOBJECT_H_
+#define CACHEALIGNEDHEAPOBJECT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CacheAlignedHeap.h"
+#include "Object.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Creates a CacheAlignedHeap and registers it in the HeapManager, so that it can be selected
+ * with the HeapName parameter of the GAM and of the DataSourceI components (e.g. GAMDataSource and MemoryDataSourceI).
+ * @details The name of the heap is the name of this object.
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +GAMsHeap = {
+ *     Class = CacheAlignedHeapObject
+ *     CPUs = 0x4 //Optional. CPU mask of the thread(s) that will access the memory. The memory is placed on the NUMA node
+ *                //of these CPUs (if they all belong to the same node). If not set the memory is placed by the operating system.
+ *     CacheLineSize = 64 //Optional. Cache line size in bytes. Default = CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE.
+ * }
+ * ...
+ * +GAM1 = {
+ *     Class = AGAM
+ *     HeapName = GAMsHeap
+ *     ...
+ * }
+ * </pre>
+ *
+ * This object must be declared before the components that use the heap, so that it is initialised before them.
+ * When this object is destroyed the heap is unregistered from the HeapManager and it is only destroyed after the
+ * components that use it have freed their memory (see CacheAlignedHeap::Release).
+ * @warning Selecting a heap by name requires the framework to be compiled with MARTe2_MULTIHEAP_SUPPORT. Otherwise
+ * HeapManager::FindHeap always returns the standard heap.
+ */
+class DLL_API CacheAlignedHeapObject: public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetHeap() == NULL
+     */
+    CacheAlignedHeapObject();
+
+    /**
+     * @brief Destructor. Unregisters the heap from the HeapManager and releases it (see CacheAlignedHeap::Release).
+     */
+    virtual ~CacheAlignedHeapObject();
+
+    /**
+     * @brief Reads the optional CPUs and CacheLineSize parameters, creates the heap and registers it in the HeapManager.
+     * @param[in] data the configuration data.
+     * @return true if Object::Initialise succeeds and the heap can be registered in the HeapManager.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Gets the heap.
+     * @return the heap or NULL if Initialise was not successfully called.
+     */
+    CacheAlignedHeap *GetHeap();
+
+private:
+
+    /**
+     * The heap.
+     */
+    CacheAlignedHeap *heap;
+
+    /**
+     * True if the heap was registered in the HeapManager.
+     */
+    bool registered;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* CACHEALIGNEDHEAPOBJECT_H_ */
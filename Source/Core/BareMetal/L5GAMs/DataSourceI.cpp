@@ -101,10 +101,29 @@ bool DataSourceI::AddSignals(StructuredDataI &data) {
 bool DataSourceI::SetConfiguredDatabase(StructuredDataI & data) {
     configuredDatabase = dynamic_cast<ConfigurationDatabase &>(data);
     configuredDatabase.SetCurrentNodeAsRootNode();
+    bool ret = true;
     if (configuredDatabase.MoveAbsolute("Functions")) {
         functionsDatabaseNode = configuredDatabase;
+        uint32 numberOfFunctions = configuredDatabase.GetNumberOfChildren();
+        uint32 f;
+        for (f = 0u; (f < numberOfFunctions) && (ret); f++) {
+            StreamString functionName;
+            ret = configuredDatabase.MoveToChild(f);
+            if (ret) {
+                ret = configuredDatabase.Read("QualifiedName", functionName);
+            }
+            if (ret) {
+                uint32 ff = f;
+                ret = functionNameCache.Write(functionName.Buffer(), ff);
+            }
+            if (ret) {
+                ret = configuredDatabase.MoveToAncestor(1u);
+            }
+        }
+    }
+    if (ret) {
+        ret = configuredDatabase.MoveAbsolute("Signals");
     }
-    bool ret = configuredDatabase.MoveAbsolute("Signals");
     if (ret) {
         signalsDatabaseNode = configuredDatabase;
         numberOfSignals = configuredDatabase.GetNumberOfChildren();
@@ -441,23 +460,7 @@ bool DataSourceI::GetFunctionName(const uint32 functionIdx, StreamString &functi
 }
 
 bool DataSourceI::GetFunctionIndex(uint32 &functionIdx, const char8* const functionName) {
-
-    uint32 numberOfFunctions = GetNumberOfFunctions();
-    bool ret = true;
-    bool found = false;
-    uint32 i;
-    for (i = 0u; (i < numberOfFunctions) && (ret) && (!found); i++) {
-        StreamString searchName;
-        ret = GetFunctionName(i, searchName);
-        if (ret) {
-            found = (StringHelper::Compare(functionName, searchName.Buffer()) == 0);
-            functionIdx = i;
-        }
-    }
-    if (ret) {
-        ret = found;
-    }
-    return ret;
+    return functionNameCache.Read(functionName, functionIdx);
 }
 
 bool DataSourceI::GetFunctionNumberOfSignals(const SignalDirection direction, const uint32 functionIdx, uint32 &numSignals) {
@@ -736,6 +739,11 @@ bool DataSourceI::BrokerCopyTerminated() {
     return true;
 }
 
+/*lint -e{715} The symbols are not referenced because this is a default implementation, i.e. it is expected to be implemented on derived classes.*/
+bool DataSourceI::SynchroniseBatch(const void * const * const pages, const uint32 numberOfPages, const uint32 pageSize) {
+    return false;
+}
+
 bool DataSourceI::GetInputBrokers(ReferenceContainer &inputBrokers,
                                                      const char8* const functionName,
                                                      void * const gamMemPtr) {
@@ -522,6 +522,20 @@ public:
      */
     virtual bool Synchronise() = 0;
 
+    /**
+     * @brief A DataSourceI that implements this method can consume several samples of its signals in a single synchronisation call.
+     * @details A buffering BrokerI implementation (e.g. the MemoryMapAsyncOutputBroker in batch mode) may call this method, instead of calling
+     *  Synchronise once per sample, to hand over all the pending samples at once. Each page holds one sample of all the signals copied by the broker,
+     *  packed in the order of the broker copy table (i.e. the order in which the signals would be copied into the DataSourceI memory).
+     *  Before calling this method the broker also copies the last page into the DataSourceI memory.
+     *  This allows, for example, file or network DataSources to issue a single large write.
+     * @param[in] pages the memory address of each page, from the oldest to the newest sample.
+     * @param[in] numberOfPages the number of pages in \a pages.
+     * @param[in] pageSize the size in bytes of each page.
+     * @return false in the default implementation (i.e. batch synchronisation is not supported).
+     */
+    virtual bool SynchroniseBatch(const void * const * const pages, const uint32 numberOfPages, const uint32 pageSize);
+
     /**
      * @brief Allocate the memory for this DataSourceI.
      * @return true if the memory can be successfully allocated.
@@ -725,6 +739,11 @@ private:
      */
     ConfigurationDatabase signalNameCache;
 
+    /**
+     * Accelerator for the function names.
+     */
+    ConfigurationDatabase functionNameCache;
+
     /**
      * Default broker optimisation
      */
@@ -44,16 +44,25 @@ namespace MARTe {
 ExecutableI::ExecutableI() {
     timingSignalAddress = NULL_PTR(uint32 * const);
     enabled = true;
+    timingSignalNanoseconds = false;
+    executionTimeHistogram = NULL_PTR(ExecutionTimeHistogram *);
 }
 
 /*lint -e{1540} the timingSignalAddress is to freed by the class that uses the ExecutableI, typically a GAMSchedulerI.*/
 ExecutableI::~ExecutableI() {
+    if (executionTimeHistogram != NULL_PTR(ExecutionTimeHistogram *)) {
+        delete executionTimeHistogram;
+    }
 }
 
 void ExecutableI::SetTimingSignalAddress(uint32 * const timingSignalAddressIn) {
     timingSignalAddress = timingSignalAddressIn;
 }
 
+void ExecutableI::SetTimingSignalNanoseconds(const bool nanoseconds) {
+    timingSignalNanoseconds = nanoseconds;
+}
+
 void ExecutableI::SetEnabled(const bool isEnabled) {
     enabled = isEnabled;
 }
@@ -62,5 +71,11 @@ bool ExecutableI::IsEnabled() const {
     return enabled;
 }
 
+void ExecutableI::EnableExecutionTimeHistogram() {
+    if (executionTimeHistogram == NULL_PTR(ExecutionTimeHistogram *)) {
+        executionTimeHistogram = new ExecutionTimeHistogram();
+    }
+}
+
 
 }
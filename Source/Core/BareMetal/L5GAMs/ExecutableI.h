@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogram.h"
 #include "ReferenceContainer.h"
 
 /*---------------------------------------------------------------------------*/
@@ -51,7 +52,7 @@ public:
     ExecutableI();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Frees the ExecutionTimeHistogram (if it was enabled).
      */
     virtual ~ExecutableI();
 
@@ -75,7 +76,7 @@ public:
 
     /**
      * @brief Sets the address in memory where the signal which contains the last execution time of this component is stored.
-     * @details The last execution time units are micro-seconds and are measured w.r.t. to the start of a cycle.
+     * @details The last execution time units are micro-seconds (or nano-seconds, see SetTimingSignalNanoseconds) and are measured w.r.t. to the start of a cycle.
      * @param[in] timingSignalAddressIn the address of the timing signal.
      */
     void SetTimingSignalAddress(uint32 * const timingSignalAddressIn);
@@ -87,14 +88,52 @@ public:
      */
     inline uint32 *GetTimingSignalAddress();
 
+    /**
+     * @brief Sets the type of the timing signal.
+     * @param[in] nanoseconds true if the timing signal is a uint64 where the time is stored in nano-seconds, false if it is a uint32
+     * where the time is stored in micro-seconds.
+     */
+    void SetTimingSignalNanoseconds(const bool nanoseconds);
+
+    /**
+     * @brief Returns true if the timing signal is a uint64 where the time is stored in nano-seconds.
+     * @return true if the timing signal is a uint64 where the time is stored in nano-seconds.
+     */
+    inline bool IsTimingSignalNanoseconds() const;
+
+    /**
+     * @brief Enables the recording of the execution times of this component in an ExecutionTimeHistogram.
+     * @details The histogram is allocated only once, i.e. calling this function more than once has no effect.
+     * @post
+     *   GetExecutionTimeHistogram() != NULL
+     */
+    void EnableExecutionTimeHistogram();
+
+    /**
+     * @brief Gets the ExecutionTimeHistogram where the execution times of this component are recorded.
+     * @details The histogram is updated by the GAMSchedulerI (see GAMSchedulerI::ExecuteSingleCycle).
+     * @return the ExecutionTimeHistogram or NULL if EnableExecutionTimeHistogram was never called.
+     */
+    inline ExecutionTimeHistogram *GetExecutionTimeHistogram();
+
 private:
 
     uint32 * timingSignalAddress;
 
+    /**
+     * The histogram of the execution times (NULL if not enabled).
+     */
+    ExecutionTimeHistogram *executionTimeHistogram;
+
     /**
      * True if the executable is enabled.
      */
     bool enabled;
+
+    /**
+     * True if the timing signal is a uint64 in nano-seconds.
+     */
+    bool timingSignalNanoseconds;
 };
 
 
@@ -106,6 +145,14 @@ uint32 * ExecutableI::GetTimingSignalAddress() {
     return timingSignalAddress;
 }
 
+bool ExecutableI::IsTimingSignalNanoseconds() const {
+    return timingSignalNanoseconds;
+}
+
+ExecutionTimeHistogram * ExecutableI::GetExecutionTimeHistogram() {
+    return executionTimeHistogram;
+}
+
 }
 #endif /* EXECUTORI_H_ */
 	
@@ -0,0 +1,157 @@
+/**
+ * @file ExecutionTimeHistogram.cpp
+ * @brief Source file for class ExecutionTimeHistogram
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeHistogram (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogram.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+const uint32 ExecutionTimeHistogram::SUB_BUCKETS_BITS;
+const uint32 ExecutionTimeHistogram::SUB_BUCKETS;
+const uint32 ExecutionTimeHistogram::NUMBER_OF_BUCKETS;
+
+ExecutionTimeHistogram::ExecutionTimeHistogram() {
+    periodMicroSeconds = HighResolutionTimer::Period() * 1e6;
+    numberOfSamples = 0u;
+    sumTicks = 0u;
+    minTicks = 0u;
+    maxTicks = 0u;
+    Reset();
+}
+
+ExecutionTimeHistogram::~ExecutionTimeHistogram() {
+
+}
+
+void ExecutionTimeHistogram::Reset() {
+    numberOfSamples = 0u;
+    sumTicks = 0u;
+    minTicks = 0u;
+    maxTicks = 0u;
+    for (uint32 i = 0u; i < NUMBER_OF_BUCKETS; i++) {
+        buckets[i] = 0u;
+    }
+}
+
+uint64 ExecutionTimeHistogram::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+float64 ExecutionTimeHistogram::GetMin() const {
+    return TicksToMicroSeconds(minTicks);
+}
+
+float64 ExecutionTimeHistogram::GetMax() const {
+    return TicksToMicroSeconds(maxTicks);
+}
+
+float64 ExecutionTimeHistogram::GetMean() const {
+    float64 mean = 0.0;
+    uint64 n = numberOfSamples;
+    if (n > 0u) {
+        mean = TicksToMicroSeconds(sumTicks) / static_cast<float64>(n);
+    }
+    return mean;
+}
+
+float64 ExecutionTimeHistogram::GetPercentile(const float64 percentile) const {
+    uint64 valueTicks = 0u;
+    uint64 n = numberOfSamples;
+    if (n > 0u) {
+        float64 p = percentile;
+        if (p < 0.0) {
+            p = 0.0;
+        }
+        if (p > 100.0) {
+            p = 100.0;
+        }
+        //Rank of the sample (1 based) that satisfies the percentile
+        float64 rankF = (p * static_cast<float64>(n)) / 100.0;
+        uint64 rank = static_cast<uint64>(rankF);
+        if (static_cast<float64>(rank) < rankF) {
+            rank++;
+        }
+        if (rank == 0u) {
+            rank = 1u;
+        }
+        uint64 cumulative = 0u;
+        bool found = false;
+        for (uint32 i = 0u; (i < NUMBER_OF_BUCKETS) && (!found); i++) {
+            cumulative += buckets[i];
+            found = (cumulative >= rank);
+            if (found) {
+                valueTicks = GetBucketUpperLimit(i);
+            }
+        }
+        if ((!found) || (valueTicks > maxTicks)) {
+            valueTicks = maxTicks;
+        }
+        if (valueTicks < minTicks) {
+            valueTicks = minTicks;
+        }
+    }
+    return TicksToMicroSeconds(valueTicks);
+}
+
+uint32 ExecutionTimeHistogram::GetBucketCounter(const uint32 bucketIdx) const {
+    uint32 counter = 0u;
+    if (bucketIdx < NUMBER_OF_BUCKETS) {
+        counter = buckets[bucketIdx];
+    }
+    return counter;
+}
+
+uint64 ExecutionTimeHistogram::GetBucketUpperLimit(const uint32 bucketIdx) {
+    uint64 upperLimit;
+    if (bucketIdx < SUB_BUCKETS) {
+        upperLimit = bucketIdx;
+    }
+    else {
+        uint32 msb = (bucketIdx / SUB_BUCKETS) + (SUB_BUCKETS_BITS - 1u);
+        uint32 shift = msb - SUB_BUCKETS_BITS;
+        uint64 subBucket = static_cast<uint64>(bucketIdx % SUB_BUCKETS);
+        uint64 lowerLimit = ((static_cast<uint64>(SUB_BUCKETS) + subBucket) << shift);
+        upperLimit = lowerLimit + ((static_cast<uint64>(1u) << shift) - 1u);
+    }
+    return upperLimit;
+}
+
+float64 ExecutionTimeHistogram::TicksToMicroSeconds(const uint64 ticks) const {
+    return static_cast<float64>(ticks) * periodMicroSeconds;
+}
+
+}
@@ -0,0 +1,251 @@
+/**
+ * @file ExecutionTimeHistogram.h
+ * @brief Header file for class ExecutionTimeHistogram
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionTimeHistogram
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONTIMEHISTOGRAM_H_
+#define EXECUTIONTIMEHISTOGRAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Fixed-bucket histogram of execution times.
+ * @details The execution times are recorded in HighResolutionTimer ticks. The first 8 buckets hold the exact values 0 to 7,
+ * after which each power of two is split in 8 linear sub-buckets, so that the relative resolution of any
+ * bucket is better than 12.5% over the full uint64 range.
+ *
+ * The Update method is meant to be called from the real-time thread: it does not allocate memory, does not lock and
+ * executes in constant time. The histogram has a single writer. Readers (which may run in any other thread) get the
+ * statistics without locking and, while the writer is active, these might be off by the sample being recorded.
+ *
+ * All the statistics are returned in micro-seconds.
+ */
+class DLL_API ExecutionTimeHistogram {
+public:
+
+    /**
+     * Number of sub-buckets (log2) in which each power of two is split.
+     */
+    static const uint32 SUB_BUCKETS_BITS = 3u;
+
+    /**
+     * Number of sub-buckets in which each power of two is split.
+     */
+    static const uint32 SUB_BUCKETS = 8u;
+
+    /**
+     * Total number of buckets needed to cover the uint64 range.
+     */
+    static const uint32 NUMBER_OF_BUCKETS = 496u;
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfSamples() == 0
+     */
+    ExecutionTimeHistogram();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    ~ExecutionTimeHistogram();
+
+    /**
+     * @brief Records one execution time.
+     * @param[in] ticks the execution time in HighResolutionTimer ticks.
+     */
+    inline void Update(const uint64 ticks);
+
+    /**
+     * @brief Clears all the recorded values.
+     * @post
+     *   GetNumberOfSamples() == 0
+     */
+    void Reset();
+
+    /**
+     * @brief Gets the number of recorded values.
+     * @return the number of recorded values.
+     */
+    uint64 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets the minimum recorded execution time.
+     * @return the minimum recorded execution time in micro-seconds or 0 if GetNumberOfSamples() == 0.
+     */
+    float64 GetMin() const;
+
+    /**
+     * @brief Gets the maximum recorded execution time.
+     * @return the maximum recorded execution time in micro-seconds or 0 if GetNumberOfSamples() == 0.
+     */
+    float64 GetMax() const;
+
+    /**
+     * @brief Gets the mean of the recorded execution times.
+     * @return the mean of the recorded execution times in micro-seconds or 0 if GetNumberOfSamples() == 0.
+     */
+    float64 GetMean() const;
+
+    /**
+     * @brief Gets the execution time below which \a percentile percent of the recorded values fall.
+     * @details The value is the upper limit of the bucket where the percentile is found, bounded by GetMin() and GetMax().
+     * @param[in] percentile the percentile (e.g. 99.0 or 99.9) in the range [0, 100].
+     * @return the execution time in micro-seconds or 0 if GetNumberOfSamples() == 0.
+     */
+    float64 GetPercentile(const float64 percentile) const;
+
+    /**
+     * @brief Gets the number of values recorded in the bucket \a bucketIdx.
+     * @param[in] bucketIdx the bucket index.
+     * @return the number of values recorded in the bucket or 0 if bucketIdx >= NUMBER_OF_BUCKETS.
+     */
+    uint32 GetBucketCounter(const uint32 bucketIdx) const;
+
+    /**
+     * @brief Gets the index of the bucket where a given value is recorded.
+     * @param[in] ticks the value in HighResolutionTimer ticks.
+     * @return the index of the bucket where \a ticks is recorded.
+     */
+    static inline uint32 GetBucketIndex(const uint64 ticks);
+
+    /**
+     * @brief Gets the largest value (in ticks) that is recorded in the bucket \a bucketIdx.
+     * @param[in] bucketIdx the bucket index.
+     * @return the largest value (in ticks) recorded in the bucket \a bucketIdx.
+     * @pre
+     *   bucketIdx < NUMBER_OF_BUCKETS
+     */
+    static uint64 GetBucketUpperLimit(const uint32 bucketIdx);
+
+private:
+
+    /**
+     * @brief Converts ticks to micro-seconds.
+     * @param[in] ticks the value to convert.
+     * @return \a ticks in micro-seconds.
+     */
+    float64 TicksToMicroSeconds(const uint64 ticks) const;
+
+    /**
+     * The counters of each bucket.
+     */
+    uint32 buckets[NUMBER_OF_BUCKETS];
+
+    /**
+     * The number of recorded values.
+     */
+    uint64 numberOfSamples;
+
+    /**
+     * The sum of all the recorded values.
+     */
+    uint64 sumTicks;
+
+    /**
+     * The minimum recorded value.
+     */
+    uint64 minTicks;
+
+    /**
+     * The maximum recorded value.
+     */
+    uint64 maxTicks;
+
+    /**
+     * The HighResolutionTimer period in micro-seconds.
+     */
+    float64 periodMicroSeconds;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+uint32 ExecutionTimeHistogram::GetBucketIndex(const uint64 ticks) {
+    uint32 idx;
+    if (ticks < SUB_BUCKETS) {
+        idx = static_cast<uint32>(ticks);
+    }
+    else {
+        //Binary search for the most significant bit
+        uint64 value = ticks;
+        uint32 msb = 0u;
+        if ((value >> 32u) != 0u) {
+            value >>= 32u;
+            msb += 32u;
+        }
+        if ((value >> 16u) != 0u) {
+            value >>= 16u;
+            msb += 16u;
+        }
+        if ((value >> 8u) != 0u) {
+            value >>= 8u;
+            msb += 8u;
+        }
+        if ((value >> 4u) != 0u) {
+            value >>= 4u;
+            msb += 4u;
+        }
+        if ((value >> 2u) != 0u) {
+            value >>= 2u;
+            msb += 2u;
+        }
+        if ((value >> 1u) != 0u) {
+            msb += 1u;
+        }
+        uint32 subBucket = static_cast<uint32>(ticks >> (msb - SUB_BUCKETS_BITS)) & (SUB_BUCKETS - 1u);
+        idx = ((msb - (SUB_BUCKETS_BITS - 1u)) * SUB_BUCKETS) + subBucket;
+    }
+    return idx;
+}
+
+void ExecutionTimeHistogram::Update(const uint64 ticks) {
+    buckets[GetBucketIndex(ticks)]++;
+    if ((numberOfSamples == 0u) || (ticks < minTicks)) {
+        minTicks = ticks;
+    }
+    if (ticks > maxTicks) {
+        maxTicks = ticks;
+    }
+    sumTicks += ticks;
+    numberOfSamples++;
+}
+
+}
+
+#endif /* EXECUTIONTIMEHISTOGRAM_H_ */
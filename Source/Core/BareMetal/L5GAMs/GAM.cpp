@@ -31,9 +31,12 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "BrokerI.h"
 #include "GAM.h"
+#include "HeapManager.h"
 #include "Reference.h"
+#include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -98,6 +101,17 @@ bool GAM::Initialise(StructuredDataI &data) {
     if (ret) {
         ret = signalsDatabase.MoveToRoot();
     }
+    if (ret) {
+        StreamString heapName;
+        if (data.Read("HeapName", heapName)) {
+            gamHeap = HeapManager::FindHeap(heapName.Buffer());
+            if (gamHeap == NULL_PTR(HeapI*)) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not instantiate a gamHeap with the name: %s", heapName.Buffer());
+                gamHeap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+                ret = false;
+            }
+        }
+    }
     return ret;
 }
 
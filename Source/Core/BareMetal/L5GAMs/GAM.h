@@ -51,6 +51,7 @@ namespace MARTe {
  * in RealTimeApplicationConfigurationBuilder):
  * +ThisGAMName = {"
  *    Class = ClassThatInheritsFromGAM"
+ *    HeapName = "The name of the Heap to use" If not specified GlobalObjectsDatabase::GetStandardHeap() will be used (e.g. a CacheAlignedHeapObject).
  *    Signals = {
  *        InputSignals|OutputSignals = {
  *            NAME*={
@@ -106,8 +107,9 @@ public:
      * @details Initialises the ReferenceContainer with input \a data StructuredDataI.
      * Moves to the node "Signals" in the input \a data StructuredDataI and
      * locally stores the information of all the available Input/Output signals.
+     * Reads the optional HeapName, i.e. the heap where the input and output signals memory is to be allocated.
      * @param[in] data The configuration information which may include a Signals node.
-     * @return true if the ReferenceContainer is successfully initialised.
+     * @return true if the ReferenceContainer is successfully initialised and, if the HeapName is specified, if the HeapI is found.
      */
     virtual bool Initialise(StructuredDataI & data);
 
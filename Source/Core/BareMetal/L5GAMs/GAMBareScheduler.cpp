@@ -70,14 +70,14 @@ ErrorManagement::ErrorType GAMBareScheduler::StartNextStateExecution() {
     while(isAlive) { 
         Cycle(0u); 
 
-        uint32 absTime = 0u;
+        uint64 tmp = 0u;
         if (lastCycleTimeStamp != 0u) {
-            uint64 tmp = (HighResolutionTimer::Counter() - lastCycleTimeStamp);
-            float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-            absTime = static_cast<uint32>(ticksToTime);  //us
+            tmp = (HighResolutionTimer::Counter() - lastCycleTimeStamp);
+            if (nextState->threads[0].cycleTimeHistogram != NULL_PTR(ExecutionTimeHistogram *)) {
+                nextState->threads[0].cycleTimeHistogram->Update(tmp);
+            }
         }
-        uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-        if (!MemoryOperationsHelper::Copy(nextState->threads[0].cycleTime, &absTime, sizeToCopy)) {
+        if (!WriteTimingSignal(nextState->threads[0].cycleTime, nextState->threads[0].cycleTimeNanoseconds, tmp)) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
         }
         lastCycleTimeStamp = HighResolutionTimer::Counter();
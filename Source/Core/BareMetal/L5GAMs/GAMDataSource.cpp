@@ -37,6 +37,8 @@
 #include "GAM.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
+#include "MemoryMapSeqlockInputBroker.h"
+#include "MemoryMapSeqlockOutputBroker.h"
 #include "ReferenceT.h"
 #include "StandardParser.h"
 #include "CLASSREGISTER.h"
@@ -46,6 +48,11 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of uint32 between two signal sequences, so that each sequence lives in its own cache line.
+ */
+static const uint32 GAM_DATA_SOURCE_SEQUENCE_STRIDE = 16u;
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -59,6 +66,10 @@ GAMDataSource::GAMDataSource() :
     allowMultipleSamples = false;
     resetUnusedVariablesAtStateChange = true;
     forceResetUnusedVariablesAtStateChange = true;
+    seqlock = false;
+    seqlockSequences = NULL_PTR(volatile uint32 *);
+    seqlockSignalSizes = NULL_PTR(uint32 *);
+    seqlockBufferStride = 0u;
 }
 
 GAMDataSource::~GAMDataSource() {
@@ -71,6 +82,12 @@ GAMDataSource::~GAMDataSource() {
             delete[] signalOffsets;
         }
     }
+    if (seqlockSequences != NULL_PTR(volatile uint32 *)) {
+        delete[] seqlockSequences;
+    }
+    if (seqlockSignalSizes != NULL_PTR(uint32 *)) {
+        delete[] seqlockSignalSizes;
+    }
     /*lint -e{1740} memoryHeap+ was zero or it is freed and zeroed by HeapManager::Free*/
 }
 
@@ -104,6 +121,11 @@ bool GAMDataSource::Initialise(StructuredDataI &data) {
         (void) (data.Read("ResetUnusedVariablesAtStateChange", resetUnusedVariablesAtStateChangeUInt32));
         resetUnusedVariablesAtStateChange = (resetUnusedVariablesAtStateChangeUInt32 == 1u);
     }
+    if (ret) {
+        uint32 seqlockUInt32 = 0u;
+        (void) (data.Read("Seqlock", seqlockUInt32));
+        seqlock = (seqlockUInt32 == 1u);
+    }
     forceResetUnusedVariablesAtStateChange = true;
     return ret;
 }
@@ -147,6 +169,9 @@ bool GAMDataSource::AllocateMemory() {
     }
     if (ret) {
         signalOffsets = new uint32[nOfSignals];
+        if (seqlock) {
+            seqlockSignalSizes = new uint32[nOfSignals];
+        }
     }
 
     uint32 memorySize = 0u;
@@ -170,13 +195,26 @@ bool GAMDataSource::AllocateMemory() {
         }
         if (ret) {
             memorySize += thisSignalMemorySize;
+            if (seqlockSignalSizes != NULL_PTR(uint32 *)) {
+                seqlockSignalSizes[s] = thisSignalMemorySize;
+            }
         }
     }
+    uint32 allocatedMemorySize = memorySize;
+    if ((ret) && (seqlock)) {
+        //The second buffer of all the signals follows the first one.
+        seqlockBufferStride = memorySize;
+        allocatedMemorySize = (2u * memorySize);
+        uint32 numberOfSequences = (nOfSignals * GAM_DATA_SOURCE_SEQUENCE_STRIDE);
+        uint32 *sequences = new uint32[numberOfSequences];
+        ret = MemoryOperationsHelper::Set(sequences, '\0', numberOfSequences * static_cast<uint32>(sizeof(uint32)));
+        seqlockSequences = sequences;
+    }
     if (ret) {
         if (memoryHeap != NULL_PTR(HeapI*)) {
-            signalMemory = memoryHeap->Malloc(memorySize);
+            signalMemory = memoryHeap->Malloc(allocatedMemorySize);
         }
-        ret = MemoryOperationsHelper::Set(signalMemory, '\0', memorySize);
+        ret = MemoryOperationsHelper::Set(signalMemory, '\0', allocatedMemorySize);
     }
     return ret;
 }
@@ -197,10 +235,10 @@ const char8* GAMDataSource::GetBrokerName(StructuredDataI &data,
     if (freq < 0.) {
         if ( (samples == 1u) || ((samples >= 1u) && allowMultipleSamples) ) {
             if (direction == InputSignals) {
-                brokerName = "MemoryMapInputBroker";
+                brokerName = (seqlock) ? ("MemoryMapSeqlockInputBroker") : ("MemoryMapInputBroker");
             }
             else {
-                brokerName = "MemoryMapOutputBroker";
+                brokerName = (seqlock) ? ("MemoryMapSeqlockOutputBroker") : ("MemoryMapOutputBroker");
             }
         }
     }
@@ -322,6 +360,11 @@ bool GAMDataSource::PrepareNextState(const char8 *const currentStateName,
                     }
 
                 }
+                //The signal is not written in this state: both buffers shall hold the reset value.
+                if ((ret) && (seqlock) && (seqlockSignalSizes != NULL_PTR(uint32 *))) {
+                    char8 *secondBuffer = &(reinterpret_cast<char8 *>(thisSignalMemory)[seqlockBufferStride]);
+                    ret = MemoryOperationsHelper::Copy(secondBuffer, thisSignalMemory, seqlockSignalSizes[signalIdx]);
+                }
             }
         }
     }
@@ -332,7 +375,7 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
                                     const char8 *const functionName,
                                     void *const gamMemPtr) {
 //generally a loop for each supported broker
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+    ReferenceT<MemoryMapBroker> broker((seqlock) ? ("MemoryMapSeqlockInputBroker") : ("MemoryMapInputBroker"));
     bool ret = broker.IsValid();
     if (ret) {
         ret = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
@@ -348,7 +391,7 @@ bool GAMDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
 bool GAMDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
                                      const char8 *const functionName,
                                      void *const gamMemPtr) {
-    ReferenceT<MemoryMapOutputBroker> broker("MemoryMapOutputBroker");
+    ReferenceT<MemoryMapBroker> broker((seqlock) ? ("MemoryMapSeqlockOutputBroker") : ("MemoryMapOutputBroker"));
     bool ret = broker.IsValid();
     if (ret) {
         ret = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
@@ -409,6 +452,23 @@ bool GAMDataSource::Synchronise() {
     return false;
 }
 
+bool GAMDataSource::GetSeqlockSignal(const uint32 signalIdx,
+                                     volatile uint32 *&sequence,
+                                     uint32 &byteSize,
+                                     uint32 &bufferStride) {
+    bool ret = (seqlockSequences != NULL_PTR(volatile uint32 *));
+    if (ret) {
+        ret = (signalIdx < GetNumberOfSignals());
+    }
+    if (ret) {
+        sequence = &seqlockSequences[signalIdx * GAM_DATA_SOURCE_SEQUENCE_STRIDE];
+        /*lint -e{613} seqlockSignalSizes is allocated together with seqlockSequences.*/
+        byteSize = seqlockSignalSizes[signalIdx];
+        bufferStride = seqlockBufferStride;
+    }
+    return ret;
+}
+
 CLASS_REGISTER(GAMDataSource, "1.0")
 
 }
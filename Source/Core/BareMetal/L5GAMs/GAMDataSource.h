@@ -57,7 +57,15 @@ namespace MARTe {
  *    AllowNoProducers = 0 //Optional. If 1 the GAMDataSource will allow for signals not to be connected (only issuing a warning).
  *    AllowMultipleSamples = 0 //Optional. If 1 the GAMDataSource will allow for signals with NumberOfSamples > 0
  *    ResetUnusedVariablesAtStateChange = 1 //Optional. If 1 the GAMDataSource will reset the value of any input to its default value if the producer was not executed in the current state. 
+ *    Seqlock = 0 //Optional. If 1 the signals can be produced and consumed by GAMs executing in different RealTimeThreads (see below).
  * }
+ *
+ * @details When Seqlock = 1 each signal is double buffered and protected by a sequence (seqlock), so that
+ *  the signals can be exchanged between RealTimeThreads without any mutex. The MemoryMapSeqlockOutputBroker writes
+ *  the buffer that is not being read (and never waits) and the MemoryMapSeqlockInputBroker copies the last completely written buffer,
+ *  retrying if a write of any of its signals started or finished while it was copying. As a consequence, all the signals read by
+ *  a GAM are a consistent snapshot of the signals written by each producer GAM. Each signal shall be produced by a single
+ *  RealTimeThread in any given state.
  */
 class DLL_API GAMDataSource: public DataSourceI {
 public:
@@ -110,7 +118,8 @@ public:
     /**
      * @brief See DataSourceI::GetBrokerName()
      * @return MemoryMapInputBroker if direction is InputSignals, MemoryMapOutputBroker if the direction is OutputSignals
-     *  or NULL if Frequency != -1 and Samples != 1.
+     *  or NULL if Frequency != -1 and Samples != 1. If Seqlock = 1 the MemoryMapSeqlockInputBroker and the MemoryMapSeqlockOutputBroker
+     *  are returned instead.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data, const SignalDirection direction);
 
@@ -165,6 +174,21 @@ public:
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
+    /**
+     * @brief Gets the seqlock information of the signal \a signalIdx (only available if Seqlock = 1).
+     * @details The second buffer of the signal is at GetSignalMemoryBuffer(signalIdx, 0) + bufferStride.
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] sequence the sequence of the signal. It is odd while the signal is being written and the index of the last
+     * completely written buffer is (sequence / 2) % 2.
+     * @param[out] byteSize the size of the signal in memory (including all the samples).
+     * @param[out] bufferStride the distance between the two buffers of a signal.
+     * @return true if Seqlock = 1, the memory was allocated and \a signalIdx is valid.
+     */
+    bool GetSeqlockSignal(const uint32 signalIdx,
+                          volatile uint32 *&sequence,
+                          uint32 &byteSize,
+                          uint32 &bufferStride);
+
 protected:
     /**
      * The single buffer memory.
@@ -201,6 +225,26 @@ protected:
      */
     bool forceResetUnusedVariablesAtStateChange;
 
+    /**
+     * Double buffer the signals and protect them with a seqlock?
+     */
+    bool seqlock;
+
+    /**
+     * The sequence of each signal (one per cache line). Only allocated if seqlock.
+     */
+    volatile uint32 *seqlockSequences;
+
+    /**
+     * The memory size of each signal. Only allocated if seqlock.
+     */
+    uint32 *seqlockSignalSizes;
+
+    /**
+     * The distance between the two buffers of each signal.
+     */
+    uint32 seqlockBufferStride;
+
 };
 
 }
@@ -53,13 +53,15 @@ namespace MARTe {
 
 GAMSchedulerI::GAMSchedulerI() :
         ReferenceContainer(),
-        clockPeriod(HighResolutionTimer::Period()) {
+        clockPeriod(HighResolutionTimer::Period()),
+        ticksConverter() {
     states = NULL_PTR(ScheduledState *);
     scheduledStates[0] = NULL_PTR(ScheduledState *);
     scheduledStates[1] = NULL_PTR(ScheduledState *);
     numberOfStates = 0u;
     currentStateIdentifier = NULL_PTR(uint32 *);
     nextStateIdentifier = 0u;
+    executionTimeHistograms = false;
 }
 
 /*lint -e{1740} currentStateIdentifier is a pointer to a memory block allocated elsewhere*/
@@ -75,6 +77,9 @@ GAMSchedulerI::~GAMSchedulerI() {
                         if (states[s].threads[t].executables != NULL_PTR(ExecutableI **)) {
                             delete [] states[s].threads[t].executables;
                         }
+                        if (states[s].threads[t].cycleTimeHistogram != NULL_PTR(ExecutionTimeHistogram *)) {
+                            delete states[s].threads[t].cycleTimeHistogram;
+                        }
                     }
                     delete [] states[s].threads;
                 }
@@ -94,6 +99,12 @@ bool GAMSchedulerI::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify the TimingDataSource address");
         }
     }
+    if (ret) {
+        uint32 executionTimeHistogramsU32 = 0u;
+        if (data.Read("ExecutionTimeHistograms", executionTimeHistogramsU32)) {
+            executionTimeHistograms = (executionTimeHistogramsU32 == 1u);
+        }
+    }
 
     return ret;
 }
@@ -137,6 +148,11 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                     states[i].name = stateElement->GetName();
 
                     states[i].threads = new ScheduledThread[numberOfThreads];
+                    for (uint32 j = 0u; j < numberOfThreads; j++) {
+                        states[i].threads[j].executables = NULL_PTR(ExecutableI **);
+                        states[i].threads[j].cycleTimeHistogram = NULL_PTR(ExecutionTimeHistogram *);
+                        states[i].threads[j].cycleTimeNanoseconds = false;
+                    }
 
                     for (uint32 j = 0u; (j < numberOfThreads) && (ret); j++) {
                         ReferenceT<RealTimeThread> threadElement = threadContainer->Get(j);
@@ -209,6 +225,17 @@ bool GAMSchedulerI::ConfigureScheduler(Reference realTimeAppIn) {
                                 if (ret) {
                                     ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void*&>(states[i].threads[j].cycleTime));
                                 }
+                                if (ret) {
+                                    states[i].threads[j].cycleTimeNanoseconds = IsNanosecondsTimingSignal(signalIdx);
+                                }
+                            }
+
+                            //Allocate the execution time histograms
+                            if ((ret) && (executionTimeHistograms)) {
+                                states[i].threads[j].cycleTimeHistogram = new ExecutionTimeHistogram();
+                                for (uint32 e = 0u; e < numberOfExecutables; e++) {
+                                    states[i].threads[j].executables[e]->EnableExecutionTimeHistogram();
+                                }
                             }
 
                             //Get the current state identifier
@@ -250,6 +277,10 @@ bool GAMSchedulerI::InsertInputBrokers(ReferenceT<GAM> gam,
     if (ret) {
         ret = (signalAddress != NULL);
     }
+    bool nanoseconds = false;
+    if (ret) {
+        nanoseconds = IsNanosecondsTimingSignal(signalIdx);
+    }
     if (ret) {
         ret = (states != NULL_PTR(ScheduledState *));
     }
@@ -273,6 +304,8 @@ bool GAMSchedulerI::InsertInputBrokers(ReferenceT<GAM> gam,
             states[stateIdx].threads[threadIdx].executables[executableIdx] = input.operator->();
             //lint -e{613} states != NULL checked before entering here.
             states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+            //lint -e{613} states != NULL checked before entering here.
+            states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalNanoseconds(nanoseconds);
         }
         executableIdx++;
     }
@@ -310,6 +343,8 @@ bool GAMSchedulerI::InsertGAM(ReferenceT<GAM> gam,
         states[stateIdx].threads[threadIdx].executables[executableIdx] = gam.operator->();
         //lint -e{613} states != NULL checked before entering here.
         states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+        //lint -e{613} states != NULL checked before entering here.
+        states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalNanoseconds(IsNanosecondsTimingSignal(signalIdx));
     }
     return ret;
 }
@@ -330,6 +365,10 @@ bool GAMSchedulerI::InsertOutputBrokers(ReferenceT<GAM> gam,
     if (ret) {
         ret = signalAddress != NULL;
     }
+    bool nanoseconds = false;
+    if (ret) {
+        nanoseconds = IsNanosecondsTimingSignal(signalIdx);
+    }
     if (ret) {
         ret = (states != NULL_PTR(ScheduledState *));
     }
@@ -353,12 +392,18 @@ bool GAMSchedulerI::InsertOutputBrokers(ReferenceT<GAM> gam,
             states[stateIdx].threads[threadIdx].executables[executableIdx] = output.operator->();
             //lint -e{613} states != NULL checked before entering here.
             states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalAddress(reinterpret_cast<uint32*>(signalAddress));
+            //lint -e{613} states != NULL checked before entering here.
+            states[stateIdx].threads[threadIdx].executables[executableIdx]->SetTimingSignalNanoseconds(nanoseconds);
         }
         executableIdx++;
     }
     return ret;
 }
 
+bool GAMSchedulerI::IsNanosecondsTimingSignal(const uint32 signalIdx) const {
+    return (timingDataSource->GetSignalType(signalIdx) == UnsignedInteger64Bit);
+}
+
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The GAMSchedulerI implementation does not need
  to know the currentStateName (but other implementations of the GAMSchedulerI might need to know).*/
 bool GAMSchedulerI::PrepareNextState(const char8 * const currentStateName,
@@ -403,19 +448,23 @@ bool GAMSchedulerI::ExecuteSingleCycle(ExecutableI * const * const executables,
 
     bool ret = true;
     uint64 absTicks = HighResolutionTimer::Counter();
+    uint64 lastTicks = absTicks;
     for (uint32 i = 0u; (i < numberOfExecutables) && (ret); i++) {
         // save the time before
         // execute the gam/broker
-        if (executables[i]->IsEnabled()) {
+        bool enabled = executables[i]->IsEnabled();
+        if (enabled) {
             ret = executables[i]->Execute();
         }
 
-        uint64 tmp = (HighResolutionTimer::Counter() - absTicks);
-        float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-        uint32 absTime = static_cast<uint32>(ticksToTime);  //us
+        uint64 nowTicks = HighResolutionTimer::Counter();
+        ExecutionTimeHistogram *histogram = executables[i]->GetExecutionTimeHistogram();
+        if ((enabled) && (histogram != NULL_PTR(ExecutionTimeHistogram *))) {
+            histogram->Update(nowTicks - lastTicks);
+        }
+        lastTicks = nowTicks;
         if (ret) {
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            ret = MemoryOperationsHelper::Copy(executables[i]->GetTimingSignalAddress(), &absTime, sizeToCopy);
+            ret = WriteTimingSignal(executables[i]->GetTimingSignalAddress(), executables[i]->IsTimingSignalNanoseconds(), nowTicks - absTicks);
         }
         else {
             BrokerI *broker = dynamic_cast<BrokerI *>(executables[i]);
@@ -466,6 +515,34 @@ uint32 GAMSchedulerI::GetNumberOfExecutables(const char8 * const stateName,
     return numberOfExecutables;
 }
 
+const ExecutionTimeHistogram *GAMSchedulerI::GetCycleTimeHistogram(const char8 * const stateName,
+                                                                   const char8 * const threadName) const {
+    const ExecutionTimeHistogram *histogram = NULL_PTR(const ExecutionTimeHistogram *);
+    if (states != NULL) {
+        bool foundState = false;
+        for (uint32 i = 0u; (i < numberOfStates) && (!foundState); i++) {
+            foundState = StringHelper::Compare(stateName, states[i].name) == 0;
+            if (foundState) {
+                uint32 numberOfThreads = states[i].numberOfThreads;
+                if (states[i].threads != NULL) {
+                    bool foundThread = false;
+                    for (uint32 j = 0u; (j < numberOfThreads) && (!foundThread); j++) {
+                        foundThread = StringHelper::Compare(threadName, states[i].threads[j].name) == 0;
+                        if (foundThread) {
+                            histogram = states[i].threads[j].cycleTimeHistogram;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return histogram;
+}
+
+bool GAMSchedulerI::IsExecutionTimeHistogramsEnabled() const {
+    return executionTimeHistograms;
+}
+
 ScheduledState * const * GAMSchedulerI::GetSchedulableStates() {
     return scheduledStates;
 
@@ -33,7 +33,10 @@
 /*---------------------------------------------------------------------------*/
 
 #include "ExecutableI.h"
+#include "ExecutionTimeHistogram.h"
 #include "GAM.h"
+#include "HighResolutionTimerConverter.h"
+#include "MemoryOperationsHelper.h"
 #include "ProcessorType.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
@@ -65,6 +68,16 @@ struct ScheduledThread {
      */
     uint32 *cycleTime;
 
+    /**
+     * True if the cycle time signal is a uint64 in nano-seconds (as opposed to a uint32 in micro-seconds).
+     */
+    bool cycleTimeNanoseconds;
+
+    /**
+     * Histogram of the cycle times (NULL if ExecutionTimeHistograms is not enabled).
+     */
+    ExecutionTimeHistogram *cycleTimeHistogram;
+
     /**
      * The cpus where is possible to run the thread
      */
@@ -113,9 +126,16 @@ struct ScheduledState {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    ExecutionTimeHistograms = 1 //Optional. If 1 the execution times of every ExecutableI and the cycle time of every thread are also recorded in an ExecutionTimeHistogram. Default = 0.
  * }\n
  *
  * and it has to be contained in the [RealTimeApplication] declaration.
+ *
+ * @details When ExecutionTimeHistograms is enabled, the histograms can be queried with ExecutableI::GetExecutionTimeHistogram and
+ * GAMSchedulerI::GetCycleTimeHistogram.
+ *
+ * @details The timing signals are written in micro-seconds (uint32) or, if the signal is declared as a uint64 in the TimingDataSource,
+ * in nano-seconds. The conversion from HighResolutionTimer ticks is performed with the integer only HighResolutionTimerConverter.
  */
 class DLL_API GAMSchedulerI: public ReferenceContainer, public StatefulI {
 
@@ -132,7 +152,7 @@ public:
     virtual ~GAMSchedulerI();
 
     /**
-     * @brief Reads the TimingDataSource name.
+     * @brief Reads the TimingDataSource name and the optional ExecutionTimeHistograms flag.
      * @param[in] data the StructuredDataI with the TimingDataSource.
      * @return false if the TimingDataSource is not defined.
      */
@@ -158,6 +178,7 @@ public:
      * @brief Executes a list of ExecutableIs storing their execution times with respect the start time instant.
      * @details Note that if one of the executables returns ErrorManagement::Completed, the current cycle will be 
      * deemed to be completed and thus no other executables will run.
+     * If the ExecutableI has an ExecutionTimeHistogram, the duration of its execution is also recorded in the histogram.
      * @param[in] executables the list of ExecutablesIs to be executed
      * @param[in] numberOfExecutables how many ExecutableIs have to be executed.
      */
@@ -171,6 +192,20 @@ public:
      */
     uint32 GetNumberOfExecutables(const char8 * const stateName, const char8 * const threadName) const;
 
+    /**
+     * @brief Gets the histogram of the cycle times of the thread \a threadName in the state \a stateName.
+     * @param[in] stateName the name of the state.
+     * @param[in] threadName the name of the thread.
+     * @return the histogram of the cycle times or NULL if the state/thread does not exist or if ExecutionTimeHistograms is not enabled.
+     */
+    const ExecutionTimeHistogram *GetCycleTimeHistogram(const char8 * const stateName, const char8 * const threadName) const;
+
+    /**
+     * @brief Returns true if the ExecutionTimeHistograms were enabled in the configuration.
+     * @return true if the ExecutionTimeHistograms were enabled in the configuration.
+     */
+    bool IsExecutionTimeHistogramsEnabled() const;
+
     /**
      * @brief Starts the execution of the next state threads.
      * @pre
@@ -202,11 +237,25 @@ protected:
      */
     virtual void CustomPrepareNextState()=0;
 
+    /**
+     * @brief Writes an elapsed time in a timing signal.
+     * @param[in] timingSignal the address of the timing signal.
+     * @param[in] nanoseconds true if the timing signal is a uint64 in nano-seconds, false if it is a uint32 in micro-seconds.
+     * @param[in] ticks the elapsed time in HighResolutionTimer ticks.
+     * @return true if the value was successfully written.
+     */
+    inline bool WriteTimingSignal(void * const timingSignal, const bool nanoseconds, const uint64 ticks) const;
+
     /**
      * Clock period
      */
     const float64 clockPeriod;
 
+    /**
+     * Converts HighResolutionTimer ticks to time without floating point arithmetic.
+     */
+    const HighResolutionTimerConverter ticksConverter;
+
     /**
      * The real-time application linked to this scheduler
      */
@@ -249,6 +298,11 @@ protected:
      */
     uint32 numberOfStates;
 
+    /**
+     * True if the execution times are to be recorded in ExecutionTimeHistogram instances.
+     */
+    bool executionTimeHistograms;
+
     /**
      * @brief Helper function to add the input brokers of the \a gam to the table of states to be executed.
      * @param[in] gamFullName the GAM fully qualified name.
@@ -279,6 +333,13 @@ protected:
      */
     bool InsertGAM(ReferenceT<GAM> gam, const char8 * const gamFullName, const uint32 stateIdx, const uint32 threadIdx, const uint32 executableIdx) const;
 
+    /**
+     * @brief Helper function to check if a timing signal is a uint64 (i.e. recorded in nano-seconds).
+     * @param[in] signalIdx the index of the signal in the TimingDataSource.
+     * @return true if the signal with index \a signalIdx is a uint64.
+     */
+    bool IsNanosecondsTimingSignal(const uint32 signalIdx) const;
+
 };
 
 }
@@ -286,6 +347,22 @@ protected:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+bool GAMSchedulerI::WriteTimingSignal(void * const timingSignal, const bool nanoseconds, const uint64 ticks) const {
+    bool ret;
+    if (nanoseconds) {
+        uint64 time = ticksConverter.TicksToNanoseconds(ticks);
+        ret = MemoryOperationsHelper::Copy(timingSignal, &time, static_cast<uint32>(sizeof(uint64)));
+    }
+    else {
+        uint32 time = static_cast<uint32>(ticksConverter.TicksToMicroseconds(ticks));
+        ret = MemoryOperationsHelper::Copy(timingSignal, &time, static_cast<uint32>(sizeof(uint32)));
+    }
+    return ret;
+}
+
+}
 
 #endif /* GAMSCHEDULERI_H_ */
 
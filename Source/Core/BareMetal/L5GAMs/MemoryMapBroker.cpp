@@ -48,12 +48,21 @@ MemoryMapBroker::MemoryMapBroker() :
     copyTable = NULL_PTR(MemoryMapBrokerCopyTableEntry*);
     dataSource = NULL_PTR(DataSourceI*);
     numberOfCopies = 0u;
+    mergedCopyTable = NULL_PTR(MemoryMapBrokerCopyTableEntry*);
+    numberOfMergedCopies = NULL_PTR(uint32*);
+    numberOfMergedBuffers = 0u;
 }
 
 MemoryMapBroker::~MemoryMapBroker() {
     if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
         delete[] copyTable;
     }
+    if (mergedCopyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+        delete[] mergedCopyTable;
+    }
+    if (numberOfMergedCopies != NULL_PTR(uint32*)) {
+        delete[] numberOfMergedCopies;
+    }
     /*lint -e{1740} dataSource contains a copy of a pointer. No need to be freed.*/
 }
 
@@ -133,6 +142,58 @@ bool MemoryMapBroker::Init(const SignalDirection direction,
         }
 //        }
     }
+    if (ret) {
+        ret = MergeCopyTable(numberOfBuffers);
+    }
+    return ret;
+}
+
+bool MemoryMapBroker::MergeCopyTable(const uint32 numberOfBuffers) {
+    if (mergedCopyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+        delete[] mergedCopyTable;
+    }
+    if (numberOfMergedCopies != NULL_PTR(uint32*)) {
+        delete[] numberOfMergedCopies;
+    }
+    numberOfMergedBuffers = 0u;
+    mergedCopyTable = new MemoryMapBrokerCopyTableEntry[numberOfCopies * numberOfBuffers];
+    numberOfMergedCopies = new uint32[numberOfBuffers];
+    bool ret = (mergedCopyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) && (numberOfMergedCopies != NULL_PTR(uint32*));
+    for (uint32 b = 0u; (b < numberOfBuffers) && (ret); b++) {
+        uint32 first = (b * numberOfCopies);
+        uint32 m = first;
+        //lint -e{613} Possible use of null pointer. Justification: if ret == true --> mergedCopyTable != NULL
+        mergedCopyTable[m] = copyTable[first];
+        for (uint32 n = 1u; n < numberOfCopies; n++) {
+            const MemoryMapBrokerCopyTableEntry &entry = copyTable[first + n];
+            char8 *gamEnd = &(reinterpret_cast<char8*>(mergedCopyTable[m].gamPointer)[mergedCopyTable[m].copySize]);
+            char8 *dataSourceEnd = &(reinterpret_cast<char8*>(mergedCopyTable[m].dataSourcePointer)[mergedCopyTable[m].copySize]);
+            bool contiguous = (reinterpret_cast<char8*>(entry.gamPointer) == gamEnd);
+            if (contiguous) {
+                contiguous = (reinterpret_cast<char8*>(entry.dataSourcePointer) == dataSourceEnd);
+            }
+            if (contiguous) {
+                mergedCopyTable[m].copySize += entry.copySize;
+            }
+            else {
+                m++;
+                mergedCopyTable[m] = entry;
+            }
+        }
+        //lint -e{613} Possible use of null pointer. Justification: if ret == true --> numberOfMergedCopies != NULL
+        numberOfMergedCopies[b] = ((m - first) + 1u);
+    }
+    if (ret) {
+        numberOfMergedBuffers = numberOfBuffers;
+    }
+    return ret;
+}
+
+uint32 MemoryMapBroker::GetNumberOfMergedCopies(const uint32 bufferIdx) const {
+    uint32 ret = 0u;
+    if (bufferIdx < numberOfMergedBuffers) {
+        ret = numberOfMergedCopies[bufferIdx];
+    }
     return ret;
 }
 
@@ -127,8 +127,45 @@ public:
                       void *const gamMemoryAddress,
                       const bool optim);
 
+    /**
+     * @brief Gets the number of copy operations that are actually executed for the state buffer \a bufferIdx.
+     * @details At Init time, consecutive MemoryMapBrokerCopyTableEntry elements that are contiguous both in the GAM
+     * memory and in the DataSourceI memory are merged into a single copy operation (see MergeCopyTable).
+     * @param[in] bufferIdx the index of the DataSourceI stateful memory buffer.
+     * @return the number of merged copy operations for \a bufferIdx (<= GetNumberOfCopies()) or 0 if \a bufferIdx is not valid.
+     */
+    uint32 GetNumberOfMergedCopies(const uint32 bufferIdx) const;
+
 protected:
 
+    /**
+     * @brief Builds the mergedCopyTable from the copyTable.
+     * @details For each stateful memory buffer, adjacent entries of the copyTable are merged into maximal
+     * runs where the memory is contiguous both in the GAM and in the DataSourceI. The type of a merged entry is the
+     * type of the first entry of the run.
+     * @param[in] numberOfBuffers the number of stateful memory buffers of the DataSourceI.
+     * @return true if the memory for the mergedCopyTable can be allocated.
+     * @pre
+     *   copyTable != NULL && numberOfCopies > 0
+     */
+    bool MergeCopyTable(const uint32 numberOfBuffers);
+
+    /**
+     * A table with the merged elements to be copied for each stateful memory buffer.
+     * The elements of the buffer b start at mergedCopyTable[b * numberOfCopies].
+     */
+    MemoryMapBrokerCopyTableEntry *mergedCopyTable;
+
+    /**
+     * The number of merged elements for each stateful memory buffer.
+     */
+    uint32 *numberOfMergedCopies;
+
+    /**
+     * The number of stateful memory buffers for which the mergedCopyTable was built.
+     */
+    uint32 numberOfMergedBuffers;
+
     /**
      * A table with all the elements to be copied
      */
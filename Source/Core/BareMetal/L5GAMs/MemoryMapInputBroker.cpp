@@ -54,10 +54,12 @@ bool MemoryMapInputBroker::Execute() {
     /*lint -e{613} null pointer checked before.*/
     uint32 i = dataSource->GetCurrentStateBuffer();
     bool ret = true;
-    if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-        for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-            uint32 dataSourceIndex = ((i * numberOfCopies) + n);
-            ret = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].copySize);
+    if (mergedCopyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
+        uint32 first = (i * numberOfCopies);
+        uint32 numberOfMerged = GetNumberOfMergedCopies(i);
+        for (n = 0u; (n < numberOfMerged) && (ret); n++) {
+            const MemoryMapBrokerCopyTableEntry &entry = mergedCopyTable[first + n];
+            ret = MemoryOperationsHelper::Copy(entry.gamPointer, entry.dataSourcePointer, entry.copySize);
         }
     }
     return ret;
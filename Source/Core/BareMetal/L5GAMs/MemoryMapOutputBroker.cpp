@@ -54,10 +54,12 @@ bool MemoryMapOutputBroker::Execute() {
     /*lint -e{613} null pointer checked before.*/
     uint32 i = dataSource->GetCurrentStateBuffer();
     bool ret = true;
-    for (n = 0u; (n < numberOfCopies) && (ret); n++) {
-        if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
-            uint32 dataSourceIndex = ((i * numberOfCopies) + n);
-            ret = MemoryOperationsHelper::Copy(copyTable[dataSourceIndex].dataSourcePointer, copyTable[n].gamPointer, copyTable[n].copySize);
+    if (mergedCopyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry *)) {
+        uint32 first = (i * numberOfCopies);
+        uint32 numberOfMerged = GetNumberOfMergedCopies(i);
+        for (n = 0u; (n < numberOfMerged) && (ret); n++) {
+            const MemoryMapBrokerCopyTableEntry &entry = mergedCopyTable[first + n];
+            ret = MemoryOperationsHelper::Copy(entry.dataSourcePointer, entry.gamPointer, entry.copySize);
         }
     }
     return ret;
@@ -0,0 +1,242 @@
+/**
+ * @file MemoryMapSeqlockBroker.cpp
+ * @brief Source file for class MemoryMapSeqlockBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapSeqlockBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryMapSeqlockBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Maximum number of attempts of CopyInputs to get a consistent snapshot.
+ */
+static const uint32 MEMORY_MAP_SEQLOCK_BROKER_MAX_RETRIES = 1000u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MemoryMapSeqlockBroker::MemoryMapSeqlockBroker() :
+        MemoryMapBroker() {
+    numberOfSeqlockSignals = 0u;
+    sequences = NULL_PTR(volatile uint32 **);
+    sequenceSnapshots = NULL_PTR(uint32 *);
+    signalAddresses = NULL_PTR(char8 **);
+    signalSizes = NULL_PTR(uint32 *);
+    partialSignals = NULL_PTR(bool *);
+    copySignals = NULL_PTR(uint32 *);
+    bufferStride = 0u;
+}
+
+MemoryMapSeqlockBroker::~MemoryMapSeqlockBroker() {
+    if (sequences != NULL_PTR(volatile uint32 **)) {
+        delete[] sequences;
+    }
+    if (sequenceSnapshots != NULL_PTR(uint32 *)) {
+        delete[] sequenceSnapshots;
+    }
+    if (signalAddresses != NULL_PTR(char8 **)) {
+        delete[] signalAddresses;
+    }
+    if (signalSizes != NULL_PTR(uint32 *)) {
+        delete[] signalSizes;
+    }
+    if (partialSignals != NULL_PTR(bool *)) {
+        delete[] partialSignals;
+    }
+    if (copySignals != NULL_PTR(uint32 *)) {
+        delete[] copySignals;
+    }
+}
+
+bool MemoryMapSeqlockBroker::Init(const SignalDirection direction,
+                                  DataSourceI &dataSourceIn,
+                                  const char8 * const functionName,
+                                  void * const gamMemoryAddress) {
+    return Init(direction, dataSourceIn, functionName, gamMemoryAddress, false);
+}
+
+/*lint -e{715} optim is ignored as the copies of different signals cannot be merged.*/
+bool MemoryMapSeqlockBroker::Init(const SignalDirection direction,
+                                  DataSourceI &dataSourceIn,
+                                  const char8 * const functionName,
+                                  void * const gamMemoryAddress,
+                                  const bool optim) {
+    GAMDataSource *gamDataSource = dynamic_cast<GAMDataSource *>(&dataSourceIn);
+    bool ret = (gamDataSource != NULL_PTR(GAMDataSource *));
+    if (ret) {
+        ret = MemoryMapBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress, false);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The MemoryMapSeqlockBroker can only be used with a GAMDataSource");
+    }
+    if (ret) {
+        ret = (sequences == NULL_PTR(volatile uint32 **));
+    }
+    if (ret) {
+        sequences = new volatile uint32 *[numberOfCopies];
+        sequenceSnapshots = new uint32[numberOfCopies];
+        signalAddresses = new char8 *[numberOfCopies];
+        signalSizes = new uint32[numberOfCopies];
+        partialSignals = new bool[numberOfCopies];
+        copySignals = new uint32[numberOfCopies];
+    }
+    //Signals with Ranges have more than one copy. Each signal shall be published once.
+    uint32 *dataSourceSignals = NULL_PTR(uint32 *);
+    uint32 *copiedBytes = NULL_PTR(uint32 *);
+    if (ret) {
+        dataSourceSignals = new uint32[numberOfCopies];
+        copiedBytes = new uint32[numberOfCopies];
+    }
+    for (uint32 c = 0u; (c < numberOfCopies) && (ret); c++) {
+        uint32 signalIdx = GetDSCopySignalIndex(c);
+        uint32 s = 0u;
+        bool found = false;
+        while ((s < numberOfSeqlockSignals) && (!found)) {
+            /*lint -e{613} dataSourceSignals allocated before.*/
+            found = (dataSourceSignals[s] == signalIdx);
+            if (!found) {
+                s++;
+            }
+        }
+        if (!found) {
+            uint32 byteSize = 0u;
+            /*lint -e{613} all the tables allocated before.*/
+            ret = gamDataSource->GetSeqlockSignal(signalIdx, sequences[s], byteSize, bufferStride);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The MemoryMapSeqlockBroker requires a GAMDataSource with Seqlock = 1");
+            }
+            void *signalAddress = NULL_PTR(void *);
+            if (ret) {
+                ret = gamDataSource->GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+            }
+            if (ret) {
+                /*lint -e{613} all the tables allocated before.*/
+                dataSourceSignals[s] = signalIdx;
+                signalAddresses[s] = reinterpret_cast<char8 *>(signalAddress);
+                signalSizes[s] = byteSize;
+                copiedBytes[s] = 0u;
+                numberOfSeqlockSignals++;
+            }
+        }
+        if (ret) {
+            /*lint -e{613} all the tables allocated before.*/
+            copySignals[c] = s;
+            copiedBytes[s] += copyTable[c].copySize;
+        }
+    }
+    for (uint32 s = 0u; (s < numberOfSeqlockSignals) && (ret); s++) {
+        /*lint -e{613} all the tables allocated before.*/
+        partialSignals[s] = (copiedBytes[s] < signalSizes[s]);
+    }
+    if (dataSourceSignals != NULL_PTR(uint32 *)) {
+        delete[] dataSourceSignals;
+    }
+    if (copiedBytes != NULL_PTR(uint32 *)) {
+        delete[] copiedBytes;
+    }
+    return ret;
+}
+
+uint32 MemoryMapSeqlockBroker::GetNumberOfSeqlockSignals() const {
+    return numberOfSeqlockSignals;
+}
+
+/*lint -e{613} the tables are allocated in Init, which is a precondition.*/
+bool MemoryMapSeqlockBroker::CopyInputs() {
+    bool ret = (copySignals != NULL_PTR(uint32 *));
+    bool consistent = false;
+    for (uint32 attempt = 0u; (attempt < MEMORY_MAP_SEQLOCK_BROKER_MAX_RETRIES) && (ret) && (!consistent); attempt++) {
+        uint32 s;
+        for (s = 0u; s < numberOfSeqlockSignals; s++) {
+            sequenceSnapshots[s] = Atomic::LoadAcquire(sequences[s]);
+        }
+        for (uint32 c = 0u; (c < numberOfCopies) && (ret); c++) {
+            //The last completely written buffer. If the sequence is odd this is not the buffer being written.
+            uint32 buffer = ((sequenceSnapshots[copySignals[c]] >> 1u) & 1u);
+            char8 *dataSourcePointer = reinterpret_cast<char8 *>(copyTable[c].dataSourcePointer);
+            ret = MemoryOperationsHelper::Copy(copyTable[c].gamPointer, &dataSourcePointer[buffer * bufferStride], copyTable[c].copySize);
+        }
+        //The data loads must complete before the sequences are read again.
+        Atomic::MemoryFence();
+        consistent = true;
+        for (s = 0u; (s < numberOfSeqlockSignals) && (consistent); s++) {
+            consistent = (Atomic::LoadAcquire(sequences[s]) == sequenceSnapshots[s]);
+        }
+        if (!consistent) {
+            Atomic::Pause();
+        }
+    }
+    if ((ret) && (!consistent)) {
+        ret = false;
+        REPORT_ERROR(ErrorManagement::Timeout, "Could not get a consistent copy of the signals after %d attempts", MEMORY_MAP_SEQLOCK_BROKER_MAX_RETRIES);
+    }
+    return ret;
+}
+
+/*lint -e{613} the tables are allocated in Init, which is a precondition.*/
+bool MemoryMapSeqlockBroker::CopyOutputs() {
+    bool ret = (copySignals != NULL_PTR(uint32 *));
+    uint32 s;
+    for (s = 0u; (s < numberOfSeqlockSignals) && (ret); s++) {
+        //Single writer: a plain read of the sequence is sufficient.
+        sequenceSnapshots[s] = *sequences[s];
+        Atomic::StoreRelease(sequences[s], sequenceSnapshots[s] + 1u);
+    }
+    //The odd sequences must be visible before any of the data stores.
+    Atomic::MemoryFence();
+    for (s = 0u; (s < numberOfSeqlockSignals) && (ret); s++) {
+        if (partialSignals[s]) {
+            uint32 lastBuffer = ((sequenceSnapshots[s] >> 1u) & 1u);
+            uint32 nextBuffer = (lastBuffer ^ 1u);
+            ret = MemoryOperationsHelper::Copy(&signalAddresses[s][nextBuffer * bufferStride], &signalAddresses[s][lastBuffer * bufferStride], signalSizes[s]);
+        }
+    }
+    for (uint32 c = 0u; (c < numberOfCopies) && (ret); c++) {
+        uint32 nextBuffer = (((sequenceSnapshots[copySignals[c]] >> 1u) & 1u) ^ 1u);
+        char8 *dataSourcePointer = reinterpret_cast<char8 *>(copyTable[c].dataSourcePointer);
+        ret = MemoryOperationsHelper::Copy(&dataSourcePointer[nextBuffer * bufferStride], copyTable[c].gamPointer, copyTable[c].copySize);
+    }
+    for (s = 0u; s < numberOfSeqlockSignals; s++) {
+        //Release: the data stores are visible before the even sequence.
+        Atomic::StoreRelease(sequences[s], sequenceSnapshots[s] + 2u);
+    }
+    return ret;
+}
+
+}
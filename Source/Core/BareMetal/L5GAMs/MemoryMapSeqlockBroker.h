@@ -0,0 +1,158 @@
+/**
+ * @file MemoryMapSeqlockBroker.h
+ * @brief Header file for class MemoryMapSeqlockBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapSeqlockBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPSEQLOCKBROKER_H_
+#define MEMORYMAPSEQLOCKBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GAMDataSource.h"
+#include "MemoryMapBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Memory mapped BrokerI which exchanges signals with a GAMDataSource configured with Seqlock = 1.
+ * @details Each signal of the GAMDataSource has two buffers and a sequence (see GAMDataSource::GetSeqlockSignal).
+ * The writer (see CopyOutputs) makes the sequences of all its signals odd, copies the GAM signals into the buffer which
+ * is not the last completely written one and makes the sequences even again. The writer never waits for the readers.
+ *
+ * The reader (see CopyInputs) takes a snapshot of the sequences of all its signals, copies the last completely written buffer of each signal
+ * and verifies that none of the sequences changed. Otherwise the copy is retried. Given that the reader never copies the buffer being
+ * written, the copy is only retried if a write of one of its signals started or finished while it was copying.
+ *
+ * The copies are never merged (see MemoryMapBroker::Init), given that the buffer to be used is selected for each signal.
+ */
+class DLL_API MemoryMapSeqlockBroker: public MemoryMapBroker {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MemoryMapSeqlockBroker();
+
+    /**
+     * @brief Destructor. Frees the memory allocated in Init.
+     */
+    virtual ~MemoryMapSeqlockBroker();
+
+    /**
+     * @brief Calls Init(direction, dataSourceIn, functionName, gamMemoryAddress, false).
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief Calls MemoryMapBroker::Init without optimisation (optim is ignored) and collects the sequence of each of the signals to be copied.
+     * @return true if MemoryMapBroker::Init succeeds and \a dataSourceIn is a GAMDataSource with Seqlock = 1.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress,
+                      const bool optim);
+
+    /**
+     * @brief Gets the number of distinct signals copied by this broker.
+     * @return the number of distinct signals copied by this broker.
+     */
+    uint32 GetNumberOfSeqlockSignals() const;
+
+protected:
+
+    /**
+     * @brief Copies a consistent snapshot of the signals from the GAMDataSource to the GAM memory.
+     * @return false if a consistent snapshot could not be copied after MEMORY_MAP_SEQLOCK_BROKER_MAX_RETRIES attempts.
+     */
+    bool CopyInputs();
+
+    /**
+     * @brief Publishes the GAM signals into the GAMDataSource.
+     * @details The signals which are only partially written (see Ranges) are first copied from the last written buffer, so that
+     * the published buffer is always complete.
+     * @return true if all the copies are successfully performed.
+     */
+    bool CopyOutputs();
+
+private:
+
+    /**
+     * The number of distinct signals.
+     */
+    uint32 numberOfSeqlockSignals;
+
+    /**
+     * The sequence of each distinct signal.
+     */
+    volatile uint32 **sequences;
+
+    /**
+     * The value of the sequence of each distinct signal when the copy started.
+     */
+    uint32 *sequenceSnapshots;
+
+    /**
+     * The address of the first buffer of each distinct signal.
+     */
+    char8 **signalAddresses;
+
+    /**
+     * The memory size of each distinct signal.
+     */
+    uint32 *signalSizes;
+
+    /**
+     * True if the copies do not cover the whole signal.
+     */
+    bool *partialSignals;
+
+    /**
+     * The distinct signal of each copy.
+     */
+    uint32 *copySignals;
+
+    /**
+     * The distance between the two buffers of a signal.
+     */
+    uint32 bufferStride;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPSEQLOCKBROKER_H_ */
@@ -0,0 +1,75 @@
+/**
+ * @file MemoryMapSeqlockInputBroker.h
+ * @brief Header file for class MemoryMapSeqlockInputBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapSeqlockInputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYMAPSEQLOCKINPUTBROKER_H_
+#define MEMORYMAPSEQLOCKINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryMapSeqlockBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Input implementation of the MemoryMapSeqlockBroker: copies the signals from the GAMDataSource to the GAM memory.
+ */
+class DLL_API MemoryMapSeqlockInputBroker: public MemoryMapSeqlockBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MemoryMapSeqlockInputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~MemoryMapSeqlockInputBroker();
+
+    /**
+     * @brief Copies a consistent snapshot of the signals from the GAMDataSource to the GAM memory (see MemoryMapSeqlockBroker::CopyInputs).
+     * @return the return value of MemoryMapSeqlockBroker::CopyInputs.
+     * @pre
+     *     Init()
+     */
+    virtual bool Execute();
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYMAPSEQLOCKINPUTBROKER_H_ */
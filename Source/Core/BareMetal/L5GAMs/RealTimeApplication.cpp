@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "CRC.h"
 #include "GAM.h"
 #include "GAMSchedulerI.h"
 #include "Matrix.h"
@@ -64,6 +65,7 @@ RealTimeApplication::RealTimeApplication() :
     index=1u;
     checkSameGamInMoreThreads=true;
     checkMultipleProducersWrites=true;
+    configurationHash = 0u;
 }
 
 /*lint -e{1551} Guarantess that the execution is stopped upon destrucion of the RealTimeApplication*/
@@ -79,6 +81,23 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
 
     bool ret = ReferenceContainer::Initialise(data);
 
+    if (ret) {
+        configurationCache = Find("ConfigurationCache");
+        configurationHash = 0u;
+        if (configurationCache.IsValid()) {
+            StreamString configurationStr;
+            ret = configurationStr.Printf("%!", data);
+            if (ret) {
+                CRC<uint32> crc;
+                crc.ComputeTable(0x04C11DB7u);
+                configurationHash = crc.Compute(reinterpret_cast<const uint8 *>(configurationStr.Buffer()), static_cast<int32>(configurationStr.Size()), 0u, false);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Could not compute the configuration hash of RealTimeApplication %s", GetName());
+            }
+        }
+    }
+
     if(ret){
         uint8 checkSameGamInMoreThreadsT=1u;
         if(!data.Read("CheckSameGamInMoreThreads", checkSameGamInMoreThreadsT)){
@@ -209,12 +228,43 @@ bool RealTimeApplication::Initialise(StructuredDataI & data) {
 }
 
 bool RealTimeApplication::ConfigureApplication() {
+    bool loaded = false;
+    ConfigurationDatabase functionsDatabaseCached;
+    ConfigurationDatabase dataSourcesDatabaseCached;
+    if (configurationCache.IsValid()) {
+        loaded = configurationCache->Load(configurationHash, functionsDatabaseCached, dataSourcesDatabaseCached);
+    }
+    bool ret;
+    if (loaded) {
+        REPORT_ERROR(ErrorManagement::Information, "Going to configure from the ConfigurationCache (hash = %u)", configurationHash);
+        ret = ConfigureApplication(functionsDatabaseCached, dataSourcesDatabaseCached);
+    }
+    else {
+        ret = ConfigureApplicationWithBuilder();
+    }
+    return ret;
+}
+
+bool RealTimeApplication::ConfigureApplicationWithBuilder() {
     RealTimeApplicationConfigurationBuilder rtAppBuilder(*this, defaultDataSourceName.Buffer());
     REPORT_ERROR(ErrorManagement::Information, "Going to rtAppBuilder.ConfigureAfterInitialisation()");
     bool ret = rtAppBuilder.ConfigureAfterInitialisation();
     if (!ret) {
         REPORT_ERROR(ErrorManagement::ParametersError, "Failed to rtAppBuilder.ConfigureAfterInitialisation()");
     }
+    if ((ret) && (configurationCache.IsValid())) {
+        ConfigurationDatabase functionsDatabaseToCache;
+        ConfigurationDatabase dataSourcesDatabaseToCache;
+        ret = rtAppBuilder.Copy(functionsDatabaseToCache, dataSourcesDatabaseToCache);
+        if (ret) {
+            if (!configurationCache->Store(configurationHash, functionsDatabaseToCache, dataSourcesDatabaseToCache)) {
+                REPORT_ERROR(ErrorManagement::Warning, "Failed to store the configuration in the ConfigurationCache");
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Failed to rtAppBuilder.Copy()");
+        }
+    }
     if (ret) {
         REPORT_ERROR(ErrorManagement::Information, "Going to rtAppBuilder.PostConfigureDataSources()");
         ret = rtAppBuilder.PostConfigureDataSources();
@@ -588,6 +638,10 @@ bool RealTimeApplication::CheckMultipleProducersWrites() const{
     return checkMultipleProducersWrites;
 }
 
+uint32 RealTimeApplication::GetConfigurationHash() const {
+    return configurationHash;
+}
+
 ErrorManagement::ErrorType RealTimeApplication::ConfigureRealTimeApplication() {
     ErrorManagement::ErrorType err;
     err.fatalError = !ConfigureApplication();
@@ -36,6 +36,7 @@
 #include "GAMSchedulerI.h"
 #include "MessageI.h"
 #include "RealTimeApplicationConfigurationBuilder.h"
+#include "RealTimeApplicationConfigurationCacheI.h"
 #include "ReferenceContainer.h"
 #include "ReferenceT.h"
 #include "RegisteredMethodsMessageFilter.h"
@@ -165,6 +166,10 @@ public:
      * @details The user can specify the following parameters
      *   CheckMultipleProducersWrites = 1 //enable-disable check multiple producers to write on the same data source signal. Default = 1
      *   CheckSameGamInMoreThreads = 1 //allow a GAM to be declared in more than one RTT per state. Default = 1
+     * @details Optionally a child named ConfigurationCache, implementing the RealTimeApplicationConfigurationCacheI interface, may be declared.
+     * In this case the databases resolved by the RealTimeApplicationConfigurationBuilder are stored in (and later loaded from) this cache,
+     * keyed by a CRC of the application configuration (see GetConfigurationHash). Note that only the configuration is hashed, so that
+     * the cache must be cleared if the binaries of any of the components (GAMs, DataSources, ...) are changed.
      * @param[in] data contains the initialisation data.
      * @return true if the parameters +Functions, +States, +Data and +Scheduler
      * exist and each inherit from ReferenceContainer.
@@ -173,6 +178,9 @@ public:
 
     /**
      * @brief Configures a RealTimeApplication (most of the work delegated to a RealTimeApplicationConfigurationBuilder).
+     * @details If a ConfigurationCache was declared and it can Load the databases for the current GetConfigurationHash, the
+     * RealTimeApplicationConfigurationBuilder is skipped and ConfigureApplication(ConfigurationDatabase &, ConfigurationDatabase &) is called
+     * with the loaded databases. Otherwise the databases resolved by the RealTimeApplicationConfigurationBuilder are stored in the ConfigurationCache.
      * @return true if all the RealTimeApplication could be successfully configured. When this function returns true it
      *  guarantees that all the MARTe components are ready to be used (e.g. the Scheduler may start to work and execute the GAMs).
      */
@@ -247,8 +255,21 @@ public:
      * by more than one GAM in the RealTimeState
      */
     bool CheckMultipleProducersWrites() const;
+
+    /**
+     * @brief Gets the CRC of the configuration that was used to Initialise this RealTimeApplication.
+     * @return the CRC of the configuration that was used to Initialise this RealTimeApplication.
+     */
+    uint32 GetConfigurationHash() const;
 private:
 
+    /**
+     * @brief Configures the RealTimeApplication using a RealTimeApplicationConfigurationBuilder and, if a ConfigurationCache
+     * was declared, stores the resolved databases in the cache.
+     * @return see ConfigureApplication
+     */
+    bool ConfigureApplicationWithBuilder();
+
     /**
      * @brief Calls GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory on all the GAM components.
      * @return true if all the GAM::AllocateInputSignalsMemory and GAM::AllocateOutputSignalsMemory calls return true.
@@ -328,6 +349,16 @@ private:
      */
     ReferenceT<RegisteredMethodsMessageFilter> filter;
 
+    /**
+     * The optional ConfigurationCache.
+     */
+    ReferenceT<RealTimeApplicationConfigurationCacheI> configurationCache;
+
+    /**
+     * The CRC of the configuration.
+     */
+    uint32 configurationHash;
+
     /**
      * Check if the GAM is defined in more than one RTT
      */
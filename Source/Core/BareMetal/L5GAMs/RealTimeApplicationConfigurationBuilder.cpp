@@ -1938,21 +1938,13 @@ bool RealTimeApplicationConfigurationBuilder::AddThreadCycleTime(const char8 *co
                         ret = dataSourcesDatabase.MoveRelative("Signals");
                     }
                     if (ret) {
-                        uint32 numberOfTimeSignals = dataSourcesDatabase.GetNumberOfChildren();
-                        bool found = false;
-                        uint32 j;
-                        ConfigurationDatabase dataSourcesDatabaseBeforeTimeSignals = dataSourcesDatabase;
-                        for (j = 0u; (j < numberOfTimeSignals) && (ret) && (!found); j++) {
-                            ret = dataSourcesDatabase.MoveToChild(j);
-                            StreamString qualifiedName;
+                        uint32 foundSignalId = 0u;
+                        bool found = dataSourcesSignalIndexCache.Read(signalName.Buffer(), foundSignalId);
+                        if (found) {
+                            ConfigurationDatabase dataSourcesDatabaseBeforeTimeSignals = dataSourcesDatabase;
+                            ret = dataSourcesDatabase.MoveToChild(foundSignalId);
                             if (ret) {
-                                ret = dataSourcesDatabase.Read("QualifiedName", qualifiedName);
-                            }
-                            if (ret) {
-                                found = (qualifiedName == signalName);
-                                if (found) {
-                                    ret = CheckTimeSignalInfo();
-                                }
+                                ret = CheckTimeSignalInfo();
                             }
                             if (ret) {
                                 dataSourcesDatabase = dataSourcesDatabaseBeforeTimeSignals;
@@ -2021,14 +2013,20 @@ bool RealTimeApplicationConfigurationBuilder::CheckTimeSignalInfo() {
     StreamString signalName;
     bool ret = dataSourcesDatabase.Read("QualifiedName", signalName);
 
+    //The time signals are either uint32 (micro-seconds) or uint64 (nano-seconds)
+    StreamString type = "uint32";
+    uint32 typeByteSize = static_cast<uint32>(sizeof(uint32));
     if (ret) {
-        StreamString type;
-
-        if (!dataSourcesDatabase.Read("Type", type)) {
-            ret = dataSourcesDatabase.Write("Type", "uint32");
+        StreamString typeRead;
+        if (!dataSourcesDatabase.Read("Type", typeRead)) {
+            ret = dataSourcesDatabase.Write("Type", type.Buffer());
+        }
+        else if (typeRead == "uint64") {
+            type = typeRead;
+            typeByteSize = static_cast<uint32>(sizeof(uint64));
         }
         else {
-            ret = (type == "uint32");
+            ret = (typeRead == "uint32");
         }
     }
     if (ret) {
@@ -2037,7 +2035,7 @@ bool RealTimeApplicationConfigurationBuilder::CheckTimeSignalInfo() {
         while ((signalName.SkipTokens(1u, ".")) && (ret)) {
             fullTypeTest += "Node.";
         }
-        fullTypeTest += "uint32";
+        fullTypeTest += type;
         StreamString fullType;
         if (!dataSourcesDatabase.Read("FullType", fullType)) {
             ret = dataSourcesDatabase.Write("FullType", fullTypeTest.Buffer());
@@ -2069,11 +2067,11 @@ bool RealTimeApplicationConfigurationBuilder::CheckTimeSignalInfo() {
     if (ret) {
         uint32 byteSize;
         if (!dataSourcesDatabase.Read("ByteSize", byteSize)) {
-            byteSize = static_cast<uint32>(sizeof(uint32));
+            byteSize = typeByteSize;
             ret = dataSourcesDatabase.Write("ByteSize", byteSize);
         }
         else {
-            ret = (byteSize == sizeof(uint32));
+            ret = (byteSize == typeByteSize);
         }
     }
     return ret;
@@ -2376,7 +2374,11 @@ bool RealTimeApplicationConfigurationBuilder::CheckProducersRanges(const uint32
 }
 
 bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
-    bool ret = dataSourcesDatabase.MoveRelative("Signals");
+    //The signals of the timing DataSource are searched in the dataSourcesSignalIndexCache, so that the number of lookups is linear with the number of functions.
+    bool ret = dataSourcesSignalIndexCache.MoveAbsolute(dataSourcesDatabase.GetName());
+    if (ret) {
+        ret = dataSourcesDatabase.MoveRelative("Signals");
+    }
     if (ret) {
         ret = functionsDatabase.MoveAbsolute("Functions");
     }
@@ -2397,22 +2399,13 @@ bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
             for (uint32 k = 0u; (postfix[k] != NULL) && ret; k++) {
                 StreamString signalNameStr = functionName;
                 signalNameStr += postfix[k];
-                uint32 numberOfPresentSignals = dataSourcesDatabase.GetNumberOfChildren();
-                bool found = false;
-                uint32 j;
+                uint32 foundSignalId = 0u;
+                bool found = dataSourcesSignalIndexCache.Read(signalNameStr.Buffer(), foundSignalId);
                 ConfigurationDatabase dataSourcesDatabaseBeforeSignalMove = dataSourcesDatabase;
-                for (j = 0u; (j < numberOfPresentSignals) && (ret) && (!found); j++) {
-                    dataSourcesDatabase = dataSourcesDatabaseBeforeSignalMove;
-                    ret = dataSourcesDatabase.MoveToChild(j);
-                    StreamString toAdd;
-                    if (ret) {
-                        ret = dataSourcesDatabase.Read("QualifiedName", toAdd);
-                    }
+                if (found) {
+                    ret = dataSourcesDatabase.MoveToChild(foundSignalId);
                     if (ret) {
-                        found = (toAdd == signalNameStr);
-                        if (found) {
-                            ret = CheckTimeSignalInfo();
-                        }
+                        ret = CheckTimeSignalInfo();
                     }
                 }
                 if (ret) {
@@ -2426,6 +2419,9 @@ bool RealTimeApplicationConfigurationBuilder::AddTimingSignals() {
                     if (ret) {
                         ret = dataSourcesDatabase.CreateRelative(newSignalIdx.Buffer());
                     }
+                    if (ret) {
+                        ret = dataSourcesSignalIndexCache.Write(signalNameStr.Buffer(), nextIndex);
+                    }
                     if (ret) {
                         ret = WriteTimeSignalInfo(signalNameStr.Buffer());
                     }
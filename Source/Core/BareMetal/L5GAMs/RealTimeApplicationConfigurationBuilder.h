@@ -1064,7 +1064,7 @@ private:
     bool WriteTimeSignalInfo(const char8 * const signalName);
 
     /**
-     * @brief Verifies if all the TimingDataSource signals have the correct properties (type = uint32, NumberOfElements = 1).
+     * @brief Verifies if all the TimingDataSource signals have the correct properties (type = uint32 or uint64, NumberOfElements = 1).
      * @return true if all the TimingDataSource signals have the correct properties.
      */
     bool CheckTimeSignalInfo();
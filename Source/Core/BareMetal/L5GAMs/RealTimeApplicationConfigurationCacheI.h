@@ -0,0 +1,86 @@
+/**
+ * @file RealTimeApplicationConfigurationCacheI.h
+ * @brief Header file for class RealTimeApplicationConfigurationCacheI
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeApplicationConfigurationCacheI
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMEAPPLICATIONCONFIGURATIONCACHEI_H_
+#define REALTIMEAPPLICATIONCONFIGURATIONCACHEI_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Abstract class to store the Functions and Data databases that are resolved by the RealTimeApplicationConfigurationBuilder.
+ * @details When a RealTimeApplication has a ConfigurationCache (see RealTimeApplication::Initialise), ConfigureApplication
+ * tries to Load the databases that were stored for a configuration with the same hash and, if successful, skips the
+ * RealTimeApplicationConfigurationBuilder (see RealTimeApplication::ConfigureApplication(ConfigurationDatabase &, ConfigurationDatabase &)).
+ * Otherwise, the databases resolved by the RealTimeApplicationConfigurationBuilder are Stored against the configuration hash.
+ */
+class DLL_API RealTimeApplicationConfigurationCacheI {
+public:
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~RealTimeApplicationConfigurationCacheI() {
+    }
+
+    /**
+     * @brief Loads the databases that were stored for a configuration with hash \a configurationHash.
+     * @param[in] configurationHash the hash of the RealTimeApplication configuration.
+     * @param[out] functionsDatabaseOut where to write the Functions database.
+     * @param[out] dataSourcesDatabaseOut where to write the Data database.
+     * @return true if databases for a configuration with hash \a configurationHash exist and could be loaded.
+     */
+    virtual bool Load(const uint32 configurationHash,
+                      ConfigurationDatabase &functionsDatabaseOut,
+                      ConfigurationDatabase &dataSourcesDatabaseOut) = 0;
+
+    /**
+     * @brief Stores the databases resolved for a configuration with hash \a configurationHash, replacing any previously stored databases.
+     * @param[in] configurationHash the hash of the RealTimeApplication configuration.
+     * @param[in] functionsDatabaseIn the Functions database to store.
+     * @param[in] dataSourcesDatabaseIn the Data database to store.
+     * @return true if the databases were successfully stored.
+     */
+    virtual bool Store(const uint32 configurationHash,
+                       ConfigurationDatabase &functionsDatabaseIn,
+                       ConfigurationDatabase &dataSourcesDatabaseIn) = 0;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMEAPPLICATIONCONFIGURATIONCACHEI_H_ */
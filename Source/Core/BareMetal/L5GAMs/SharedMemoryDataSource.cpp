@@ -0,0 +1,319 @@
+/**
+ * @file SharedMemoryDataSource.cpp
+ * @brief Source file for class SharedMemoryDataSource
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "MemoryMapInputBroker.h"
+#include "SharedMemory.h"
+#include "SharedMemoryDataSource.h"
+#include "SharedMemoryOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Rounds \a value up to a multiple of SHARED_MEMORY_DATASOURCE_ALIGNMENT.
+ */
+static uint32 SharedMemoryDataSourceAlign(const uint32 value) {
+    return (((value + SHARED_MEMORY_DATASOURCE_ALIGNMENT) - 1u) / SHARED_MEMORY_DATASOURCE_ALIGNMENT) * SHARED_MEMORY_DATASOURCE_ALIGNMENT;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemoryDataSource::SharedMemoryDataSource() :
+        MemoryDataSourceI() {
+    removeOnExit = true;
+    segment = NULL_PTR(uint8 *);
+    segmentSize = 0u;
+    firstBufferOffset = 0u;
+    bufferStride = 0u;
+}
+
+SharedMemoryDataSource::~SharedMemoryDataSource() {
+    if (segment != NULL_PTR(uint8 *)) {
+        void *segmentAddress = reinterpret_cast<void *>(segment);
+        SharedMemory::Close(segmentAddress, segmentSize);
+        segment = NULL_PTR(uint8 *);
+        if (removeOnExit) {
+            (void) SharedMemory::Remove(sharedMemoryName.Buffer());
+        }
+    }
+    //The signal memory belongs to the segment. Do not let MemoryDataSourceI free it.
+    memory = NULL_PTR(uint8 *);
+}
+
+bool SharedMemoryDataSource::Initialise(StructuredDataI & data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    //The memory is never allocated from a heap.
+    memoryHeap = NULL_PTR(HeapI *);
+    if (ok) {
+        StreamString name;
+        ok = data.Read("SharedMemoryName", name);
+        if (ok) {
+            ok = (name.Size() > 0u);
+        }
+        if (ok) {
+            if (name[0u] != '/') {
+                sharedMemoryName = "/";
+            }
+            sharedMemoryName += name;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SharedMemoryName shall be specified");
+        }
+    }
+    if (ok) {
+        uint32 removeOnExitUInt32 = 1u;
+        (void) data.Read("RemoveOnExit", removeOnExitUInt32);
+        removeOnExit = (removeOnExitUInt32 == 1u);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::AllocateMemory() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    bool ok = (segment == NULL_PTR(uint8 *));
+    if (ok) {
+        ok = (nOfSignals > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "No signals defined for DataSource with name %s", GetName());
+        }
+    }
+    if (ok) {
+        signalOffsets = new uint32[nOfSignals];
+        signalSize = new uint32[nOfSignals];
+    }
+    stateMemorySize = 0u;
+    for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+        uint32 thisSignalMemorySize;
+        ok = GetSignalByteSize(s, thisSignalMemorySize);
+        if (ok) {
+            ok = (thisSignalMemorySize > 0u);
+        }
+        if (ok) {
+            /*lint -e{613} signalOffsets and signalSize allocated before.*/
+            signalOffsets[s] = stateMemorySize;
+            /*lint -e{613} signalOffsets and signalSize allocated before.*/
+            signalSize[s] = thisSignalMemorySize;
+            stateMemorySize += (thisSignalMemorySize * numberOfBuffers);
+        }
+    }
+    uint32 numberOfStateBuffers = GetNumberOfStatefulMemoryBuffers();
+    if (ok) {
+        ok = (numberOfStateBuffers > 0u);
+    }
+    uint32 signalTableOffset = SharedMemoryDataSourceAlign(static_cast<uint32>(sizeof(SharedMemoryDataSourceHeader)));
+    if (ok) {
+        totalMemorySize = stateMemorySize * numberOfStateBuffers;
+        firstBufferOffset = SharedMemoryDataSourceAlign(signalTableOffset + (nOfSignals * static_cast<uint32>(sizeof(SharedMemoryDataSourceSignal))));
+        bufferStride = SharedMemoryDataSourceAlign(SHARED_MEMORY_DATASOURCE_ALIGNMENT + stateMemorySize);
+        segmentSize = firstBufferOffset + (bufferStride * numberOfStateBuffers);
+        segment = reinterpret_cast<uint8 *>(SharedMemory::Create(sharedMemoryName.Buffer(), segmentSize));
+        ok = (segment != NULL_PTR(uint8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::OSError, "Could not create the shared memory segment %s", sharedMemoryName.Buffer());
+        }
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(segment, '\0', segmentSize);
+    }
+    if (ok) {
+        //Buffer 0 is the beginning of the signal memory as seen by the MemoryDataSourceI.
+        memory = &segment[firstBufferOffset + SHARED_MEMORY_DATASOURCE_ALIGNMENT];
+    }
+    /*lint -e{927} -e{826} the segment is aligned and large enough to hold the header and the signal table.*/
+    SharedMemoryDataSourceSignal *signalTable = (ok) ? (reinterpret_cast<SharedMemoryDataSourceSignal *>(&segment[signalTableOffset])) : (NULL_PTR(SharedMemoryDataSourceSignal *));
+    for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+        StreamString signalName;
+        ok = GetSignalName(s, signalName);
+        if (ok) {
+            uint32 nameSize = static_cast<uint32>(signalName.Size());
+            if (nameSize >= SHARED_MEMORY_DATASOURCE_NAME_SIZE) {
+                nameSize = (SHARED_MEMORY_DATASOURCE_NAME_SIZE - 1u);
+            }
+            ok = MemoryOperationsHelper::Copy(&signalTable[s].name[0], signalName.Buffer(), nameSize);
+        }
+        uint8 numberOfDimensions = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfDimensions(s, numberOfDimensions);
+        }
+        uint32 numberOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(s, numberOfElements);
+        }
+        if (ok) {
+            signalTable[s].type = static_cast<uint32>(GetSignalType(s).all);
+            signalTable[s].numberOfDimensions = numberOfDimensions;
+            signalTable[s].numberOfElements = numberOfElements;
+            /*lint -e{613} signalOffsets and signalSize allocated before.*/
+            signalTable[s].offset = signalOffsets[s];
+            /*lint -e{613} signalOffsets and signalSize allocated before.*/
+            signalTable[s].byteSize = signalSize[s] * numberOfBuffers;
+        }
+    }
+    if (ok) {
+        /*lint -e{927} -e{826} the segment is aligned and large enough to hold the header.*/
+        SharedMemoryDataSourceHeader *segmentHeader = reinterpret_cast<SharedMemoryDataSourceHeader *>(segment);
+        segmentHeader->version = SHARED_MEMORY_DATASOURCE_VERSION;
+        segmentHeader->numberOfSignals = nOfSignals;
+        segmentHeader->numberOfStateBuffers = numberOfStateBuffers;
+        segmentHeader->stateMemorySize = stateMemorySize;
+        segmentHeader->signalTableOffset = signalTableOffset;
+        segmentHeader->firstBufferOffset = firstBufferOffset;
+        segmentHeader->bufferStride = bufferStride;
+        segmentHeader->lastWrittenBuffer = 0u;
+        //Publish the segment only after it is fully described.
+        Atomic::StoreRelease(&segmentHeader->magic, SHARED_MEMORY_DATASOURCE_MAGIC);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                                   const uint32 bufferIdx,
+                                                   void *&signalAddress) {
+    bool ok = (bufferIdx < GetNumberOfStatefulMemoryBuffers());
+    if (ok) {
+        ok = (signalIdx < GetNumberOfSignals());
+    }
+    if (ok) {
+        ok = (segment != NULL_PTR(uint8 *));
+    }
+    if (ok) {
+        uint32 offset = 0u;
+        if (signalOffsets != NULL_PTR(uint32 *)) {
+            offset = signalOffsets[signalIdx];
+        }
+        offset += (firstBufferOffset + (bufferStride * bufferIdx) + SHARED_MEMORY_DATASOURCE_ALIGNMENT);
+        signalAddress = reinterpret_cast<void *>(&segment[offset]);
+    }
+    return ok;
+}
+
+const char8 *SharedMemoryDataSource::GetBrokerName(StructuredDataI &data,
+                                                   const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    float32 freq;
+    if (!data.Read("Frequency", freq)) {
+        freq = -1.0F;
+    }
+    uint32 samples;
+    if (!data.Read("Samples", samples)) {
+        samples = 1u;
+    }
+    if ((freq < 0.F) && (samples == 1u)) {
+        if (direction == InputSignals) {
+            brokerName = "MemoryMapInputBroker";
+        }
+        else {
+            brokerName = "SharedMemoryOutputBroker";
+        }
+    }
+    return brokerName;
+}
+
+bool SharedMemoryDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
+                                             const char8 * const functionName,
+                                             void * const gamMemPtr) {
+    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(InputSignals, *this, functionName, gamMemPtr, true);
+    }
+    if (ok) {
+        if (broker->GetNumberOfCopies() > 0u) {
+            ok = inputBrokers.Insert(broker);
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                              const char8 * const functionName,
+                                              void * const gamMemPtr) {
+    ReferenceT<SharedMemoryOutputBroker> broker("SharedMemoryOutputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
+    }
+    if (ok) {
+        if (broker->GetNumberOfCopies() > 0u) {
+            ok = outputBrokers.Insert(broker);
+        }
+    }
+    return ok;
+}
+
+/*lint -e{715} the segment does not depend on the state.*/
+bool SharedMemoryDataSource::PrepareNextState(const char8 * const currentStateName,
+                                              const char8 * const nextStateName) {
+    return true;
+}
+
+bool SharedMemoryDataSource::Synchronise() {
+    return true;
+}
+
+SharedMemoryDataSourceBufferHeader *SharedMemoryDataSource::GetBufferHeader(const uint32 bufferIdx) {
+    /*lint -e{927} -e{826} -e{613} each state buffer starts with an aligned SharedMemoryDataSourceBufferHeader.*/
+    return reinterpret_cast<SharedMemoryDataSourceBufferHeader *>(&segment[firstBufferOffset + (bufferStride * bufferIdx)]);
+}
+
+void SharedMemoryDataSource::BeginWrite(const uint32 bufferIdx) {
+    SharedMemoryDataSourceBufferHeader *bufferHeader = GetBufferHeader(bufferIdx);
+    //Only the real-time thread writes the sequence, so that a plain read is sufficient.
+    Atomic::StoreRelease(&bufferHeader->sequence, bufferHeader->sequence + 1u);
+    //The odd sequence must be visible before any of the data stores.
+    Atomic::MemoryFence();
+}
+
+void SharedMemoryDataSource::EndWrite(const uint32 bufferIdx) {
+    SharedMemoryDataSourceBufferHeader *bufferHeader = GetBufferHeader(bufferIdx);
+    Atomic::StoreRelease(&bufferHeader->sequence, bufferHeader->sequence + 1u);
+    /*lint -e{927} -e{826} -e{613} the segment starts with the SharedMemoryDataSourceHeader.*/
+    SharedMemoryDataSourceHeader *segmentHeader = reinterpret_cast<SharedMemoryDataSourceHeader *>(segment);
+    Atomic::StoreRelease(&segmentHeader->lastWrittenBuffer, bufferIdx);
+}
+
+const char8 *SharedMemoryDataSource::GetSharedMemoryName() {
+    return sharedMemoryName.Buffer();
+}
+
+CLASS_REGISTER(SharedMemoryDataSource, "1.0")
+
+}
@@ -0,0 +1,333 @@
+/**
+ * @file SharedMemoryDataSource.h
+ * @brief Header file for class SharedMemoryDataSource
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYDATASOURCE_H_
+#define SHAREDMEMORYDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Identifies a segment created by a SharedMemoryDataSource ("MSHM").
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_MAGIC = 0x4D48534Du;
+
+/**
+ * Version of the segment layout.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_VERSION = 1u;
+
+/**
+ * Maximum length (including the terminator) of a signal name in the segment signal table.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_NAME_SIZE = 64u;
+
+/**
+ * Alignment of each state buffer in the segment (one cache line), so that the sequence of a buffer never shares a cache line with
+ * the data of another buffer.
+ */
+static const uint32 SHARED_MEMORY_DATASOURCE_ALIGNMENT = 64u;
+
+/**
+ * @brief First bytes of a SharedMemoryDataSource segment.
+ * @details All the offsets are in bytes and relative to the beginning of the segment.
+ */
+struct SharedMemoryDataSourceHeader {
+    /**
+     * SHARED_MEMORY_DATASOURCE_MAGIC. Written last, so that a reader never sees a partially described segment.
+     */
+    volatile uint32 magic;
+
+    /**
+     * SHARED_MEMORY_DATASOURCE_VERSION.
+     */
+    uint32 version;
+
+    /**
+     * Number of SharedMemoryDataSourceSignal entries in the signal table.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * Number of state buffers (see DataSourceI::GetNumberOfStatefulMemoryBuffers).
+     */
+    uint32 numberOfStateBuffers;
+
+    /**
+     * Size of the signal data of each state buffer.
+     */
+    uint32 stateMemorySize;
+
+    /**
+     * Offset of the signal table.
+     */
+    uint32 signalTableOffset;
+
+    /**
+     * Offset of the first state buffer (which starts with a SharedMemoryDataSourceBufferHeader).
+     */
+    uint32 firstBufferOffset;
+
+    /**
+     * Distance between two consecutive state buffers.
+     */
+    uint32 bufferStride;
+
+    /**
+     * Index of the state buffer that was last written.
+     */
+    volatile uint32 lastWrittenBuffer;
+};
+
+/**
+ * @brief Description of a signal in the segment signal table.
+ */
+struct SharedMemoryDataSourceSignal {
+    /**
+     * The signal name (truncated to SHARED_MEMORY_DATASOURCE_NAME_SIZE - 1 characters).
+     */
+    char8 name[SHARED_MEMORY_DATASOURCE_NAME_SIZE];
+
+    /**
+     * TypeDescriptor::all of the signal type.
+     */
+    uint32 type;
+
+    /**
+     * The signal number of dimensions.
+     */
+    uint32 numberOfDimensions;
+
+    /**
+     * The signal number of elements.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Offset of the signal w.r.t. the beginning of the data of a state buffer.
+     */
+    uint32 offset;
+
+    /**
+     * The signal size in bytes (times NumberOfBuffers).
+     */
+    uint32 byteSize;
+};
+
+/**
+ * @brief Header of each state buffer in the segment.
+ * @details The sequence implements a seqlock: it is odd while the buffer is being written and even otherwise.
+ * The buffer data starts SHARED_MEMORY_DATASOURCE_ALIGNMENT bytes after the header.
+ */
+struct SharedMemoryDataSourceBufferHeader {
+    /**
+     * Incremented before and after each write of the buffer.
+     */
+    volatile uint32 sequence;
+};
+
+/**
+ * @brief A MemoryDataSourceI whose signal memory lives in a named shared-memory segment (see SharedMemory), so that the signals
+ * can be read by other processes without any copy through a socket.
+ * @details The segment starts with a SharedMemoryDataSourceHeader, followed by a table with one SharedMemoryDataSourceSignal per
+ * signal and by the state buffers. Each state buffer is preceded by a SharedMemoryDataSourceBufferHeader whose sequence implements a seqlock:
+ * the SharedMemoryOutputBroker makes it odd before copying the GAM signals into the buffer and even again after the copy.
+ * The real-time thread therefore never waits for the readers; a reader (see SharedMemoryReader) retries when the sequence is odd or changed
+ * while it was copying.
+ *
+ * The segment is created in AllocateMemory (i.e. when all the signal properties are known) and, unless RemoveOnExit = 0, removed by the destructor.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +SharedMemoryDataSource_Name = {
+ *    Class = SharedMemoryDataSource
+ *    SharedMemoryName = "/MARTeDiagnostics" //Compulsory. Name of the segment. A '/' is prepended if missing.
+ *    RemoveOnExit = 1 //Optional. Default = 1. If 0 the segment is left in the system after the DataSource is destroyed.
+ *    NumberOfBuffers = 1 //Optional. See MemoryDataSourceI.
+ *    Signals = {
+ *        ...
+ *    }
+ * }
+ * </pre>
+ */
+class DLL_API SharedMemoryDataSource: public MemoryDataSourceI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryDataSource();
+
+    /**
+     * @brief Destructor. Unmaps the segment and, if RemoveOnExit, removes it.
+     */
+    virtual ~SharedMemoryDataSource();
+
+    /**
+     * @brief See MemoryDataSourceI::Initialise. Reads the SharedMemoryName and the RemoveOnExit parameters.
+     * @param[in] data the configuration data.
+     * @return true if MemoryDataSourceI::Initialise returns true and the SharedMemoryName is specified.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief Creates the segment, with the same signal layout as MemoryDataSourceI::AllocateMemory, and writes the header and the signal table.
+     * @return true if the segment can be created and mapped.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief See MemoryDataSourceI::GetSignalMemoryBuffer. Returns the address of the signal inside the state buffer \a bufferIdx of the segment.
+     * @param[in] signalIdx the index of the signal.
+     * @param[in] bufferIdx the index of the state buffer.
+     * @param[out] signalAddress the address of the signal.
+     * @return true if the signalIdx and the bufferIdx exist.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+                                       const uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return MemoryMapInputBroker for InputSignals and SharedMemoryOutputBroker for OutputSignals.
+     * NULL if Frequency is set or if Samples > 1.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief Adds a MemoryMapInputBroker for the \a functionName input signals.
+     * @param[out] inputBrokers where the broker is added.
+     * @param[in] functionName the name of the function.
+     * @param[in] gamMemPtr the GAM memory.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
+                                 const char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Adds a SharedMemoryOutputBroker for the \a functionName output signals.
+     * @param[out] outputBrokers where the broker is added.
+     * @param[in] functionName the name of the function.
+     * @param[in] gamMemPtr the GAM memory.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                  const char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief NOOP. The data is published by the SharedMemoryOutputBroker.
+     * @return true.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Opens the write of the state buffer \a bufferIdx (makes its sequence odd).
+     * @param[in] bufferIdx the index of the state buffer.
+     * @pre
+     *   AllocateMemory() && bufferIdx < GetNumberOfStatefulMemoryBuffers()
+     */
+    void BeginWrite(const uint32 bufferIdx);
+
+    /**
+     * @brief Closes the write of the state buffer \a bufferIdx (makes its sequence even) and marks it as the last written buffer.
+     * @param[in] bufferIdx the index of the state buffer.
+     * @pre
+     *   BeginWrite(bufferIdx)
+     */
+    void EndWrite(const uint32 bufferIdx);
+
+    /**
+     * @brief Gets the name of the segment.
+     * @return the name of the segment.
+     */
+    const char8 *GetSharedMemoryName();
+
+private:
+
+    /**
+     * Gets the header of the state buffer \a bufferIdx.
+     */
+    SharedMemoryDataSourceBufferHeader *GetBufferHeader(const uint32 bufferIdx);
+
+    /**
+     * The name of the segment.
+     */
+    StreamString sharedMemoryName;
+
+    /**
+     * Remove the segment in the destructor?
+     */
+    bool removeOnExit;
+
+    /**
+     * The address where the segment is mapped.
+     */
+    uint8 *segment;
+
+    /**
+     * The size of the segment.
+     */
+    uint32 segmentSize;
+
+    /**
+     * See SharedMemoryDataSourceHeader::firstBufferOffset.
+     */
+    uint32 firstBufferOffset;
+
+    /**
+     * See SharedMemoryDataSourceHeader::bufferStride.
+     */
+    uint32 bufferStride;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYDATASOURCE_H_ */
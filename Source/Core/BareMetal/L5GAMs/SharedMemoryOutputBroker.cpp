@@ -0,0 +1,89 @@
+/**
+ * @file SharedMemoryOutputBroker.cpp
+ * @brief Source file for class SharedMemoryOutputBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryOutputBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "SharedMemoryOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemoryOutputBroker::SharedMemoryOutputBroker() :
+        MemoryMapOutputBroker() {
+    sharedMemoryDataSource = NULL_PTR(SharedMemoryDataSource *);
+}
+
+SharedMemoryOutputBroker::~SharedMemoryOutputBroker() {
+    /*lint -e{1740} sharedMemoryDataSource contains a copy of a pointer. No need to be freed.*/
+}
+
+bool SharedMemoryOutputBroker::Init(const SignalDirection direction,
+                                    DataSourceI &dataSourceIn,
+                                    const char8 * const functionName,
+                                    void * const gamMemoryAddress) {
+    return Init(direction, dataSourceIn, functionName, gamMemoryAddress, false);
+}
+
+bool SharedMemoryOutputBroker::Init(const SignalDirection direction,
+                                    DataSourceI &dataSourceIn,
+                                    const char8 * const functionName,
+                                    void * const gamMemoryAddress,
+                                    const bool optim) {
+    sharedMemoryDataSource = dynamic_cast<SharedMemoryDataSource *>(&dataSourceIn);
+    bool ok = (sharedMemoryDataSource != NULL_PTR(SharedMemoryDataSource *));
+    if (ok) {
+        ok = MemoryMapOutputBroker::Init(direction, dataSourceIn, functionName, gamMemoryAddress, optim);
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "The SharedMemoryOutputBroker can only be used with a SharedMemoryDataSource");
+    }
+    return ok;
+}
+
+bool SharedMemoryOutputBroker::Execute() {
+    bool ok = (sharedMemoryDataSource != NULL_PTR(SharedMemoryDataSource *));
+    if (ok) {
+        uint32 bufferIdx = sharedMemoryDataSource->GetCurrentStateBuffer();
+        sharedMemoryDataSource->BeginWrite(bufferIdx);
+        ok = MemoryMapOutputBroker::Execute();
+        sharedMemoryDataSource->EndWrite(bufferIdx);
+    }
+    return ok;
+}
+
+CLASS_REGISTER(SharedMemoryOutputBroker, "1.0")
+
+}
@@ -0,0 +1,101 @@
+/**
+ * @file SharedMemoryOutputBroker.h
+ * @brief Header file for class SharedMemoryOutputBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryOutputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYOUTPUTBROKER_H_
+#define SHAREDMEMORYOUTPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "MemoryMapOutputBroker.h"
+#include "SharedMemoryDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief MemoryMapOutputBroker which publishes the copied signals to the readers of a SharedMemoryDataSource.
+ * @details The copy into the current state buffer is enclosed between SharedMemoryDataSource::BeginWrite and SharedMemoryDataSource::EndWrite,
+ * so that the seqlock sequence of the buffer is odd while the copy is ongoing. The broker never waits for the readers.
+ */
+class DLL_API SharedMemoryOutputBroker: public MemoryMapOutputBroker {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryOutputBroker();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~SharedMemoryOutputBroker();
+
+    /**
+     * @brief See MemoryMapBroker::Init.
+     * @return false if \a dataSourceIn is not a SharedMemoryDataSource or if MemoryMapBroker::Init fails.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief See MemoryMapBroker::Init.
+     * @return false if \a dataSourceIn is not a SharedMemoryDataSource or if MemoryMapBroker::Init fails.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress,
+                      const bool optim);
+
+    /**
+     * @brief Calls MemoryMapOutputBroker::Execute between SharedMemoryDataSource::BeginWrite and SharedMemoryDataSource::EndWrite.
+     * @return true if MemoryMapOutputBroker::Execute returns true.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * The SharedMemoryDataSource given in Init.
+     */
+    SharedMemoryDataSource *sharedMemoryDataSource;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYOUTPUTBROKER_H_ */
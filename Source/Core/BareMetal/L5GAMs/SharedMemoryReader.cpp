@@ -0,0 +1,205 @@
+/**
+ * @file SharedMemoryReader.cpp
+ * @brief Source file for class SharedMemoryReader
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryReader (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
+#include "SharedMemory.h"
+#include "SharedMemoryReader.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemoryReader::SharedMemoryReader() {
+    segment = NULL_PTR(const uint8 *);
+    segmentSize = 0u;
+    segmentHeader = NULL_PTR(const SharedMemoryDataSourceHeader *);
+    signalTable = NULL_PTR(const SharedMemoryDataSourceSignal *);
+}
+
+SharedMemoryReader::~SharedMemoryReader() {
+    Close();
+}
+
+bool SharedMemoryReader::Open(const char8 * const name) {
+    Close();
+    uint32 size = 0u;
+    void *address = SharedMemory::Open(name, size, true);
+    bool ok = (address != NULL_PTR(void *));
+    if (ok) {
+        segment = reinterpret_cast<const uint8 *>(address);
+        segmentSize = size;
+        ok = (segmentSize >= static_cast<uint32>(sizeof(SharedMemoryDataSourceHeader)));
+    }
+    if (ok) {
+        /*lint -e{927} -e{826} the size of the segment was checked before.*/
+        segmentHeader = reinterpret_cast<const SharedMemoryDataSourceHeader *>(segment);
+        uint32 magic = Atomic::LoadAcquire(&segmentHeader->magic);
+        ok = (magic == SHARED_MEMORY_DATASOURCE_MAGIC);
+    }
+    if (ok) {
+        ok = (segmentHeader->version == SHARED_MEMORY_DATASOURCE_VERSION);
+    }
+    if (ok) {
+        uint64 signalTableEnd = static_cast<uint64>(segmentHeader->signalTableOffset);
+        signalTableEnd += (static_cast<uint64>(segmentHeader->numberOfSignals) * sizeof(SharedMemoryDataSourceSignal));
+        uint64 buffersEnd = static_cast<uint64>(segmentHeader->firstBufferOffset);
+        buffersEnd += (static_cast<uint64>(segmentHeader->bufferStride) * segmentHeader->numberOfStateBuffers);
+        ok = (signalTableEnd <= segmentSize) && (buffersEnd <= segmentSize) && (segmentHeader->numberOfStateBuffers > 0u);
+        if (ok) {
+            ok = ((segmentHeader->stateMemorySize + SHARED_MEMORY_DATASOURCE_ALIGNMENT) <= segmentHeader->bufferStride);
+        }
+    }
+    if (ok) {
+        /*lint -e{927} -e{826} the signal table bounds were checked before.*/
+        signalTable = reinterpret_cast<const SharedMemoryDataSourceSignal *>(&segment[segmentHeader->signalTableOffset]);
+        for (uint32 s = 0u; (s < segmentHeader->numberOfSignals) && (ok); s++) {
+            ok = ((static_cast<uint64>(signalTable[s].offset) + signalTable[s].byteSize) <= segmentHeader->stateMemorySize);
+        }
+    }
+    if (!ok) {
+        Close();
+    }
+    return ok;
+}
+
+void SharedMemoryReader::Close() {
+    if (segment != NULL_PTR(const uint8 *)) {
+        /*lint -e{930} -e{9005} SharedMemory::Close does not write into the segment.*/
+        void *address = const_cast<void *>(reinterpret_cast<const void *>(segment));
+        SharedMemory::Close(address, segmentSize);
+    }
+    segment = NULL_PTR(const uint8 *);
+    segmentSize = 0u;
+    segmentHeader = NULL_PTR(const SharedMemoryDataSourceHeader *);
+    signalTable = NULL_PTR(const SharedMemoryDataSourceSignal *);
+}
+
+uint32 SharedMemoryReader::GetNumberOfSignals() const {
+    uint32 numberOfSignals = 0u;
+    if (segmentHeader != NULL_PTR(const SharedMemoryDataSourceHeader *)) {
+        numberOfSignals = segmentHeader->numberOfSignals;
+    }
+    return numberOfSignals;
+}
+
+const SharedMemoryDataSourceSignal *SharedMemoryReader::GetSignal(const uint32 signalIdx) const {
+    const SharedMemoryDataSourceSignal *signal = NULL_PTR(const SharedMemoryDataSourceSignal *);
+    if (signalIdx < GetNumberOfSignals()) {
+        signal = &signalTable[signalIdx];
+    }
+    return signal;
+}
+
+bool SharedMemoryReader::GetSignalIndex(const char8 * const signalName,
+                                        uint32 &signalIdx) const {
+    bool found = false;
+    uint32 numberOfSignals = GetNumberOfSignals();
+    for (uint32 s = 0u; (s < numberOfSignals) && (!found); s++) {
+        found = (StringHelper::CompareN(&signalTable[s].name[0], signalName, SHARED_MEMORY_DATASOURCE_NAME_SIZE) == 0);
+        if (found) {
+            signalIdx = s;
+        }
+    }
+    return found;
+}
+
+const char8 *SharedMemoryReader::GetSignalName(const uint32 signalIdx) const {
+    const SharedMemoryDataSourceSignal *signal = GetSignal(signalIdx);
+    return (signal != NULL_PTR(const SharedMemoryDataSourceSignal *)) ? (&signal->name[0]) : (NULL_PTR(const char8 *));
+}
+
+TypeDescriptor SharedMemoryReader::GetSignalType(const uint32 signalIdx) const {
+    TypeDescriptor type = InvalidType;
+    const SharedMemoryDataSourceSignal *signal = GetSignal(signalIdx);
+    if (signal != NULL_PTR(const SharedMemoryDataSourceSignal *)) {
+        type = TypeDescriptor(static_cast<uint16>(signal->type));
+    }
+    return type;
+}
+
+uint32 SharedMemoryReader::GetSignalNumberOfElements(const uint32 signalIdx) const {
+    const SharedMemoryDataSourceSignal *signal = GetSignal(signalIdx);
+    return (signal != NULL_PTR(const SharedMemoryDataSourceSignal *)) ? (signal->numberOfElements) : (0u);
+}
+
+uint32 SharedMemoryReader::GetSignalNumberOfDimensions(const uint32 signalIdx) const {
+    const SharedMemoryDataSourceSignal *signal = GetSignal(signalIdx);
+    return (signal != NULL_PTR(const SharedMemoryDataSourceSignal *)) ? (signal->numberOfDimensions) : (0u);
+}
+
+uint32 SharedMemoryReader::GetSignalByteSize(const uint32 signalIdx) const {
+    const SharedMemoryDataSourceSignal *signal = GetSignal(signalIdx);
+    return (signal != NULL_PTR(const SharedMemoryDataSourceSignal *)) ? (signal->byteSize) : (0u);
+}
+
+bool SharedMemoryReader::Read(const uint32 signalIdx,
+                              void * const destination,
+                              uint32 &sequence,
+                              const uint32 maxRetries) const {
+    const SharedMemoryDataSourceSignal *signal = GetSignal(signalIdx);
+    bool ok = (signal != NULL_PTR(const SharedMemoryDataSourceSignal *));
+    bool consistent = false;
+    for (uint32 attempt = 0u; (attempt < maxRetries) && (ok) && (!consistent); attempt++) {
+        /*lint -e{613} signal != NULL checked before.*/
+        uint32 bufferIdx = Atomic::LoadAcquire(&segmentHeader->lastWrittenBuffer);
+        if (bufferIdx >= segmentHeader->numberOfStateBuffers) {
+            bufferIdx = 0u;
+        }
+        uint32 bufferOffset = segmentHeader->firstBufferOffset + (segmentHeader->bufferStride * bufferIdx);
+        /*lint -e{927} -e{826} each state buffer starts with an aligned SharedMemoryDataSourceBufferHeader.*/
+        const SharedMemoryDataSourceBufferHeader *bufferHeader = reinterpret_cast<const SharedMemoryDataSourceBufferHeader *>(&segment[bufferOffset]);
+        uint32 before = Atomic::LoadAcquire(&bufferHeader->sequence);
+        if ((before & 1u) == 0u) {
+            /*lint -e{613} signal != NULL checked before.*/
+            ok = MemoryOperationsHelper::Copy(destination, &segment[bufferOffset + SHARED_MEMORY_DATASOURCE_ALIGNMENT + signal->offset], signal->byteSize);
+            //The data loads must complete before the sequence is read again.
+            Atomic::MemoryFence();
+            uint32 after = Atomic::LoadAcquire(&bufferHeader->sequence);
+            consistent = (before == after);
+            if (consistent) {
+                sequence = before;
+            }
+        }
+        if (!consistent) {
+            Atomic::Pause();
+        }
+    }
+    return (ok && consistent);
+}
+
+}
@@ -0,0 +1,183 @@
+/**
+ * @file SharedMemoryReader.h
+ * @brief Header file for class SharedMemoryReader
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryReader
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYREADER_H_
+#define SHAREDMEMORYREADER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "SharedMemoryDataSource.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Reads the signals published by a SharedMemoryDataSource from another process.
+ * @details The segment is mapped read-only and the signals are copied out of the last written state buffer using the seqlock protocol
+ * described in SharedMemoryDataSource: the copy is retried if the buffer sequence is odd (write ongoing) or if it changed during the copy.
+ * The reader never blocks the writer.
+ *
+ * Usage example (in the external process):
+ * <pre>
+ * SharedMemoryReader reader;
+ * if (reader.Open("/MARTeDiagnostics")) {
+ *     uint32 idx;
+ *     if (reader.GetSignalIndex("Counter", idx)) {
+ *         uint32 counter;
+ *         uint32 sequence;
+ *         (void) reader.Read(idx, &counter, sequence);
+ *     }
+ * }
+ * </pre>
+ */
+class DLL_API SharedMemoryReader {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    SharedMemoryReader();
+
+    /**
+     * @brief Destructor. Calls Close.
+     */
+    ~SharedMemoryReader();
+
+    /**
+     * @brief Maps the segment \a name and validates its header.
+     * @param[in] name the name of the segment (see SharedMemoryDataSource SharedMemoryName).
+     * @return true if the segment exists, was created by a SharedMemoryDataSource with the same layout version and is consistent with its size.
+     */
+    bool Open(const char8 * const name);
+
+    /**
+     * @brief Unmaps the segment.
+     */
+    void Close();
+
+    /**
+     * @brief Gets the number of signals in the segment.
+     * @return the number of signals in the segment or 0 if the reader is not open.
+     */
+    uint32 GetNumberOfSignals() const;
+
+    /**
+     * @brief Gets the index of the signal with name \a signalName.
+     * @param[in] signalName the name of the signal.
+     * @param[out] signalIdx the index of the signal.
+     * @return true if the signal exists.
+     */
+    bool GetSignalIndex(const char8 * const signalName,
+                        uint32 &signalIdx) const;
+
+    /**
+     * @brief Gets the name of the signal \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @return the name of the signal or NULL if \a signalIdx is not valid.
+     */
+    const char8 *GetSignalName(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the type of the signal \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @return the type of the signal or InvalidType if \a signalIdx is not valid.
+     */
+    TypeDescriptor GetSignalType(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the number of elements of the signal \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @return the number of elements of the signal or 0 if \a signalIdx is not valid.
+     */
+    uint32 GetSignalNumberOfElements(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the number of dimensions of the signal \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @return the number of dimensions of the signal or 0 if \a signalIdx is not valid.
+     */
+    uint32 GetSignalNumberOfDimensions(const uint32 signalIdx) const;
+
+    /**
+     * @brief Gets the size in bytes of the signal \a signalIdx.
+     * @param[in] signalIdx the index of the signal.
+     * @return the size in bytes of the signal or 0 if \a signalIdx is not valid.
+     */
+    uint32 GetSignalByteSize(const uint32 signalIdx) const;
+
+    /**
+     * @brief Copies a consistent snapshot of the signal \a signalIdx from the last written state buffer.
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] destination where to copy the signal (at least GetSignalByteSize(signalIdx) bytes).
+     * @param[out] sequence the sequence of the state buffer when the signal was copied. It increases by two every time the buffer is written.
+     * @param[in] maxRetries maximum number of attempts to get a consistent copy.
+     * @return true if a consistent copy was obtained in less than \a maxRetries attempts.
+     */
+    bool Read(const uint32 signalIdx,
+              void * const destination,
+              uint32 &sequence,
+              const uint32 maxRetries = 1000u) const;
+
+private:
+    /**
+     * Gets the signal table entry \a signalIdx (NULL if not valid).
+     */
+    const SharedMemoryDataSourceSignal *GetSignal(const uint32 signalIdx) const;
+
+    /**
+     * The address where the segment is mapped.
+     */
+    const uint8 *segment;
+
+    /**
+     * The size of the segment.
+     */
+    uint32 segmentSize;
+
+    /**
+     * The segment header.
+     */
+    const SharedMemoryDataSourceHeader *segmentHeader;
+
+    /**
+     * The signal table.
+     */
+    const SharedMemoryDataSourceSignal *signalTable;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYREADER_H_ */
@@ -51,6 +51,12 @@ namespace MARTe {
  *  for this GAM_NAME have been executed. The GAM_NAME_WriteTime holds the time elapsed from the beginning of the cycle
  *  until all the output brokers for this GAM_NAME have been executed. The GAM_NAME_ExecTime holds the time elapsed
  *  from the beginning of the cycle until this GAM_NAME has finished its execution.
+ *
+ * @details By default the times are stored in micro-seconds. If any of these signals is explicitly declared with Type = uint64
+ *  (either in the TimingDataSource Signals or by a GAM that reads it), the time is instead stored in nano-seconds.
+ *  Given that the thread cycle time signals are created before the GAM signals are resolved, a uint64 cycle time
+ *  must be declared in the TimingDataSource Signals (e.g. Signals = { STATE_NAME = { THREAD_NAME_CycleTime = { Type = uint64 } } }).
+ *  The conversion from HighResolutionTimer ticks is performed by the GAMSchedulerI using a HighResolutionTimerConverter.
  */
 class DLL_API TimingDataSource: public GAMDataSource {
 public:
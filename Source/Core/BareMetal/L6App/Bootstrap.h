@@ -65,7 +65,7 @@ public:
      * - Filename: the name of the file to be load;
      * - DefaultCPUs: sets the threads defaults CPUs (see ProcessorType::SetDefaultCPUs);\n
      * - SchedulerGranularity: sets the scheduler granularity in micro-seconds (i.e. any requests to sleep no more than this value, will busy sleep).
-     * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml and json;\n
+     * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml, json and bin (see BinaryConfiguration);\n
      * - MessageDestination (optional): the name of the Object that will receive the message upon program Start (see Loader::Initialise);\n
      * - MessageFunction (optional): the name of the Function to be called in the MessageDestination (see Loader::Initialise);\n
      * - FirstState (optional): the name of the FirstState in a RealTimeApplication (see RealTimeLoader::Initialise).
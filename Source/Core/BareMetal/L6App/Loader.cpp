@@ -30,6 +30,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "BinaryConfiguration.h"
 #include "ConfigurationDatabase.h"
 #include "JsonParser.h"
 #include "Loader.h"
@@ -51,6 +52,7 @@ Loader::Loader() :
         Object() {
     firstLoading = true;
     reloadLast = false;
+    incremental = false;
 }
 
 //lint -e{1551} purge must be called in the destructor
@@ -158,6 +160,9 @@ ErrorManagement::ErrorType Loader::Reconfigure(StreamI &configuration, StreamStr
             StandardParser parser(configuration, newParsedConfiguration, &errStream);
             ret.initialisationError = !parser.Parse();
         }
+        else if (parserType == "bin") {
+            ret.initialisationError = !BinaryConfiguration::Import(configuration, newParsedConfiguration, &errStream);
+        }
         else {
             ret = ErrorManagement::ParametersError;
             REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown Parser specified");
@@ -183,21 +188,27 @@ ErrorManagement::ErrorType Loader::ReconfigureImpl(StructuredDataI &configuratio
     if (!firstLoading) {
         ret = SendConfigurationMessage(preConfigMsg);
     }
+    const bool incrementalReconfiguration = ((!firstLoading) && (incremental));
     if (ret.ErrorsCleared()) {
-        Reference keepAlive = this;
-        uint32 nOfObjs = ObjectRegistryDatabase::Instance()->Size();
-        REPORT_ERROR(ErrorManagement::Debug, "Purging ObjectRegistryDatabase with %d objects", nOfObjs);
-        ObjectRegistryDatabase::Instance()->Purge();
-        nOfObjs = ObjectRegistryDatabase::Instance()->Size();
-        REPORT_ERROR(ErrorManagement::Debug, "Purge ObjectRegistryDatabase. Number of objects left: %d", nOfObjs);
-        ret.fatalError = !configuration.MoveToRoot();
-        //lint -e{1788} keepAlive variable is just to make sure this class is not removed...
-    }
-    if (ret.ErrorsCleared()) {
-        ret.initialisationError = !ObjectRegistryDatabase::Instance()->Initialise(configuration);
-        if (!ret.ErrorsCleared()) {
-            (void)errStream.Printf("%s", "Failed to initialise the ObjectRegistryDatabase");
-            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, errStream.Buffer());
+        if (incrementalReconfiguration) {
+            ret = ReconfigureIncremental(configuration, errStream);
+        }
+        else {
+            Reference keepAlive = this;
+            uint32 nOfObjs = ObjectRegistryDatabase::Instance()->Size();
+            REPORT_ERROR(ErrorManagement::Debug, "Purging ObjectRegistryDatabase with %d objects", nOfObjs);
+            ObjectRegistryDatabase::Instance()->Purge();
+            nOfObjs = ObjectRegistryDatabase::Instance()->Size();
+            REPORT_ERROR(ErrorManagement::Debug, "Purge ObjectRegistryDatabase. Number of objects left: %d", nOfObjs);
+            ret.fatalError = !configuration.MoveToRoot();
+            //lint -e{1788} keepAlive variable is just to make sure this class is not removed...
+            if (ret.ErrorsCleared()) {
+                ret.initialisationError = !ObjectRegistryDatabase::Instance()->Initialise(configuration);
+                if (!ret.ErrorsCleared()) {
+                    (void)errStream.Printf("%s", "Failed to initialise the ObjectRegistryDatabase");
+                    REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, errStream.Buffer());
+                }
+            }
         }
     }
     if (ret.ErrorsCleared()) {
@@ -236,9 +247,17 @@ ErrorManagement::ErrorType Loader::ReconfigureImpl(StructuredDataI &configuratio
                 }
             }
         }
-        //Always reload the keep alive objects
+        //Always reload the keep alive objects (unless they were never removed by an incremental reconfiguration)
         for (uint32 c=0u; c<keepAliveObjs.Size(); c++) {
-            bool retIns = ObjectRegistryDatabase::Instance()->Insert(keepAliveObjs.Get(c));
+            bool retIns = true;
+            bool alreadyInserted = false;
+            if (incrementalReconfiguration) {
+                Reference existing = ObjectRegistryDatabase::Instance()->Find(keepAliveObjs.Get(c)->GetName());
+                alreadyInserted = (existing == keepAliveObjs.Get(c));
+            }
+            if (!alreadyInserted) {
+                retIns = ObjectRegistryDatabase::Instance()->Insert(keepAliveObjs.Get(c));
+            }
             if (retIns) {
                 REPORT_ERROR_STATIC(ErrorManagement::Information, "Inserted keep alive object with name %s", keepAliveObjs.Get(c)->GetName());
             }
@@ -273,6 +292,119 @@ ErrorManagement::ErrorType Loader::ReconfigureImpl(StructuredDataI &configuratio
     return ret; 
 }
 
+ErrorManagement::ErrorType Loader::ReconfigureIncremental(StructuredDataI &configuration, StreamString &errStream) {
+    ErrorManagement::ErrorType ret;
+    ObjectRegistryDatabase *objDb = ObjectRegistryDatabase::Instance();
+    ConfigurationDatabase changedConfiguration;
+    ReferenceContainer toPurge;
+    ret.fatalError = !configuration.MoveToRoot();
+    if (ret.ErrorsCleared()) {
+        ret.fatalError = !parsedConfiguration.MoveToRoot();
+    }
+    //Find the new and modified objects
+    uint32 numberOfChildren = configuration.GetNumberOfChildren();
+    for (uint32 i = 0u; (ret.ErrorsCleared()) && (i < numberOfChildren); i++) {
+        StreamString nodeName = configuration.GetChildName(i);
+        //lint -e{9007} there are no side-effects on IsBuildToken or IsDomainToken.
+        bool isObject = (nodeName.Size() > 1u) && ((ReferenceContainer::IsBuildToken(nodeName[0u])) || (ReferenceContainer::IsDomainToken(nodeName[0u])));
+        if (isObject) {
+            isObject = !IsPreservedNode(nodeName.Buffer());
+        }
+        if (isObject) {
+            ret.fatalError = !configuration.MoveRelative(nodeName.Buffer());
+            StreamString newNode;
+            if (ret.ErrorsCleared()) {
+                ret.fatalError = !newNode.Printf("%!", configuration);
+            }
+            bool changed = true;
+            if (parsedConfiguration.MoveRelative(nodeName.Buffer())) {
+                StreamString lastNode;
+                if (lastNode.Printf("%!", parsedConfiguration)) {
+                    changed = (newNode != lastNode);
+                }
+                (void) parsedConfiguration.MoveToRoot();
+            }
+            Reference existing = objDb->Find(&(nodeName.Buffer()[1u]));
+            if ((!changed) && (!existing.IsValid())) {
+                changed = true;
+            }
+            if (ret.ErrorsCleared()) {
+                if (changed) {
+                    REPORT_ERROR(ErrorManagement::Debug, "Object %s to be (re)initialised", nodeName.Buffer());
+                    ret.fatalError = !changedConfiguration.CreateAbsolute(nodeName.Buffer());
+                    if (ret.ErrorsCleared()) {
+                        ret.fatalError = !configuration.Copy(changedConfiguration);
+                    }
+                    if ((ret.ErrorsCleared()) && (existing.IsValid())) {
+                        ret.fatalError = !toPurge.Insert(existing);
+                    }
+                }
+            }
+            if (ret.ErrorsCleared()) {
+                ret.fatalError = !configuration.MoveToRoot();
+            }
+        }
+    }
+    //Find the removed objects
+    numberOfChildren = parsedConfiguration.GetNumberOfChildren();
+    for (uint32 i = 0u; (ret.ErrorsCleared()) && (i < numberOfChildren); i++) {
+        StreamString nodeName = parsedConfiguration.GetChildName(i);
+        //lint -e{9007} there are no side-effects on IsBuildToken or IsDomainToken.
+        bool isObject = (nodeName.Size() > 1u) && ((ReferenceContainer::IsBuildToken(nodeName[0u])) || (ReferenceContainer::IsDomainToken(nodeName[0u])));
+        if (isObject) {
+            isObject = !IsPreservedNode(nodeName.Buffer());
+        }
+        if (isObject) {
+            if (!configuration.MoveRelative(nodeName.Buffer())) {
+                Reference existing = objDb->Find(&(nodeName.Buffer()[1u]));
+                if (existing.IsValid()) {
+                    REPORT_ERROR(ErrorManagement::Debug, "Object %s to be removed", nodeName.Buffer());
+                    ret.fatalError = !toPurge.Insert(existing);
+                }
+            }
+            else {
+                ret.fatalError = !configuration.MoveToRoot();
+            }
+        }
+    }
+    uint32 numberOfPurged = toPurge.Size();
+    for (uint32 i = 0u; (ret.ErrorsCleared()) && (i < numberOfPurged); i++) {
+        Reference obj = toPurge.Get(i);
+        ret.fatalError = !objDb->Delete(obj);
+        if (ret.ErrorsCleared()) {
+            ReferenceT<ReferenceContainer> container = obj;
+            if (container.IsValid()) {
+                container->Purge();
+            }
+        }
+    }
+    REPORT_ERROR(ErrorManagement::Information, "Incremental reconfiguration purged %d objects and is going to initialise %d objects", numberOfPurged,
+                 changedConfiguration.GetNumberOfChildren());
+    if (ret.ErrorsCleared()) {
+        ret.fatalError = !changedConfiguration.MoveToRoot();
+    }
+    if (ret.ErrorsCleared()) {
+        ret.initialisationError = !objDb->Initialise(changedConfiguration);
+        if (!ret.ErrorsCleared()) {
+            (void)errStream.Printf("%s", "Failed to initialise the ObjectRegistryDatabase");
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, errStream.Buffer());
+        }
+    }
+    if (ret.ErrorsCleared()) {
+        ret.fatalError = !configuration.MoveToRoot();
+    }
+    return ret;
+}
+
+bool Loader::IsPreservedNode(const char8 * const nodeName) {
+    bool preserved = (StringHelper::Compare(&nodeName[1u], "LoaderPostInit") == 0);
+    //lint -e{9007} keepAliveObjs size is not changed.
+    for (uint32 i = 0u; (!preserved) && (i < keepAliveObjs.Size()); i++) {
+        preserved = (StringHelper::Compare(&nodeName[1u], keepAliveObjs.Get(i)->GetName()) == 0);
+    }
+    return preserved;
+}
+
 ErrorManagement::ErrorType Loader::Reconfigure(StreamString &configuration, StreamString &errStream, uint32 hash) {
     ErrorManagement::ErrorType err;
     err.fatalError = !loaderHash.IsValid();
@@ -340,6 +472,19 @@ ErrorManagement::ErrorType Loader::PostInit() {
                     REPORT_ERROR(err, "ReloadLast shall be either set to true or false. %s is not supported.", reloadLastStr.Buffer());
                 }
             }
+            StreamString incrementalStr;
+            if ((err.ErrorsCleared()) && (postInitParameters->Read("Incremental", incrementalStr))) {
+                if (incrementalStr == "true") {
+                    incremental = true;
+                }
+                else if (incrementalStr == "false") {
+                    incremental = false;
+                }
+                else {
+                    err.parametersError = true;
+                    REPORT_ERROR(err, "Incremental shall be either set to true or false. %s is not supported.", incrementalStr.Buffer());
+                }
+            }
             AnyType arrayDescription = postInitParameters->GetType("KeepAlive");
             if(arrayDescription.GetDataPointer() != NULL_PTR(void *)) {
                 uint32 numberOfElements = arrayDescription.GetNumberOfElements(0u);
@@ -58,6 +58,7 @@ namespace MARTe {
  *        Class = ConfigurationDatabase
  *        ReloadLast = true //Optional. Reload old configuration in case of (re)configuration failure? Default = true. If true the FailedConfiguration message will not to be sent.
  *        KeepAlive = { "MyObj1" "MyObj2" "MyObj3" } //Optional. Array with name of the objects (at the root level) that shall not be purged and will always (i.e. even in case of error) be readded to the ObjectRegistryDatabase after a reconfiguration is triggered.
+ *        Incremental = false //Optional. If true a reconfiguration will only rebuild the root objects whose configuration changed (see Reconfigure). Default = false.
  *    }
  *    +Messages = {
  *      Class = ReferenceContainer
@@ -110,7 +111,7 @@ public:
      * @param[in] data the loader parameters: \n
      * - DefaultCPUs (optional): sets the threads defaults CPUs (see ProcessorType::SetDefaultCPUs);\n
      * - SchedulerGranularity (optional): sets the scheduler granularity in micro-seconds (i.e. any requests to sleep no more than this value, will busy sleep).
-     * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml and json;\n
+     * - Parser: the type of parser to be parse the \a configuration as one of:cdb, xml, json and bin (a database exported with BinaryConfiguration::Export);\n
      * - MessageDestination (optional): the name of the Object that will receive the message when Start is called;\n
      * - MessageFunction (optional, but compulsory if MessageDestination is set): the name of the Function to be called in the MessageDestination.
      * @param[in] configuration the MARTe configuration stream to be loaded (and parsed using the Parser defined above).
@@ -134,6 +135,11 @@ public:
      * @brief Allows to reconfigure an application.
      * @details It will attempt to call ObjectRegistryDatabase::Initialise.
      * It will call ObjectRegistryDatabase::Purge before applying the new configuration.
+     * If the LoaderPostInit Incremental parameter is true, the new configuration is instead compared against the last valid configuration
+     * and only the root objects whose configuration node was removed, added or modified are purged and (re)initialised. The objects whose configuration did not
+     * change (together with the LoaderPostInit and the KeepAlive objects) are left untouched, i.e. they keep running. Note that an unchanged object holding
+     * references (resolved at Initialise time) to a modified object will keep pointing at the purged instance and should thus also be modified.
+     * If the incremental reconfiguration fails, and ReloadLast is set, the last valid configuration is fully reloaded (see ReloadLastValidConfiguration).
      * After this function is successfully called, the GetLastValidConfiguration will return the updated configuration.
      * @param[in] configuration the StructuredDataI with the new configuration to be loaded.
      * @param[out] errStream any errors that may be raised.
@@ -201,6 +207,21 @@ protected:
      */
     ErrorManagement::ErrorType ReconfigureImpl(StructuredDataI &configuration, StreamString &errStream, bool sendPostMsg);
 
+    /**
+     * @brief Purges and (re)initialises only the root objects whose configuration differs from the last valid configuration.
+     * @param[in] configuration the new configuration to be applied.
+     * @param[out] errStream any errors that may be raised.
+     * @return ErrorManagement::NoError if the modified objects are successfully (re)initialised.
+     */
+    ErrorManagement::ErrorType ReconfigureIncremental(StructuredDataI &configuration, StreamString &errStream);
+
+    /**
+     * @brief Checks if a root configuration node is to be left untouched by an incremental reconfiguration (i.e. the LoaderPostInit and the KeepAlive objects).
+     * @param[in] nodeName the name of the configuration node, including the build or domain token.
+     * @return true if the node is the LoaderPostInit or one of the KeepAlive objects.
+     */
+    bool IsPreservedNode(const char8 * const nodeName);
+
 
     /**
      * @brief The loader parameters.
@@ -259,6 +280,11 @@ private:
      */
     bool reloadLast;
 
+    /**
+     * If true the reconfigurations will only rebuild the root objects whose configuration changed.
+     */
+    bool incremental;
+
     /**
      * Hash component.
      */
@@ -70,13 +70,19 @@ ErrorManagement::ErrorType RealTimeLoader::PostReconfigure() {
     ObjectRegistryDatabase *objDb = ObjectRegistryDatabase::Instance();
     uint32 nOfObjs = objDb->Size();
     bool found = false;
+    ReferenceContainer configuredApps;
     //start all the RT Applications
     for (uint32 n = 0u; (ret) && (n < nOfObjs); n++) {
         ReferenceT<RealTimeApplication> rtApp = objDb->Get(n);
         if (rtApp.IsValid()) {
             found = true;
-            ret.initialisationError = !rtApps.Insert(rtApp);
-            if (ret.ErrorsCleared()) {
+            //Applications that were kept by an incremental reconfiguration are already configured (and possibly running)
+            bool alreadyConfigured = false;
+            for (uint32 a = 0u; (!alreadyConfigured) && (a < rtApps.Size()); a++) {
+                alreadyConfigured = (rtApps.Get(a) == rtApp);
+            }
+            ret.initialisationError = !configuredApps.Insert(rtApp);
+            if ((ret.ErrorsCleared()) && (!alreadyConfigured)) {
                 ret.initialisationError = !rtApp->ConfigureApplication();
                 if (!ret) {
                     REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to Configure RealTimeApplication");
@@ -84,6 +90,14 @@ ErrorManagement::ErrorType RealTimeLoader::PostReconfigure() {
             }
         }
     }
+    //Only remove the references, Purge would also purge the applications
+    while (rtApps.Size() > 0u) {
+        (void) rtApps.Delete(rtApps.Get(0u));
+    }
+    //lint -e{9007} configuredApps size is not changed.
+    for (uint32 a = 0u; (ret) && (a < configuredApps.Size()); a++) {
+        ret.fatalError = !rtApps.Insert(configuredApps.Get(a));
+    }
     if (!found) {
         ret.parametersError = true;
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Could not find a RealTimeApplication");
@@ -74,6 +74,7 @@ public:
 
     /**
      * @brief Configures all the RealTimeApplication instances.
+     * @details The RealTimeApplication instances that were already configured (i.e. that were kept by an incremental reconfiguration, see Loader::Reconfigure) are not configured again.
      * @return ErrorManagement::NoError if at least one RealTimeApplication is found and all RealTimeApplication instances configuration is sucessfully executed.
      */
     virtual ErrorManagement::ErrorType PostReconfigure();
@@ -203,6 +203,17 @@ public:
      */
     bool IsConnected() const;
 
+    /**
+     * @brief Enables or disables the coalescing of small writes (Nagle's algorithm).
+     * @details Request/reply protocols which write a reply in several small pieces (e.g. the HTTP chunked transfer encoding)
+     * should disable the coalescing, otherwise each reply can be delayed until the peer acknowledges the previous segment.
+     * @param[in] noDelay if true the data is sent as soon as it is written.
+     * @return true if the option was successfully set.
+     * @pre
+     *   IsValid()
+     */
+    bool SetNoDelay(const bool noDelay);
+
     /**
      * @brief Accepts the next connection in the pending queue returning the relative socket.
      * @param[in] timeout is the desired timeout.
@@ -97,6 +97,14 @@ bool BasicTCPSocket::IsConnected() const {
 
 }
 
+bool BasicTCPSocket::SetNoDelay(const bool noDelay) {
+    bool ret = false;
+#ifdef LWIP_ENABLED
+
+#endif
+    return ret;
+}
+
 BasicTCPSocket *BasicTCPSocket::WaitConnection(const TimeoutType &timeout,
                                                BasicTCPSocket *client) {
     BasicTCPSocket *ret = static_cast<BasicTCPSocket *>(NULL);
@@ -235,6 +235,23 @@ bool BasicTCPSocket::IsConnected() const {
 
 }
 
+bool BasicTCPSocket::SetNoDelay(const bool noDelay) {
+    bool ret = false;
+#ifdef LWIP_ENABLED
+    if (IsValid()) {
+        int32 value = noDelay ? 1 : 0;
+        ret = (setsockopt(connectionSocket, IPPROTO_TCP, TCP_NODELAY, &value, static_cast<socklen_t>(sizeof(value))) == 0);
+        if (!ret) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "BasicTCPSocket: Failed setsockopt() setting TCP_NODELAY");
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC_0(ErrorManagement::FatalError, "BasicTCPSocket: The socked handle is not valid");
+    }
+#endif
+    return ret;
+}
+
 BasicTCPSocket *BasicTCPSocket::WaitConnection(const TimeoutType &timeout,
                                                BasicTCPSocket *client) {
     BasicTCPSocket *ret = static_cast<BasicTCPSocket *>(NULL);
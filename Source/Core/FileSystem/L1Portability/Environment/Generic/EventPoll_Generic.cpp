@@ -0,0 +1,87 @@
+/**
+ * @file EventPoll_Generic.cpp
+ * @brief Source file for class EventPoll
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPoll (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "../../EventPoll.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+EventPoll::EventPoll() {
+    pollDescriptor = -1;
+}
+
+EventPoll::~EventPoll() {
+}
+
+bool EventPoll::Open() {
+    return false;
+}
+
+bool EventPoll::Close() {
+    return true;
+}
+
+bool EventPoll::IsValid() const {
+    return false;
+}
+
+/*lint -e{715} event polling is not supported by this implementation.*/
+bool EventPoll::AddReadHandle(const HandleI &handle,
+                              void * const context) {
+    return false;
+}
+
+/*lint -e{715} event polling is not supported by this implementation.*/
+bool EventPoll::RearmReadHandle(const HandleI &handle,
+                                void * const context) {
+    return false;
+}
+
+/*lint -e{715} event polling is not supported by this implementation.*/
+bool EventPoll::RemoveReadHandle(const HandleI &handle) {
+    return false;
+}
+
+/*lint -e{715} event polling is not supported by this implementation.*/
+int32 EventPoll::WaitUntil(const TimeoutType &timeout,
+                           void ** const contexts,
+                           const uint32 maxContexts) {
+    return -1;
+}
+
+}
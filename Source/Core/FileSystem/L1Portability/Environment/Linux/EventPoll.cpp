@@ -0,0 +1,170 @@
+/**
+ * @file EventPoll.cpp
+ * @brief Source file for class EventPoll
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPoll (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ErrorManagement.h"
+#include "EventPoll.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maximum number of events retrieved by each call to epoll_wait.
+ */
+const MARTe::uint32 EVENT_POLL_MAX_EVENTS = 64u;
+
+/**
+ * Events monitored for each handle. EPOLLRDHUP and the (always reported) EPOLLHUP/EPOLLERR are returned as read events.
+ */
+const MARTe::uint32 EVENT_POLL_READ_EVENTS = static_cast<MARTe::uint32>(EPOLLIN | EPOLLRDHUP | EPOLLONESHOT);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+EventPoll::EventPoll() {
+    pollDescriptor = -1;
+}
+
+/*lint -e{1551} .Justification: Removes the warning "Function may throw exception '...' in destructor". */
+EventPoll::~EventPoll() {
+    if (IsValid()) {
+        if (!Close()) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoll: Failed to close the poll descriptor");
+        }
+    }
+}
+
+bool EventPoll::Open() {
+    bool ret = !IsValid();
+    if (ret) {
+        pollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+        ret = (pollDescriptor >= 0);
+        if (!ret) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoll: epoll_create1 failed");
+        }
+    }
+    return ret;
+}
+
+bool EventPoll::Close() {
+    bool ret = true;
+    if (IsValid()) {
+        ret = (close(pollDescriptor) == 0);
+        pollDescriptor = -1;
+    }
+    return ret;
+}
+
+bool EventPoll::IsValid() const {
+    return (pollDescriptor >= 0);
+}
+
+bool EventPoll::AddReadHandle(const HandleI &handle,
+                              void * const context) {
+    bool ret = IsValid();
+    if (ret) {
+        struct epoll_event event;
+        event.events = EVENT_POLL_READ_EVENTS;
+        event.data.ptr = context;
+        ret = (epoll_ctl(pollDescriptor, EPOLL_CTL_ADD, handle.GetReadHandle(), &event) == 0);
+        if (!ret) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoll: Failed to add the handle");
+        }
+    }
+    return ret;
+}
+
+bool EventPoll::RearmReadHandle(const HandleI &handle,
+                                void * const context) {
+    bool ret = IsValid();
+    if (ret) {
+        struct epoll_event event;
+        event.events = EVENT_POLL_READ_EVENTS;
+        event.data.ptr = context;
+        ret = (epoll_ctl(pollDescriptor, EPOLL_CTL_MOD, handle.GetReadHandle(), &event) == 0);
+        if (!ret) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoll: Failed to rearm the handle");
+        }
+    }
+    return ret;
+}
+
+bool EventPoll::RemoveReadHandle(const HandleI &handle) {
+    bool ret = IsValid();
+    if (ret) {
+        //Kernels before 2.6.9 require a non-null event even if it is ignored.
+        struct epoll_event event;
+        event.events = 0u;
+        event.data.ptr = NULL_PTR(void *);
+        ret = (epoll_ctl(pollDescriptor, EPOLL_CTL_DEL, handle.GetReadHandle(), &event) == 0);
+        if (!ret) {
+            REPORT_ERROR_STATIC_0(ErrorManagement::OSError, "EventPoll: Failed to remove the handle");
+        }
+    }
+    return ret;
+}
+
+int32 EventPoll::WaitUntil(const TimeoutType &timeout,
+                           void ** const contexts,
+                           const uint32 maxContexts) {
+    int32 ret = -1;
+    if ((IsValid()) && (contexts != NULL_PTR(void **)) && (maxContexts > 0u)) {
+        struct epoll_event events[EVENT_POLL_MAX_EVENTS];
+        uint32 maxEvents = maxContexts;
+        if (maxEvents > EVENT_POLL_MAX_EVENTS) {
+            maxEvents = EVENT_POLL_MAX_EVENTS;
+        }
+        int32 timeoutMSec = -1;
+        if (timeout.IsFinite()) {
+            timeoutMSec = static_cast<int32>(timeout.GetTimeoutMSec());
+        }
+        ret = epoll_wait(pollDescriptor, &events[0], static_cast<int32>(maxEvents), timeoutMSec);
+        if (ret < 0) {
+            //A signal interrupting the wait is handled as a timeout.
+            if (errno == EINTR) {
+                ret = 0;
+            }
+        }
+        int32 i;
+        for (i = 0; i < ret; i++) {
+            contexts[i] = events[i].data.ptr;
+        }
+    }
+    return ret;
+}
+
+}
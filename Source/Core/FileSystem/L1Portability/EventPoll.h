@@ -0,0 +1,158 @@
+/**
+ * @file EventPoll.h
+ * @brief Header file for class EventPoll
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EventPoll
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EVENTPOLL_H_
+#define EVENTPOLL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "HandleI.h"
+#include "TimeoutType.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Scalable monitoring of read events on a large number of handles.
+ * @details Contrary to Select, the set of monitored handles is kept by the operating system (epoll on Linux), so that the cost
+ * of WaitUntil does not depend on the number of handles being monitored and the set does not have to be rebuilt before each wait.
+ *
+ * Each handle is associated to a user context (e.g. the object which owns the handle), which is what WaitUntil returns for each
+ * handle that is ready to be read. A handle which was closed by the peer (or that has an error) is also reported as ready to be read, so that
+ * the owner can detect it with the next read.
+ *
+ * The handles are monitored in one-shot mode: after being returned by WaitUntil, a handle is no longer monitored until RearmReadHandle is called.
+ * This allows several threads to call WaitUntil on the same EventPoll while guaranteeing that a given handle is only served by one thread at a time.
+ *
+ * On environments where this is not implemented Open always fails.
+ */
+class DLL_API EventPoll {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     * @post
+     *   !IsValid()
+     */
+    EventPoll();
+
+    /**
+     * @brief Destructor. Calls Close.
+     */
+    virtual ~EventPoll();
+
+    /**
+     * @brief Creates the set of monitored handles.
+     * @return true if the set was successfully created.
+     * @pre
+     *   !IsValid()
+     * @post
+     *   IsValid()
+     */
+    bool Open();
+
+    /**
+     * @brief Destroys the set of monitored handles. The handles themselves are not closed.
+     * @return true if the set was successfully destroyed.
+     * @post
+     *   !IsValid()
+     */
+    bool Close();
+
+    /**
+     * @brief Checks if Open was successfully called.
+     * @return true if Open was successfully called (and Close was not called afterwards).
+     */
+    bool IsValid() const;
+
+    /**
+     * @brief Adds a handle to be monitored in read mode.
+     * @param[in] handle the handle to be monitored (its GetReadHandle is used).
+     * @param[in] context the user context that is returned by WaitUntil when the handle is ready to be read.
+     * @return true if the handle was successfully added.
+     * @pre
+     *   IsValid() &&
+     *   The handle must not have been added previously.
+     */
+    bool AddReadHandle(const HandleI &handle,
+                       void * const context);
+
+    /**
+     * @brief Restarts the monitoring of a handle that was returned by WaitUntil.
+     * @param[in] handle the handle to be monitored.
+     * @param[in] context the user context that is returned by WaitUntil when the handle is ready to be read.
+     * @return true if the handle was successfully rearmed.
+     * @pre
+     *   IsValid() &&
+     *   The handle must have been added with AddReadHandle.
+     */
+    bool RearmReadHandle(const HandleI &handle,
+                         void * const context);
+
+    /**
+     * @brief Removes a handle from the monitored set. Shall be called before closing the handle.
+     * @param[in] handle the handle to be removed.
+     * @return true if the handle was successfully removed.
+     * @pre
+     *   IsValid() &&
+     *   The handle must have been added with AddReadHandle.
+     */
+    bool RemoveReadHandle(const HandleI &handle);
+
+    /**
+     * @brief Blocks until at least one of the monitored handles is ready to be read, or the function timeouts.
+     * @param[in] timeout the maximum time to wait.
+     * @param[out] contexts where to write the user contexts of the handles that are ready to be read.
+     * @param[in] maxContexts the maximum number of user contexts that can be written in \a contexts.
+     * @return -1 in case of errors, 0 if the timeout expired, otherwise the number of user contexts written in \a contexts.
+     */
+    int32 WaitUntil(const TimeoutType &timeout,
+                    void ** const contexts,
+                    const uint32 maxContexts);
+
+private:
+
+    /**
+     * The operating system descriptor of the monitored set (-1 if not open).
+     */
+    int32 pollDescriptor;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EVENTPOLL_H_ */
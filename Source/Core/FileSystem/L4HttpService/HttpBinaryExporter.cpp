@@ -0,0 +1,327 @@
+/**
+ * @file HttpBinaryExporter.cpp
+ * @brief Source file for class HttpBinaryExporter
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpBinaryExporter (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "DeflateEncoder.h"
+#include "Endianity.h"
+#include "HttpBinaryExporter.h"
+#include "HttpChunkedStream.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Size of the buffer used to swap the bytes of the elements in big-endian architectures.
+ */
+static const uint32 HTTP_BINARY_EXPORTER_SWAP_BUFFER_SIZE = 1024u;
+
+struct HttpBinaryExporterVariable {
+    /**
+     * The name of the variable.
+     */
+    StreamString name;
+
+    /**
+     * The variable type, dimensions and memory.
+     */
+    AnyType value;
+};
+
+/**
+ * @brief Checks if \a value can be exported (numeric type with whole bytes and at most two dimensions).
+ */
+static bool HttpBinaryExporterIsSupported(const AnyType &value) {
+    bool ok = value.GetTypeDescriptor().IsNumericType();
+    if (ok) {
+        ok = ((value.GetBitSize() % 8u) == 0u);
+    }
+    if (ok) {
+        ok = (value.GetNumberOfDimensions() <= 2u);
+    }
+    if (ok) {
+        ok = (value.GetDataPointer() != NULL_PTR(void *));
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the total number of elements of \a value.
+ */
+static uint32 HttpBinaryExporterNumberOfElements(const AnyType &value) {
+    uint32 numberOfElements = 1u;
+    for (uint32 d = 0u; d < value.GetNumberOfDimensions(); d++) {
+        numberOfElements *= value.GetNumberOfElements(d);
+    }
+    return numberOfElements;
+}
+
+/**
+ * @brief Writes \a size bytes into the \a encoder, if not NULL, or directly into the \a stream.
+ */
+static bool HttpBinaryExporterWrite(BufferedStreamI &stream,
+                                    DeflateEncoder * const encoder,
+                                    const char8 * const data,
+                                    const uint32 size) {
+    bool ok;
+    if (encoder != NULL_PTR(DeflateEncoder *)) {
+        ok = encoder->Write(data, size);
+    }
+    else {
+        uint32 writeSize = size;
+        ok = stream.Write(data, writeSize);
+        if (ok) {
+            ok = (writeSize == size);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes \a numberOfElements elements with \a elementSize bytes, converting them to little-endian.
+ */
+static bool HttpBinaryExporterWriteElements(BufferedStreamI &stream,
+                                            DeflateEncoder * const encoder,
+                                            const uint8 * const data,
+                                            const uint32 numberOfElements,
+                                            const uint32 elementSize) {
+    bool ok = true;
+    bool swap = (Endianity::Type() == Endianity::ENDIANITY_BIG_ENDIAN);
+    if (swap) {
+        swap = (elementSize > 1u);
+    }
+    if (!swap) {
+        ok = HttpBinaryExporterWrite(stream, encoder, reinterpret_cast<const char8 *>(data), numberOfElements * elementSize);
+    }
+    else {
+        uint8 buffer[HTTP_BINARY_EXPORTER_SWAP_BUFFER_SIZE];
+        uint32 elementsPerBuffer = (HTTP_BINARY_EXPORTER_SWAP_BUFFER_SIZE / elementSize);
+        uint32 e = 0u;
+        while ((ok) && (e < numberOfElements)) {
+            uint32 toSwap = (numberOfElements - e);
+            if (toSwap > elementsPerBuffer) {
+                toSwap = elementsPerBuffer;
+            }
+            for (uint32 i = 0u; i < toSwap; i++) {
+                const uint8 * const element = &data[(e + i) * elementSize];
+                for (uint32 b = 0u; b < elementSize; b++) {
+                    buffer[(i * elementSize) + b] = element[(elementSize - 1u) - b];
+                }
+            }
+            ok = HttpBinaryExporterWrite(stream, encoder, reinterpret_cast<const char8 *>(&buffer[0]), toSwap * elementSize);
+            e += toSwap;
+        }
+    }
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HttpBinaryExporter::HttpBinaryExporter() {
+}
+
+HttpBinaryExporter::~HttpBinaryExporter() {
+    HttpBinaryExporterVariable *variable = NULL_PTR(HttpBinaryExporterVariable *);
+    while (variables.Extract(0u, variable)) {
+        delete variable;
+    }
+}
+
+bool HttpBinaryExporter::AddVariable(const char8 * const name,
+                                     const AnyType &value) {
+    bool ok = (name != NULL_PTR(const char8 *));
+    if (ok) {
+        ok = HttpBinaryExporterIsSupported(value);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::UnsupportedFeature, "The variable %s is not numeric or has more than two dimensions", name);
+        }
+    }
+    if (ok) {
+        HttpBinaryExporterVariable *variable = new HttpBinaryExporterVariable();
+        variable->name = name;
+        variable->value = value;
+        ok = variables.Add(variable);
+        if (!ok) {
+            delete variable;
+        }
+    }
+    return ok;
+}
+
+bool HttpBinaryExporter::AddVariables(StructuredDataI &data) {
+    return AddVariables(data, "");
+}
+
+bool HttpBinaryExporter::AddVariables(StructuredDataI &data,
+                                      const char8 * const prefix) {
+    bool ok = true;
+    uint32 numberOfChildren = data.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        StreamString childName = data.GetChildName(i);
+        StreamString fullName;
+        ok = fullName.Printf("%s%s", prefix, childName.Buffer());
+        if (ok) {
+            if (data.MoveRelative(childName.Buffer())) {
+                StreamString childPrefix;
+                ok = childPrefix.Printf("%s.", fullName.Buffer());
+                if (ok) {
+                    ok = AddVariables(data, childPrefix.Buffer());
+                }
+                if (ok) {
+                    ok = data.MoveToAncestor(1u);
+                }
+            }
+            else {
+                //Leafs which cannot be exported (e.g. strings) are skipped.
+                AnyType value = data.GetType(childName.Buffer());
+                if (HttpBinaryExporterIsSupported(value)) {
+                    ok = AddVariable(fullName.Buffer(), value);
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+uint32 HttpBinaryExporter::GetNumberOfVariables() const {
+    return variables.GetSize();
+}
+
+bool HttpBinaryExporter::GetHeader(StreamString &header) {
+    bool ok = header.Printf("%s", "{\"Variables\": [");
+    uint32 offset = 0u;
+    uint32 numberOfVariables = variables.GetSize();
+    for (uint32 i = 0u; (i < numberOfVariables) && (ok); i++) {
+        HttpBinaryExporterVariable *variable = NULL_PTR(HttpBinaryExporterVariable *);
+        ok = variables.Peek(i, variable);
+        if (ok) {
+            uint8 numberOfDimensions = variable->value.GetNumberOfDimensions();
+            uint32 size = (HttpBinaryExporterNumberOfElements(variable->value) * variable->value.GetByteSize());
+            const char8 * const typeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(variable->value.GetTypeDescriptor());
+            ok = header.Printf("%s{\"Name\": \"%s\", \"Type\": \"%s\", \"NumberOfDimensions\": %u, \"NumberOfElements\": [", (i > 0u) ? ", " : "",
+                               variable->name.Buffer(), typeName, numberOfDimensions);
+            for (uint32 d = 0u; (d < numberOfDimensions) && (ok); d++) {
+                ok = header.Printf("%s%u", (d > 0u) ? ", " : "", variable->value.GetNumberOfElements(d));
+            }
+            if (ok) {
+                ok = header.Printf("], \"Offset\": %u, \"Size\": %u}", offset, size);
+            }
+            offset += size;
+        }
+    }
+    if (ok) {
+        ok = header.Printf("%s", "]}");
+    }
+    return ok;
+}
+
+/*lint -e{613} hstream cannot be NULL as otherwise ok would be false*/
+bool HttpBinaryExporter::Export(StreamI &stream,
+                                HttpProtocol &protocol) {
+    HttpChunkedStream *hstream = dynamic_cast<HttpChunkedStream *>(&stream);
+    bool ok = (hstream != NULL_PTR(HttpChunkedStream *));
+    bool compress = false;
+    if (ok) {
+        compress = protocol.AcceptsEncoding("deflate");
+        ok = protocol.MoveAbsolute("OutputOptions");
+    }
+    if (ok) {
+        ok = protocol.Write("Transfer-Encoding", "chunked");
+    }
+    if (ok) {
+        ok = protocol.Write("Content-Type", "application/octet-stream");
+    }
+    if ((ok) && (compress)) {
+        ok = protocol.Write("Content-Encoding", "deflate");
+    }
+    if (ok) {
+        //empty string... go in chunked mode
+        StreamString hs;
+        ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyOK, &hs, NULL_PTR(const char8*));
+    }
+    DeflateEncoder *encoder = NULL_PTR(DeflateEncoder *);
+    if (ok) {
+        hstream->SetChunkMode(true);
+        if (compress) {
+            encoder = new DeflateEncoder(*hstream);
+        }
+    }
+    StreamString header;
+    if (ok) {
+        ok = GetHeader(header);
+    }
+    if (ok) {
+        uint32 headerSize = static_cast<uint32>(header.Size());
+        Endianity::ToLittleEndian(headerSize);
+        ok = HttpBinaryExporterWrite(*hstream, encoder, reinterpret_cast<const char8 *>(&headerSize), static_cast<uint32>(sizeof(uint32)));
+    }
+    if (ok) {
+        ok = HttpBinaryExporterWrite(*hstream, encoder, header.Buffer(), static_cast<uint32>(header.Size()));
+    }
+    uint32 numberOfVariables = variables.GetSize();
+    for (uint32 i = 0u; (i < numberOfVariables) && (ok); i++) {
+        HttpBinaryExporterVariable *variable = NULL_PTR(HttpBinaryExporterVariable *);
+        ok = variables.Peek(i, variable);
+        if (ok) {
+            const AnyType &value = variable->value;
+            uint32 elementSize = value.GetByteSize();
+            bool rowPointers = ((value.GetNumberOfDimensions() == 2u) && (!value.IsStaticDeclared()));
+            if (rowPointers) {
+                //Matrices which are not statically declared are stored as an array of pointers to the rows.
+                const uint8 * const * const rows = static_cast<const uint8 * const *>(value.GetDataPointer());
+                uint32 numberOfColumns = value.GetNumberOfElements(0u);
+                uint32 numberOfRows = value.GetNumberOfElements(1u);
+                for (uint32 r = 0u; (r < numberOfRows) && (ok); r++) {
+                    ok = HttpBinaryExporterWriteElements(*hstream, encoder, rows[r], numberOfColumns, elementSize);
+                }
+            }
+            else {
+                ok = HttpBinaryExporterWriteElements(*hstream, encoder, static_cast<const uint8 *>(value.GetDataPointer()),
+                                                     HttpBinaryExporterNumberOfElements(value), elementSize);
+            }
+        }
+    }
+    if (encoder != NULL_PTR(DeflateEncoder *)) {
+        if (ok) {
+            ok = encoder->Finish();
+        }
+        delete encoder;
+    }
+    return ok;
+}
+
+}
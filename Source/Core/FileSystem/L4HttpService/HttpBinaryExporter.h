@@ -0,0 +1,151 @@
+/**
+ * @file HttpBinaryExporter.h
+ * @brief Header file for class HttpBinaryExporter
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpBinaryExporter
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HTTPBINARYEXPORTER_H_
+#define HTTPBINARYEXPORTER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AnyType.h"
+#include "HttpProtocol.h"
+#include "StaticList.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Describes one of the variables to be exported (see HttpBinaryExporter.cpp).
+ */
+struct HttpBinaryExporterVariable;
+
+/**
+ * @brief Replies to an HTTP request with numeric arrays in binary form (see HttpDataExportI::GetAsBinary).
+ * @details Printing large arrays in JSON (see HttpDataExportI::GetAsStructuredData) generates several times more bytes than the
+ * memory they occupy and takes a considerable amount of time to format. This class sends instead the memory of the arrays, preceded
+ * by a small JSON header which allows the client to interpret it.
+ *
+ * The reply body (Content-Type: application/octet-stream) is:
+ *  - the size in bytes of the JSON header (uint32, little-endian);
+ *  - the JSON header, with the name, type (see TypeDescriptor::GetTypeNameFromTypeDescriptor), number of dimensions, number of elements in each dimension,
+ *    offset (in the data, i.e. after the header) and size in bytes of each variable, e.g.:
+ * <pre>
+ * {"Variables": [{"Name": "Time", "Type": "uint32", "NumberOfDimensions": 0, "NumberOfElements": [], "Offset": 0, "Size": 4},
+ *                {"Name": "Samples", "Type": "float64", "NumberOfDimensions": 1, "NumberOfElements": [1000000], "Offset": 4, "Size": 8000000}]}
+ * </pre>
+ *  - the elements of all the variables, in the order of the header, in little-endian. Matrices are written row after row, with NumberOfElements
+ *    given as [columns, rows].
+ *
+ * If the client accepts it (Accept-Encoding, see HttpProtocol::AcceptsEncoding), the body is compressed while it is sent
+ * (Content-Encoding: deflate, see DeflateEncoder).
+ *
+ * Only numeric types with up to two dimensions can be exported. The memory of the variables is not copied, so it shall remain valid until Export returns.
+ */
+class DLL_API HttpBinaryExporter {
+public:
+
+    /**
+     * @brief Constructor.
+     * @post
+     *   GetNumberOfVariables() == 0
+     */
+    HttpBinaryExporter();
+
+    /**
+     * @brief Destructor. Frees the variable descriptions.
+     */
+    ~HttpBinaryExporter();
+
+    /**
+     * @brief Adds a variable to be exported.
+     * @param[in] name the name of the variable.
+     * @param[in] value the variable. Its memory shall remain valid until Export returns.
+     * @return true if the type of \a value is numeric (with a size multiple of 8 bits) and it has at most two dimensions.
+     */
+    bool AddVariable(const char8 * const name,
+                     const AnyType &value);
+
+    /**
+     * @brief Adds all the numeric leafs below the current node of \a data.
+     * @details The leafs of sub-nodes are named with the path relative to the current node (e.g. Node.Leaf). Leafs that cannot be exported (e.g. strings) are skipped.
+     * @param[in] data the structured data with the values. It shall remain valid (and unchanged) until Export returns.
+     * @return true if \a data could be navigated.
+     */
+    bool AddVariables(StructuredDataI &data);
+
+    /**
+     * @brief Gets the number of variables to be exported.
+     * @return the number of variables to be exported.
+     */
+    uint32 GetNumberOfVariables() const;
+
+    /**
+     * @brief Prints the JSON header describing the variables (see class description).
+     * @param[out] header where to print the header.
+     * @return true if the header was successfully printed.
+     */
+    bool GetHeader(StreamString &header);
+
+    /**
+     * @brief Writes the HTTP header and the body (see class description).
+     * @details The body is sent in chunked mode and compressed if the client accepts the deflate encoding.
+     * @param[out] stream the stream where the reply is written. Shall be an HttpChunkedStream.
+     * @param[out] protocol where the HTTP header is written.
+     * @return true if the reply was successfully written.
+     */
+    bool Export(StreamI &stream,
+                HttpProtocol &protocol);
+
+private:
+
+    /**
+     * @brief See AddVariables(StructuredDataI &). Recursive implementation.
+     * @param[in] data the structured data with the values.
+     * @param[in] prefix the path of the current node of \a data.
+     * @return true if \a data could be navigated.
+     */
+    bool AddVariables(StructuredDataI &data,
+                      const char8 * const prefix);
+
+    /**
+     * The variables to be exported.
+     */
+    StaticList<HttpBinaryExporterVariable *> variables;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HTTPBINARYEXPORTER_H_ */
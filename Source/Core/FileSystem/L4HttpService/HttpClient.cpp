@@ -328,6 +328,10 @@ bool HttpClient::Connect(const TimeoutType &msecTimeout) {
     if (ret) {
         ret = tcpSocket.SetBlocking(true);
     }
+    //The request is written in several pieces.
+    if (ret) {
+        ret = tcpSocket.SetNoDelay(true);
+    }
     if (ret) {
         ret = tcpSocket.Connect(urlHost.Buffer(), urlPort, msecTimeout);
     }
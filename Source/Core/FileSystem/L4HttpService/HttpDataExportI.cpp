@@ -100,6 +100,18 @@ bool HttpDataExportI::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     return ok;
 }
 
+/*lint -e{715} stream is not used as no data is sent.*/
+bool HttpDataExportI::GetAsBinary(StreamI &stream, HttpProtocol &protocol) {
+    bool ok = protocol.MoveAbsolute("OutputOptions");
+    if (ok) {
+        ok = protocol.Write("Connection", "close");
+    }
+    if (ok) {
+        ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyNotAcceptable, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8*));
+    }
+    return ok;
+}
+
 bool HttpDataExportI::ReplyNotFound(HttpProtocol &protocol) const {
     bool ok = protocol.MoveAbsolute("OutputOptions");
     if (ok) {
@@ -75,6 +75,17 @@ public:
      */
     virtual bool GetAsText(StreamI &stream, HttpProtocol &protocol);
 
+    /**
+     * @brief Streams the data in binary form (application/octet-stream).
+     * @details Called by the HttpService when the client requests BinaryMode=1 (see HttpProtocol::BinaryMode).
+     * Classes which hold large arrays (e.g. signals) are expected to specialise this method and export the data with an HttpBinaryExporter.
+     * The default implementation replies that the resource cannot be provided in this format.
+     * @param[out] stream the stream where to write the data.
+     * @param[out] protocol writes the HTTP header.
+     * @return true if the header was correctly written.
+     */
+    virtual bool GetAsBinary(StreamI &stream, HttpProtocol &protocol);
+
 protected:
     /**
      * @brief Helper function to be used when a given resource is not available.
@@ -29,18 +29,39 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "HttpBinaryExporter.h"
 #include "HttpChunkedStream.h"
 
 #include "HttpDirectoryResource.h"
 #include "HttpObjectBrowser.h"
 #include "HttpProtocol.h"
-#include "JsonPrinter.h"
 #include "ObjectRegistryDatabase.h"
-#include "StreamStructuredData.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * A reply stored in the HttpObjectBrowser cache.
+ */
+struct HttpObjectBrowserCacheEntry {
+    /**
+     * The path requested w.r.t. to the root.
+     */
+    StreamString path;
+
+    /**
+     * The generation of the path when the body was exported.
+     */
+    uint32 generation;
+
+    /**
+     * The exported JSON body.
+     */
+    StreamString body;
+};
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,10 +72,18 @@ HttpObjectBrowser::HttpObjectBrowser() :
         ReferenceContainer(), HttpDataExportI() {
     closeOnAuthFail = 1u;
     root = NULL_PTR(ReferenceContainer *);
+    responseCache = false;
+    responseCacheSize = 32u;
+    etagEpoch = HighResolutionTimer::Counter32();
+    cacheSem.Create();
 }
 
 HttpObjectBrowser::~HttpObjectBrowser() {
     /*lint -e{1540} root is freed by the parent Reference*/
+    HttpObjectBrowserCacheEntry *entry = NULL_PTR(HttpObjectBrowserCacheEntry *);
+    while (cacheEntries.Extract(0u, entry)) {
+        delete entry;
+    }
 }
 
 void HttpObjectBrowser::Purge(ReferenceContainer &purgeList) {
@@ -119,6 +148,20 @@ bool HttpObjectBrowser::Initialise(StructuredDataI &data) {
             closeOnAuthFail = 1u;
         }
     }
+    if (ok) {
+        uint8 responseCacheU8;
+        if (!data.Read("ResponseCache", responseCacheU8)) {
+            responseCacheU8 = 0u;
+        }
+        responseCache = (responseCacheU8 > 0u);
+        if (!data.Read("ResponseCacheSize", responseCacheSize)) {
+            responseCacheSize = 32u;
+        }
+        ok = (responseCacheSize > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "ResponseCacheSize shall be > 0");
+        }
+    }
     return ok;
 }
 
@@ -226,6 +269,11 @@ Reference HttpObjectBrowser::FindTarget(HttpProtocol &protocol) {
 bool HttpObjectBrowser::GetAsStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol) {
     bool ok = CheckSecurity(protocol);
     if (ok) {
+        //The path is needed to identify the cached reply and FindTarget modifies it.
+        StreamString requestPath;
+        if (responseCache) {
+            protocol.GetUnmatchedId(requestPath);
+        }
         Reference target = FindTarget(protocol);
         ok = target.IsValid();
         StreamStructuredData<JsonPrinter> *sdata;
@@ -235,85 +283,240 @@ bool HttpObjectBrowser::GetAsStructuredData(StreamStructuredDataI &data, HttpPro
             ok = (sdata != NULL_PTR(StreamStructuredData<JsonPrinter> *));
         }
         if (ok) {
-            bool isThis = (target == this);
-            //If we are printing ourselves list all the elements belonging to the root (note that the root might be pointing elsewhere).
-            if (isThis) {
+            //If not pointing at ourselves, it can be a HttpDataExportI in which case we forward the work.
+            ReferenceT<HttpDataExportI> httpDataExportI;
+            if (target != this) {
+                httpDataExportI = target;
+            }
+            if (httpDataExportI.IsValid()) {
+                //The reply is not managed by this instance. Do not let it go with a stale ETag.
+                if (responseCache) {
+                    if (protocol.MoveAbsolute("OutputOptions")) {
+                        (void) protocol.Delete("ETag");
+                    }
+                }
+                ok = httpDataExportI->GetAsStructuredData(data, protocol);
+            }
+            else if (responseCache) {
+                ok = GetAsCachedStructuredData(data, protocol, target, requestPath.Buffer());
+            }
+            else {
                 ok = HttpDataExportI::GetAsStructuredData(data, protocol);
-                //Print the opening {
                 if (ok) {
                     //lint -e{644} sdata initialised otherwise ok would be false*/
-                    ok = sdata->GetPrinter()->PrintBegin();
-                }
-                if (ok) {
-                    //Export the data.
-                    ok = Object::ExportData(data);
+                    ok = ExportTarget(target, *sdata);
                 }
-                //List the elements that belong to the root (cannot point directly to the RC implementation as otherwise it would print the wrong class name).
-                uint32 numberOfChildren = root->Size();
-                for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
-                    StreamString nname;
-                    uint32 ii = i;
-                    ok = nname.Printf("%d", ii);
-                    if (ok) {
-                        ok = data.CreateRelative(nname.Buffer());
-                    }
-                    Reference child;
-                    if (ok) {
-                        child = root->Get(i);
-                        ok = child.IsValid();
-                    }
-                    if (ok) {
-                        ReferenceT<ReferenceContainer> childRC = child;
-                        //Do not go recursive
-                        if (childRC.IsValid()) {
-                            ok = child->Object::ExportData(data);
-                            if (ok) {
-                                ok = data.Write("IsContainer", 1);
-                            }
-                        }
-                        else {
-                            ok = child->ExportData(data);
-                        }
-                    }
+            }
+        }
+        else {
+            ok = HttpDataExportI::ReplyNotFound(protocol);
+        }
+    }
+    return ok;
+}
+
+bool HttpObjectBrowser::ExportTarget(Reference &target, StreamStructuredData<JsonPrinter> &sdata) {
+    //Print the opening {
+    bool ok = sdata.GetPrinter()->PrintBegin();
+    //If we are printing ourselves list all the elements belonging to the root (note that the root might be pointing elsewhere).
+    if (target == this) {
+        if (ok) {
+            //Export the data.
+            ok = Object::ExportData(sdata);
+        }
+        //List the elements that belong to the root (cannot point directly to the RC implementation as otherwise it would print the wrong class name).
+        uint32 numberOfChildren = root->Size();
+        for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+            StreamString nname;
+            uint32 ii = i;
+            ok = nname.Printf("%d", ii);
+            if (ok) {
+                ok = sdata.CreateRelative(nname.Buffer());
+            }
+            Reference child;
+            if (ok) {
+                child = root->Get(i);
+                ok = child.IsValid();
+            }
+            if (ok) {
+                ReferenceT<ReferenceContainer> childRC = child;
+                //Do not go recursive
+                if (childRC.IsValid()) {
+                    ok = child->Object::ExportData(sdata);
                     if (ok) {
-                        ok = data.MoveToAncestor(1u);
+                        ok = sdata.Write("IsContainer", 1);
                     }
                 }
-                //Print the closing {
-                if (ok) {
-                    ok = sdata->GetPrinter()->PrintEnd();
+                else {
+                    ok = child->ExportData(sdata);
                 }
             }
-            else {
-                //Not pointing at ourselves. It can be a HttpDataExportI in which case we forward the work.
-                ReferenceT<HttpDataExportI> httpDataExportI = target;
-                if (httpDataExportI.IsValid()) {
-                    ok = httpDataExportI->GetAsStructuredData(data, protocol);
+            if (ok) {
+                ok = sdata.MoveToAncestor(1u);
+            }
+        }
+    }
+    else {
+        //Otherwise dump the object values.
+        if (ok) {
+            ok = target->ExportData(sdata);
+        }
+    }
+    //Print the closing }
+    if (ok) {
+        ok = sdata.GetPrinter()->PrintEnd();
+    }
+    return ok;
+}
+
+uint32 HttpObjectBrowser::GetPathGeneration(const char8 * const requestPath) {
+    uint32 generation = ReferenceContainer::GetLastChangeNotification();
+    uint32 containerGeneration = GetGeneration();
+    if (containerGeneration > generation) {
+        generation = containerGeneration;
+    }
+    //Walk the path comparing the names of the children (the Find would create temporary containers).
+    ReferenceContainer *current = root;
+    StreamString path = requestPath;
+    bool ok = path.Seek(0ULL);
+    while ((current != NULL_PTR(ReferenceContainer *)) && (ok)) {
+        containerGeneration = current->GetGeneration();
+        if (containerGeneration > generation) {
+            generation = containerGeneration;
+        }
+        StreamString token;
+        char8 terminator;
+        ok = path.GetToken(token, ".", terminator);
+        ReferenceContainer *next = NULL_PTR(ReferenceContainer *);
+        uint32 numberOfChildren = current->Size();
+        for (uint32 i = 0u; (i < numberOfChildren) && (ok) && (next == NULL_PTR(ReferenceContainer *)); i++) {
+            ReferenceT<ReferenceContainer> child = current->Get(i);
+            if (child.IsValid()) {
+                if (token == child->GetName()) {
+                    next = child.operator ->();
                 }
-                else {
-                    //Otherwise dump the object values.
-                    ok = HttpDataExportI::GetAsStructuredData(data, protocol);
-                    //Print the opening {
-                    if (ok) {
-                        ok = sdata->GetPrinter()->PrintBegin();
+            }
+        }
+        current = next;
+    }
+    return generation;
+}
+
+bool HttpObjectBrowser::GetAsCachedStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol, Reference &target, const char8 * const requestPath) {
+    uint32 generation = GetPathGeneration(requestPath);
+    StreamString etag;
+    bool ok = etag.Printf("\"%x-%x\"", etagEpoch, generation);
+    if (ok) {
+        if (!protocol.MoveAbsolute("OutputOptions")) {
+            ok = protocol.CreateAbsolute("OutputOptions");
+        }
+    }
+    if (ok) {
+        ok = protocol.Write("ETag", etag.Buffer());
+    }
+    bool notModified = false;
+    if (ok) {
+        if (protocol.MoveAbsolute("InputOptions")) {
+            StreamString ifNoneMatch;
+            if (protocol.Read("If-None-Match", ifNoneMatch)) {
+                notModified = (ifNoneMatch == "*");
+                if (!notModified) {
+                    notModified = (StringHelper::SearchString(ifNoneMatch.Buffer(), etag.Buffer()) != NULL_PTR(const char8 *));
+                }
+            }
+        }
+        ok = protocol.MoveAbsolute("OutputOptions");
+    }
+    if (notModified) {
+        if (ok) {
+            //The reply has no body. Remove any transfer encoding left by a previous reply on the same connection.
+            (void) protocol.Delete("Transfer-Encoding");
+            ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyNotModified, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8 *));
+        }
+    }
+    else {
+        StreamString body;
+        bool found = false;
+        if (ok) {
+            ok = (cacheSem.FastLock() == ErrorManagement::NoError);
+        }
+        if (ok) {
+            uint32 numberOfEntries = cacheEntries.GetSize();
+            for (uint32 i = 0u; (i < numberOfEntries) && (!found); i++) {
+                HttpObjectBrowserCacheEntry *entry = NULL_PTR(HttpObjectBrowserCacheEntry *);
+                if (cacheEntries.Peek(i, entry)) {
+                    found = ((entry->generation == generation) && (entry->path == requestPath));
+                    if (found) {
+                        body = entry->body;
                     }
-                    if (ok) {
-                        ok = target->ExportData(data);
+                }
+            }
+            cacheSem.FastUnLock();
+        }
+        if ((ok) && (!found)) {
+            StreamStructuredData<JsonPrinter> bodyData;
+            bodyData.SetStream(body);
+            ok = ExportTarget(target, bodyData);
+            if (ok) {
+                ok = (cacheSem.FastLock() == ErrorManagement::NoError);
+            }
+            if (ok) {
+                //Replace any (stale) reply to the same path, otherwise evict the oldest if full.
+                uint32 numberOfEntries = cacheEntries.GetSize();
+                uint32 toRemove = numberOfEntries;
+                for (uint32 i = 0u; (i < numberOfEntries) && (toRemove == numberOfEntries); i++) {
+                    HttpObjectBrowserCacheEntry *entry = NULL_PTR(HttpObjectBrowserCacheEntry *);
+                    if (cacheEntries.Peek(i, entry)) {
+                        if (entry->path == requestPath) {
+                            toRemove = i;
+                        }
                     }
-                    //Print the closing }
-                    if (ok) {
-                        ok = sdata->GetPrinter()->PrintEnd();
+                }
+                if ((toRemove == numberOfEntries) && (numberOfEntries >= responseCacheSize)) {
+                    toRemove = 0u;
+                }
+                HttpObjectBrowserCacheEntry *entry = NULL_PTR(HttpObjectBrowserCacheEntry *);
+                if (toRemove < numberOfEntries) {
+                    if (cacheEntries.Extract(toRemove, entry)) {
+                        delete entry;
                     }
                 }
+                entry = new HttpObjectBrowserCacheEntry();
+                entry->path = requestPath;
+                entry->generation = generation;
+                entry->body = body;
+                if (!cacheEntries.Add(entry)) {
+                    delete entry;
+                }
+                cacheSem.FastUnLock();
             }
         }
-        else {
-            ok = HttpDataExportI::ReplyNotFound(protocol);
+        if (ok) {
+            //The Content-Length may have been left by a previous reply on the same connection.
+            (void) protocol.Delete("Content-Length");
+            ok = HttpDataExportI::GetAsStructuredData(data, protocol);
+        }
+        BufferedStreamI *stream = data.GetStream();
+        if (ok) {
+            ok = (stream != NULL_PTR(BufferedStreamI *));
+        }
+        if (ok) {
+            uint32 bodySize = static_cast<uint32>(body.Size());
+            ok = stream->Write(body.Buffer(), bodySize);
         }
     }
     return ok;
 }
 
+uint32 HttpObjectBrowser::GetNumberOfCachedResponses() {
+    uint32 numberOfEntries = 0u;
+    if (cacheSem.FastLock() == ErrorManagement::NoError) {
+        numberOfEntries = cacheEntries.GetSize();
+        cacheSem.FastUnLock();
+    }
+    return numberOfEntries;
+}
+
 bool HttpObjectBrowser::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     bool ok = CheckSecurity(protocol);
     if (ok) {
@@ -355,6 +558,42 @@ bool HttpObjectBrowser::GetAsText(StreamI &stream, HttpProtocol &protocol) {
     return ok;
 }
 
+bool HttpObjectBrowser::GetAsBinary(StreamI &stream, HttpProtocol &protocol) {
+    bool ok = CheckSecurity(protocol);
+    if (ok) {
+        Reference target = FindTarget(protocol);
+        bool found = target.IsValid();
+        if (found) {
+            found = (target != this);
+        }
+        if (found) {
+            ReferenceT<HttpDataExportI> httpDataExportI = target;
+            if (httpDataExportI.IsValid()) {
+                ok = httpDataExportI->GetAsBinary(stream, protocol);
+            }
+            else {
+                //The exported values must remain valid until the reply is sent.
+                ConfigurationDatabase cdb;
+                HttpBinaryExporter exporter;
+                found = target->ExportData(cdb);
+                if (found) {
+                    found = cdb.MoveToRoot();
+                }
+                if (found) {
+                    found = exporter.AddVariables(cdb);
+                }
+                if (found) {
+                    ok = exporter.Export(stream, protocol);
+                }
+            }
+        }
+        if (!found) {
+            ok = HttpDataExportI::ReplyNotFound(protocol);
+        }
+    }
+    return ok;
+}
+
 Reference HttpObjectBrowser::FindReference(const char8 * const unmatchedPath) {
     Reference target;
     if (StringHelper::Length(unmatchedPath) > 0u) {
@@ -31,13 +31,22 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
 #include "HttpDataExportI.h"
 #include "HttpRealmI.h"
+#include "JsonPrinter.h"
+#include "StaticList.h"
+#include "StreamStructuredData.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * Forward declaration of a cached reply (see HttpObjectBrowser ResponseCache).
+ */
+struct HttpObjectBrowserCacheEntry;
+
 /**
  * @brief HTTP browsing of any ReferenceContainer.
  *
@@ -56,8 +65,20 @@ namespace MARTe {
  *    - The target is this instance: checks if there is an HttpDirectoryResource capable of handling the request and if so forwards it.
  *    - The target is not this instance and the target implements HttpDataExportI: calls GetAsText on the target object.
  *    - None of the above: reply HttpDataExportI::ReplyNotFound.
+ *  -GetAsBinary is called:
+ *    - The target is not this instance and the target implements HttpDataExportI: calls GetAsBinary on the target object.
+ *    - The target is not this instance and the target does not implement HttpDataExportI: calls ExportData on the target object and replies
+ *      with all its numeric values (see HttpBinaryExporter::AddVariables).
+ *    - None of the above: reply HttpDataExportI::ReplyNotFound.
  * If GetAsText is called and the path points at any other
  *
+ * @details When ResponseCache is enabled, the replies to GetAsStructuredData (with the exception of the targets that implement HttpDataExportI, which are always forwarded) are
+ * tagged with an ETag computed from the generations (see ReferenceContainer::GetGeneration) of the root, of this instance and of every container in the requested path,
+ * and from ReferenceContainer::GetLastChangeNotification. If the request carries an If-None-Match header with the current ETag, a 304 (Not Modified) reply without body is sent.
+ * Otherwise the JSON body is served from the cache (or exported and stored in the cache if the ETag has changed). As a consequence, inserting or removing objects
+ * invalidates the cache automatically, while changes to the values exported by an object (see Object::ExportData) shall be signalled with ReferenceContainer::NotifyChange.
+ * GetAsText replies are never cached.
+ *
  * @details The configuration syntax is (names are only given as an example):
  * <pre>
  * +HttpObjectBrowser1 = {
@@ -65,6 +86,8 @@ namespace MARTe {
  *     Root = "/" //Compulsory. The Root object. Can be a path to any ReferenceContainer in the ObjectRegistryDatabase (e.g. Root = "A.B.C"), or the ObjectRegistryDatabase itself (Root = "/") or this instance (Root = ".").
  *     Realm = ARealmImplementation //Optional. Points at an object that implements the HttpRealmI interface. If it exits every HTTP request will be validated by such object.
  *     CloseOnAuthFail = 1 //Optional (default = 1). Close the connection in case of an authentication failure?
+ *     ResponseCache = 1 //Optional (default = 0). If 1 the GetAsStructuredData replies are tagged with an ETag and cached (see above).
+ *     ResponseCacheSize = 32 //Optional (default = 32). Maximum number of cached replies. When full the oldest reply is evicted. Shall be > 0.
  * }
  * </pre>
  */
@@ -78,7 +101,7 @@ public:
     HttpObjectBrowser();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Deletes the cached replies.
      */
     virtual ~HttpObjectBrowser();
 
@@ -88,7 +111,7 @@ public:
     virtual void Purge(ReferenceContainer &purgeList);
 
     /**
-     * @brief Calls ReferenceContainer::Initialise and reads the Root and the CloseOnAuthFail parameters (see class description) .
+     * @brief Calls ReferenceContainer::Initialise and reads the Root, CloseOnAuthFail, ResponseCache and ResponseCacheSize parameters (see class description) .
      * @return true if the parameters are correctly specified and the Root is valid.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -109,6 +132,20 @@ public:
      */
     virtual bool GetAsText(StreamI &stream, HttpProtocol &protocol);
 
+    /**
+     * @brief See HttpDataExportI::GetAsBinary and the class description above.
+     * @param[out] stream see HttpDataExportI::GetAsBinary and the class description above.
+     * @param[out] protocol see HttpDataExportI::GetAsBinary and the class description above.
+     * @return see HttpDataExportI::GetAsBinary.
+     */
+    virtual bool GetAsBinary(StreamI &stream, HttpProtocol &protocol);
+
+    /**
+     * @brief Gets the number of replies currently stored in the cache.
+     * @return the number of cached replies (always zero if ResponseCache is not enabled).
+     */
+    uint32 GetNumberOfCachedResponses();
+
 private:
 
     /**
@@ -132,6 +169,31 @@ private:
      */
     Reference FindTarget(HttpProtocol &protocol);
 
+    /**
+     * @brief Exports the target (or the root listing if the target is this instance) between a PrintBegin and a PrintEnd.
+     * @param[in] target the object to export.
+     * @param[out] sdata where to export the data.
+     * @return true if the data was successfully exported.
+     */
+    bool ExportTarget(Reference &target, StreamStructuredData<JsonPrinter> &sdata);
+
+    /**
+     * @brief Computes the maximum generation of the root, of this instance and of every container in \a requestPath (see class description).
+     * @param[in] requestPath the path requested w.r.t. to the root.
+     * @return the generation that identifies the current state of the requested resource.
+     */
+    uint32 GetPathGeneration(const char8 * const requestPath);
+
+    /**
+     * @brief Replies to a GetAsStructuredData using the cache (see class description).
+     * @param[in] data see GetAsStructuredData.
+     * @param[in] protocol see GetAsStructuredData.
+     * @param[in] target the object to export.
+     * @param[in] requestPath the path requested w.r.t. to the root.
+     * @return true if the reply was successfully written.
+     */
+    bool GetAsCachedStructuredData(StreamStructuredDataI &data, HttpProtocol &protocol, Reference &target, const char8 * const requestPath);
+
     /**
      * The realm associated to this browser.
      */
@@ -148,6 +210,31 @@ private:
      */
     ReferenceContainer *root;
 
+    /**
+     * True if the GetAsStructuredData replies are to be cached.
+     */
+    bool responseCache;
+
+    /**
+     * Maximum number of cached replies.
+     */
+    uint32 responseCacheSize;
+
+    /**
+     * Taken from the HighResolutionTimer at construction so that ETags from different executions (which restart the generations) do not match.
+     */
+    uint32 etagEpoch;
+
+    /**
+     * The cached replies (oldest first).
+     */
+    StaticList<HttpObjectBrowserCacheEntry *> cacheEntries;
+
+    /**
+     * Protects the access to cacheEntries.
+     */
+    FastPollingMutexSem cacheSem;
+
 };
 }
 
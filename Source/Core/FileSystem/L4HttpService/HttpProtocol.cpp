@@ -55,6 +55,7 @@ HttpProtocol::HttpProtocol(DoubleBufferedStream &outputStreamIn) :
     /** unknown information length */
     unreadInput = -1;
     textMode = -1;
+    binaryMode = -1;
     isChunked = false;
 }
 
@@ -179,6 +180,10 @@ bool HttpProtocol::ReadHeader(const uint32 bufferReadSize) {
                     if (!Read("TextMode", textMode)) {
                         textMode = textModeT;
                     }
+                    int8 binaryModeT = binaryMode;
+                    if (!Read("BinaryMode", binaryMode)) {
+                        binaryMode = binaryModeT;
+                    }
                 }
             }
         }
@@ -973,6 +978,61 @@ int8 HttpProtocol::TextMode() const {
     return textMode;
 }
 
+int8 HttpProtocol::BinaryMode() const {
+    return binaryMode;
+}
+
+bool HttpProtocol::AcceptsEncoding(const char8 * const encoding) {
+    StreamString acceptEncoding;
+    bool ok = MoveAbsolute("InputOptions");
+    if (ok) {
+        ok = Read("Accept-Encoding", acceptEncoding);
+    }
+    if (ok) {
+        ok = acceptEncoding.Seek(0ULL);
+    }
+    uint32 encodingSize = StringHelper::Length(encoding);
+    bool accepted = false;
+    bool found = false;
+    while ((ok) && (!found)) {
+        StreamString coding;
+        char8 terminator;
+        ok = acceptEncoding.GetToken(coding, ",", terminator, " \t,");
+        if (ok) {
+            //Separate the coding from its parameters (e.g. deflate;q=0.5)
+            const char8 *parameters = StringHelper::SearchChar(coding.Buffer(), ';');
+            uint32 codingSize = static_cast<uint32>(coding.Size());
+            if (parameters != NULL_PTR(const char8 *)) {
+                /*lint -e{946,947,9125} allow for pointers to be subtracted and cast to uint32*/
+                codingSize = static_cast<uint32>(parameters - coding.Buffer());
+            }
+            bool isEncoding = (codingSize == encodingSize);
+            if (isEncoding) {
+                isEncoding = (StringHelper::CompareNoCaseSensN(coding.Buffer(), encoding, encodingSize) == 0);
+            }
+            bool isAny = (codingSize == 1u);
+            if (isAny) {
+                isAny = (coding.Buffer()[0] == '*');
+            }
+            if ((isEncoding) || (isAny)) {
+                accepted = true;
+                if (parameters != NULL_PTR(const char8 *)) {
+                    const char8 *quality = StringHelper::SearchString(parameters, "q=");
+                    if (quality != NULL_PTR(const char8 *)) {
+                        float32 qValue = 1.F;
+                        if (TypeConvert(qValue, &quality[2u])) {
+                            accepted = (qValue > 0.F);
+                        }
+                    }
+                }
+                //The coding explicitly listed has precedence over the wildcard.
+                found = isEncoding;
+            }
+        }
+    }
+    return accepted;
+}
+
 bool HttpProtocol::GetInputCommand(const char8 * const commandName, const AnyType &commandValue) {
 
     bool ret = MoveAbsolute("InputCommands");
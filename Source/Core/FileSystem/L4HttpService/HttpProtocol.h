@@ -177,6 +177,24 @@ public:
      */
     int8 TextMode() const;
 
+    /**
+     * @brief Retrieves the binary mode status.
+     * @details If the client specifies an input command BinaryMode=1 the service (in this case HttpService) will call
+     * DataExportI::GetAsBinary, independently of the TextMode. This flag is initialised at -1, this means that the client
+     * does not assert anything about it.
+     * @return -1 if the client has not specified a BinaryMode command, otherwise the value of the BinaryMode command.
+     */
+    int8 BinaryMode() const;
+
+    /**
+     * @brief Checks if the client accepts the content \a encoding (e.g. deflate).
+     * @details The codings listed in the Accept-Encoding option of the request are compared (without case) against \a encoding.
+     * The wildcard * matches any coding. A coding with a quality value of zero (e.g. deflate;q=0) is not accepted.
+     * @param[in] encoding the name of the content encoding.
+     * @return true if the Accept-Encoding option of the request accepts \a encoding.
+     */
+    bool AcceptsEncoding(const char8 * const encoding);
+
 protected:
 
     /**
@@ -238,6 +256,11 @@ protected:
      */
     int8 textMode;
 
+    /**
+     * The binary mode flag
+     */
+    int8 binaryMode;
+
     /**
      * True if the request is chunked
      */
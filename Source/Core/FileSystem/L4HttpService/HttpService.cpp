@@ -55,6 +55,9 @@ HttpService::HttpService() :
     listenMaxConnections = 0;
     textMode = 1u;
     chunkSize = 0u;
+    eventDriven = 0u;
+    numberOfWorkers = 0u;
+    connectionsSem.Create();
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -73,8 +76,31 @@ HttpService::~HttpService() {
 }
 
 bool HttpService::Initialise(StructuredDataI &data) {
-    //Cannot have more than one thread listening for the request.
-    bool ret = data.Write("MinNumberOfThreads", 1);
+    if (!data.Read("EventDriven", eventDriven)) {
+        eventDriven = 0u;
+    }
+    bool ret = true;
+    if (eventDriven > 0u) {
+        if (!data.Read("NumberOfWorkers", numberOfWorkers)) {
+            numberOfWorkers = 2u;
+            REPORT_ERROR(ErrorManagement::Information, "NumberOfWorkers not specified: using default %d", numberOfWorkers);
+        }
+        ret = (numberOfWorkers > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfWorkers must be > 0");
+        }
+        //All the workers wait for events and none is ever added (see ServerCycle).
+        if (ret) {
+            ret = data.Write("MinNumberOfThreads", numberOfWorkers);
+        }
+        if (ret) {
+            ret = data.Write("MaxNumberOfThreads", numberOfWorkers + 1u);
+        }
+    }
+    else {
+        //Cannot have more than one thread listening for the request.
+        ret = data.Write("MinNumberOfThreads", 1);
+    }
     if (ret) {
         ret = MultiClientService::Initialise(data);
     }
@@ -136,6 +162,17 @@ ErrorManagement::ErrorType HttpService::Start() {
         if (err.ErrorsCleared()) {
             err = !(server.Listen(port, listenMaxConnections));
 
+            if (err.ErrorsCleared()) {
+                if (eventDriven > 0u) {
+                    err = !(poll.Open());
+                    if (err.ErrorsCleared()) {
+                        err = !(poll.AddReadHandle(server, &server));
+                    }
+                    if (!err.ErrorsCleared()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed to open the EventPoll");
+                    }
+                }
+            }
             if (err.ErrorsCleared()) {
                 err = MultiClientService::Start();
             }
@@ -144,6 +181,76 @@ ErrorManagement::ErrorType HttpService::Start() {
     return err;
 }
 
+ErrorManagement::ErrorType HttpService::Stop() {
+    ErrorManagement::ErrorType err = MultiClientService::Stop();
+    if (err.ErrorsCleared()) {
+        if (poll.IsValid()) {
+            if (connectionsSem.FastLock() == ErrorManagement::NoError) {
+                uint32 i;
+                for (i = 0u; i < connections.GetSize(); i++) {
+                    HttpChunkedStream *commClient = NULL_PTR(HttpChunkedStream *);
+                    if (connections.Peek(i, commClient)) {
+                        (void) commClient->Close();
+                        delete commClient;
+                    }
+                }
+                connections.Clean();
+            }
+            connectionsSem.FastUnLock();
+            (void) poll.Close();
+        }
+    }
+    return err;
+}
+
+ErrorManagement::ErrorType HttpService::ServeRequest(HttpChunkedStream &commClient,
+                                                     HttpProtocol &hprotocol) const {
+    ErrorManagement::ErrorType err;
+    uint8 requestedTextMode = textMode;
+    //you want plain text or data
+    if (!hprotocol.ReadHeader()) {
+        err = ErrorManagement::CommunicationError;
+        REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
+    }
+    bool pagePrepared = false;
+
+    if (err.ErrorsCleared()) {
+        if (hprotocol.TextMode() >= 0) {
+            requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (!hprotocol.MoveAbsolute("OutputOptions")) {
+            err = !(hprotocol.CreateAbsolute("OutputOptions"));
+        }
+        if (hprotocol.BinaryMode() > 0) {
+            pagePrepared = webRoot->GetAsBinary(commClient, hprotocol);
+        }
+        else if (requestedTextMode > 0u) {
+            pagePrepared = webRoot->GetAsText(commClient, hprotocol);
+        }
+        else {
+            StreamStructuredData<JsonPrinter> sdata;
+            sdata.SetStream(commClient);
+            pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
+        }
+        if (err.ErrorsCleared()) {
+            err = !(commClient.Flush());
+        }
+        if (err.ErrorsCleared()) {
+            if (commClient.IsChunkMode()) {
+                err = !(commClient.FinalChunk());
+            }
+        }
+    }
+    if (err.ErrorsCleared()) {
+        if (!pagePrepared) {
+            //TODO??
+        }
+    }
+    return err;
+}
+
 ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const commClient) const {
     ErrorManagement::ErrorType err = !(commClient == NULL);
 
@@ -157,47 +264,9 @@ ErrorManagement::ErrorType HttpService::ClientService(HttpChunkedStream * const
     }
     //give the possibility to stop the thread
     if (err.ErrorsCleared()) {
-        uint8 requestedTextMode = textMode;
         HttpProtocol hprotocol(*commClient);
         if (sel.WaitUntil(1000u) > 0) {
-            //you want plain text or data
-            if (!hprotocol.ReadHeader()) {
-                err = ErrorManagement::CommunicationError;
-                REPORT_ERROR(ErrorManagement::CommunicationError, "Error while reading HTTP header");
-            }
-            bool pagePrepared = false;
-
-            if (err.ErrorsCleared()) {
-                if (hprotocol.TextMode() >= 0) {
-                    requestedTextMode = static_cast<uint8>(hprotocol.TextMode());
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!hprotocol.MoveAbsolute("OutputOptions")) {
-                    err = !(hprotocol.CreateAbsolute("OutputOptions"));
-                }
-                if (requestedTextMode > 0u) {
-                    pagePrepared = webRoot->GetAsText(*commClient, hprotocol);
-                }
-                else {
-                    StreamStructuredData<JsonPrinter> sdata;
-                    sdata.SetStream(*commClient);
-                    pagePrepared = webRoot->GetAsStructuredData(sdata, hprotocol);
-                }
-                if (err.ErrorsCleared()) {
-                    err = !(commClient->Flush());
-                }
-                if (err.ErrorsCleared()) {
-                    if (commClient->IsChunkMode()) {
-                        err = !(commClient->FinalChunk());
-                    }
-                }
-            }
-            if (err.ErrorsCleared()) {
-                if (!pagePrepared) {
-                    //TODO??
-                }
-            }
+            err = ServeRequest(*commClient, hprotocol);
         }
         if (err.ErrorsCleared()) {
             if (!hprotocol.KeepAlive()) {
@@ -228,8 +297,30 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
     }
     if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
 
+        if (eventDriven > 0u) {
+            if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
+                void *ready = NULL_PTR(void *);
+                int32 nReady = poll.WaitUntil(acceptTimeout, &ready, 1u);
+                //Always keep the worker waiting for events.
+                err = MARTe::ErrorManagement::Timeout;
+                if (nReady < 0) {
+                    err = MARTe::ErrorManagement::FatalError;
+                }
+                else if (nReady > 0) {
+                    if (ready == &server) {
+                        AcceptConnection();
+                    }
+                    else {
+                        ServeConnection(reinterpret_cast<HttpChunkedStream *>(ready));
+                    }
+                }
+                else {
+                    //Timeout
+                }
+            }
+        }
         /*lint -e{593} -e{429} the newClient pointer will be freed within the thread*/
-        if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
+        else if (information.GetStageSpecific() == MARTe::ExecutionInfo::WaitRequestStageSpecific) {
             /*lint -e{429} the newClient pointer will be freed within the thread*/
             HttpChunkedStream *newClient = new HttpChunkedStream();
             newClient->SetChunkMode(false);
@@ -241,6 +332,10 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
                     delete newClient;
                 }
                 else {
+                    //The reply is written in several chunks.
+                    if (!newClient->SetNoDelay(true)) {
+                        REPORT_ERROR(ErrorManagement::Warning, "Failed to disable the coalescing of small writes");
+                    }
                     if (GetNumberOfActiveThreads() == GetMaximumNumberOfPoolThreads()) {
                         err = MARTe::ErrorManagement::Timeout;
                         HttpProtocol hprotocol(*newClient);
@@ -260,15 +355,108 @@ ErrorManagement::ErrorType HttpService::ServerCycle(MARTe::ExecutionInfo &inform
                 }
             }
         }
-        if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
+        else if (information.GetStageSpecific() == MARTe::ExecutionInfo::ServiceRequestStageSpecific) {
             HttpChunkedStream *newClient = reinterpret_cast<HttpChunkedStream *>(information.GetThreadSpecificContext());
             err = ClientService(newClient);
         }
+        else {
+            //NOOP
+        }
     }
 
     return err;
 }
 
+void HttpService::AcceptConnection() {
+    /*lint -e{429} the newClient pointer is either freed here or added to the connections list*/
+    HttpChunkedStream *newClient = new HttpChunkedStream();
+    newClient->SetChunkMode(false);
+    newClient->SetCalibWriteParam(0u);
+    bool ok = newClient->SetBufferSize(32u, chunkSize);
+    if (ok) {
+        ok = (server.WaitConnection(acceptTimeout, newClient) != NULL);
+    }
+    if (ok) {
+        if (!newClient->SetNoDelay(true)) {
+            REPORT_ERROR(ErrorManagement::Warning, "Failed to disable the coalescing of small writes");
+        }
+    }
+    if (ok) {
+        ok = (static_cast<int32>(GetNumberOfConnections()) < listenMaxConnections);
+        if (!ok) {
+            HttpProtocol hprotocol(*newClient);
+            StreamString s;
+            (void) s.SetSize(0LLU);
+            if (!hprotocol.WriteHeader(false, HttpDefinition::HSHCReplyTooManyRequests, &s, NULL_PTR(const char8*))) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Too many connections");
+            }
+            REPORT_ERROR(ErrorManagement::Warning, "Too many connections");
+            (void) newClient->Close();
+        }
+    }
+    if (ok) {
+        ok = newClient->SetBlocking(true);
+    }
+    if (ok) {
+        ok = (connectionsSem.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            ok = connections.Add(newClient);
+        }
+        connectionsSem.FastUnLock();
+        if (ok) {
+            ok = poll.AddReadHandle(*newClient, newClient);
+            if (!ok) {
+                CloseConnection(newClient);
+                newClient = NULL_PTR(HttpChunkedStream *);
+            }
+        }
+    }
+    if ((!ok) && (newClient != NULL_PTR(HttpChunkedStream *))) {
+        (void) newClient->Close();
+        delete newClient;
+    }
+    if (!poll.RearmReadHandle(server, &server)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to rearm the server socket");
+    }
+}
+
+void HttpService::ServeConnection(HttpChunkedStream * const commClient) {
+    commClient->SetChunkMode(false);
+    HttpProtocol hprotocol(*commClient);
+    ErrorManagement::ErrorType err = ServeRequest(*commClient, hprotocol);
+    bool keepAlive = err.ErrorsCleared();
+    if (keepAlive) {
+        keepAlive = hprotocol.KeepAlive();
+    }
+    if (keepAlive) {
+        keepAlive = poll.RearmReadHandle(*commClient, commClient);
+    }
+    if (!keepAlive) {
+        CloseConnection(commClient);
+    }
+}
+
+void HttpService::CloseConnection(HttpChunkedStream * const commClient) {
+    (void) poll.RemoveReadHandle(*commClient);
+    if (connectionsSem.FastLock() == ErrorManagement::NoError) {
+        uint32 i;
+        bool found = false;
+        for (i = 0u; (i < connections.GetSize()) && (!found); i++) {
+            HttpChunkedStream *c = NULL_PTR(HttpChunkedStream *);
+            found = connections.Peek(i, c);
+            if (found) {
+                found = (c == commClient);
+            }
+            if (found) {
+                found = connections.Remove(i);
+            }
+        }
+    }
+    connectionsSem.FastUnLock();
+    (void) commClient->Close();
+    delete commClient;
+}
+
 uint16 HttpService::GetPort() const {
     return port;
 }
@@ -281,6 +469,23 @@ ReferenceT<HttpDataExportI> HttpService::GetWebRoot() const {
     return webRoot;
 }
 
+bool HttpService::IsEventDriven() const {
+    return (eventDriven > 0u);
+}
+
+uint32 HttpService::GetNumberOfWorkers() const {
+    return numberOfWorkers;
+}
+
+uint32 HttpService::GetNumberOfConnections() {
+    uint32 n = 0u;
+    if (connectionsSem.FastLock() == ErrorManagement::NoError) {
+        n = connections.GetSize();
+    }
+    connectionsSem.FastUnLock();
+    return n;
+}
+
 CLASS_REGISTER(HttpService, "1.0")
 CLASS_METHOD_REGISTER(HttpService, Start)
 }
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "EmbeddedServiceMethodBinderT.h"
+#include "EventPoll.h"
 #include "FastPollingMutexSem.h"
 #include "HttpChunkedStream.h"
 #include "HttpDataExportI.h"
@@ -39,6 +40,7 @@
 #include "MultiClientService.h"
 #include "ReferenceT.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "StaticList.h"
 #include "StreamString.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -46,6 +48,8 @@
 
 namespace MARTe{
 
+class HttpProtocol;
+
 /**
  * @brief Implementation of an HTTP server.
  * @see MultiClientService.
@@ -63,6 +67,16 @@ namespace MARTe{
  * DataExportI::GetAsText of the object found at the path received from the client, or DatExportI::GetAsStructuredData if
  * TextMode=0. In this second case a StructuredDataStream<JsonPrinter> is passed in input to the DatExportI::GetAsStructuredData
  * in order to send to the client data written in json language.
+ * If the client sends BinaryMode=1 the HttpService calls DataExportI::GetAsBinary instead, so that large arrays can be sent
+ * as raw binary data (see HttpBinaryExporter).
+ *
+ * @details In event-driven mode (EventDriven = 1) the connections are not bound to threads. A fixed pool of NumberOfWorkers threads waits
+ * on an EventPoll which monitors the server socket and all the open connections. The worker that is woken by the server socket accepts the new
+ * connection and adds it to the EventPoll. The worker that is woken by a connection serves one request (see ClientService) and, if the connection is
+ * to be kept alive, gives it back to the EventPoll. This allows many keep-alive clients (e.g. dashboards periodically polling an HttpObjectBrowser) to
+ * be served by a small number of threads. Note that a worker still blocks while reading a request that was only partially received.
+ * In this mode ListenMaxConnections is also the maximum number of simultaneously open connections and MaxNumberOfThreads is ignored.
+ * This mode is only available in environments that implement the EventPoll (e.g. Linux).
  *
  * @details The HttpService replies to the client always using the HTTP chunked transfer encoding. This allows to stream out
  * data to the socket without knowing a priori the full length of the HTTP message body. This allows to avoid having to store the
@@ -80,6 +94,8 @@ namespace MARTe{
  *     WebRoot = ARoot //Compulsory. Path in the ObjectConfigurationDatabase of the object that acts as the root for the service. This object shall inherit from HttpDataExportI.
  *     IsTextMode = 1 //Optional (default = 1). If the GET option TextMode is not set, the reply is either sent as text/html (IsTextMode = 1) or as text/json (IsTextMode = 0). With the former GetAsText is called on the web root object, while with the latter GetAsStructuredData is called instead.
  *     ChunkSize = 32 //Optional (default = 32). The maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode.
+ *     EventDriven = 0 //Optional (default = 0). If 1 the connections are served by a fixed pool of NumberOfWorkers threads (see above).
+ *     NumberOfWorkers = 2 //Optional (default = 2). Only meaningful if EventDriven = 1. The number of threads serving all the connections.
  * }
  * </pre>
  */
@@ -110,6 +126,8 @@ public:
      *   IsTextMode: The default data sending mode. A client can change this mode by sending the HTTP command called TextMode=[0(false), 1(true)].
      *     Default=1 (text mode).
      *   ChunkSize: the maximum size of the chunks in which the reply bode is divided to perform the chunked transfer encoding mode. Default = 32
+     *   EventDriven: if 1 the connections are served by a fixed pool of threads waiting on an EventPoll. Default = 0.
+     *   NumberOfWorkers: the number of threads of the pool when EventDriven = 1 (MinNumberOfThreads is set to this value). Default = 2.
      * @return true if all the parameters are set and valid.
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -118,15 +136,24 @@ public:
      * @see MultiClientService::Start
      * @details Before starting the thread, it finds the root object specified in the \a WebRoot configuration parameter.
      * If the path is wrong, ErrorManagement::FatalError is returned.
+     * In event-driven mode it also opens the EventPoll and adds the server socket to it.
      */
     virtual ErrorManagement::ErrorType Start();
 
+    /**
+     * @see MultiClientService::Stop
+     * @details In event-driven mode, after stopping the threads, closes all the open connections and the EventPoll.
+     */
+    virtual ErrorManagement::ErrorType Stop();
+
 
     /**
      * @brief The server task that has to be performed by one thread at once.
      * @brief Once a new connection has been created the thread calls ClientService to handle the
      * connection task with the client, while a new thread calls ServerCycle to wait for new connections.
      * @param[in] information specifies the thread status managed in MultiClientEmbeddedThread::ThreadLoop.
+     * @details In event-driven mode the requests are served in the ExecutionInfo::WaitRequestStageSpecific stage (which always returns
+     * ErrorManagement::Timeout), so that the threads of the pool never leave the wait stage nor request new threads.
      */
     ErrorManagement::ErrorType ServerCycle(MARTe::ExecutionInfo &information);
 
@@ -157,7 +184,52 @@ public:
      */
     ReferenceT<HttpDataExportI> GetWebRoot() const;
 
+    /**
+     * @brief Checks if the service is in event-driven mode.
+     * @return true if the service is in event-driven mode.
+     */
+    bool IsEventDriven() const;
+
+    /**
+     * @brief Gets the number of threads serving the connections in event-driven mode.
+     * @return the number of threads serving the connections in event-driven mode.
+     */
+    uint32 GetNumberOfWorkers() const;
+
+    /**
+     * @brief Gets the number of connections currently open in event-driven mode.
+     * @return the number of connections currently open in event-driven mode.
+     */
+    uint32 GetNumberOfConnections();
+
 private:
+
+    /**
+     * @brief Reads the HTTP header from the client and writes the reply.
+     * @param[in] commClient is the socket to communicate with the client.
+     * @param[in] hprotocol the HttpProtocol associated to \a commClient.
+     * @return ErrorManagement::NoError if the header was successfully read and the reply written.
+     */
+    ErrorManagement::ErrorType ServeRequest(HttpChunkedStream &commClient,
+                                            HttpProtocol &hprotocol) const;
+
+    /**
+     * @brief Event-driven mode. Accepts a new connection and adds it to the EventPoll.
+     */
+    void AcceptConnection();
+
+    /**
+     * @brief Event-driven mode. Serves one request from a connection that is ready to be read and gives it back to the EventPoll or closes it.
+     * @param[in] commClient the connection.
+     */
+    void ServeConnection(HttpChunkedStream * const commClient);
+
+    /**
+     * @brief Event-driven mode. Removes a connection from the EventPoll and from the list of open connections, closes and destroys it.
+     * @param[in] commClient the connection.
+     */
+    void CloseConnection(HttpChunkedStream * const commClient);
+
     /**
      * The server socket
      */
@@ -209,6 +281,31 @@ private:
      * Filter to receive the RPC
      */
     ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * The event-driven mode flag.
+     */
+    uint8 eventDriven;
+
+    /**
+     * The number of threads serving the connections in event-driven mode.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * Monitors the server socket and the open connections in event-driven mode.
+     */
+    EventPoll poll;
+
+    /**
+     * The open connections in event-driven mode.
+     */
+    StaticList<HttpChunkedStream *> connections;
+
+    /**
+     * Protects the connections list.
+     */
+    FastPollingMutexSem connectionsSem;
 };
 
 }
@@ -0,0 +1,427 @@
+/**
+ * @file HttpStreamDataSource.cpp
+ * @brief Source file for class HttpStreamDataSource
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpStreamDataSource (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HttpBinaryExporter.h"
+#include "HttpChunkedStream.h"
+#include "HttpProtocol.h"
+#include "HttpStreamDataSource.h"
+#include "JsonPrinter.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * Maximum number of attempts to get a consistent copy of a snapshot.
+ */
+static const uint32 HTTP_STREAM_DATASOURCE_MAX_RETRIES = 1000u;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+HttpStreamDataSource::HttpStreamDataSource() :
+        MemoryDataSourceI(),
+        HttpDataExportI() {
+    publishDecimation = 1u;
+    publishCounter = 0u;
+    streamPeriod = 100u;
+    maxNumberOfStreams = 4u;
+    numberOfStreams = 0u;
+    stopStreams = 0u;
+    snapshotSequence = 0u;
+    snapshots = NULL_PTR(uint8 *);
+}
+
+HttpStreamDataSource::~HttpStreamDataSource() {
+    if (snapshots != NULL_PTR(uint8 *)) {
+        delete[] snapshots;
+        snapshots = NULL_PTR(uint8 *);
+    }
+}
+
+bool HttpStreamDataSource::Initialise(StructuredDataI & data) {
+    bool ok = MemoryDataSourceI::Initialise(data);
+    if (ok) {
+        if (!data.Read("PublishDecimation", publishDecimation)) {
+            publishDecimation = 1u;
+        }
+        ok = (publishDecimation > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "PublishDecimation shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("StreamPeriod", streamPeriod)) {
+            streamPeriod = 100u;
+        }
+        ok = (streamPeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "StreamPeriod shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("MaxNumberOfStreams", maxNumberOfStreams)) {
+            maxNumberOfStreams = 4u;
+        }
+        ok = (maxNumberOfStreams > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "MaxNumberOfStreams shall be > 0");
+        }
+    }
+    return ok;
+}
+
+bool HttpStreamDataSource::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    if (ok) {
+        ok = (snapshots == NULL_PTR(uint8 *));
+    }
+    if (ok) {
+        snapshots = new uint8[2u * stateMemorySize];
+        ok = MemoryOperationsHelper::Set(snapshots, '\0', (2u * stateMemorySize));
+    }
+    return ok;
+}
+
+const char8 *HttpStreamDataSource::GetBrokerName(StructuredDataI &data,
+                                                 const SignalDirection direction) {
+    const char8 *brokerName = NULL_PTR(const char8 *);
+    float32 freq;
+    if (!data.Read("Frequency", freq)) {
+        freq = -1.0F;
+    }
+    uint32 samples;
+    if (!data.Read("Samples", samples)) {
+        samples = 1u;
+    }
+    if ((freq < 0.F) && (samples == 1u) && (direction == OutputSignals)) {
+        brokerName = "MemoryMapSynchronisedOutputBroker";
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Only OutputSignals without Frequency and with Samples = 1 are supported");
+    }
+    return brokerName;
+}
+
+/*lint -e{715} input signals are not supported.*/
+bool HttpStreamDataSource::GetInputBrokers(ReferenceContainer &inputBrokers,
+                                           const char8 * const functionName,
+                                           void * const gamMemPtr) {
+    return false;
+}
+
+bool HttpStreamDataSource::GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                            const char8 * const functionName,
+                                            void * const gamMemPtr) {
+    ReferenceT<MemoryMapSynchronisedOutputBroker> broker("MemoryMapSynchronisedOutputBroker");
+    bool ok = broker.IsValid();
+    if (ok) {
+        ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr, true);
+    }
+    if (ok) {
+        ok = outputBrokers.Insert(broker);
+    }
+    return ok;
+}
+
+/*lint -e{715} the snapshots do not depend on the state.*/
+bool HttpStreamDataSource::PrepareNextState(const char8 * const currentStateName,
+                                            const char8 * const nextStateName) {
+    return true;
+}
+
+bool HttpStreamDataSource::Synchronise() {
+    bool ok = (snapshots != NULL_PTR(uint8 *));
+    if (ok) {
+        publishCounter++;
+        if (publishCounter >= publishDecimation) {
+            publishCounter = 0u;
+            //Only the real-time thread writes the sequence, so that a plain read is sufficient.
+            uint32 sequence = snapshotSequence;
+            uint32 nextBuffer = (((sequence >> 1u) & 1u) ^ 1u);
+            Atomic::StoreRelease(&snapshotSequence, sequence + 1u);
+            //The odd sequence must be visible before any of the data stores.
+            Atomic::MemoryFence();
+            ok = MemoryOperationsHelper::Copy(&snapshots[nextBuffer * stateMemorySize], memory, stateMemorySize);
+            //Release: the data stores are visible before the even sequence.
+            Atomic::StoreRelease(&snapshotSequence, sequence + 2u);
+        }
+    }
+    return ok;
+}
+
+void HttpStreamDataSource::Purge(ReferenceContainer &purgeList) {
+    Atomic::StoreRelease(&stopStreams, 1u);
+    ReferenceContainer::Purge(purgeList);
+}
+
+bool HttpStreamDataSource::GetSnapshot(uint8 * const snapshot,
+                                       uint32 &numberOfSnapshots) {
+    bool ok = (snapshots != NULL_PTR(uint8 *));
+    bool consistent = false;
+    for (uint32 attempt = 0u; (attempt < HTTP_STREAM_DATASOURCE_MAX_RETRIES) && (ok) && (!consistent); attempt++) {
+        uint32 sequence = Atomic::LoadAcquire(&snapshotSequence);
+        //The last completely written buffer. If the sequence is odd this is not the buffer being written.
+        uint32 buffer = ((sequence >> 1u) & 1u);
+        ok = MemoryOperationsHelper::Copy(snapshot, &snapshots[buffer * stateMemorySize], stateMemorySize);
+        //The data loads must complete before the sequence is read again.
+        Atomic::MemoryFence();
+        consistent = (Atomic::LoadAcquire(&snapshotSequence) == sequence);
+        if (consistent) {
+            numberOfSnapshots = (sequence >> 1u);
+        }
+        else {
+            Atomic::Pause();
+        }
+    }
+    if ((ok) && (!consistent)) {
+        ok = false;
+        REPORT_ERROR(ErrorManagement::Timeout, "Could not get a consistent copy of the signals after %d attempts", HTTP_STREAM_DATASOURCE_MAX_RETRIES);
+    }
+    return ok;
+}
+
+uint32 HttpStreamDataSource::GetNumberOfSnapshots() {
+    return (Atomic::LoadAcquire(&snapshotSequence) >> 1u);
+}
+
+uint32 HttpStreamDataSource::GetNumberOfStreams() {
+    return Atomic::LoadAcquire(&numberOfStreams);
+}
+
+bool HttpStreamDataSource::PrintSnapshot(BufferedStreamI &stream,
+                                         uint8 * const snapshot) {
+    JsonPrinter printer(stream);
+    bool ok = printer.PrintBegin();
+    uint32 nOfSignals = GetNumberOfSignals();
+    for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+        if (s > 0u) {
+            ok = printer.PrintVariableSeparator();
+        }
+        StreamString signalName;
+        if (ok) {
+            ok = GetSignalName(s, signalName);
+        }
+        uint32 numberOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(s, numberOfElements);
+        }
+        if (ok) {
+            ok = printer.PrintOpenAssignment(signalName.Buffer());
+        }
+        if (ok) {
+            /*lint -e{613} signalOffsets is allocated if there are signals.*/
+            AnyType value(GetSignalType(s), 0u, &snapshot[signalOffsets[s]]);
+            //Matrices are exported as vectors.
+            if (numberOfElements > 1u) {
+                value.SetNumberOfDimensions(1u);
+                value.SetNumberOfElements(0u, numberOfElements);
+            }
+            ok = printer.PrintVariable(value);
+        }
+        if (ok) {
+            ok = printer.PrintCloseAssignment(signalName.Buffer());
+        }
+    }
+    if (ok) {
+        ok = printer.PrintEnd();
+    }
+    return ok;
+}
+
+bool HttpStreamDataSource::GetAsStructuredData(StreamStructuredDataI &data,
+                                               HttpProtocol &protocol) {
+    bool ok = (snapshots != NULL_PTR(uint8 *));
+    if (ok) {
+        ok = HttpDataExportI::GetAsStructuredData(data, protocol);
+    }
+    BufferedStreamI *stream = NULL_PTR(BufferedStreamI *);
+    if (ok) {
+        stream = data.GetStream();
+        ok = (stream != NULL_PTR(BufferedStreamI *));
+    }
+    uint8 *snapshot = NULL_PTR(uint8 *);
+    uint32 numberOfSnapshots;
+    if (ok) {
+        snapshot = new uint8[stateMemorySize];
+        ok = GetSnapshot(snapshot, numberOfSnapshots);
+    }
+    if (ok) {
+        /*lint -e{613} stream cannot be NULL as otherwise ok would be false*/
+        ok = PrintSnapshot(*stream, snapshot);
+    }
+    if (snapshot != NULL_PTR(uint8 *)) {
+        delete[] snapshot;
+    }
+    return ok;
+}
+
+bool HttpStreamDataSource::GetAsBinary(StreamI &stream,
+                                       HttpProtocol &protocol) {
+    bool ok = (snapshots != NULL_PTR(uint8 *));
+    uint8 *snapshot = NULL_PTR(uint8 *);
+    uint32 numberOfSnapshots;
+    if (ok) {
+        snapshot = new uint8[stateMemorySize];
+        ok = GetSnapshot(snapshot, numberOfSnapshots);
+    }
+    HttpBinaryExporter exporter;
+    uint32 nOfSignals = GetNumberOfSignals();
+    for (uint32 s = 0u; (s < nOfSignals) && (ok); s++) {
+        StreamString signalName;
+        ok = GetSignalName(s, signalName);
+        uint32 numberOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(s, numberOfElements);
+        }
+        if (ok) {
+            /*lint -e{613} signalOffsets is allocated if there are signals.*/
+            AnyType value(GetSignalType(s), 0u, &snapshot[signalOffsets[s]]);
+            //Matrices are exported as vectors.
+            if (numberOfElements > 1u) {
+                value.SetNumberOfDimensions(1u);
+                value.SetNumberOfElements(0u, numberOfElements);
+            }
+            ok = exporter.AddVariable(signalName.Buffer(), value);
+        }
+    }
+    if (ok) {
+        ok = exporter.Export(stream, protocol);
+    }
+    if (snapshot != NULL_PTR(uint8 *)) {
+        delete[] snapshot;
+    }
+    return ok;
+}
+
+bool HttpStreamDataSource::GetAsText(StreamI &stream,
+                                     HttpProtocol &protocol) {
+    HttpChunkedStream *hstream = dynamic_cast<HttpChunkedStream *>(&stream);
+    bool ok = (hstream != NULL_PTR(HttpChunkedStream *));
+    if (ok) {
+        ok = (snapshots != NULL_PTR(uint8 *));
+    }
+    //Reserve a stream.
+    bool reserved = false;
+    bool full = false;
+    while ((ok) && (!reserved) && (!full)) {
+        uint32 currentNumberOfStreams = Atomic::LoadAcquire(&numberOfStreams);
+        full = (currentNumberOfStreams >= maxNumberOfStreams);
+        if (!full) {
+            reserved = Atomic::CompareAndSwap(&numberOfStreams, currentNumberOfStreams, currentNumberOfStreams + 1u);
+        }
+    }
+    if (full) {
+        REPORT_ERROR(ErrorManagement::Warning, "Too many streams");
+        if (protocol.MoveAbsolute("OutputOptions")) {
+            (void) protocol.Write("Connection", "close");
+        }
+        ok = protocol.WriteHeader(true, HttpDefinition::HSHCReplyTooManyRequests, NULL_PTR(BufferedStreamI *), NULL_PTR(const char8 *));
+    }
+    else if (ok) {
+        ok = protocol.MoveAbsolute("OutputOptions");
+        if (ok) {
+            ok = protocol.Write("Transfer-Encoding", "chunked");
+        }
+        if (ok) {
+            ok = protocol.Write("Content-Type", "text/event-stream");
+        }
+        if (ok) {
+            ok = protocol.Write("Cache-Control", "no-cache");
+        }
+        if (ok) {
+            //empty string... go in chunked mode
+            StreamString hs;
+            ok = protocol.WriteHeader(false, HttpDefinition::HSHCReplyOK, &hs, NULL_PTR(const char8 *));
+        }
+        uint32 numberOfEvents = 0u;
+        if (ok) {
+            if (!protocol.GetInputCommand("NumberOfEvents", numberOfEvents)) {
+                numberOfEvents = 0u;
+            }
+            hstream->SetChunkMode(true);
+        }
+        uint8 *snapshot = NULL_PTR(uint8 *);
+        if (ok) {
+            snapshot = new uint8[stateMemorySize];
+        }
+        uint32 n = 0u;
+        bool done = !ok;
+        while (!done) {
+            uint32 numberOfSnapshots;
+            ok = GetSnapshot(snapshot, numberOfSnapshots);
+            //Each event is sent in its own chunk.
+            if (ok) {
+                ok = hstream->Printf("id: %u\ndata: ", numberOfSnapshots);
+            }
+            if (ok) {
+                ok = PrintSnapshot(*hstream, snapshot);
+            }
+            if (ok) {
+                ok = hstream->Printf("%s", "\n\n");
+            }
+            if (ok) {
+                ok = hstream->Flush();
+            }
+            n++;
+            done = (!ok);
+            if (!done) {
+                done = ((numberOfEvents > 0u) && (n >= numberOfEvents));
+            }
+            if (!done) {
+                Sleep::MSec(streamPeriod);
+                done = (Atomic::LoadAcquire(&stopStreams) > 0u);
+            }
+        }
+        if (snapshot != NULL_PTR(uint8 *)) {
+            delete[] snapshot;
+        }
+        if (reserved) {
+            bool released = false;
+            while (!released) {
+                uint32 currentNumberOfStreams = Atomic::LoadAcquire(&numberOfStreams);
+                released = Atomic::CompareAndSwap(&numberOfStreams, currentNumberOfStreams, currentNumberOfStreams - 1u);
+            }
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(HttpStreamDataSource, "1.0")
+
+}
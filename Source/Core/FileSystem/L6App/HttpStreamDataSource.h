@@ -0,0 +1,256 @@
+/**
+ * @file HttpStreamDataSource.h
+ * @brief Header file for class HttpStreamDataSource
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpStreamDataSource
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILESYSTEM_L6APP_HTTPSTREAMDATASOURCE_H_
+#define FILESYSTEM_L6APP_HTTPSTREAMDATASOURCE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HttpDataExportI.h"
+#include "MemoryDataSourceI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A MemoryDataSourceI which streams the value of its signals to HTTP clients as server-sent events (text/event-stream).
+ * @details The signals are written by the GAMs through a MemoryMapSynchronisedOutputBroker. In the Synchronise (i.e. in the real-time thread)
+ * a snapshot of all the signals is published, every PublishDecimation cycles, into a double buffer protected by a sequence (seqlock): the sequence is
+ * made odd, the buffer which does not hold the last snapshot is written and the sequence is made even again. The real-time thread never waits for
+ * the readers and never allocates memory.
+ *
+ * The snapshots are read, formatted and sent by the HttpService thread which is serving the request (see HttpDataExportI):
+ *  - GetAsText replies with a chunked text/event-stream. Every StreamPeriod milliseconds the last snapshot is sent as an event with the
+ *    number of published snapshots as the id and the signals as a single line JSON object, e.g.:
+ * <pre>
+ * id: 42
+ * data: {"Signal1": 3,"Signal2": [ 1.0, 2.0 ] }
+ * </pre>
+ *    The stream ends when the client closes the connection, when the DataSource is purged or, if the request has a NumberOfEvents
+ *    parameter (e.g. http://host:port/Stream?NumberOfEvents=10), after that number of events.
+ *    Note that each stream keeps an HttpService thread busy. If MaxNumberOfStreams are already active a 429 (Too Many Requests) is replied.
+ *  - GetAsStructuredData replies with the last snapshot as a JSON object.
+ *  - GetAsBinary replies with the last snapshot in binary form (see HttpBinaryExporter). This is the preferred format for large signals.
+ *
+ * Only output signals are allowed. Matrices are exported as vectors with all the elements.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +HttpStreamDataSource_Name = {
+ *    Class = HttpStreamDataSource
+ *    PublishDecimation = 1 //Optional. Default = 1. A snapshot is published every PublishDecimation calls to Synchronise. Shall be > 0.
+ *    StreamPeriod = 100 //Optional. Default = 100. Period in milliseconds of the events sent to each client. Shall be > 0.
+ *    MaxNumberOfStreams = 4 //Optional. Default = 4. Maximum number of clients being streamed at the same time. Shall be > 0.
+ *    Signals = {
+ *        ...
+ *    }
+ * }
+ * </pre>
+ */
+class DLL_API HttpStreamDataSource: public MemoryDataSourceI, public HttpDataExportI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    HttpStreamDataSource();
+
+    /**
+     * @brief Destructor. Frees the snapshot buffers.
+     */
+    virtual ~HttpStreamDataSource();
+
+    /**
+     * @brief See MemoryDataSourceI::Initialise. Reads the PublishDecimation, StreamPeriod and MaxNumberOfStreams parameters.
+     * @param[in] data the configuration data.
+     * @return true if MemoryDataSourceI::Initialise returns true and the parameters are valid.
+     */
+    virtual bool Initialise(StructuredDataI & data);
+
+    /**
+     * @brief See MemoryDataSourceI::AllocateMemory. Also allocates the two snapshot buffers.
+     * @return true if the memory can be allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @brief See DataSourceI::GetBrokerName.
+     * @return MemoryMapSynchronisedOutputBroker for OutputSignals. NULL for InputSignals, if Frequency is set or if Samples > 1.
+     */
+    virtual const char8 *GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @brief Input signals are not supported.
+     * @return false.
+     */
+    virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
+                                 const char8 * const functionName,
+                                 void * const gamMemPtr);
+
+    /**
+     * @brief Adds a MemoryMapSynchronisedOutputBroker for the \a functionName output signals.
+     * @param[out] outputBrokers where the broker is added.
+     * @param[in] functionName the name of the function.
+     * @param[in] gamMemPtr the GAM memory.
+     * @return true if the broker can be initialised.
+     */
+    virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
+                                  const char8 * const functionName,
+                                  void * const gamMemPtr);
+
+    /**
+     * @brief NOOP.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName,
+                                  const char8 * const nextStateName);
+
+    /**
+     * @brief Publishes a snapshot of the signals every PublishDecimation calls (see class description).
+     * @return true if the memory was allocated.
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Stops all the active streams and calls ReferenceContainer::Purge.
+     * @param[in] purgeList see ReferenceContainer::Purge.
+     */
+    virtual void Purge(ReferenceContainer &purgeList);
+
+    /**
+     * @brief Replies with the last snapshot as a JSON object.
+     * @param[out] data see HttpDataExportI::GetAsStructuredData.
+     * @param[out] protocol see HttpDataExportI::GetAsStructuredData.
+     * @return see HttpDataExportI::GetAsStructuredData.
+     */
+    virtual bool GetAsStructuredData(StreamStructuredDataI &data,
+                                     HttpProtocol &protocol);
+
+    /**
+     * @brief Streams the snapshots as server-sent events (see class description).
+     * @param[out] stream see HttpDataExportI::GetAsText.
+     * @param[out] protocol see HttpDataExportI::GetAsText.
+     * @return true if the stream was closed by the DataSource (i.e. not because of a communication error).
+     */
+    virtual bool GetAsText(StreamI &stream,
+                           HttpProtocol &protocol);
+
+    /**
+     * @brief Replies with the last snapshot in binary form (see HttpBinaryExporter).
+     * @param[out] stream see HttpDataExportI::GetAsBinary.
+     * @param[out] protocol see HttpDataExportI::GetAsBinary.
+     * @return true if the snapshot was successfully sent.
+     */
+    virtual bool GetAsBinary(StreamI &stream,
+                             HttpProtocol &protocol);
+
+    /**
+     * @brief Copies the last published snapshot.
+     * @param[out] snapshot where to copy the snapshot. Shall have space for all the signals (see MemoryDataSourceI).
+     * @param[out] numberOfSnapshots the number of snapshots published before this one.
+     * @return true if the memory was allocated and a consistent copy was obtained.
+     */
+    bool GetSnapshot(uint8 * const snapshot,
+                     uint32 &numberOfSnapshots);
+
+    /**
+     * @brief Gets the number of published snapshots.
+     * @return the number of published snapshots.
+     */
+    uint32 GetNumberOfSnapshots();
+
+    /**
+     * @brief Gets the number of clients currently being streamed.
+     * @return the number of clients currently being streamed.
+     */
+    uint32 GetNumberOfStreams();
+
+private:
+
+    /**
+     * @brief Prints \a snapshot as a single line JSON object (between braces).
+     * @param[in] stream where to print the object.
+     * @param[in] snapshot a snapshot copied with GetSnapshot.
+     * @return true if all the signals were printed.
+     */
+    bool PrintSnapshot(BufferedStreamI &stream,
+                       uint8 * const snapshot);
+
+    /**
+     * The snapshot is published every publishDecimation calls to Synchronise.
+     */
+    uint32 publishDecimation;
+
+    /**
+     * Number of calls to Synchronise since the last published snapshot.
+     */
+    uint32 publishCounter;
+
+    /**
+     * Period of the events in milliseconds.
+     */
+    uint32 streamPeriod;
+
+    /**
+     * Maximum number of clients being streamed at the same time.
+     */
+    uint32 maxNumberOfStreams;
+
+    /**
+     * Number of clients being streamed.
+     */
+    volatile uint32 numberOfStreams;
+
+    /**
+     * Set to 1 when the DataSource is purged so that the active streams end.
+     */
+    volatile uint32 stopStreams;
+
+    /**
+     * Odd while a snapshot is being written. The last published snapshot is in the buffer (sequence / 2) % 2.
+     */
+    volatile uint32 snapshotSequence;
+
+    /**
+     * The two snapshot buffers (each with stateMemorySize bytes).
+     */
+    uint8 *snapshots;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILESYSTEM_L6APP_HTTPSTREAMDATASOURCE_H_ */
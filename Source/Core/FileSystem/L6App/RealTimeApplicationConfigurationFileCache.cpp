@@ -0,0 +1,232 @@
+/**
+ * @file RealTimeApplicationConfigurationFileCache.cpp
+ * @brief Source file for class RealTimeApplicationConfigurationFileCache
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeApplicationConfigurationFileCache (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#define DLL_API
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "File.h"
+#include "RealTimeApplicationConfigurationFileCache.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Writes all the children of the current node of \a database, quoting the names so that the numeric
+ * names used by the RealTimeApplicationConfigurationBuilder can be parsed back by the StandardParser.
+ * @details The StandardParser does not accept empty blocks, so the full path of the empty nodes (e.g. the States of a signal that is not
+ * used in any state) is appended to \a emptyNodes and the node is not written.
+ */
+static bool WriteNode(File &cacheFile,
+                      ConfigurationDatabase &database,
+                      const StreamString &path,
+                      StreamString &emptyNodes) {
+    bool ok = true;
+    uint32 numberOfChildren = database.GetNumberOfChildren();
+    for (uint32 i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 * const childName = database.GetChildName(i);
+        if (database.MoveRelative(childName)) {
+            StreamString childPath = path;
+            if (childPath.Size() > 0u) {
+                ok = childPath.Printf("%s", ".");
+            }
+            if (ok) {
+                ok = childPath.Printf("%s", childName);
+            }
+            if (database.GetNumberOfChildren() == 0u) {
+                if (ok) {
+                    ok = emptyNodes.Printf("\"%s\" ", childPath.Buffer());
+                }
+                if (ok) {
+                    ok = database.MoveToAncestor(1u);
+                }
+            }
+            else {
+                if (ok) {
+                    ok = cacheFile.Printf("\"%s\" = {\n", childName);
+                }
+                if (ok) {
+                    ok = WriteNode(cacheFile, database, childPath, emptyNodes);
+                }
+                if (ok) {
+                    ok = database.MoveToAncestor(1u);
+                }
+                if (ok) {
+                    ok = cacheFile.Printf("%s", "}\n");
+                }
+            }
+        }
+        else {
+            AnyType leaf = database.GetType(childName);
+            ok = cacheFile.Printf("\"%s\" = %#!\n", childName, leaf);
+        }
+    }
+    return ok;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+RealTimeApplicationConfigurationFileCache::RealTimeApplicationConfigurationFileCache() :
+        Object(),
+        RealTimeApplicationConfigurationCacheI() {
+}
+
+RealTimeApplicationConfigurationFileCache::~RealTimeApplicationConfigurationFileCache() {
+}
+
+bool RealTimeApplicationConfigurationFileCache::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = data.Read("File", fileName);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The File shall be set");
+        }
+    }
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCache::Load(const uint32 configurationHash,
+                                                     ConfigurationDatabase &functionsDatabaseOut,
+                                                     ConfigurationDatabase &dataSourcesDatabaseOut) {
+    File cacheFile;
+    //Not finding the file is the normal cache miss.
+    bool ok = cacheFile.Open(fileName.Buffer(), BasicFile::ACCESS_MODE_R);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = cacheFile.Seek(0LLU);
+        StreamString errStream;
+        if (ok) {
+            StandardParser parser(cacheFile, cdb, &errStream);
+            ok = parser.Parse();
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "Failed to parse the ConfigurationCache %s: %s", fileName.Buffer(), errStream.Buffer());
+        }
+        (void) cacheFile.Flush();
+        (void) cacheFile.Close();
+    }
+    if (ok) {
+        uint32 storedHash = 0u;
+        ok = cdb.Read("Hash", storedHash);
+        if (ok) {
+            ok = (storedHash == configurationHash);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Information, "The ConfigurationCache %s was stored for another configuration", fileName.Buffer());
+        }
+    }
+    if (ok) {
+        AnyType emptyNodesType = cdb.GetType("EmptyNodes");
+        if (emptyNodesType.GetDataPointer() != NULL_PTR(void *)) {
+            uint32 numberOfEmptyNodes = emptyNodesType.GetNumberOfElements(0u);
+            Vector<StreamString> emptyNodes(numberOfEmptyNodes);
+            ok = cdb.Read("EmptyNodes", emptyNodes);
+            for (uint32 n = 0u; (n < numberOfEmptyNodes) && (ok); n++) {
+                ok = cdb.CreateAbsolute(emptyNodes[n].Buffer());
+            }
+            if (ok) {
+                ok = cdb.MoveToRoot();
+            }
+        }
+    }
+    if (ok) {
+        functionsDatabaseOut.Purge();
+        ok = cdb.MoveAbsolute("Functions");
+        if (ok) {
+            ok = functionsDatabaseOut.CreateAbsolute("Functions");
+        }
+        if (ok) {
+            ok = cdb.Copy(functionsDatabaseOut);
+        }
+        if (ok) {
+            ok = functionsDatabaseOut.MoveToRoot();
+        }
+    }
+    if (ok) {
+        dataSourcesDatabaseOut.Purge();
+        ok = cdb.MoveAbsolute("Data");
+        if (ok) {
+            ok = dataSourcesDatabaseOut.CreateAbsolute("Data");
+        }
+        if (ok) {
+            ok = cdb.Copy(dataSourcesDatabaseOut);
+        }
+        if (ok) {
+            ok = dataSourcesDatabaseOut.MoveToRoot();
+        }
+    }
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCache::Store(const uint32 configurationHash,
+                                                      ConfigurationDatabase &functionsDatabaseIn,
+                                                      ConfigurationDatabase &dataSourcesDatabaseIn) {
+    File cacheFile;
+    bool ok = cacheFile.Open(fileName.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::OSError, "Failed to open the ConfigurationCache %s", fileName.Buffer());
+    }
+    if (ok) {
+        ok = cacheFile.Printf("Hash = %u\n", configurationHash);
+    }
+    if (ok) {
+        ok = functionsDatabaseIn.MoveToRoot();
+    }
+    StreamString emptyNodes;
+    if (ok) {
+        ok = WriteNode(cacheFile, functionsDatabaseIn, "", emptyNodes);
+    }
+    if (ok) {
+        ok = dataSourcesDatabaseIn.MoveToRoot();
+    }
+    if (ok) {
+        ok = WriteNode(cacheFile, dataSourcesDatabaseIn, "", emptyNodes);
+    }
+    if ((ok) && (emptyNodes.Size() > 0u)) {
+        ok = cacheFile.Printf("EmptyNodes = { %s}\n", emptyNodes.Buffer());
+    }
+    if (cacheFile.IsOpen()) {
+        if (!cacheFile.Flush()) {
+            ok = false;
+        }
+        if (!cacheFile.Close()) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(RealTimeApplicationConfigurationFileCache, "1.0")
+
+}
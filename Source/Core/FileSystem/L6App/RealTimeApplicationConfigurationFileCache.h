@@ -0,0 +1,116 @@
+/**
+ * @file RealTimeApplicationConfigurationFileCache.h
+ * @brief Header file for class RealTimeApplicationConfigurationFileCache
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeApplicationConfigurationFileCache
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILESYSTEM_L6APP_REALTIMEAPPLICATIONCONFIGURATIONFILECACHE_H_
+#define FILESYSTEM_L6APP_REALTIMEAPPLICATIONCONFIGURATIONFILECACHE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "Object.h"
+#include "RealTimeApplicationConfigurationCacheI.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+/**
+ * @brief A RealTimeApplicationConfigurationCacheI which stores the resolved Functions and Data databases in a file.
+ * @details The databases are stored in the standard configuration language (with all the node names quoted), together with the hash of the
+ * RealTimeApplication configuration that generated them. Only one configuration is kept per file, i.e. Store replaces
+ * the file contents and Load fails if the stored hash does not match.
+ *
+ * Note that only the RealTimeApplication configuration is hashed. The file shall be deleted if the binaries of
+ * any of the RealTimeApplication components are changed.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +MyApp = {
+ *     Class = RealTimeApplication
+ *     +ConfigurationCache = {
+ *         Class = RealTimeApplicationConfigurationFileCache
+ *         File = "/tmp/MyApp.cache" //Compulsory. The file where the resolved databases are stored.
+ *     }
+ *     ...
+ * }
+ * </pre>
+ */
+class DLL_API RealTimeApplicationConfigurationFileCache: public Object, public RealTimeApplicationConfigurationCacheI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RealTimeApplicationConfigurationFileCache();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~RealTimeApplicationConfigurationFileCache();
+
+    /**
+     * @brief Reads the File parameter.
+     * @param[in] data see class description.
+     * @return true if the File parameter is specified.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @see RealTimeApplicationConfigurationCacheI::Load
+     * @return true if the File exists, can be parsed and was stored with \a configurationHash.
+     */
+    virtual bool Load(const uint32 configurationHash,
+                      ConfigurationDatabase &functionsDatabaseOut,
+                      ConfigurationDatabase &dataSourcesDatabaseOut);
+
+    /**
+     * @see RealTimeApplicationConfigurationCacheI::Store
+     * @return true if the File can be (re)written.
+     */
+    virtual bool Store(const uint32 configurationHash,
+                       ConfigurationDatabase &functionsDatabaseIn,
+                       ConfigurationDatabase &dataSourcesDatabaseIn);
+
+private:
+
+    /**
+     * The file where the databases are stored.
+     */
+    StreamString fileName;
+};
+}
+
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILESYSTEM_L6APP_REALTIMEAPPLICATIONCONFIGURATIONFILECACHE_H_ */
@@ -46,6 +46,9 @@ LoggerService::LoggerService() :
     consumers = NULL_PTR(LoggerConsumerI **);
     logger = NULL_PTR(Logger *);
     nOfConsumers = 0u;
+    batch = NULL_PTR(LoggerPage **);
+    nOfLogsPerBatch = 0u;
+    lastNumberOfDroppedLogs = 0u;
 }
 
 /*lint -e{1551} -e{1740} the destructor must guarantee that the SingleThreadService. The logger is a singleton and is freed by the Logger class at the end of program execution*/
@@ -58,6 +61,9 @@ LoggerService::~LoggerService() {
     if (consumers != NULL_PTR(LoggerConsumerI **)) {
         delete[] consumers;
     }
+    if (batch != NULL_PTR(LoggerPage **)) {
+        delete[] batch;
+    }
 }
 
 bool LoggerService::Initialise(StructuredDataI &data) {
@@ -65,6 +71,7 @@ bool LoggerService::Initialise(StructuredDataI &data) {
     uint32 cpuMask = 0x1u;
     uint32 stackSize = THREADS_DEFAULT_STACKSIZE;
     uint32 numberOfLogPages = DEFAULT_NUMBER_OF_LOG_PAGES;
+    uint32 numberOfLogsPerBatch = 16u;
     if (ok) {
         ok = data.Read("CPUs", cpuMask);
         if (!ok) {
@@ -85,6 +92,13 @@ bool LoggerService::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::Warning, "NumberOfLogPages must be > 0");
         }
     }
+    if (ok) {
+        (void) data.Read("NumberOfLogsPerBatch", numberOfLogsPerBatch);
+        ok = (numberOfLogsPerBatch > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "NumberOfLogsPerBatch must be > 0");
+        }
+    }
     if (ok) {
         nOfConsumers = Size();
         ok = (nOfConsumers > 0u);
@@ -109,6 +123,8 @@ bool LoggerService::Initialise(StructuredDataI &data) {
     }
     if (ok) {
         logger = Logger::Instance(numberOfLogPages);
+        nOfLogsPerBatch = numberOfLogsPerBatch;
+        batch = new LoggerPage*[nOfLogsPerBatch];
         logThreadService.SetStackSize(stackSize);
         logThreadService.SetCPUMask(cpuMask);
         logThreadService.SetName(GetName());
@@ -133,14 +149,36 @@ ErrorManagement::ErrorType LoggerService::Execute(ExecutionInfo & info) {
             Sleep::Sec(1.0F);
         }
         uint32 i;
-        if (consumers != NULL_PTR(LoggerConsumerI **)) {
-            LoggerPage *page = logger->GetLogEntry();
-            while (page != NULL_PTR(LoggerPage *)) {
+        uint32 j;
+        if ((consumers != NULL_PTR(LoggerConsumerI **)) && (batch != NULL_PTR(LoggerPage **))) {
+            bool empty = false;
+            while (!empty) {
+                uint32 nOfLogs = 0u;
+                LoggerPage *page = logger->GetLogEntry();
+                while (page != NULL_PTR(LoggerPage *)) {
+                    batch[nOfLogs] = page;
+                    nOfLogs++;
+                    if (nOfLogs < nOfLogsPerBatch) {
+                        page = logger->GetLogEntry();
+                    }
+                    else {
+                        page = NULL_PTR(LoggerPage *);
+                    }
+                }
+                empty = (nOfLogs < nOfLogsPerBatch);
                 for (i = 0u; (i < nOfConsumers); i++) {
-                    consumers[i]->ConsumeLogMessage(page);
+                    for (j = 0u; (j < nOfLogs); j++) {
+                        consumers[i]->ConsumeLogMessage(batch[j]);
+                    }
+                }
+                for (j = 0u; (j < nOfLogs); j++) {
+                    logger->ReturnPage(batch[j]);
                 }
-                logger->ReturnPage(page);
-                page = logger->GetLogEntry();
+            }
+            uint32 numberOfDroppedLogs = logger->GetNumberOfDroppedLogs();
+            if (numberOfDroppedLogs != lastNumberOfDroppedLogs) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "%u log messages were lost because there were no free log pages", (numberOfDroppedLogs - lastNumberOfDroppedLogs));
+                lastNumberOfDroppedLogs = numberOfDroppedLogs;
             }
         }
         if (terminate) {
@@ -168,6 +206,10 @@ uint32 LoggerService::GetStackSize() const {
     return logThreadService.GetStackSize();
 }
 
+uint32 LoggerService::GetNumberOfLogsPerBatch() const {
+    return nOfLogsPerBatch;
+}
+
 CLASS_REGISTER(LoggerService, "1.0")
 
 }
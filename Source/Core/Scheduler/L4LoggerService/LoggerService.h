@@ -45,7 +45,11 @@ namespace MARTe {
 /**
  * @brief The LoggerService registers itself as a callback for the logging messages and
  * asynchronously offer these messages to all the registered LoggerConsumerI.
- * @details The configuration syntax is (names are only given as an example):
+ * @details The messages are taken from the Logger in batches of up to NumberOfLogsPerBatch pages, which are offered to each
+ * consumer in turn before being returned to the Logger. If the Logger had to discard messages (because all the pages were in use),
+ * the number of lost messages is reported with a Warning.
+ *
+ * The configuration syntax is (names are only given as an example):
  *
  * <pre>
  * +LoggerService = {
@@ -53,6 +57,7 @@ namespace MARTe {
  *     CPUs = 0x1 //Compulsory. The CPU mask where the asynchronous thread will run.
  *     StackSize = 32768 //Optional. The stack size of the asynchronous thread.
  *     NumberOfLogPages = 128 //Optional. The number of log pages.
+ *     NumberOfLogsPerBatch = 16 //Optional. The maximum number of log pages that are consumed in one go.
  *     +LoggerConsumer1 = {
  *         Class = ALoggerConsumer
  *         ...
@@ -78,17 +83,17 @@ LoggerService    ();
     virtual ~LoggerService();
 
     /**
-     * @brief Calls ReferenceContainer::Initialise and reads the CPUs and StackSize parameters info.
+     * @brief Calls ReferenceContainer::Initialise and reads the CPUs, StackSize, NumberOfLogPages and NumberOfLogsPerBatch parameters info.
      * @param[in] data see ReferenceContainer::Initialise.
      * @return true if CPUs is specified and at least one valid ConsumerI is registered. If one of the child elements does not implement
-     *  the LoggerConsumerI interface it will return false.
+     *  the LoggerConsumerI interface it will return false. It will also return false if StackSize, NumberOfLogPages or NumberOfLogsPerBatch are zero.
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @brief Callback function for the EmbeddedThread that polls data from the Logger.
-     * @details Polls data from the Logger and if a new log message is available calls ConsumeLogMessage on all
-     *  the registered consumers.
+     * @details Polls data from the Logger, in batches of up to NumberOfLogsPerBatch messages, and calls ConsumeLogMessage on all
+     *  the registered consumers. Reports the number of messages that were dropped by the Logger since the previous call.
      * @param[in] info see EmbeddedServiceMethodBinderI
      * @return ErrorManagement::NoError.
      */
@@ -117,6 +122,14 @@ LoggerService    ();
      *   Initialise()
      */
     uint32 GetStackSize() const;
+
+    /**
+     * @brief Gets the configured maximum number of log pages consumed in one go.
+     * @return the configured maximum number of log pages consumed in one go.
+     * @pre
+     *   Initialise()
+     */
+    uint32 GetNumberOfLogsPerBatch() const;
 private:
 
     /**
@@ -138,6 +151,21 @@ private:
      * Number of consumers.
      */
     uint32 nOfConsumers;
+
+    /**
+     * The pages taken from the Logger in the current batch.
+     */
+    LoggerPage **batch;
+
+    /**
+     * The maximum number of pages in a batch.
+     */
+    uint32 nOfLogsPerBatch;
+
+    /**
+     * The value of Logger::GetNumberOfDroppedLogs when the lost messages were last reported (so that messages lost before the service was started are also reported).
+     */
+    uint32 lastNumberOfDroppedLogs;
 };
 }
 
@@ -77,6 +77,11 @@ CircularBufferThreadInputDataSource::CircularBufferThreadInputDataSource() :
     getFirst = false;
     stop = 0;
     sleepTime = 0.F;
+    blockingSynchronise = false;
+    waitingForSamples = 0;
+    if (!newSamplesSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create the EventSem");
+    }
 
 }
 
@@ -236,6 +241,13 @@ bool CircularBufferThreadInputDataSource::Initialise(StructuredDataI &data) {
         }
         getFirst = (getFirstTemp > 0u);
     }
+    if (ret) {
+        uint8 blockingSynchroniseTemp = 0u;
+        if (!data.Read("BlockingSynchronise", blockingSynchroniseTemp)) {
+            blockingSynchroniseTemp = 0u;
+        }
+        blockingSynchronise = (blockingSynchroniseTemp > 0u);
+    }
 
     REPORT_ERROR(ret ? ErrorManagement::Information : ErrorManagement::FatalError, "CircularBufferThreadInputDataSource::Initialise returning %s",
                  ret ? "true" : "false");
@@ -257,13 +269,10 @@ void CircularBufferThreadInputDataSource::PrepareInputOffsets() {
                 if (lastReadBufTemp >= numberOfBuffers) {
                     lastReadBufTemp = 0u;
                 }
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
                 uint32 index = (lastReadBufTemp * numberOfSignals) + i;
-                if (isRefreshed[index] == 0u) {
-                    mutex.FastUnLock();
+                if (Atomic::LoadAcquire(&isRefreshed[index]) == 0u) {
                     break;
                 }
-                mutex.FastUnLock();
                 lastReadBuffer[i] = lastReadBufTemp;
                 nStepsForward++;
             }
@@ -287,13 +296,10 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
             if (lastReadBufTemp >= numberOfBuffers) {
                 lastReadBufTemp = 0u;
             }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
             uint32 index = (lastReadBufTemp * numberOfSignals) + syncSignal;
-            if (isRefreshed[index] == 0u) {
-                mutex.FastUnLock();
+            if (Atomic::LoadAcquire(&isRefreshed[index]) == 0u) {
                 break;
             }
-            mutex.FastUnLock();
             lastReadBuffer[syncSignal] = lastReadBufTemp;
             nStepsForward++;
         }
@@ -318,17 +324,23 @@ bool CircularBufferThreadInputDataSource::Synchronise() {
                 lastReadBuffer[syncSignal] = 0u;
             }
             uint32 index = (lastReadBuffer[syncSignal] * numberOfSignals) + syncSignal;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            bool isArrived = (isRefreshed[index] == 1u);
-            mutex.FastUnLock();
+            bool isArrived = (Atomic::LoadAcquire(&isRefreshed[index]) == 1u);
             /*lint -e{9131} -e{9007} known dependences and side effects.*/
             while ((!isArrived) && (stop == 0)) {
-                (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                isArrived = (isRefreshed[index] == 1u);
-                mutex.FastUnLock();
-                if (!isArrived) {
+                if (blockingSynchronise) {
+                    (void) newSamplesSem.Reset();
+                    //Announce the wait before checking again, so that the producer either sees it (and posts) or the sample is already visible.
+                    (void) Atomic::Exchange(&waitingForSamples, 1);
+                    isArrived = (Atomic::LoadAcquire(&isRefreshed[index]) == 1u);
+                    if (!isArrived) {
+                        //Finite timeout (ms) so that the stop flag is periodically checked.
+                        (void) newSamplesSem.Wait(TimeoutType(100u));
+                    }
+                }
+                else {
                     Sleep::Sec(sleepTime);
                 }
+                isArrived = (Atomic::LoadAcquire(&isRefreshed[index]) == 1u);
             }
             numberOfSamplesSinceLastTrigger--;
         }
@@ -910,16 +922,12 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
                         errorMemIndex = (signalOffsets[errorCheckSignalIndex] + ((index1 + cnt) * static_cast<uint32>(sizeof(uint32))));
 
                         //overlap error
-                        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                        if (isRefreshed[index] == 1u) {
+                        if (Atomic::LoadAcquire(&isRefreshed[index]) == 1u) {
                             void *errorPtr = &memory[errorMemIndex];
                             *reinterpret_cast<uint32*>(errorPtr) |= 2u;
                         }
-                        mutex.FastUnLock();
                     }
-                    (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-                    isRefreshed[index] = 1u;
-                    mutex.FastUnLock();
+                    Atomic::StoreRelease(&isRefreshed[index], 1u);
                     currentBuffer[i]++;
                     if (currentBuffer[i] >= numberOfBuffers) {
                         currentBuffer[i] = 0u;
@@ -930,9 +938,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         }
         if (timeStampSignalIndex != 0xFFFFFFFFu) {
             uint32 index = (currentBuffer[timeStampSignalIndex] * (numberOfSignals)) + timeStampSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+            Atomic::StoreRelease(&isRefreshed[index], 1u);
             currentBuffer[timeStampSignalIndex]++;
             if (currentBuffer[timeStampSignalIndex] >= numberOfBuffers) {
                 currentBuffer[timeStampSignalIndex] = 0u;
@@ -940,9 +946,7 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
         }
         if (errorCheckSignalIndex != 0xFFFFFFFFu) {
             uint32 index = (currentBuffer[errorCheckSignalIndex] * (numberOfSignals)) + errorCheckSignalIndex;
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-            isRefreshed[index] = 1u;
-            mutex.FastUnLock();
+            Atomic::StoreRelease(&isRefreshed[index], 1u);
 
             currentBuffer[errorCheckSignalIndex]++;
             if (currentBuffer[errorCheckSignalIndex] >= numberOfBuffers) {
@@ -955,14 +959,21 @@ ErrorManagement::ErrorType CircularBufferThreadInputDataSource::Execute(Executio
                 *reinterpret_cast<uint32*>(errorPtr) = 0u;
             }
         }
+        if (blockingSynchronise) {
+            //Only pay for the post if the consumer is (about to be) waiting
+            if (Atomic::Exchange(&waitingForSamples, 0) == 1) {
+                (void) newSamplesSem.Post();
+            }
+        }
     }
     else if (info.GetStage() == ExecutionInfo::StartupStage) {
         for (uint32 i = 0u; i < numberOfSignals; i++) {
             currentBuffer[i] = 0u;
         }
-        (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
-        (void) MemoryOperationsHelper::Set(&isRefreshed[0], '\0', numberOfBuffers * numberOfSignals);
-        mutex.FastUnLock();
+        uint32 nTotalElements = numberOfBuffers * numberOfSignals;
+        for (uint32 i = 0u; i < nTotalElements; i++) {
+            Atomic::StoreRelease(&isRefreshed[i], 0u);
+        }
     }
     else {
     }
@@ -991,10 +1002,9 @@ bool CircularBufferThreadInputDataSource::TerminateInputCopy(const uint32 signal
             if (index >= numberOfBuffers) {
                 index = 0u;
             }
-            (void) mutex.FastLock(TTInfiniteWait, sleepInMutexSec);
             uint32 index1 = (index * numberOfSignals) + signalIdx;
-            isRefreshed[index1] = 0u;
-            mutex.FastUnLock();
+            //Release: the brokers must have completed the copy before the buffer is handed back to the internal thread
+            Atomic::StoreRelease(&isRefreshed[index1], 0u);
         }
         nBrokerOpPerSignalCounter[signalIdx] = nBrokerOpPerSignal[signalIdx];
     }
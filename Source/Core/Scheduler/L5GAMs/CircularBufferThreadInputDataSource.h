@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "FastPollingMutexSem.h"
 #include "EventSem.h"
@@ -65,6 +66,13 @@ namespace MARTe {
  * If the parameter SignalDefinitionInterleaved is = 1, it is assumed that the defined signals form part of a packet that is interleaved (and replicated for N samples).
  * Again, the protected accelerators (see numberOfInterleavedSamples, numberOfInterleavedSignalMembers and memberByteSize) allow specialised classes to use this information.
  *
+ * The internal thread (single producer) and the real-time thread (single consumer) share the buffers without locking: the producer publishes a buffer by setting
+ * its isRefreshed flag with release semantics (after the buffer memory is written) and the consumer reads the flag with acquire semantics (before reading the buffer memory)
+ * and clears it with release semantics once the brokers have copied the buffer.
+ *
+ * By default, while waiting for new samples, Synchronise polls the buffers sleeping SleepTime seconds in-between each poll. If BlockingSynchronise = 1, Synchronise instead
+ * blocks on an event semaphore which is posted by the internal thread (only when the consumer is waiting) after each acquisition.
+ *
  * @details The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
  * +CircularBuffer_0 = {
@@ -76,7 +84,8 @@ namespace MARTe {
  *     *ReceiverThreadStackSize = N (the stack size of the internal thread, default is THREADS_DEFAULT_STACKSIZE)
  *     *SleepTime = 0 (the sleep time in mutex in seconds, default is 0.F)
  *     *SignalDefinitionInterleaved = 0/1 (if 0, default, it is assumed that the signal is not defined as interleaved)
- *     *sleepInMutexSec = 1e-6F (the sleep time in mutex in seconds, default is 1e-6F)
+ *     *SleepInMutexSec = 1e-6F (the sleep time in mutex in seconds, default is 1e-6F. Not used by this class, which does not lock the buffers, but kept for the specialised classes)
+ *     *BlockingSynchronise = 0/1 (if 0, default, Synchronise polls every SleepTime seconds. If 1 Synchronise waits for the internal thread to post an event semaphore)
  *     *GetFirst = 0/1 (if 0, default, do not wait for the first valid buffer to arrive)
  *     Signals = {
  *         *InternalTimeStamp = {
@@ -241,8 +250,8 @@ protected:
     SingleThreadService executor;
 
     /**
-     * The spinlock used to guarantee mutual access to the
-     * shared isRefreshed flag memory
+     * Spinlock available to the specialised classes. The isRefreshed flags are not protected
+     * by this spinlock, given that they are accessed with Atomic::LoadAcquire and Atomic::StoreRelease.
      */
     FastPollingMutexSem mutex;
 
@@ -250,6 +259,7 @@ protected:
      * The flags to denote if a buffer is written or read
      * isRefreshed[i]=1: the buffer i is written by the internal thread.
      * isRefreshed[i]=0: the buffer i is read by the brokers.
+     * Shall only be accessed with Atomic::LoadAcquire and Atomic::StoreRelease.
      */
     uint8 *isRefreshed;
 
@@ -300,7 +310,7 @@ protected:
     uint32 errorCheckSignalIndex;
 
     /**
-     * How much time to sleep in lock.
+     * How much time to sleep in lock (see mutex).
      */
     float32 sleepInMutexSec;
 
@@ -349,6 +359,21 @@ protected:
      */
     float32 sleepTime;
 
+    /**
+     * If true Synchronise blocks on newSamplesSem instead of polling every sleepTime seconds.
+     */
+    bool blockingSynchronise;
+
+    /**
+     * Posted by the internal thread, after a new sample has been published, when waitingForSamples is set.
+     */
+    EventSem newSamplesSem;
+
+    /**
+     * Set to 1 by Synchronise before blocking on newSamplesSem and reset by the internal thread before posting it.
+     */
+    volatile int32 waitingForSamples;
+
 
 private:
 
@@ -361,6 +361,8 @@ void FastScheduler::CustomPrepareNextState() {
                 rtThreadInfo[nextBuffer][j].executables = NULL_PTR(ExecutableI **);
                 rtThreadInfo[nextBuffer][j].numberOfExecutables = 0u;
                 rtThreadInfo[nextBuffer][j].cycleTime = NULL_PTR(uint32 *);
+                rtThreadInfo[nextBuffer][j].cycleTimeNanoseconds = false;
+                rtThreadInfo[nextBuffer][j].cycleTimeHistogram = NULL_PTR(ExecutionTimeHistogram *);
                 rtThreadInfo[nextBuffer][j].lastCycleTimeStamp = 0u;
             }
 
@@ -371,6 +373,8 @@ void FastScheduler::CustomPrepareNextState() {
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].executables = nextState->threads[i].executables;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].cycleTime = nextState->threads[i].cycleTime;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].cycleTimeNanoseconds = nextState->threads[i].cycleTimeNanoseconds;
+                rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].cycleTimeHistogram = nextState->threads[i].cycleTimeHistogram;
                 rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].lastCycleTimeStamp = 0u;
                 REPORT_ERROR(ErrorManagement::FatalError, "Configuring rtThreadInfo[%d][%d]=%!", nextBuffer, cpuThreadMap[nextStateIdentifier][i],
                         rtThreadInfo[nextBuffer][cpuThreadMap[nextStateIdentifier][i]].numberOfExecutables);
@@ -410,14 +414,14 @@ ErrorManagement::ErrorType FastScheduler::Execute(ExecutionInfo & information) {
                         }
                     }
                 }
-                uint32 absTime = 0u;
+                uint64 tmp = 0u;
                 if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
-                    uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                    float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                    absTime = static_cast<uint32>(ticksToTime); //us
+                    tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
+                    if (rtThreadInfo[idx][threadNumber].cycleTimeHistogram != NULL_PTR(ExecutionTimeHistogram *)) {
+                        rtThreadInfo[idx][threadNumber].cycleTimeHistogram->Update(tmp);
+                    }
                 }
-                uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-                (void)MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy);
+                (void) WriteTimingSignal(rtThreadInfo[idx][threadNumber].cycleTime, rtThreadInfo[idx][threadNumber].cycleTimeNanoseconds, tmp);
                 rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = HighResolutionTimer::Counter();
             }
             else {
@@ -30,10 +30,12 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "ExecutionInfo.h"
 #include "GAMScheduler.h"
 #include "MultiThreadService.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
@@ -46,11 +48,23 @@ namespace MARTe {
 /*---------------------------------------------------------------------------*/
 
 GAMScheduler::GAMScheduler() :
-        GAMSchedulerI(), binder(*this, &GAMScheduler::Execute) {
+        GAMSchedulerI(), binder(*this, &GAMScheduler::Execute), threadPoolBinder(*this, &GAMScheduler::ExecuteThreadPool) {
     multiThreadService[0] = NULL_PTR(MultiThreadService *);
     multiThreadService[1] = NULL_PTR(MultiThreadService *);
     rtThreadInfo[0] = NULL_PTR(RTThreadParam *);
     rtThreadInfo[1] = NULL_PTR(RTThreadParam *);
+    prebuiltThreadPools = false;
+    threadPool = NULL_PTR(MultiThreadService *);
+    threadPoolInfo = NULL_PTR(RTThreadParam *);
+    threadPoolSize = 0u;
+    stateEventSems = NULL_PTR(EventSem *);
+    activeStateIndex = 0u;
+    threadPoolStopping = false;
+    stateSwitchStart = 0u;
+    stateSwitchTimeRecorded = 1;
+    lastStateSwitchTime = 0u;
+    stateSwitchTimeSignal = NULL_PTR(void *);
+    stateSwitchTimeNanoseconds = false;
     if (!eventSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed Create(*) of the event semaphore");
     }
@@ -81,6 +95,17 @@ GAMScheduler::~GAMScheduler() {
     if (rtThreadInfo[1] != NULL) {
         delete[] rtThreadInfo[1];
     }
+    if (threadPool != NULL) {
+        StopThreadPool();
+        delete threadPool;
+    }
+    if (threadPoolInfo != NULL) {
+        delete[] threadPoolInfo;
+    }
+    if (stateEventSems != NULL) {
+        delete[] stateEventSems;
+    }
+    stateSwitchTimeSignal = NULL_PTR(void *);
 }
 
 bool GAMScheduler::Initialise(StructuredDataI & data) {
@@ -100,10 +125,98 @@ bool GAMScheduler::Initialise(StructuredDataI & data) {
             }
         }
     }
+    if (ret) {
+        uint32 prebuiltThreadPoolsU32 = 0u;
+        if (data.Read("PrebuiltThreadPools", prebuiltThreadPoolsU32)) {
+            prebuiltThreadPools = (prebuiltThreadPoolsU32 == 1u);
+        }
+    }
 
     return ret;
 }
 
+bool GAMScheduler::ConfigureScheduler(Reference realTimeAppIn) {
+    bool ret = GAMSchedulerI::ConfigureScheduler(realTimeAppIn);
+    if ((ret) && (prebuiltThreadPools)) {
+        ret = CreateThreadPools();
+    }
+    return ret;
+}
+
+bool GAMScheduler::CreateThreadPools() {
+    realTimeApplicationT = realTimeApp;
+    bool ret = (threadPool == NULL_PTR(MultiThreadService *));
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::FatalError, "The thread pools were already created");
+    }
+    if (ret) {
+        threadPoolSize = 0u;
+        for (uint32 s = 0u; s < numberOfStates; s++) {
+            threadPoolSize += states[s].numberOfThreads;
+        }
+        stateEventSems = new EventSem[numberOfStates];
+        for (uint32 s = 0u; (s < numberOfStates) && (ret); s++) {
+            ret = stateEventSems[s].Create();
+            if (ret) {
+                ret = stateEventSems[s].Reset();
+            }
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to Create(*) the state semaphores");
+        }
+        //No state is active until StartNextStateExecution
+        activeStateIndex = numberOfStates;
+    }
+    ErrorManagement::ErrorType err;
+    if (ret) {
+        threadPool = new (NULL) MultiThreadService(threadPoolBinder);
+        threadPool->SetNumberOfPoolThreads(threadPoolSize);
+        err = threadPool->CreateThreads();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to CreateThreads().");
+        }
+    }
+    if ((ret) && (err.ErrorsCleared())) {
+        threadPoolInfo = new RTThreadParam[threadPoolSize];
+        uint32 n = 0u;
+        for (uint32 s = 0u; s < numberOfStates; s++) {
+            for (uint32 i = 0u; i < states[s].numberOfThreads; i++) {
+                threadPoolInfo[n].executables = states[s].threads[i].executables;
+                threadPoolInfo[n].numberOfExecutables = states[s].threads[i].numberOfExecutables;
+                threadPoolInfo[n].cycleTime = states[s].threads[i].cycleTime;
+                threadPoolInfo[n].cycleTimeNanoseconds = states[s].threads[i].cycleTimeNanoseconds;
+                threadPoolInfo[n].cycleTimeHistogram = states[s].threads[i].cycleTimeHistogram;
+                threadPoolInfo[n].lastCycleTimeStamp = 0u;
+                threadPoolInfo[n].stateIndex = s;
+                threadPoolInfo[n].parked = false;
+                threadPool->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, n);
+                threadPool->SetCPUMaskThreadPool(states[s].threads[i].cpu, n);
+                threadPool->SetStackSizeThreadPool(states[s].threads[i].stackSize, n);
+                threadPool->SetThreadNameThreadPool(states[s].threads[i].name, n);
+                n++;
+            }
+        }
+        err = threadPool->Start();
+        if (!err.ErrorsCleared()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed to Start() the threadPool.");
+        }
+    }
+    if (ret) {
+        ret = err.ErrorsCleared();
+    }
+    //The StateSwitchTime signal is optional
+    if (ret) {
+        uint32 signalIdx;
+        if (timingDataSource->GetSignalIndex(signalIdx, "StateSwitchTime")) {
+            ret = timingDataSource->GetSignalMemoryBuffer(signalIdx, 0u, stateSwitchTimeSignal);
+            if (ret) {
+                stateSwitchTimeNanoseconds = IsNanosecondsTimingSignal(signalIdx);
+            }
+        }
+    }
+    return ret;
+}
+
 void GAMScheduler::Purge(ReferenceContainer &purgeList) {
     //Post the semaphore to make sure that no Threads are awaiting to start!
     if (!eventSem.Post()) {
@@ -123,6 +236,9 @@ void GAMScheduler::Purge(ReferenceContainer &purgeList) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not StopCurrentStateExecution multiThreadService[1]");
         }
     }
+    if (threadPool != NULL) {
+        StopThreadPool();
+    }
     ReferenceContainer::Purge(purgeList);
 }
 
@@ -133,7 +249,30 @@ ErrorManagement::ErrorType GAMScheduler::StartNextStateExecution() {
         if (err.ErrorsCleared()) {
             uint32 newBuffer = realTimeApplicationT->GetIndex();
             ScheduledState *newState = GetSchedulableStates()[newBuffer];
-            if (newState != NULL_PTR(ScheduledState *)) {
+            if ((newState != NULL_PTR(ScheduledState *)) && (prebuiltThreadPools)) {
+                //The next state is handed off to its parked threads.
+                uint32 newStateIndex = static_cast<uint32>(newState - states);
+                if (activeStateIndex < numberOfStates) {
+                    stateSwitchStart = HighResolutionTimer::Counter();
+                    err = ParkActiveState();
+                }
+                else if (stateSwitchStart == 0u) {
+                    stateSwitchStart = HighResolutionTimer::Counter();
+                }
+                else {
+                    //NOOP the switch time is measured from StopCurrentStateExecution
+                }
+                if (err.ErrorsCleared()) {
+                    *currentStateIdentifier = nextStateIdentifier;
+                    stateSwitchTimeRecorded = 0;
+                    activeStateIndex = newStateIndex;
+                    if (!stateEventSems[newStateIndex].Post()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the state semaphore");
+                        err.fatalError = true;
+                    }
+                }
+            }
+            else if (newState != NULL_PTR(ScheduledState *)) {
                 *currentStateIdentifier = nextStateIdentifier;
                 if (!eventSem.Post()) {
                     REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the event semaphore");
@@ -155,18 +294,73 @@ ErrorManagement::ErrorType GAMScheduler::StartNextStateExecution() {
 
 ErrorManagement::ErrorType GAMScheduler::StopCurrentStateExecution() {
     ErrorManagement::ErrorType err(realTimeApplicationT.IsValid());
-    if (err.ErrorsCleared()) {
+    if ((err.ErrorsCleared()) && (prebuiltThreadPools)) {
+        if (activeStateIndex < numberOfStates) {
+            stateSwitchStart = HighResolutionTimer::Counter();
+            err = ParkActiveState();
+        }
+    }
+    else if (err.ErrorsCleared()) {
         uint32 currentIndex = realTimeApplicationT->GetIndex();
         if (multiThreadService[currentIndex] != NULL) {
             err = multiThreadService[currentIndex]->Stop();
         }
     }
+    else {
+        //NOOP
+    }
+    return err;
+}
+
+void GAMScheduler::StopThreadPool() {
+    //Wake all the parked threads so that they can be stopped (and no state is to be parked after).
+    threadPoolStopping = true;
+    activeStateIndex = numberOfStates;
+    for (uint32 s = 0u; s < numberOfStates; s++) {
+        if (!stateEventSems[s].Post()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Failed Post(*) of the state semaphore");
+        }
+    }
+    ErrorManagement::ErrorType err;
+    err = threadPool->Stop();
+    if (!err.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not Stop the threadPool");
+    }
+}
+
+ErrorManagement::ErrorType GAMScheduler::ParkActiveState() {
+    ErrorManagement::ErrorType err;
+    uint32 stateIndex = activeStateIndex;
+    //Reset before deactivating, otherwise the threads could see the semaphore still posted and not park.
+    if (!stateEventSems[stateIndex].Reset()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed Reset(*) of the state semaphore");
+        err.fatalError = true;
+    }
+    activeStateIndex = numberOfStates;
+    //Wait for the threads to finish their current cycle (as the Stop of the MultiThreadService would), so that the executables shared
+    //with the next state are never executed concurrently.
+    bool allParked = false;
+    while ((err.ErrorsCleared()) && (!allParked)) {
+        allParked = true;
+        for (uint32 n = 0u; (n < threadPoolSize) && (allParked); n++) {
+            if (threadPoolInfo[n].stateIndex == stateIndex) {
+                allParked = threadPoolInfo[n].parked;
+            }
+        }
+        if (!allParked) {
+            Sleep::Busy(1e-5F);
+        }
+    }
     return err;
 }
 
 void GAMScheduler::CustomPrepareNextState() {
     ErrorManagement::ErrorType err;
-    if (eventSem.Reset()) {
+    if (prebuiltThreadPools) {
+        //The threads of all the states are already running.
+        realTimeApplicationT = realTimeApp;
+    }
+    else if (eventSem.Reset()) {
         realTimeApplicationT = realTimeApp;
         err = !realTimeApplicationT.IsValid();
         if (err.ErrorsCleared()) {
@@ -195,7 +389,11 @@ void GAMScheduler::CustomPrepareNextState() {
                     rtThreadInfo[nextBuffer][i].executables = nextState->threads[i].executables;
                     rtThreadInfo[nextBuffer][i].numberOfExecutables = nextState->threads[i].numberOfExecutables;
                     rtThreadInfo[nextBuffer][i].cycleTime = nextState->threads[i].cycleTime;
+                    rtThreadInfo[nextBuffer][i].cycleTimeNanoseconds = nextState->threads[i].cycleTimeNanoseconds;
+                    rtThreadInfo[nextBuffer][i].cycleTimeHistogram = nextState->threads[i].cycleTimeHistogram;
                     rtThreadInfo[nextBuffer][i].lastCycleTimeStamp = 0u;
+                    rtThreadInfo[nextBuffer][i].stateIndex = 0u;
+                    rtThreadInfo[nextBuffer][i].parked = false;
                     multiThreadService[nextBuffer]->SetPriorityClassThreadPool(Threads::RealTimePriorityClass, i);
                     multiThreadService[nextBuffer]->SetCPUMaskThreadPool(nextState->threads[i].cpu, i);
                     multiThreadService[nextBuffer]->SetStackSizeThreadPool(nextState->threads[i].stackSize, i);
@@ -228,29 +426,7 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
     }
     else if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
         if (rtThreadInfo[idx] != NULL_PTR(RTThreadParam *)) {
-            bool ok = ExecuteSingleCycle(rtThreadInfo[idx][threadNumber].executables, rtThreadInfo[idx][threadNumber].numberOfExecutables);
-            if (!ok) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
-                //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
-                //If this was not handled then it would wait on eventSem.Wait(TTInfiniteWait) every time ExecuteSingleCycle returns false.
-                //ret.fatalError = true;
-                if (errorMessage.IsValid()) {
-                    if (MessageI::SendMessage(errorMessage, this) != ErrorManagement::NoError) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
-                    }
-                }
-            }
-            uint32 absTime = 0u;
-            if (rtThreadInfo[idx][threadNumber].lastCycleTimeStamp != 0u) {
-                uint64 tmp = (HighResolutionTimer::Counter() - rtThreadInfo[idx][threadNumber].lastCycleTimeStamp);
-                float64 ticksToTime = (static_cast<float64>(tmp) * clockPeriod) * 1e6;
-                absTime = static_cast<uint32>(ticksToTime);  //us
-            }
-            uint32 sizeToCopy = static_cast<uint32>(sizeof(uint32));
-            if (!MemoryOperationsHelper::Copy(rtThreadInfo[idx][threadNumber].cycleTime, &absTime, sizeToCopy)) {
-                REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
-            }
-            rtThreadInfo[idx][threadNumber].lastCycleTimeStamp = HighResolutionTimer::Counter();
+            ExecuteThreadCycle(rtThreadInfo[idx][threadNumber]);
         }
         else {
             REPORT_ERROR(ErrorManagement::FatalError, "RTThreadParam is NULL.");
@@ -262,6 +438,72 @@ ErrorManagement::ErrorType GAMScheduler::Execute(ExecutionInfo & information) {
     return ret;
 }
 
+/*lint -e{1764} EmbeddedServiceMethodBinderI callback method pointer prototype requires a non constant ExecutionInfo*/
+ErrorManagement::ErrorType GAMScheduler::ExecuteThreadPool(ExecutionInfo & information) {
+    ErrorManagement::ErrorType ret;
+    if (information.GetStage() == MARTe::ExecutionInfo::MainStage) {
+        RTThreadParam &threadInfo = threadPoolInfo[information.GetThreadNumber()];
+        if (threadPoolStopping) {
+            //Do not spin on the posted semaphore, otherwise the real-time threads with the same priority might never be scheduled to stop.
+            Sleep::MSec(1u);
+        }
+        else if (activeStateIndex != threadInfo.stateIndex) {
+            //Do not account the time spent parked as cycle time
+            threadInfo.lastCycleTimeStamp = 0u;
+            threadInfo.parked = true;
+            ret = stateEventSems[threadInfo.stateIndex].Wait(TTInfiniteWait);
+            threadInfo.parked = false;
+        }
+        else {
+            if (Atomic::TestAndSet(&stateSwitchTimeRecorded)) {
+                lastStateSwitchTime = (HighResolutionTimer::Counter() - stateSwitchStart);
+                stateSwitchStart = 0u;
+                if (stateSwitchTimeSignal != NULL_PTR(void *)) {
+                    if (!WriteTimingSignal(stateSwitchTimeSignal, stateSwitchTimeNanoseconds, lastStateSwitchTime)) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Could not copy state switch time information.");
+                    }
+                }
+            }
+            ExecuteThreadCycle(threadInfo);
+        }
+    }
+    return ret;
+}
+
+void GAMScheduler::ExecuteThreadCycle(RTThreadParam &threadInfo) {
+    bool ok = ExecuteSingleCycle(threadInfo.executables, threadInfo.numberOfExecutables);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to ExecuteSingleCycle().");
+        //Do not set ret.fatalError = true because when ExecuteSingleCycle returns false it will trigger the MultiThreadService to restart the execution of ThreadLoop.
+        //If this was not handled then it would wait on eventSem.Wait(TTInfiniteWait) every time ExecuteSingleCycle returns false.
+        //ret.fatalError = true;
+        if (errorMessage.IsValid()) {
+            if (MessageI::SendMessage(errorMessage, this) != ErrorManagement::NoError) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to SendMessage.");
+            }
+        }
+    }
+    uint64 tmp = 0u;
+    if (threadInfo.lastCycleTimeStamp != 0u) {
+        tmp = (HighResolutionTimer::Counter() - threadInfo.lastCycleTimeStamp);
+        if (threadInfo.cycleTimeHistogram != NULL_PTR(ExecutionTimeHistogram *)) {
+            threadInfo.cycleTimeHistogram->Update(tmp);
+        }
+    }
+    if (!WriteTimingSignal(threadInfo.cycleTime, threadInfo.cycleTimeNanoseconds, tmp)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not copy cycle time information.");
+    }
+    threadInfo.lastCycleTimeStamp = HighResolutionTimer::Counter();
+}
+
+bool GAMScheduler::IsPrebuiltThreadPools() const {
+    return prebuiltThreadPools;
+}
+
+uint64 GAMScheduler::GetLastStateSwitchTime() const {
+    return lastStateSwitchTime;
+}
+
 CLASS_REGISTER(GAMScheduler, "1.0")
 
 }
@@ -59,10 +59,26 @@ struct RTThreadParam {
      * The cycle time
      */
     uint32* cycleTime;
+    /**
+     * True if the cycle time is a uint64 in nano-seconds
+     */
+    bool cycleTimeNanoseconds;
+    /**
+     * The cycle time histogram (may be NULL)
+     */
+    ExecutionTimeHistogram *cycleTimeHistogram;
     /**
      * HRT value last cycle time
      */
     uint64 lastCycleTimeStamp;
+    /**
+     * Index of the state to which the thread belongs (only used with PrebuiltThreadPools).
+     */
+    uint32 stateIndex;
+    /**
+     * True while the thread is parked waiting for its state to be activated (only used with PrebuiltThreadPools).
+     */
+    volatile bool parked;
 };
 
 /**
@@ -73,11 +89,26 @@ struct RTThreadParam {
  *    Class = Scheduler_name
  *     ...\n
  *    TimingDataSource = "Name of the TimingDataSource"
+ *    PrebuiltThreadPools = 1 //Optional. If 1 the threads of all the states are created when the application is configured (see below). Default = 0.
  *    +ErrorMessage = { //Optional. Fired every time there is an execution error. Name is only an example.
  *        Class = Message
  *        ...
  *    }
  * }\n
+ *
+ * @details By default the threads of the next state are created (and the threads of the state before the current one destroyed)
+ * every time PrepareNextState is called.
+ *
+ * @details If PrebuiltThreadPools = 1, the threads of all the states are created, configured (priority, CPU affinity, stack and name)
+ * and started in ConfigureScheduler. The threads of the states which are not being executed are parked on a per-state semaphore.
+ * A state transition is then only a handoff: StopCurrentStateExecution parks the threads of the current state (each thread finishes its
+ * current cycle) and StartNextStateExecution wakes the threads of the next state. No thread is created, stopped or destroyed after
+ * the application is configured.
+ *
+ * @details With PrebuiltThreadPools = 1 the time elapsed between the request to stop the current state (or to start the next state if
+ * StopCurrentStateExecution was not called) and the start of the first cycle of the next state is measured. If the TimingDataSource has a
+ * signal named StateSwitchTime (i.e. if any GAM reads it), this value is written in this signal (in micro-seconds if declared as a uint32
+ * or in nano-seconds if declared as a uint64). The value is also available with GetLastStateSwitchTime.
  */
 class DLL_API GAMScheduler: public GAMSchedulerI {
 
@@ -102,6 +133,13 @@ public:
      */
     virtual bool Initialise(StructuredDataI & data);
 
+    /**
+     * @brief Calls GAMSchedulerI::ConfigureScheduler and, if PrebuiltThreadPools = 1, creates and starts the threads of all the states.
+     * @param[in] realTimeAppIn the RealTimeApplication using this scheduler.
+     * @return true if GAMSchedulerI::ConfigureScheduler returns true and if the threads could be successfully started.
+     */
+    virtual bool ConfigureScheduler(Reference realTimeAppIn);
+
     /**
      * @brief Starts the multi-thread execution for the current state.
      * @return ErrorManagement::NoError if the next state was configured (see PrepareNextState) and the MultiThreadService could be successfully started.
@@ -132,6 +170,19 @@ public:
      */
     virtual void Purge(ReferenceContainer &purgeList);
 
+    /**
+     * @brief Returns true if PrebuiltThreadPools = 1.
+     * @return true if PrebuiltThreadPools = 1.
+     */
+    bool IsPrebuiltThreadPools() const;
+
+    /**
+     * @brief Gets the duration of the last state switch (only measured if PrebuiltThreadPools = 1).
+     * @return the time elapsed between the request to stop the previous state and the start of the first cycle of the current state,
+     * in HighResolutionTimer ticks, or 0 if no state switch was measured.
+     */
+    uint64 GetLastStateSwitchTime() const;
+
 protected:
 
     /**
@@ -139,6 +190,14 @@ protected:
      */
     virtual void CustomPrepareNextState();
 
+    /**
+     * @brief Callback function for the MultiThreadService when PrebuiltThreadPools = 1.
+     * @details Parks the thread if its state is not being executed, otherwise executes one cycle of its ExecutableI.
+     * @param[in] information (see EmbeddedThread)
+     * @return ErrorManagement::NoError if the thread could be parked.
+     */
+    ErrorManagement::ErrorType ExecuteThreadPool(ExecutionInfo &information);
+
     /**
      * The array of identifiers of the thread in execution.
      */
@@ -168,6 +227,96 @@ protected:
      * Specialised real-time application reference.
      */
     ReferenceT<RealTimeApplication> realTimeApplicationT;
+
+private:
+
+    /**
+     * @brief Executes one cycle of the ExecutableI of a thread and updates its cycle time.
+     * @param[in] threadInfo the thread parameters.
+     */
+    void ExecuteThreadCycle(RTThreadParam &threadInfo);
+
+    /**
+     * @brief Creates, configures and starts the threads of all the states (PrebuiltThreadPools = 1).
+     * @return true if the threads were successfully started.
+     */
+    bool CreateThreadPools();
+
+    /**
+     * @brief Parks the threads of the state being executed and waits for all of them to finish their current cycle.
+     * @return ErrorManagement::NoError if all the threads could be parked.
+     */
+    ErrorManagement::ErrorType ParkActiveState();
+
+    /**
+     * @brief Wakes all the parked threads and stops the threadPool.
+     */
+    void StopThreadPool();
+
+    /**
+     * True if the threads of all the states are created in ConfigureScheduler.
+     */
+    bool prebuiltThreadPools;
+
+    /**
+     * Registers the ExecuteThreadPool callback function to be called by the threadPool.
+     */
+    EmbeddedServiceMethodBinderT<GAMScheduler> threadPoolBinder;
+
+    /**
+     * The threads of all the states (PrebuiltThreadPools = 1).
+     */
+    MultiThreadService *threadPool;
+
+    /**
+     * The parameters of each of the threadPool threads.
+     */
+    RTThreadParam *threadPoolInfo;
+
+    /**
+     * Number of threads in the threadPool.
+     */
+    uint32 threadPoolSize;
+
+    /**
+     * One semaphore per state where the threads of the state are parked.
+     */
+    EventSem *stateEventSems;
+
+    /**
+     * The index of the state being executed (numberOfStates if none).
+     */
+    volatile uint32 activeStateIndex;
+
+    /**
+     * True while the threadPool is being stopped.
+     */
+    volatile bool threadPoolStopping;
+
+    /**
+     * HighResolutionTimer counter when the state switch was requested (0 if no switch is being measured).
+     */
+    uint64 stateSwitchStart;
+
+    /**
+     * Set to 0 when a state is activated, so that only the first thread of this state records the state switch time.
+     */
+    volatile int32 stateSwitchTimeRecorded;
+
+    /**
+     * The duration of the last state switch in HighResolutionTimer ticks.
+     */
+    uint64 lastStateSwitchTime;
+
+    /**
+     * Memory address where the StateSwitchTime signal is stored (NULL if this signal is not defined).
+     */
+    void *stateSwitchTimeSignal;
+
+    /**
+     * True if the StateSwitchTime signal is a uint64 in nano-seconds.
+     */
+    bool stateSwitchTimeNanoseconds;
 };
 
 }
@@ -43,6 +43,10 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
         MemoryMapBroker(),
         binder(*this, &MemoryMapAsyncOutputBroker::BufferLoop), service(binder) {
     bufferMemoryMap = NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*);
+    pagesMemory = NULL_PTR(char8 *);
+    pageSize = 0u;
+    batchPages = NULL_PTR(const void **);
+    batchIndexes = NULL_PTR(uint32 *);
     numberOfBuffers = 0u;
     writeIdx = 0u;
     readSynchIdx = 0u;
@@ -59,6 +63,7 @@ MemoryMapAsyncOutputBroker::MemoryMapAsyncOutputBroker() :
     flushed = true;
     destroying = false;
     ignoreBufferOverrun = false;
+    batchSynchronise = false;
 }
 
 /*lint -e{1551} the destructor must guarantee that the SingleThreadService is stopped and that buffer memory is freed.*/
@@ -67,10 +72,6 @@ MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
     if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
-            uint32 c;
-            for (c = 0u; c < numberOfCopies; c++) {
-                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(bufferMemoryMap[i].mem[c]);
-            }
             delete[] bufferMemoryMap[i].mem;
             bufferMemoryMap[i].mem = NULL_PTR(void**);
         }
@@ -78,6 +79,16 @@ MemoryMapAsyncOutputBroker::~MemoryMapAsyncOutputBroker() {
         delete[] bufferMemoryMap;
         bufferMemoryMap = NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*);
     }
+    if (pagesMemory != NULL_PTR(char8 *)) {
+        void *pagesMemoryToFree = reinterpret_cast<void *>(pagesMemory);
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(pagesMemoryToFree);
+    }
+    if (batchPages != NULL_PTR(const void **)) {
+        delete[] batchPages;
+    }
+    if (batchIndexes != NULL_PTR(uint32 *)) {
+        delete[] batchIndexes;
+    }
 }
 
 void MemoryMapAsyncOutputBroker::UnlinkDataSource() {
@@ -164,17 +175,36 @@ bool MemoryMapAsyncOutputBroker::InitWithBufferParameters(const SignalDirection
     if (ok) {
         dataSourceRef = Reference(&dataSourceIn);
     }
+    if (ok) {
+        uint32 c;
+        pageSize = 0u;
+        for (c = 0u; c < numberOfCopies; c++) {
+            pageSize += copyTable[c].copySize;
+        }
+        //All the pages in a single block, so that consecutive pages are also contiguous in memory.
+        uint32 pagesMemorySize = (numberOfBuffers * pageSize);
+        if (pagesMemorySize > 0u) {
+            pagesMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pagesMemorySize));
+            ok = (pagesMemory != NULL_PTR(char8 *));
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(pagesMemory, '\0', pagesMemorySize);
+            }
+        }
+    }
     if (ok) {
         bufferMemoryMap = new MemoryMapAsyncOutputBrokerBufferEntry[numberOfBuffers];
+        batchPages = new const void*[numberOfBuffers];
+        batchIndexes = new uint32[numberOfBuffers];
         uint32 i;
         for (i = 0u; i < numberOfBuffers; i++) {
             bufferMemoryMap[i].index = i;
             bufferMemoryMap[i].toConsume = false;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
-            for (c = 0u; (c < numberOfCopies) && (ok); c++) {
-                bufferMemoryMap[i].mem[c] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(copyTable[c].copySize);
-                ok = MemoryOperationsHelper::Set(bufferMemoryMap[i].mem[c], '\0', copyTable[c].copySize);
+            uint32 pageOffset = (i * pageSize);
+            for (c = 0u; c < numberOfCopies; c++) {
+                bufferMemoryMap[i].mem[c] = &pagesMemory[pageOffset];
+                pageOffset += copyTable[c].copySize;
             }
         }
     }
@@ -276,10 +306,17 @@ ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo
             synchStopIdx = 1;
         }
         bool ret = true;
+        uint32 numberOfBatchPages = 0u;
         //Check all the buffers until writeIdx - preTriggerBuffers (inclusive)
         while ((readSynchIdx != static_cast<uint32>(synchStopIdx)) && (ret)) {
             if (bufferMemoryMap != NULL_PTR(MemoryMapAsyncOutputBrokerBufferEntry*)) {
-                if (bufferMemoryMap[readSynchIdx].toConsume) {
+                if ((bufferMemoryMap[readSynchIdx].toConsume) && (batchSynchronise)) {
+                    //Only collect the page. All the pending pages are flushed below with a single call.
+                    batchPages[numberOfBatchPages] = &pagesMemory[readSynchIdx * pageSize];
+                    batchIndexes[numberOfBatchPages] = readSynchIdx;
+                    numberOfBatchPages++;
+                }
+                else if (bufferMemoryMap[readSynchIdx].toConsume) {
                     uint32 c;
                     for (c = 0u; (c < numberOfCopies) && (ret); c++) {
                         //Copy from the buffer to the DataSource memory
@@ -304,6 +341,25 @@ ErrorManagement::ErrorType MemoryMapAsyncOutputBroker::BufferLoop(ExecutionInfo
             }
         }
 
+        if (numberOfBatchPages > 0u) {
+            uint32 lastIdx = batchIndexes[numberOfBatchPages - 1u];
+            uint32 c;
+            for (c = 0u; (c < numberOfCopies) && (ret); c++) {
+                //Leave the DataSource memory with the newest sample
+                if (copyTable != NULL_PTR(MemoryMapBrokerCopyTableEntry*)) {
+                    ret = MemoryOperationsHelper::Copy(copyTable[c].dataSourcePointer, bufferMemoryMap[lastIdx].mem[c], copyTable[c].copySize);
+                }
+            }
+            if (ret) {
+                if (dataSourceRef.IsValid()) {
+                    ret = dataSourceRef->SynchroniseBatch(batchPages, numberOfBatchPages, pageSize);
+                }
+            }
+            uint32 p;
+            for (p = 0u; p < numberOfBatchPages; p++) {
+                bufferMemoryMap[batchIndexes[p]].toConsume = false;
+            }
+        }
         if (ret) {
             flushed = true;
             //Wait for new data to be available from the real-time thread.
@@ -339,5 +395,17 @@ bool MemoryMapAsyncOutputBroker::IsIgnoringBufferOverrun() const {
     return ignoreBufferOverrun;
 }
 
+void MemoryMapAsyncOutputBroker::SetBatchSynchronise(const bool batchSynchroniseIn) {
+    batchSynchronise = batchSynchroniseIn;
+}
+
+bool MemoryMapAsyncOutputBroker::IsBatchSynchronising() const {
+    return batchSynchronise;
+}
+
+uint32 MemoryMapAsyncOutputBroker::GetPageSize() const {
+    return pageSize;
+}
+
 CLASS_REGISTER(MemoryMapAsyncOutputBroker, "1.0")
 }
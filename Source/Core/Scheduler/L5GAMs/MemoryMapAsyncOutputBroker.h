@@ -67,6 +67,11 @@ struct DLL_API MemoryMapAsyncOutputBrokerBufferEntry {
  * Only one GAM is allowed to interact with this MemoryMapAsyncOutputBroker (an IOGAM can be used to collate all the signals).
  *
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
+ *
+ * By default each page is copied into the DataSourceI memory and followed by a call to DataSourceI::Synchronise. If the DataSource
+ * calls SetBatchSynchronise(true), all the pages that are pending when the SingleThreadService wakes up are handed to the DataSourceI
+ * in a single DataSourceI::SynchroniseBatch call. All the pages are allocated in a single contiguous memory block and each page
+ * holds the signals packed in the copy table order.
  */
 class DLL_API MemoryMapAsyncOutputBroker: public MemoryMapBroker {
 public:
@@ -151,6 +156,25 @@ MemoryMapAsyncOutputBroker    ();
      */
     bool IsIgnoringBufferOverrun() const;
 
+    /**
+     * @brief Sets if all the pending pages shall be flushed with a single call to DataSourceI::SynchroniseBatch.
+     * @param[in] batchSynchroniseIn if true the pending pages are flushed with DataSourceI::SynchroniseBatch, otherwise
+     * each page is copied into the DataSourceI memory and flushed with DataSourceI::Synchronise.
+     */
+    void SetBatchSynchronise(const bool batchSynchroniseIn);
+
+    /**
+     * @brief Gets if the pending pages are being flushed with a single call to DataSourceI::SynchroniseBatch.
+     * @return true if the pending pages are being flushed with DataSourceI::SynchroniseBatch.
+     */
+    bool IsBatchSynchronising() const;
+
+    /**
+     * @brief Gets the size in bytes of each buffer (i.e. page).
+     * @return the sum of the sizes of all the copies performed by this broker.
+     */
+    uint32 GetPageSize() const;
+
     /**
      * @brief Flush all the data left in the shared buffer between the threads.
      * @return true if the data is properly flushed.
@@ -197,6 +221,26 @@ private:
      */
     MemoryMapAsyncOutputBrokerBufferEntry *bufferMemoryMap;
 
+    /**
+     * The contiguous memory block which holds all the pages.
+     */
+    char8 *pagesMemory;
+
+    /**
+     * The size of each page.
+     */
+    uint32 pageSize;
+
+    /**
+     * The pages to be flushed in a single DataSourceI::SynchroniseBatch call.
+     */
+    const void **batchPages;
+
+    /**
+     * The index of the buffers referenced in batchPages.
+     */
+    uint32 *batchIndexes;
+
     /**
      * The DataSource associated to this broker
      */
@@ -242,6 +286,11 @@ private:
      */
     bool ignoreBufferOverrun;
 
+    /**
+     * If true the pending pages are flushed with DataSourceI::SynchroniseBatch.
+     */
+    bool batchSynchronise;
+
     /**
      * True if flushed was called.
      */
@@ -31,6 +31,8 @@
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -63,7 +65,16 @@ MemoryMapAsyncTriggerOutputBroker::MemoryMapAsyncTriggerOutputBroker() :
         REPORT_ERROR(ErrorManagement::FatalError, "Could not Reset the EventSem.");
     }
     fastSem.Create();
-    posted = false;
+    consumerSleeping = 0u;
+    pagesPublished = 0u;
+    pagesVisited = 0u;
+    pagesWritten = 0u;
+    pagesFlushed = 0u;
+    pagesDropped = 0u;
+    maxBacklog = 0u;
+    consumerWakeUps = 0u;
+    lastConsumerLatency = 0u;
+    maxConsumerLatency = 0u;
     destroying = false;
     triggerIndexInGAMMemory = 0u;
 }
@@ -92,10 +103,10 @@ void MemoryMapAsyncTriggerOutputBroker::UnlinkDataSource() {
         if (fastSem.FastLock() == ErrorManagement::NoError) {
             destroying = true;
             fastSem.FastUnLock();
+            //Always post, independently of consumerSleeping, so that the BufferLoop is guaranteed to see the destroying flag.
             if (!sem.Post()) {
                 REPORT_ERROR(ErrorManagement::FatalError, "Could not Post the EventSem.");
             }
-            posted = true;
         }
         if (!sem.Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not Close the EventSem.");
@@ -205,6 +216,7 @@ bool MemoryMapAsyncTriggerOutputBroker::InitWithTriggerParameters(const SignalDi
         for (i = 0u; i < numberOfBuffers; i++) {
             bufferMemoryMap[i].index = i;
             bufferMemoryMap[i].triggered = false;
+            bufferMemoryMap[i].timeStamp = 0u;
             uint32 c;
             bufferMemoryMap[i].mem = new void*[numberOfCopies];
             for (c = 0u; (c < numberOfCopies) && (ok); c++) {
@@ -294,6 +306,7 @@ bool MemoryMapAsyncTriggerOutputBroker::Execute() {
             //Buffer overrun...
             const uint32 idx = writeIdx;
             REPORT_ERROR(ErrorManagement::FatalError, "Buffer overrun for index %d ", idx);
+            pagesDropped++;
             ret = false;
         }
         uint32 n;
@@ -303,6 +316,10 @@ bool MemoryMapAsyncTriggerOutputBroker::Execute() {
                 ret = MemoryOperationsHelper::Copy(bufferMemoryMap[writeIdx].mem[n], copyTable[n].gamPointer, copyTable[n].copySize);
             }
         }
+        if (ret) {
+            bufferMemoryMap[writeIdx].timeStamp = HighResolutionTimer::Counter();
+            pagesWritten++;
+        }
         //Check if the trigger is set to 1
         bufferMemoryMap[writeIdx].triggered = (*static_cast<uint8*>(bufferMemoryMap[writeIdx].mem[triggerIndexInGAMMemory]) > 0u);
         if (bufferMemoryMap[writeIdx].triggered) {
@@ -336,19 +353,29 @@ bool MemoryMapAsyncTriggerOutputBroker::Execute() {
         if (numberOfPreBuffersWritten < static_cast<int32>(preTriggerBuffers)) {
             numberOfPreBuffersWritten++;
         }
-        if (ret) {
-            //Fast semaphore to increment writeIdx and to atomically Post the semaphore which warns the BufferLoop that there might be new data to be consumed.
-            ret = (fastSem.FastLock() == ErrorManagement::NoError);
-        }
-        writeIdx++;
-        if (writeIdx == numberOfBuffers) {
-            writeIdx = 0u;
-        }
-        if (ret) {
-            posted = true;
-            ret = sem.Post();
+        uint32 nextWriteIdx = (writeIdx + 1u);
+        if (nextWriteIdx == numberOfBuffers) {
+            nextWriteIdx = 0u;
+        }
+        //Publish the page (the release guarantees that the page contents and the triggered flags are visible before the new writeIdx).
+        Atomic::StoreRelease(&writeIdx, nextWriteIdx);
+        const uint32 published = (pagesPublished + 1u);
+        Atomic::StoreRelease(&pagesPublished, published);
+        const uint32 backlog = (published - Atomic::LoadAcquire(&pagesVisited));
+        if (backlog > maxBacklog) {
+            maxBacklog = backlog;
+        }
+        //Pairs with the fence in the BufferLoop: either the BufferLoop sees the new pagesPublished or this sees consumerSleeping == 1.
+        Atomic::MemoryFence();
+        //Only wake the BufferLoop if it is (about to be) waiting on the EventSem.
+        if (Atomic::LoadAcquire(&consumerSleeping) == 1u) {
+            if (Atomic::CompareAndSwap(&consumerSleeping, 1u, 0u)) {
+                consumerWakeUps++;
+                if (!sem.Post()) {
+                    ret = false;
+                }
+            }
         }
-        fastSem.FastUnLock();
     }
     return ret;
 }
@@ -359,10 +386,12 @@ ErrorManagement::ErrorType MemoryMapAsyncTriggerOutputBroker::BufferLoop(Executi
     bool ret = true;
     if (info.GetStage() == ExecutionInfo::MainStage) {
         int32 synchStopIdx = 0;
+        //Any page published after this point will prevent the BufferLoop from sleeping.
+        const uint32 publishedAtStart = Atomic::LoadAcquire(&pagesPublished);
         if (fastSem.FastLock() == ErrorManagement::NoError) {
             bufferLoopExecuting = true;
             //Always stay preTriggerBuffers behind from the writeIdx so that we don't lose the pre-trigger buffers
-            synchStopIdx = static_cast<int32>(writeIdx) - static_cast<int32>(preTriggerBuffers);
+            synchStopIdx = static_cast<int32>(Atomic::LoadAcquire(&writeIdx)) - static_cast<int32>(preTriggerBuffers);
         }
         fastSem.FastUnLock();
 
@@ -396,6 +425,13 @@ ErrorManagement::ErrorType MemoryMapAsyncTriggerOutputBroker::BufferLoop(Executi
                             ret = dataSourceRef->Synchronise();
                         }
                     }
+                    if (ret) {
+                        lastConsumerLatency = (HighResolutionTimer::Counter() - bufferMemoryMap[readSynchIdx].timeStamp);
+                        if (lastConsumerLatency > maxConsumerLatency) {
+                            maxConsumerLatency = lastConsumerLatency;
+                        }
+                        pagesFlushed++;
+                    }
                     bufferMemoryMap[readSynchIdx].triggered = false;
                 }
                 readSynchIdx++;
@@ -404,32 +440,30 @@ ErrorManagement::ErrorType MemoryMapAsyncTriggerOutputBroker::BufferLoop(Executi
                         readSynchIdx = 0u;
                     }
                 }
+                Atomic::StoreRelease(&pagesVisited, (pagesVisited + 1u));
             }
         }
-    }
-    bufferLoopExecuting = false;
-    if (ret) {
-        //Wait for new data to be available from the real-time thread.
-        if (!destroying) {
-            err = sem.Wait(TTInfiniteWait);
-        }
-        else {
-            Sleep::Sec(0.1F);
-        }
-        if (err.ErrorsCleared()) {
-            //Only reset the semaphore if it was not posted in-between the Wait exit and now...
-            if (fastSem.FastLock() == ErrorManagement::NoError) {
-                if (!posted) {
-                    err.fatalError = !sem.Reset();
-                }
-                if (destroying) {
-                    err = ErrorManagement::Completed;
-                }
-                posted = false;
+        bufferLoopExecuting = false;
+        if (ret) {
+            //Declare the intention to sleep. A Post from the Execute before this Reset cannot happen, as it only posts if consumerSleeping == 1.
+            err.fatalError = !sem.Reset();
+            Atomic::StoreRelease(&consumerSleeping, 1u);
+            Atomic::MemoryFence();
+            //Only wait if no page was published in the meanwhile (otherwise it might never be posted again).
+            if ((!destroying) && (Atomic::LoadAcquire(&pagesPublished) == publishedAtStart) && (err.ErrorsCleared())) {
+                err = sem.Wait(TTInfiniteWait);
+            }
+            //If the Execute did not wake the BufferLoop, clear the flag so that it does not post while the BufferLoop is busy.
+            (void) Atomic::CompareAndSwap(&consumerSleeping, 1u, 0u);
+            if (destroying) {
+                Sleep::Sec(0.1F);
+                err = ErrorManagement::Completed;
             }
-            fastSem.FastUnLock();
         }
     }
+    else {
+        bufferLoopExecuting = false;
+    }
 
     return err;
 }
@@ -467,6 +501,9 @@ bool MemoryMapAsyncTriggerOutputBroker::FlushAllTriggers() {
                             ret = dataSourceRef->Synchronise();
                         }
                     }
+                    if (ret) {
+                        pagesFlushed++;
+                    }
                     bufferMemoryMap[idx].triggered = false;
                 }
             }
@@ -485,5 +522,62 @@ void MemoryMapAsyncTriggerOutputBroker::ResetPreTriggerBuffers() {
     numberOfPreBuffersWritten = 0;
 }
 
+uint32 MemoryMapAsyncTriggerOutputBroker::GetPagesWritten() const {
+    return pagesWritten;
+}
+
+uint32 MemoryMapAsyncTriggerOutputBroker::GetPagesFlushed() const {
+    return pagesFlushed;
+}
+
+uint32 MemoryMapAsyncTriggerOutputBroker::GetPagesDropped() const {
+    return pagesDropped;
+}
+
+uint32 MemoryMapAsyncTriggerOutputBroker::GetMaxBacklog() const {
+    return maxBacklog;
+}
+
+uint32 MemoryMapAsyncTriggerOutputBroker::GetConsumerWakeUps() const {
+    return consumerWakeUps;
+}
+
+uint64 MemoryMapAsyncTriggerOutputBroker::GetLastConsumerLatency() const {
+    return lastConsumerLatency;
+}
+
+uint64 MemoryMapAsyncTriggerOutputBroker::GetMaxConsumerLatency() const {
+    return maxConsumerLatency;
+}
+
+bool MemoryMapAsyncTriggerOutputBroker::ExportData(StructuredDataI & data) {
+    bool ok = Object::ExportData(data);
+    if (ok) {
+        ok = data.Write("PagesWritten", pagesWritten);
+    }
+    if (ok) {
+        ok = data.Write("PagesFlushed", pagesFlushed);
+    }
+    if (ok) {
+        ok = data.Write("PagesDropped", pagesDropped);
+    }
+    if (ok) {
+        ok = data.Write("MaxBacklog", maxBacklog);
+    }
+    if (ok) {
+        ok = data.Write("ConsumerWakeUps", consumerWakeUps);
+    }
+    const float64 ticksToMicroSeconds = (HighResolutionTimer::Period() * 1e6);
+    if (ok) {
+        const float64 lastLatency = (static_cast<float64>(lastConsumerLatency) * ticksToMicroSeconds);
+        ok = data.Write("LastConsumerLatency", lastLatency);
+    }
+    if (ok) {
+        const float64 maxLatency = (static_cast<float64>(maxConsumerLatency) * ticksToMicroSeconds);
+        ok = data.Write("MaxConsumerLatency", maxLatency);
+    }
+    return ok;
+}
+
 CLASS_REGISTER(MemoryMapAsyncTriggerOutputBroker, "1.0")
 }
@@ -54,6 +54,11 @@ struct DLL_API MemoryMapAsyncTriggerOutputBrokerBufferEntry {
      */
     bool triggered;
 
+    /**
+     * HighResolutionTimer::Counter() value when the page was written by the Execute method.
+     */
+    MARTe::uint64 timeStamp;
+
     /**
      * Signal addresses
      */
@@ -75,6 +80,13 @@ struct DLL_API MemoryMapAsyncTriggerOutputBrokerBufferEntry {
  * Only one GAM is allowed to interact with this MemoryMapAsyncTriggerOutputBroker (an IOGAM can be used to collate all the signals).
  * 
  * The DataSource shall call the UnlinkDataSource in the DataSourceI::Purge.
+ *
+ * The Execute method only posts the EventSem when the BufferLoop has declared that it is going to sleep, so that,
+ * while the BufferLoop is busy flushing pages, the real-time thread does not perform any system call.
+ *
+ * The broker keeps the following counters, which are exported by ExportData: the number of pages written, flushed and
+ * dropped (due to buffer overruns), the maximum backlog of pages not yet visited by the BufferLoop and the latency
+ * between a page being written and being flushed into the DataSourceI.
  */
 class DLL_API MemoryMapAsyncTriggerOutputBroker: public MemoryMapBroker {
 public:
@@ -186,6 +198,57 @@ MemoryMapAsyncTriggerOutputBroker    ();
      */
     void UnlinkDataSource();
 
+    /**
+     * @brief Gets the number of pages that were successfully written by the Execute method.
+     * @return the number of pages that were successfully written by the Execute method.
+     */
+    uint32 GetPagesWritten() const;
+
+    /**
+     * @brief Gets the number of pages that were flushed into the DataSourceI.
+     * @return the number of pages that were flushed into the DataSourceI.
+     */
+    uint32 GetPagesFlushed() const;
+
+    /**
+     * @brief Gets the number of pages that could not be written due to a buffer overrun.
+     * @return the number of pages that could not be written due to a buffer overrun.
+     */
+    uint32 GetPagesDropped() const;
+
+    /**
+     * @brief Gets the maximum number of pages that were written by the Execute method but not yet visited by the BufferLoop.
+     * @return the maximum backlog of pages.
+     */
+    uint32 GetMaxBacklog() const;
+
+    /**
+     * @brief Gets the number of times that the Execute method had to wake up the BufferLoop.
+     * @return the number of times that the Execute method posted the EventSem.
+     */
+    uint32 GetConsumerWakeUps() const;
+
+    /**
+     * @brief Gets the latency, in HighResolutionTimer ticks, between the last flushed page being written and being flushed.
+     * @return the latency of the last flushed page.
+     */
+    uint64 GetLastConsumerLatency() const;
+
+    /**
+     * @brief Gets the maximum latency, in HighResolutionTimer ticks, between a page being written and being flushed.
+     * @return the maximum latency of all the flushed pages.
+     */
+    uint64 GetMaxConsumerLatency() const;
+
+    /**
+     * @brief Exports the broker counters.
+     * @details Calls Object::ExportData and adds the nodes PagesWritten, PagesFlushed, PagesDropped, MaxBacklog, ConsumerWakeUps,
+     * LastConsumerLatency and MaxConsumerLatency. The latencies are exported in micro-seconds.
+     * @param[out] data where to export the counters.
+     * @return true if all the counters are successfully written.
+     */
+    virtual bool ExportData(StructuredDataI & data);
+
 private:
 
     /**
@@ -234,7 +297,7 @@ private:
     /**
      * The current index where the Execute method is writing to.
      */
-    uint32 writeIdx;
+    volatile uint32 writeIdx;
 
     /**
      * The read index where the BufferLoop is reading from.
@@ -268,14 +331,59 @@ private:
     EventSem sem;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Protects the bufferLoopExecuting variable (needed for the FlushAllTrigger).
      */
     FastPollingMutexSem fastSem;
 
     /**
-     * Makes sure that the EventSem is not Reset while being posted and also protects the writeIdx variable.
+     * Set to 1 by the BufferLoop before waiting on the EventSem. The Execute method only posts the EventSem if it manages to swap this value from 1 to 0.
+     */
+    volatile uint32 consumerSleeping;
+
+    /**
+     * Number of pages published by the Execute method (i.e. number of times that writeIdx was incremented).
+     */
+    volatile uint32 pagesPublished;
+
+    /**
+     * Number of pages visited by the BufferLoop (i.e. number of times that readSynchIdx was incremented).
+     */
+    volatile uint32 pagesVisited;
+
+    /**
+     * See GetPagesWritten.
+     */
+    uint32 pagesWritten;
+
+    /**
+     * See GetPagesFlushed.
+     */
+    uint32 pagesFlushed;
+
+    /**
+     * See GetPagesDropped.
+     */
+    uint32 pagesDropped;
+
+    /**
+     * See GetMaxBacklog.
+     */
+    uint32 maxBacklog;
+
+    /**
+     * See GetConsumerWakeUps.
+     */
+    uint32 consumerWakeUps;
+
+    /**
+     * See GetLastConsumerLatency.
+     */
+    uint64 lastConsumerLatency;
+
+    /**
+     * See GetMaxConsumerLatency.
      */
-    bool posted;
+    uint64 maxConsumerLatency;
 
     /**
      * Allows a clean exit of the BufferLoop thread
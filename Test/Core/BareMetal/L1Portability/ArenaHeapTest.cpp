@@ -0,0 +1,252 @@
+/**
+ * @file ArenaHeapTest.cpp
+ * @brief Source file for class ArenaHeapTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeapTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ArenaHeapTest.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ArenaHeapTest::TestConstructor() {
+    ArenaHeap heap("ArenaHeapTest");
+    bool ok = (StringHelper::Compare(heap.Name(), "ArenaHeapTest") == 0);
+    if (ok) {
+        ok = (heap.GetReservedSize() == 0u);
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() == 0u);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestConstructor_SmallChunkSize() {
+    ArenaHeap heap("ArenaHeapTest", 1u);
+    bool ok = (heap.Malloc(8u) != NULL);
+    if (ok) {
+        ok = (heap.GetReservedSize() == 1024u);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestMalloc() {
+    ArenaHeap heap("ArenaHeapTest", 1024u);
+    const uint32 numberOfBlocks = 100u;
+    uint8 *blocks[numberOfBlocks];
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        uint32 size = (i % 13u) + 1u;
+        blocks[i] = static_cast<uint8 *>(heap.Malloc(size));
+        ok = (blocks[i] != NULL);
+        if (ok) {
+            ok = ((reinterpret_cast<uintp>(blocks[i]) % ArenaHeap::ALIGNMENT) == 0u);
+        }
+        if (ok) {
+            (void) MemoryOperationsHelper::Set(blocks[i], static_cast<char8>(i), size);
+        }
+    }
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        uint32 size = (i % 13u) + 1u;
+        uint32 j;
+        for (j = 0u; (j < size) && (ok); j++) {
+            ok = (blocks[i][j] == static_cast<uint8>(i));
+        }
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() <= heap.GetReservedSize());
+    }
+    if (ok) {
+        ok = (heap.GetReservedSize() > 1024u);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestMalloc_Zero() {
+    ArenaHeap heap("ArenaHeapTest");
+    return (heap.Malloc(0u) == NULL);
+}
+
+bool ArenaHeapTest::TestMalloc_LargeBlock() {
+    ArenaHeap heap("ArenaHeapTest", 1024u);
+    uint8 *small1 = static_cast<uint8 *>(heap.Malloc(8u));
+    uint8 *large = static_cast<uint8 *>(heap.Malloc(4096u));
+    uint8 *small2 = static_cast<uint8 *>(heap.Malloc(8u));
+    bool ok = (small1 != NULL) && (large != NULL) && (small2 != NULL);
+    if (ok) {
+        (void) MemoryOperationsHelper::Set(large, 'a', 4096u);
+        //The small blocks shall still come from the same chunk
+        ok = ((small2 - small1) == 8);
+    }
+    if (ok) {
+        ok = (heap.Owns(large)) && (heap.Owns(&large[4095])) && (heap.Owns(small2));
+    }
+    if (ok) {
+        ok = (heap.GetReservedSize() >= (1024u + 4096u));
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestFree() {
+    ArenaHeap heap("ArenaHeapTest");
+    void *block = heap.Malloc(16u);
+    bool ok = (block != NULL);
+    uint32 used = heap.GetUsedSize();
+    if (ok) {
+        heap.Free(block);
+        ok = (block == NULL);
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() == used);
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestRealloc_InPlace() {
+    ArenaHeap heap("ArenaHeapTest");
+    void *block = heap.Malloc(16u);
+    void *original = block;
+    bool ok = (block != NULL);
+    if (ok) {
+        (void) MemoryOperationsHelper::Set(block, 'x', 16u);
+        ok = (heap.Realloc(block, 64u) == original);
+    }
+    if (ok) {
+        ok = (heap.GetUsedSize() == 64u);
+    }
+    if (ok) {
+        ok = (static_cast<char8 *>(block)[15] == 'x');
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestRealloc_Copy() {
+    ArenaHeap heap("ArenaHeapTest");
+    void *block = heap.Malloc(16u);
+    void *other = heap.Malloc(16u);
+    void *original = block;
+    bool ok = (block != NULL) && (other != NULL);
+    if (ok) {
+        (void) MemoryOperationsHelper::Set(block, 'y', 16u);
+        ok = (heap.Realloc(block, 128u) != original);
+    }
+    if (ok) {
+        ok = (block != NULL);
+    }
+    if (ok) {
+        uint32 i;
+        for (i = 0u; (i < 16u) && (ok); i++) {
+            ok = (static_cast<char8 *>(block)[i] == 'y');
+        }
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestRealloc_NULL() {
+    ArenaHeap heap("ArenaHeapTest");
+    void *block = NULL_PTR(void *);
+    bool ok = (heap.Realloc(block, 32u) != NULL);
+    if (ok) {
+        ok = (heap.Owns(block));
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestRealloc_NotOwned() {
+    ArenaHeap heap("ArenaHeapTest");
+    uint32 notOwned[4];
+    void *block = &notOwned[0];
+    (void) heap.Malloc(8u);
+    return (heap.Realloc(block, 32u) == NULL);
+}
+
+bool ArenaHeapTest::TestDuplicate() {
+    ArenaHeap heap("ArenaHeapTest");
+    const char8 * const str = "ArenaHeap";
+    char8 *dup = static_cast<char8 *>(heap.Duplicate(str));
+    bool ok = (dup != NULL);
+    if (ok) {
+        ok = (StringHelper::Compare(dup, str) == 0);
+    }
+    if (ok) {
+        ok = (heap.Owns(dup));
+    }
+    if (ok) {
+        uint32 values[3] = { 1u, 2u, 3u };
+        uint32 *valuesDup = static_cast<uint32 *>(heap.Duplicate(&values[0], sizeof(values)));
+        ok = (valuesDup != NULL);
+        if (ok) {
+            ok = (valuesDup[0] == 1u) && (valuesDup[1] == 2u) && (valuesDup[2] == 3u);
+        }
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestOwns() {
+    ArenaHeap heap("ArenaHeapTest", 1024u);
+    uint32 notOwned = 0u;
+    bool ok = !heap.Owns(&notOwned);
+    void *first = heap.Malloc(8u);
+    uint32 i;
+    for (i = 0u; (i < 300u) && (ok); i++) {
+        ok = (heap.Malloc(8u) != NULL);
+    }
+    void *last = heap.Malloc(8u);
+    if (ok) {
+        ok = (heap.Owns(first)) && (heap.Owns(last)) && (!heap.Owns(&notOwned));
+    }
+    if (ok) {
+        ok = (heap.FirstAddress() <= reinterpret_cast<uintp>(first)) && (heap.LastAddress() >= reinterpret_cast<uintp>(last));
+    }
+    return ok;
+}
+
+bool ArenaHeapTest::TestRelease() {
+    ArenaHeap heap("ArenaHeapTest", 1024u);
+    uint32 i;
+    bool ok = true;
+    for (i = 0u; (i < 300u) && (ok); i++) {
+        ok = (heap.Malloc(8u) != NULL);
+    }
+    if (ok) {
+        heap.Release();
+        ok = (heap.GetReservedSize() == 0u) && (heap.GetUsedSize() == 0u);
+    }
+    if (ok) {
+        void *block = heap.Malloc(8u);
+        ok = (heap.Owns(block));
+    }
+    return ok;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file ArenaHeapTest.h
+ * @brief Header file for class ArenaHeapTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaHeapTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L1PORTABILITY_ARENAHEAPTEST_H_
+#define TEST_CORE_BAREMETAL_L1PORTABILITY_ARENAHEAPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ArenaHeap.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the ArenaHeap public methods.
+ */
+class ArenaHeapTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that the constructor uses chunks of at least 1024 bytes.
+     */
+    bool TestConstructor_SmallChunkSize();
+
+    /**
+     * @brief Tests that Malloc returns aligned, writable and non overlapping blocks.
+     */
+    bool TestMalloc();
+
+    /**
+     * @brief Tests that Malloc returns NULL for a zero sized block.
+     */
+    bool TestMalloc_Zero();
+
+    /**
+     * @brief Tests that Malloc allocates blocks which are larger than the chunk size without wasting the current chunk.
+     */
+    bool TestMalloc_LargeBlock();
+
+    /**
+     * @brief Tests that Free sets the pointer to NULL and does not release the memory.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that Realloc grows the last block in place.
+     */
+    bool TestRealloc_InPlace();
+
+    /**
+     * @brief Tests that Realloc copies a block which is not the last one.
+     */
+    bool TestRealloc_Copy();
+
+    /**
+     * @brief Tests that Realloc of a NULL pointer behaves as Malloc.
+     */
+    bool TestRealloc_NULL();
+
+    /**
+     * @brief Tests that Realloc fails for a block which does not belong to the heap.
+     */
+    bool TestRealloc_NotOwned();
+
+    /**
+     * @brief Tests the Duplicate method for strings and for blocks of a given size.
+     */
+    bool TestDuplicate();
+
+    /**
+     * @brief Tests the Owns, FirstAddress and LastAddress methods.
+     */
+    bool TestOwns();
+
+    /**
+     * @brief Tests that Release returns all the chunks and that the heap can be reused.
+     */
+    bool TestRelease();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L1PORTABILITY_ARENAHEAPTEST_H_ */
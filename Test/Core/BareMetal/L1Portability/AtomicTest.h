@@ -102,6 +102,24 @@ public:
      */
     bool TestBoundaryDecrement();
 
+    /**
+     * @brief Tests the LoadAcquire and the StoreRelease functions (only for uint32 and uint8).
+     * @return true if the value written with StoreRelease is read back with LoadAcquire.
+     */
+    bool TestLoadAcquireStoreRelease();
+
+    /**
+     * @brief Tests the CompareAndSwap function (only for uint32).
+     * @return true if the value is only replaced when the expected value matches.
+     */
+    bool TestCompareAndSwap();
+
+    /**
+     * @brief Tests that the MemoryFence function does not alter the values written before and after it.
+     * @return true if the values written across the fence are read back.
+     */
+    bool TestMemoryFence();
+
 private:
     /** The atomic variable */
     volatile T testValue;
@@ -191,6 +209,44 @@ bool AtomicTest<T>::TestSub() {
     return testResult;
 }
 
+template<class T>
+bool AtomicTest<T>::TestLoadAcquireStoreRelease() {
+    volatile T auxValue = 0u;
+    Atomic::StoreRelease(&auxValue, testValue);
+    bool testResult = (auxValue == testValue);
+    if (testResult) {
+        testResult = (Atomic::LoadAcquire(&auxValue) == testValue);
+    }
+    return testResult;
+}
+
+template<class T>
+bool AtomicTest<T>::TestCompareAndSwap() {
+    volatile T auxValue = testValue;
+    bool testResult = !Atomic::CompareAndSwap(&auxValue, static_cast<T>(testValue + 1u), 0u);
+    if (testResult) {
+        testResult = (auxValue == testValue);
+    }
+    if (testResult) {
+        testResult = Atomic::CompareAndSwap(&auxValue, testValue, static_cast<T>(testValue + 1u));
+    }
+    if (testResult) {
+        testResult = (auxValue == static_cast<T>(testValue + 1u));
+    }
+    return testResult;
+}
+
+template<class T>
+bool AtomicTest<T>::TestMemoryFence() {
+    volatile T first = 0u;
+    volatile T second = 0u;
+    first = testValue;
+    Atomic::MemoryFence();
+    second = static_cast<T>(testValue + 1u);
+    Atomic::MemoryFence();
+    return (first == testValue) && (second == static_cast<T>(testValue + 1u));
+}
+
 template<class T>
 bool AtomicTest<T>::TestBoundaryIncrement() {
 
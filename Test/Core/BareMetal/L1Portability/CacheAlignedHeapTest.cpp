@@ -0,0 +1,419 @@
+/**
+ * @file CacheAlignedHeapTest.cpp
+ * @brief Source file for class CacheAlignedHeapTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CacheAlignedHeapTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CacheAlignedHeapTest.h"
+#include "GlobalObjectsDatabase.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static bool IsAligned(const void * const address,
+                      const uint32 alignment) {
+    return ((reinterpret_cast<uintp>(address) % alignment) == 0u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool CacheAlignedHeapTest::TestConstructor() {
+    CacheAlignedHeap heap("TestHeap");
+    bool ok = (heap.GetCacheLineSize() == CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE);
+    if (ok) {
+        ok = (heap.GetNode() == NUMAMemory::ANY_NODE);
+    }
+    if (ok) {
+        ok = (heap.GetNumberOfAllocations() == 0u);
+    }
+    if (ok) {
+        ok = (heap.FirstAddress() == 0u) && (heap.LastAddress() == 0u);
+    }
+    CacheAlignedHeap heap128("TestHeap", 128u, 0u);
+    if (ok) {
+        ok = (heap128.GetCacheLineSize() == 128u);
+    }
+    if (ok) {
+        ok = (heap128.GetNode() == 0u);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestConstructor_InvalidCacheLineSize() {
+    CacheAlignedHeap heap1("TestHeap", 96u);
+    CacheAlignedHeap heap2("TestHeap", 32u);
+    CacheAlignedHeap heap3("TestHeap", 0u);
+    bool ok = (heap1.GetCacheLineSize() == CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE);
+    if (ok) {
+        ok = (heap2.GetCacheLineSize() == CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE);
+    }
+    if (ok) {
+        ok = (heap3.GetCacheLineSize() == CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestMalloc_Alignment() {
+    const uint32 cacheLineSizes[] = { 64u, 128u, 256u };
+    const uint32 sizes[] = { 1u, 7u, 63u, 64u, 65u, 1000u, 4096u };
+    bool ok = true;
+    for (uint32 c = 0u; (c < 3u) && (ok); c++) {
+        CacheAlignedHeap heap("TestHeap", cacheLineSizes[c]);
+        for (uint32 s = 0u; (s < 7u) && (ok); s++) {
+            void *ptr = heap.Malloc(sizes[s]);
+            ok = (ptr != NULL);
+            if (ok) {
+                ok = IsAligned(ptr, cacheLineSizes[c]);
+            }
+            heap.Free(ptr);
+        }
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestMalloc_Padding() {
+    CacheAlignedHeap heap("TestHeap");
+    const uint32 numberOfBlocks = 32u;
+    void *blocks[numberOfBlocks];
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; i < numberOfBlocks; i++) {
+        blocks[i] = heap.Malloc(i + 1u);
+        if (blocks[i] == NULL) {
+            ok = false;
+        }
+    }
+    //The last cache line of each block shall not be shared with any other block.
+    uint32 j;
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        uintp firstLine = reinterpret_cast<uintp>(blocks[i]) / heap.GetCacheLineSize();
+        uintp lastLine = (reinterpret_cast<uintp>(blocks[i]) + i) / heap.GetCacheLineSize();
+        for (j = 0u; (j < numberOfBlocks) && (ok); j++) {
+            if (i != j) {
+                uintp otherFirstLine = reinterpret_cast<uintp>(blocks[j]) / heap.GetCacheLineSize();
+                uintp otherLastLine = (reinterpret_cast<uintp>(blocks[j]) + j) / heap.GetCacheLineSize();
+                ok = ((lastLine < otherFirstLine) || (otherLastLine < firstLine));
+            }
+        }
+    }
+    //Writing the full padded block shall not corrupt the other blocks
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        uint8 *block = static_cast<uint8 *>(blocks[i]);
+        for (j = 0u; j < heap.GetCacheLineSize(); j++) {
+            block[j] = static_cast<uint8>(i);
+        }
+    }
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        uint8 *block = static_cast<uint8 *>(blocks[i]);
+        for (j = 0u; (j < heap.GetCacheLineSize()) && (ok); j++) {
+            ok = (block[j] == static_cast<uint8>(i));
+        }
+    }
+    for (i = 0u; i < numberOfBlocks; i++) {
+        heap.Free(blocks[i]);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestMalloc_ZeroSize() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = heap.Malloc(0u);
+    bool ok = (ptr == NULL);
+    if (ok) {
+        ok = (heap.GetNumberOfAllocations() == 0u);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestMalloc_Node() {
+    ProcessorType cpus(0x1u);
+    uint32 node = NUMAMemory::GetNode(cpus);
+    CacheAlignedHeap heap("TestHeap", CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE, node);
+    const uint32 numberOfElements = 10000u;
+    uint32 *ptr = static_cast<uint32 *>(heap.Malloc(numberOfElements * sizeof(uint32)));
+    bool ok = (ptr != NULL);
+    if (ok) {
+        ok = IsAligned(ptr, heap.GetCacheLineSize());
+    }
+    uint32 i;
+    if (ok) {
+        for (i = 0u; i < numberOfElements; i++) {
+            ptr[i] = i;
+        }
+        for (i = 0u; (i < numberOfElements) && (ok); i++) {
+            ok = (ptr[i] == i);
+        }
+    }
+    void *mem = ptr;
+    heap.Free(mem);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestFree() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = heap.Malloc(10u);
+    bool ok = (ptr != NULL);
+    heap.Free(ptr);
+    if (ok) {
+        ok = (ptr == NULL);
+    }
+    if (ok) {
+        //Freeing NULL shall be harmless
+        heap.Free(ptr);
+        ok = (ptr == NULL);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestRealloc() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = heap.Malloc(64u);
+    bool ok = (ptr != NULL);
+    uint32 i;
+    if (ok) {
+        for (i = 0u; i < 64u; i++) {
+            static_cast<uint8 *>(ptr)[i] = static_cast<uint8>(i);
+        }
+        ok = (heap.Realloc(ptr, 1000u) != NULL);
+    }
+    if (ok) {
+        ok = IsAligned(ptr, heap.GetCacheLineSize());
+    }
+    for (i = 0u; (i < 64u) && (ok); i++) {
+        ok = (static_cast<uint8 *>(ptr)[i] == static_cast<uint8>(i));
+    }
+    if (ok) {
+        ok = (heap.GetNumberOfAllocations() == 1u);
+    }
+    heap.Free(ptr);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestRealloc_InPlace() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = heap.Malloc(10u);
+    void *original = ptr;
+    bool ok = (ptr != NULL);
+    if (ok) {
+        ok = (heap.Realloc(ptr, heap.GetCacheLineSize()) == original);
+    }
+    if (ok) {
+        ok = (heap.Realloc(ptr, 1u) == original);
+    }
+    heap.Free(ptr);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestRealloc_Null() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = NULL_PTR(void *);
+    bool ok = (heap.Realloc(ptr, 10u) != NULL);
+    if (ok) {
+        ok = (ptr != NULL);
+    }
+    if (ok) {
+        ok = IsAligned(ptr, heap.GetCacheLineSize());
+    }
+    heap.Free(ptr);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestRealloc_ZeroSize() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = heap.Malloc(10u);
+    bool ok = (ptr != NULL);
+    if (ok) {
+        ok = (heap.Realloc(ptr, 0u) == NULL);
+    }
+    if (ok) {
+        ok = (ptr == NULL);
+    }
+    if (ok) {
+        ok = (heap.GetNumberOfAllocations() == 0u);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestDuplicate() {
+    CacheAlignedHeap heap("TestHeap");
+    const uint32 source[] = { 1u, 2u, 3u, 4u, 5u };
+    void *ptr = heap.Duplicate(&source[0], sizeof(source));
+    bool ok = (ptr != NULL);
+    if (ok) {
+        ok = IsAligned(ptr, heap.GetCacheLineSize());
+    }
+    for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+        ok = (static_cast<uint32 *>(ptr)[i] == source[i]);
+    }
+    heap.Free(ptr);
+    if (ok) {
+        ok = (heap.Duplicate(NULL_PTR(void *), 10u) == NULL);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestDuplicate_String() {
+    CacheAlignedHeap heap("TestHeap");
+    const char8 *source = "CacheAlignedHeap";
+    void *ptr = heap.Duplicate(source);
+    bool ok = (ptr != NULL);
+    if (ok) {
+        ok = (StringHelper::Compare(static_cast<char8 *>(ptr), source) == 0);
+    }
+    heap.Free(ptr);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestFirstLastAddress() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr1 = heap.Malloc(10u);
+    void *ptr2 = heap.Malloc(100u);
+    bool ok = (ptr1 != NULL) && (ptr2 != NULL);
+    if (ok) {
+        uintp first = reinterpret_cast<uintp>(ptr1);
+        if (reinterpret_cast<uintp>(ptr2) < first) {
+            first = reinterpret_cast<uintp>(ptr2);
+        }
+        ok = (heap.FirstAddress() == first);
+    }
+    if (ok) {
+        uintp last = reinterpret_cast<uintp>(ptr1) + heap.GetCacheLineSize();
+        uintp last2 = reinterpret_cast<uintp>(ptr2) + (2u * heap.GetCacheLineSize());
+        if (last2 > last) {
+            last = last2;
+        }
+        ok = (heap.LastAddress() == last);
+    }
+    heap.Free(ptr1);
+    heap.Free(ptr2);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestOwns() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr = heap.Malloc(10u);
+    bool ok = (ptr != NULL);
+    if (ok) {
+        ok = heap.Owns(ptr);
+    }
+    if (ok) {
+        ok = !heap.Owns(reinterpret_cast<void *>(heap.LastAddress() + 1u));
+    }
+    heap.Free(ptr);
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestOwns_OtherHeap() {
+    CacheAlignedHeap heap("TestHeap");
+    //Interleave blocks of the standard heap with blocks of the CacheAlignedHeap, so that the former are in the range of the latter.
+    const uint32 numberOfBlocks = 8u;
+    void *blocks[numberOfBlocks];
+    void *otherBlocks[numberOfBlocks];
+    uint32 i;
+    for (i = 0u; i < numberOfBlocks; i++) {
+        blocks[i] = heap.Malloc(10u);
+        otherBlocks[i] = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(10u);
+    }
+    bool ok = true;
+    for (i = 0u; (i < numberOfBlocks) && (ok); i++) {
+        ok = heap.Owns(blocks[i]);
+        if (ok) {
+            ok = !heap.Owns(otherBlocks[i]);
+        }
+    }
+    for (i = 0u; i < numberOfBlocks; i++) {
+        heap.Free(blocks[i]);
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(otherBlocks[i]);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestName() {
+    CacheAlignedHeap heap("TestHeap");
+    bool ok = (StringHelper::Compare(heap.Name(), "TestHeap") == 0);
+    CacheAlignedHeap heapNull(NULL_PTR(const char8 *));
+    if (ok) {
+        ok = (StringHelper::Compare(heapNull.Name(), "") == 0);
+    }
+    char8 longName[2u * CacheAlignedHeap::MAX_NAME_LENGTH];
+    uint32 i;
+    for (i = 0u; i < ((2u * CacheAlignedHeap::MAX_NAME_LENGTH) - 1u); i++) {
+        longName[i] = 'a';
+    }
+    longName[i] = '\0';
+    CacheAlignedHeap heapLong(&longName[0]);
+    if (ok) {
+        ok = (StringHelper::Length(heapLong.Name()) == (CacheAlignedHeap::MAX_NAME_LENGTH - 1u));
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestGetNumberOfAllocations() {
+    CacheAlignedHeap heap("TestHeap");
+    void *ptr1 = heap.Malloc(10u);
+    void *ptr2 = heap.Malloc(10u);
+    bool ok = (heap.GetNumberOfAllocations() == 2u);
+    heap.Free(ptr1);
+    if (ok) {
+        ok = (heap.GetNumberOfAllocations() == 1u);
+    }
+    heap.Free(ptr2);
+    if (ok) {
+        ok = (heap.GetNumberOfAllocations() == 0u);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapTest::TestRelease() {
+    CacheAlignedHeap *heap = new CacheAlignedHeap("TestHeap");
+    void *ptr1 = heap->Malloc(10u);
+    void *ptr2 = heap->Malloc(10u);
+    bool ok = (ptr1 != NULL) && (ptr2 != NULL);
+    heap->Release();
+    //The heap shall still be alive
+    if (ok) {
+        static_cast<uint8 *>(ptr1)[0] = 1u;
+        ok = (heap->GetNumberOfAllocations() == 2u);
+    }
+    heap->Free(ptr1);
+    if (ok) {
+        ok = (heap->GetNumberOfAllocations() == 1u);
+    }
+    //Destroys the heap
+    heap->Free(ptr2);
+    if (ok) {
+        ok = (ptr2 == NULL);
+    }
+    CacheAlignedHeap *emptyHeap = new CacheAlignedHeap("TestHeap");
+    //Destroyed immediately
+    emptyHeap->Release();
+    return ok;
+}
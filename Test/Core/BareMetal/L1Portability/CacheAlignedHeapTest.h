@@ -0,0 +1,149 @@
+/**
+ * @file CacheAlignedHeapTest.h
+ * @brief Header file for class CacheAlignedHeapTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CacheAlignedHeapTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L1PORTABILITY_CACHEALIGNEDHEAPTEST_H_
+#define TEST_CORE_BAREMETAL_L1PORTABILITY_CACHEALIGNEDHEAPTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CacheAlignedHeap.h"
+#include "NUMAMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the CacheAlignedHeap public methods.
+ */
+class CacheAlignedHeapTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that the constructor falls back to the default cache line size if the given one is not valid.
+     */
+    bool TestConstructor_InvalidCacheLineSize();
+
+    /**
+     * @brief Tests that Malloc returns cache line aligned blocks for different sizes.
+     */
+    bool TestMalloc_Alignment();
+
+    /**
+     * @brief Tests that two blocks allocated with Malloc never share a cache line.
+     */
+    bool TestMalloc_Padding();
+
+    /**
+     * @brief Tests that Malloc returns NULL if the size is zero.
+     */
+    bool TestMalloc_ZeroSize();
+
+    /**
+     * @brief Tests that Malloc allocates usable memory on the node of the CPU 0.
+     */
+    bool TestMalloc_Node();
+
+    /**
+     * @brief Tests the Free method.
+     */
+    bool TestFree();
+
+    /**
+     * @brief Tests that Realloc keeps the memory contents when growing a block.
+     */
+    bool TestRealloc();
+
+    /**
+     * @brief Tests that Realloc does not move the block if the new size fits in the reserved cache lines.
+     */
+    bool TestRealloc_InPlace();
+
+    /**
+     * @brief Tests that Realloc allocates memory if data is NULL.
+     */
+    bool TestRealloc_Null();
+
+    /**
+     * @brief Tests that Realloc frees the memory if the new size is zero.
+     */
+    bool TestRealloc_ZeroSize();
+
+    /**
+     * @brief Tests the Duplicate method with a given size.
+     */
+    bool TestDuplicate();
+
+    /**
+     * @brief Tests the Duplicate method of a zero terminated string.
+     */
+    bool TestDuplicate_String();
+
+    /**
+     * @brief Tests the FirstAddress and LastAddress methods.
+     */
+    bool TestFirstLastAddress();
+
+    /**
+     * @brief Tests the Owns method.
+     */
+    bool TestOwns();
+
+    /**
+     * @brief Tests that the Owns method returns false for blocks of other heaps which are inside the range of addresses of the heap.
+     */
+    bool TestOwns_OtherHeap();
+
+    /**
+     * @brief Tests the Name method.
+     */
+    bool TestName();
+
+    /**
+     * @brief Tests the GetNumberOfAllocations method.
+     */
+    bool TestGetNumberOfAllocations();
+
+    /**
+     * @brief Tests that Release defers the destruction of the heap until all the memory is freed.
+     */
+    bool TestRelease();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L1PORTABILITY_CACHEALIGNEDHEAPTEST_H_ */
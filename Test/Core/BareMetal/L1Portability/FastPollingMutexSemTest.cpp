@@ -325,3 +325,82 @@ bool FastPollingMutexSemTest::TestRecursive() {
     }
     return test;
 }
+
+bool FastPollingMutexSemTest::TestSetAdaptive() {
+    FastPollingMutexSem sem;
+    bool test = !sem.IsAdaptive();
+    sem.SetAdaptive(true);
+    test &= sem.IsAdaptive();
+    test &= (sem.FastLock(TTInfiniteWait) == ErrorManagement::NoError);
+    test &= sem.Locked();
+    test &= !sem.FastTryLock();
+    sem.FastUnLock();
+    test &= !sem.Locked();
+    test &= sem.FastTryLock();
+    sem.FastUnLock();
+    sem.SetAdaptive(false);
+    test &= !sem.IsAdaptive();
+    return test;
+}
+
+bool FastPollingMutexSemTest::TestFastLockAdaptive(int32 nOfThreads,
+                                                   TimeoutType timeout) {
+    testMutex.SetAdaptive(true);
+    return GenericMutexTestCaller(nOfThreads, timeout, (ThreadFunctionType) TestFastLockCallback);
+}
+
+bool FastPollingMutexSemTest::TestFastLockAdaptiveExternal(int32 nOfThreads,
+                                                           TimeoutType timeout) {
+    external = true;
+    testMutexExt.SetAdaptive(true);
+    return GenericMutexTestCaller(nOfThreads, timeout, (ThreadFunctionType) TestFastLockCallback);
+}
+
+bool FastPollingMutexSemTest::TestFastTryLockAdaptive(int32 nOfThreads) {
+    testMutex.SetAdaptive(true);
+    bool test = GenericMutexTestCaller(nOfThreads, TTInfiniteWait, (ThreadFunctionType) TestFastTryLockCallback);
+    FastPollingMutexSem sem;
+    sem.SetAdaptive(true);
+    test = sem.FastTryLock();
+    test &= !sem.FastTryLock();
+    sem.FastUnLock();
+    return test;
+}
+
+bool FastPollingMutexSemTest::TestFastLockErrorCodeAdaptive() {
+    testMutex.SetAdaptive(true);
+    return TestFastLockErrorCode();
+}
+
+void TestFastUnLockAdaptiveWakesWaiterCallback(FastPollingMutexSemTest &mt) {
+    mt.failed = (mt.testMutex.FastLock(TTInfiniteWait) != ErrorManagement::NoError);
+    mt.sharedVariable++;
+    mt.testMutex.FastUnLock();
+    Atomic::Decrement(&mt.nOfExecutingThreads);
+}
+
+bool FastPollingMutexSemTest::TestFastUnLockAdaptiveWakesWaiter() {
+    testMutex.SetAdaptive(true, 10u);
+    bool test = (testMutex.FastLock(TTInfiniteWait) == ErrorManagement::NoError);
+    sharedVariable = 0;
+    nOfExecutingThreads = 1;
+    if (test) {
+        Threads::BeginThread((ThreadFunctionType) TestFastUnLockAdaptiveWakesWaiterCallback, this);
+        //Give time for the thread to block on the operating system
+        Sleep::MSec(100);
+        test = (sharedVariable == 0);
+        testMutex.FastUnLock();
+    }
+    int32 counter = 0;
+    while ((nOfExecutingThreads > 0) && (counter < 100)) {
+        Sleep::MSec(10);
+        counter++;
+    }
+    if (test) {
+        test = (nOfExecutingThreads == 0);
+    }
+    if (test) {
+        test = (!failed) && (sharedVariable == 1) && (!testMutex.Locked());
+    }
+    return test;
+}
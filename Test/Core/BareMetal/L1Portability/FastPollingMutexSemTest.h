@@ -164,6 +164,40 @@ public:
      */
     bool TestRecursive();
 
+    /**
+     * @brief Tests the FastPollingMutexSem::SetAdaptive and FastPollingMutexSem::IsAdaptive functions.
+     * @return true if the semaphore is not adaptive by default and if it can be locked and unlocked after being set adaptive.
+     */
+    bool TestSetAdaptive();
+
+    /**
+     * @see TestFastLock with the FastPollingMutexSem in the adaptive mode.
+     */
+    bool TestFastLockAdaptive(int32 nOfThreads,
+                              TimeoutType timeout);
+
+    /**
+     * @see TestFastLock with the FastPollingMutexSem initialised by external spin-lock and in the adaptive mode.
+     */
+    bool TestFastLockAdaptiveExternal(int32 nOfThreads,
+                                      TimeoutType timeout);
+
+    /**
+     * @see TestFastTryLock with the FastPollingMutexSem in the adaptive mode.
+     */
+    bool TestFastTryLockAdaptive(int32 nOfThreads);
+
+    /**
+     * @see TestFastLockErrorCode with the FastPollingMutexSem in the adaptive mode.
+     */
+    bool TestFastLockErrorCodeAdaptive();
+
+    /**
+     * @brief Tests that FastPollingMutexSem::FastUnLock wakes a thread which is blocked in the adaptive FastPollingMutexSem::FastLock.
+     * @return true if the blocked thread acquires the semaphore after it is unlocked.
+     */
+    bool TestFastUnLockAdaptiveWakesWaiter();
+
 private:
 
     /**
@@ -256,6 +290,10 @@ private:
      * @see TestRecursive
      */
     friend void TestRecursiveCallback(FastPollingMutexSemTest &mt);
+    /**
+     * @see TestFastUnLockAdaptiveWakesWaiter
+     */
+    friend void TestFastUnLockAdaptiveWakesWaiterCallback(FastPollingMutexSemTest &mt);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,213 @@
+/**
+ * @file HighResolutionTimerConverterTest.cpp
+ * @brief Source file for class HighResolutionTimerConverterTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HighResolutionTimerConverterTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimer.h"
+#include "HighResolutionTimerConverterTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+
+static const uint64 frequencies[] = { 1000000000ull, 1000000ull, 3000000000ull, 2400000000ull, 32768ull, 3333333333ull, 19200000ull, 0ull };
+static const uint64 values[] = { 0ull, 1ull, 2ull, 3ull, 7ull, 999ull, 1000ull, 32767ull, 32768ull, 1000000ull, 19200000ull, 123456789ull,
+        1000000000ull, 2400000000ull, 3000000000ull, 4294967295ull, 0xFFFFFFFFFFFFFFFFull };
+
+bool HighResolutionTimerConverterTest::CheckConversion(const uint64 frequency,
+                                                       const uint64 unit,
+                                                       const bool toTicks) {
+    HighResolutionTimerConverter converter(frequency);
+    bool ok = true;
+    for (uint32 i = 0u; (values[i] != 0xFFFFFFFFFFFFFFFFull) && (ok); i++) {
+        uint64 value = values[i];
+        uint64 expected;
+        uint64 result;
+        //Split the computation so that the products do not overflow
+        if (toTicks) {
+            expected = ((value / unit) * frequency) + (((value % unit) * frequency) / unit);
+            result = converter.MicrosecondsToTicks(value);
+        }
+        else {
+            expected = ((value / frequency) * unit) + (((value % frequency) * unit) / frequency);
+            if (unit == 1000000000ull) {
+                result = converter.TicksToNanoseconds(value);
+            }
+            else {
+                result = converter.TicksToMicroseconds(value);
+            }
+        }
+        ok = (result == expected);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestDefaultConstructor() {
+    HighResolutionTimerConverter converter;
+    return (converter.GetFrequency() == HighResolutionTimer::Frequency());
+}
+
+bool HighResolutionTimerConverterTest::TestConstructor_Frequency() {
+    HighResolutionTimerConverter converter(1000u);
+    bool ok = (converter.GetFrequency() == 1000u);
+    if (ok) {
+        ok = (converter.TicksToNanoseconds(1u) == 1000000u);
+    }
+    if (ok) {
+        ok = (converter.TicksToMicroseconds(1u) == 1000u);
+    }
+    if (ok) {
+        ok = (converter.MicrosecondsToTicks(1000u) == 1u);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestInstance() {
+    const HighResolutionTimerConverter &converter1 = HighResolutionTimerConverter::Instance();
+    const HighResolutionTimerConverter &converter2 = HighResolutionTimerConverter::Instance();
+    bool ok = (&converter1 == &converter2);
+    if (ok) {
+        ok = (converter1.GetFrequency() == HighResolutionTimer::Frequency());
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestTicksToNanoseconds() {
+    bool ok = true;
+    for (uint32 i = 0u; (frequencies[i] != 0u) && (ok); i++) {
+        ok = CheckConversion(frequencies[i], 1000000000ull, false);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestTicksToMicroseconds() {
+    bool ok = true;
+    for (uint32 i = 0u; (frequencies[i] != 0u) && (ok); i++) {
+        ok = CheckConversion(frequencies[i], 1000000ull, false);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestMicrosecondsToTicks() {
+    bool ok = true;
+    for (uint32 i = 0u; (frequencies[i] != 0u) && (ok); i++) {
+        ok = CheckConversion(frequencies[i], 1000000ull, true);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestExactMultiples() {
+    HighResolutionTimerConverter converter(1000000000ull);
+    bool ok = true;
+    for (uint64 us = 1u; (us < 1000000000ull) && (ok); us *= 10u) {
+        ok = (converter.TicksToMicroseconds(us * 1000u) == us);
+        if (ok) {
+            ok = (converter.MicrosecondsToTicks(us) == (us * 1000u));
+        }
+    }
+    HighResolutionTimerConverter converter3(3000000000ull);
+    for (uint64 us = 1u; (us < 1000000000ull) && (ok); us *= 10u) {
+        ok = (converter3.TicksToMicroseconds(us * 3000u) == us);
+        if (ok) {
+            ok = (converter3.TicksToNanoseconds(us * 3000u) == (us * 1000u));
+        }
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestLargeValues() {
+    HighResolutionTimerConverter converter(3000000000ull);
+    //One year at 3 GHz
+    uint64 ticks = 3000000000ull * 31536000ull;
+    bool ok = (converter.TicksToNanoseconds(ticks) == (31536000ull * 1000000000ull));
+    if (ok) {
+        ok = (converter.TicksToMicroseconds(ticks) == (31536000ull * 1000000ull));
+    }
+    if (ok) {
+        ok = (converter.MicrosecondsToTicks(31536000ull * 1000000ull) == ticks);
+    }
+    if (ok) {
+        //Full uint64 range at 1 GHz (the result is 1000 times smaller)
+        HighResolutionTimerConverter converterG(1000000000ull);
+        ok = (converterG.TicksToMicroseconds(0xFFFFFFFFFFFFFFFFull) == (0xFFFFFFFFFFFFFFFFull / 1000u));
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestSaturation() {
+    HighResolutionTimerConverter converter(1u);
+    bool ok = (converter.TicksToNanoseconds(0xFFFFFFFFFFFFFFFFull) == 0xFFFFFFFFFFFFFFFFull);
+    if (ok) {
+        ok = (converter.TicksToMicroseconds(0xFFFFFFFFFFFFFFFFull) == 0xFFFFFFFFFFFFFFFFull);
+    }
+    if (ok) {
+        //Just above the largest value that fits
+        ok = (converter.TicksToNanoseconds((0xFFFFFFFFFFFFFFFFull / 1000000000ull) + 1u) == 0xFFFFFFFFFFFFFFFFull);
+    }
+    if (ok) {
+        ok = (converter.TicksToNanoseconds(0xFFFFFFFFFFFFFFFFull / 1000000000ull) == ((0xFFFFFFFFFFFFFFFFull / 1000000000ull) * 1000000000ull));
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestZeroFrequency() {
+    HighResolutionTimerConverter converter(0u);
+    bool ok = (converter.TicksToNanoseconds(1000u) == 0u);
+    if (ok) {
+        ok = (converter.TicksToMicroseconds(1000u) == 0u);
+    }
+    if (ok) {
+        ok = (converter.MicrosecondsToTicks(1000u) == 0u);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestHighResolutionTimerTicksToNanoseconds() {
+    uint64 frequency = HighResolutionTimer::Frequency();
+    uint64 start = HighResolutionTimer::Counter();
+    bool ok = (HighResolutionTimer::TicksToNanoseconds(start + frequency, start) == 1000000000ull);
+    if (ok) {
+        ok = (HighResolutionTimer::TicksToNanoseconds(frequency) == 1000000000ull);
+    }
+    return ok;
+}
+
+bool HighResolutionTimerConverterTest::TestHighResolutionTimerTicksToMicroseconds() {
+    uint64 frequency = HighResolutionTimer::Frequency();
+    uint64 start = HighResolutionTimer::Counter();
+    bool ok = (HighResolutionTimer::TicksToMicroseconds(start + frequency, start) == 1000000ull);
+    if (ok) {
+        ok = (HighResolutionTimer::TicksToMicroseconds(frequency) == 1000000ull);
+    }
+    return ok;
+}
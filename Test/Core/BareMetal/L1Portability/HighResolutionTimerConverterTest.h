@@ -0,0 +1,123 @@
+/**
+ * @file HighResolutionTimerConverterTest.h
+ * @brief Header file for class HighResolutionTimerConverterTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HighResolutionTimerConverterTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef HIGHRESOLUTIONTIMERCONVERTERTEST_H_
+#define HIGHRESOLUTIONTIMERCONVERTERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimerConverter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the HighResolutionTimerConverter public methods.
+ */
+class HighResolutionTimerConverterTest {
+public:
+    /**
+     * @brief Tests that the default constructor uses the HighResolutionTimer::Frequency().
+     */
+    bool TestDefaultConstructor();
+
+    /**
+     * @brief Tests the constructor with a given frequency.
+     */
+    bool TestConstructor_Frequency();
+
+    /**
+     * @brief Tests that Instance() always returns the same converter for the HighResolutionTimer::Frequency().
+     */
+    bool TestInstance();
+
+    /**
+     * @brief Tests the TicksToNanoseconds method against the exact integer conversion for several frequencies.
+     */
+    bool TestTicksToNanoseconds();
+
+    /**
+     * @brief Tests the TicksToMicroseconds method against the exact integer conversion for several frequencies.
+     */
+    bool TestTicksToMicroseconds();
+
+    /**
+     * @brief Tests the MicrosecondsToTicks method against the exact integer conversion for several frequencies.
+     */
+    bool TestMicrosecondsToTicks();
+
+    /**
+     * @brief Tests that times which are exact multiples of the unit are not truncated to the unit below.
+     */
+    bool TestExactMultiples();
+
+    /**
+     * @brief Tests the conversion of values that require the full 128 bit product.
+     */
+    bool TestLargeValues();
+
+    /**
+     * @brief Tests that results which do not fit in a uint64 saturate.
+     */
+    bool TestSaturation();
+
+    /**
+     * @brief Tests that a zero frequency converts everything to zero.
+     */
+    bool TestZeroFrequency();
+
+    /**
+     * @brief Tests the HighResolutionTimer::TicksToNanoseconds function.
+     */
+    bool TestHighResolutionTimerTicksToNanoseconds();
+
+    /**
+     * @brief Tests the HighResolutionTimer::TicksToMicroseconds function.
+     */
+    bool TestHighResolutionTimerTicksToMicroseconds();
+
+private:
+
+    /**
+     * @brief Checks all the conversions for a given frequency against the exact integer computation.
+     * @param[in] frequency the frequency to test.
+     * @param[in] unit the number of units per second (1e9 for nanoseconds and 1e6 for microseconds).
+     * @param[in] toTicks if true checks the conversion from microseconds to ticks.
+     * @return true if all the conversions are exact.
+     */
+    bool CheckConversion(const uint64 frequency, const uint64 unit, const bool toTicks);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HIGHRESOLUTIONTIMERCONVERTERTEST_H_ */
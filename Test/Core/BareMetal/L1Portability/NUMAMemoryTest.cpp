@@ -0,0 +1,115 @@
+/**
+ * @file NUMAMemoryTest.cpp
+ * @brief Source file for class NUMAMemoryTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class NUMAMemoryTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "NUMAMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool NUMAMemoryTest::TestGetNode() {
+    uint32 node = NUMAMemory::GetNode(ProcessorType(0x1u));
+    //Tests that all the CPUs that are reported to belong to the node of the CPU 0 are accepted as a single node.
+    ProcessorType cpus(0x1u);
+    bool ok = true;
+    if (node != NUMAMemory::ANY_NODE) {
+        for (uint32 j = 1u; (j < 32u) && (ok); j++) {
+            if (NUMAMemory::GetNode(ProcessorType(1u << j)) == node) {
+                cpus.AddCPU(j + 1u);
+            }
+        }
+        ok = (NUMAMemory::GetNode(cpus) == node);
+    }
+    return ok;
+}
+
+bool NUMAMemoryTest::TestGetNode_NoCPUs() {
+    BitSet noCPUs(0u);
+    return (NUMAMemory::GetNode(ProcessorType(noCPUs)) == NUMAMemory::ANY_NODE);
+}
+
+bool NUMAMemoryTest::TestAllocate_AnyNode() {
+    const uint32 size = 1000u;
+    uint8 *ptr = static_cast<uint8 *>(NUMAMemory::Allocate(size, NUMAMemory::ANY_NODE));
+    bool ok = (ptr != NULL);
+    uint32 i;
+    if (ok) {
+        for (i = 0u; i < size; i++) {
+            ptr[i] = static_cast<uint8>(i);
+        }
+        for (i = 0u; (i < size) && (ok); i++) {
+            ok = (ptr[i] == static_cast<uint8>(i));
+        }
+    }
+    void *mem = ptr;
+    NUMAMemory::Free(mem, size, NUMAMemory::ANY_NODE);
+    return ok;
+}
+
+bool NUMAMemoryTest::TestAllocate_Node() {
+    uint32 node = NUMAMemory::GetNode(ProcessorType(0x1u));
+    const uint32 size = 100000u;
+    uint8 *ptr = static_cast<uint8 *>(NUMAMemory::Allocate(size, node));
+    bool ok = (ptr != NULL);
+    uint32 i;
+    if (ok) {
+        for (i = 0u; i < size; i++) {
+            ptr[i] = static_cast<uint8>(i);
+        }
+        for (i = 0u; (i < size) && (ok); i++) {
+            ok = (ptr[i] == static_cast<uint8>(i));
+        }
+    }
+    void *mem = ptr;
+    NUMAMemory::Free(mem, size, node);
+    return ok;
+}
+
+bool NUMAMemoryTest::TestAllocate_ZeroSize() {
+    return (NUMAMemory::Allocate(0u, NUMAMemory::ANY_NODE) == NULL);
+}
+
+bool NUMAMemoryTest::TestFree() {
+    void *ptr = NUMAMemory::Allocate(10u, NUMAMemory::ANY_NODE);
+    bool ok = (ptr != NULL);
+    NUMAMemory::Free(ptr, 10u, NUMAMemory::ANY_NODE);
+    if (ok) {
+        ok = (ptr == NULL);
+    }
+    if (ok) {
+        NUMAMemory::Free(ptr, 10u, NUMAMemory::ANY_NODE);
+        ok = (ptr == NULL);
+    }
+    return ok;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file NUMAMemoryTest.h
+ * @brief Header file for class NUMAMemoryTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class NUMAMemoryTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L1PORTABILITY_NUMAMEMORYTEST_H_
+#define TEST_CORE_BAREMETAL_L1PORTABILITY_NUMAMEMORYTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "NUMAMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the NUMAMemory public methods.
+ */
+class NUMAMemoryTest {
+public:
+
+    /**
+     * @brief Tests that GetNode returns the same node for a single CPU and for a set of CPUs of that node.
+     */
+    bool TestGetNode();
+
+    /**
+     * @brief Tests that GetNode returns ANY_NODE if no CPU is set.
+     */
+    bool TestGetNode_NoCPUs();
+
+    /**
+     * @brief Tests the Allocate method with ANY_NODE.
+     */
+    bool TestAllocate_AnyNode();
+
+    /**
+     * @brief Tests the Allocate method on the node of the CPU 0.
+     */
+    bool TestAllocate_Node();
+
+    /**
+     * @brief Tests that Allocate returns NULL if the size is zero.
+     */
+    bool TestAllocate_ZeroSize();
+
+    /**
+     * @brief Tests the Free method.
+     */
+    bool TestFree();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L1PORTABILITY_NUMAMEMORYTEST_H_ */
@@ -0,0 +1,147 @@
+/**
+ * @file SharedMemoryTest.cpp
+ * @brief Source file for class SharedMemoryTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SharedMemoryTest::TestCreate() {
+    uint32 size = 1024u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryTest", size);
+    bool ok = (address != NULL);
+    if (ok) {
+        uint8 *bytes = reinterpret_cast<uint8 *>(address);
+        bytes[0] = 0xAAu;
+        bytes[size - 1u] = 0x55u;
+        ok = (bytes[0] == 0xAAu) && (bytes[size - 1u] == 0x55u);
+    }
+    SharedMemory::Close(address, size);
+    if (ok) {
+        ok = (address == NULL);
+    }
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen() {
+    uint32 size = 4096u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryTest", size);
+    bool ok = (address != NULL);
+    uint32 openSize = 0u;
+    void *other = NULL_PTR(void *);
+    if (ok) {
+        other = SharedMemory::Open("/MARTe2SharedMemoryTest", openSize, false);
+        ok = (other != NULL);
+    }
+    if (ok) {
+        ok = (openSize == size);
+    }
+    if (ok) {
+        reinterpret_cast<uint32 *>(address)[10] = 0x12345678u;
+        ok = (reinterpret_cast<uint32 *>(other)[10] == 0x12345678u);
+    }
+    if (ok) {
+        reinterpret_cast<uint32 *>(other)[20] = 0x87654321u;
+        ok = (reinterpret_cast<uint32 *>(address)[20] == 0x87654321u);
+    }
+    SharedMemory::Close(other, openSize);
+    SharedMemory::Close(address, size);
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen_ReadOnly() {
+    uint32 size = 64u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryTest", size);
+    bool ok = (address != NULL);
+    uint32 openSize = 0u;
+    void *other = NULL_PTR(void *);
+    if (ok) {
+        reinterpret_cast<uint8 *>(address)[3] = 7u;
+        other = SharedMemory::Open("/MARTe2SharedMemoryTest", openSize, true);
+        ok = (other != NULL);
+    }
+    if (ok) {
+        ok = (reinterpret_cast<uint8 *>(other)[3] == 7u);
+    }
+    SharedMemory::Close(other, openSize);
+    SharedMemory::Close(address, size);
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    return ok;
+}
+
+bool SharedMemoryTest::TestOpen_False_NotExisting() {
+    uint32 openSize = 0u;
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    void *address = SharedMemory::Open("/MARTe2SharedMemoryTest", openSize, true);
+    return (address == NULL);
+}
+
+bool SharedMemoryTest::TestClose() {
+    uint32 size = 64u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryTest", size);
+    bool ok = (address != NULL);
+    SharedMemory::Close(address, size);
+    if (ok) {
+        ok = (address == NULL);
+    }
+    if (ok) {
+        SharedMemory::Close(address, size);
+        ok = (address == NULL);
+    }
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    return ok;
+}
+
+bool SharedMemoryTest::TestRemove() {
+    uint32 size = 64u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryTest", size);
+    bool ok = (address != NULL);
+    SharedMemory::Close(address, size);
+    if (ok) {
+        ok = SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    }
+    if (ok) {
+        uint32 openSize = 0u;
+        ok = (SharedMemory::Open("/MARTe2SharedMemoryTest", openSize, true) == NULL);
+    }
+    return ok;
+}
+
+bool SharedMemoryTest::TestRemove_False() {
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryTest");
+    return !SharedMemory::Remove("/MARTe2SharedMemoryTest");
+}
@@ -0,0 +1,88 @@
+/**
+ * @file SharedMemoryTest.h
+ * @brief Header file for class SharedMemoryTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L1PORTABILITY_SHAREDMEMORYTEST_H_
+#define TEST_CORE_BAREMETAL_L1PORTABILITY_SHAREDMEMORYTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemory.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the SharedMemory public methods.
+ */
+class SharedMemoryTest {
+public:
+
+    /**
+     * @brief Tests that Create maps a writable segment with the requested size.
+     */
+    bool TestCreate();
+
+    /**
+     * @brief Tests that Open maps the same memory that was mapped by Create and returns the segment size.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that Open with readOnly = true maps the segment and sees the data written through the Create mapping.
+     */
+    bool TestOpen_ReadOnly();
+
+    /**
+     * @brief Tests that Open fails for a segment that does not exist.
+     */
+    bool TestOpen_False_NotExisting();
+
+    /**
+     * @brief Tests that Close sets the address to NULL and accepts a NULL address.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests that Remove deletes the segment, so that it can no longer be opened.
+     */
+    bool TestRemove();
+
+    /**
+     * @brief Tests that Remove fails for a segment that does not exist.
+     */
+    bool TestRemove_False();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L1PORTABILITY_SHAREDMEMORYTEST_H_ */
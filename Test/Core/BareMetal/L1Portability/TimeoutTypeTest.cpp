@@ -128,8 +128,8 @@ bool TimeoutTypeTest::TestHighResolutionTimerTicks() {
     int32 msecTimeout = 100;
     uint64 expectedTicks;
     timeout.SetTimeoutSec(double(msecTimeout) * 1e-3);
-    //Floating point operations is order dependent. Here, the same operations as the implementation are followed otherwise the result may don't meet the programmer expectations
-    expectedTicks = uint64((1e-6 * (msecTimeout * 1e3)) * HighResolutionTimer::Frequency());
+    //The conversion is computed with integer arithmetic (see HighResolutionTimerConverter), i.e. it is truncated and not subject to floating point rounding
+    expectedTicks = (static_cast<uint64>(msecTimeout) * 1000ull * HighResolutionTimer::Frequency()) / 1000000ull;
     return (expectedTicks == timeout.HighResolutionTimerTicks());
 }
 
@@ -0,0 +1,212 @@
+/**
+ * @file ReferenceContainerNameIndexTest.cpp
+ * @brief Source file for class ReferenceContainerNameIndexTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ReferenceContainerNameIndexTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Object.h"
+#include "ReferenceContainerNameIndexTest.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+using namespace MARTe;
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+const uint32 numberOfTestNodes = 100u;
+
+/**
+ * Creates numberOfTestNodes nodes referencing objects named Node0, Node1, ...
+ */
+void CreateTestNodes(ReferenceContainerNode * const nodes) {
+    for (uint32 i = 0u; i < numberOfTestNodes; i++) {
+        Reference ref("Object");
+        StreamString name;
+        name.Printf("Node%d", i);
+        ref->SetName(name.Buffer());
+        nodes[i].SetReference(ref);
+    }
+}
+
+bool FindByName(const ReferenceContainerNameIndex &index, const char8 * const name, ReferenceContainerNode *&node) {
+    return index.Find(name, StringHelper::Length(name), node);
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ReferenceContainerNameIndexTest::TestConstructor() {
+    ReferenceContainerNameIndex index;
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    bool ok = (!index.IsActive());
+    if (ok) {
+        ok = (index.GetNumberOfElements() == 0u);
+    }
+    if (ok) {
+        ok = !FindByName(index, "Node0", node);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestAdd() {
+    ReferenceContainerNode nodes[numberOfTestNodes];
+    CreateTestNodes(&nodes[0]);
+    ReferenceContainerNameIndex index;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i++) {
+        ok = index.Add(&nodes[i]);
+    }
+    if (ok) {
+        ok = (index.IsActive());
+    }
+    if (ok) {
+        ok = (index.GetNumberOfElements() == numberOfTestNodes);
+    }
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i++) {
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        ok = FindByName(index, nodes[i].GetReference()->GetName(), node);
+        if (ok) {
+            ok = (node == &nodes[i]);
+        }
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestRemove() {
+    ReferenceContainerNode nodes[numberOfTestNodes];
+    CreateTestNodes(&nodes[0]);
+    ReferenceContainerNameIndex index;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i++) {
+        ok = index.Add(&nodes[i]);
+    }
+    //Remove the even nodes
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i += 2u) {
+        index.Remove(&nodes[i]);
+    }
+    if (ok) {
+        ok = (index.GetNumberOfElements() == (numberOfTestNodes / 2u));
+    }
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i++) {
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        bool found = FindByName(index, nodes[i].GetReference()->GetName(), node);
+        if ((i % 2u) == 0u) {
+            ok = !found;
+        }
+        else {
+            ok = (found && (node == &nodes[i]));
+        }
+    }
+    if (ok) {
+        //Renamed objects can still be removed
+        nodes[1].GetReference()->SetName("Renamed");
+        index.Remove(&nodes[1]);
+        ok = (index.GetNumberOfElements() == ((numberOfTestNodes / 2u) - 1u));
+    }
+    //Add again (reusing the table after removing entries)
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i += 2u) {
+        ok = index.Add(&nodes[i]);
+    }
+    for (uint32 i = 2u; (i < numberOfTestNodes) && (ok); i++) {
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        ok = FindByName(index, nodes[i].GetReference()->GetName(), node);
+        if (ok) {
+            ok = (node == &nodes[i]);
+        }
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestFind() {
+    ReferenceContainerNode nodes[numberOfTestNodes];
+    CreateTestNodes(&nodes[0]);
+    ReferenceContainerNameIndex index;
+    bool ok = true;
+    for (uint32 i = 0u; (i < numberOfTestNodes) && (ok); i++) {
+        ok = index.Add(&nodes[i]);
+    }
+    ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+    if (ok) {
+        //Only the first 5 characters
+        ok = index.Find("Node12.Child", 6u, node);
+    }
+    if (ok) {
+        ok = (node == &nodes[12]);
+    }
+    if (ok) {
+        ok = index.Find("Node1.Child", 5u, node);
+    }
+    if (ok) {
+        ok = (node == &nodes[1]);
+    }
+    if (ok) {
+        ok = !FindByName(index, "Node", node);
+    }
+    if (ok) {
+        ok = !FindByName(index, "Node1000", node);
+    }
+    ReferenceContainerNode repeated;
+    if (ok) {
+        Reference ref("Object");
+        ref->SetName("Node7");
+        repeated.SetReference(ref);
+        ok = index.Add(&repeated);
+    }
+    if (ok) {
+        ok = !FindByName(index, "Node7", node);
+    }
+    if (ok) {
+        index.Remove(&repeated);
+        ok = FindByName(index, "Node7", node);
+    }
+    if (ok) {
+        ok = (node == &nodes[7]);
+    }
+    return ok;
+}
+
+bool ReferenceContainerNameIndexTest::TestReset() {
+    ReferenceContainerNode nodes[numberOfTestNodes];
+    CreateTestNodes(&nodes[0]);
+    ReferenceContainerNameIndex index;
+    bool ok = index.Add(&nodes[0]);
+    if (ok) {
+        index.Reset();
+        ok = (!index.IsActive());
+    }
+    if (ok) {
+        ok = (index.GetNumberOfElements() == 0u);
+    }
+    if (ok) {
+        ReferenceContainerNode *node = NULL_PTR(ReferenceContainerNode *);
+        ok = !FindByName(index, "Node0", node);
+    }
+    return ok;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file ReferenceContainerNameIndexTest.h
+ * @brief Header file for class ReferenceContainerNameIndexTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ReferenceContainerNameIndexTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REFERENCECONTAINERNAMEINDEXTEST_H_
+#define REFERENCECONTAINERNAMEINDEXTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ReferenceContainerNameIndex.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests all the ReferenceContainerNameIndex functions
+ */
+class ReferenceContainerNameIndexTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     * @return true if the index is not active and has no elements.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that a large number of nodes can be added and found (forcing the table to grow).
+     */
+    bool TestAdd();
+
+    /**
+     * @brief Tests that removed nodes are no longer found and that the remaining nodes still are,
+     * including nodes whose object was renamed after being added.
+     */
+    bool TestRemove();
+
+    /**
+     * @brief Tests that names which are not zero terminated are found and that
+     * Find returns false for unknown and repeated names.
+     */
+    bool TestFind();
+
+    /**
+     * @brief Tests that Reset frees the table.
+     */
+    bool TestReset();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REFERENCECONTAINERNAMEINDEXTEST_H_ */
@@ -28,7 +28,9 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
 #include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "ObjectTestHelper.h"
@@ -36,6 +38,7 @@
 #include "ReferenceContainerFilterObjectName.h"
 #include "ReferenceContainerFilterReferences.h"
 #include "ReferenceContainerTest.h"
+#include "StreamString.h"
 #include "StringHelper.h"
 #include "Threads.h"
 
@@ -1199,6 +1202,183 @@ bool ReferenceContainerTest::TestIsDomainToken() {
     return ok;
 }
 
+/**
+ * Creates a container with numberOfContainers containers named C0, C1, ... each holding numberOfLeafs objects
+ * named L0, L1, ... and a container named Sub holding an object named Leaf.
+ */
+static ReferenceT<ReferenceContainer> CreateIndexTestTree(const uint32 numberOfContainers, const uint32 numberOfLeafs) {
+    ReferenceT<ReferenceContainer> root(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    root->SetName("Root");
+    for (uint32 i = 0u; i < numberOfContainers; i++) {
+        ReferenceT<ReferenceContainer> container(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        StreamString name;
+        name.Printf("C%d", i);
+        container->SetName(name.Buffer());
+        for (uint32 j = 0u; j < numberOfLeafs; j++) {
+            ReferenceT<Object> leaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+            StreamString leafName;
+            leafName.Printf("L%d", j);
+            leaf->SetName(leafName.Buffer());
+            container->Insert(leaf);
+        }
+        ReferenceT<ReferenceContainer> sub(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        sub->SetName("Sub");
+        ReferenceT<Object> leaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        leaf->SetName("Leaf");
+        sub->Insert(leaf);
+        container->Insert(sub);
+        root->Insert(container);
+    }
+    return root;
+}
+
+/**
+ * Finds \a path using the filter based search.
+ */
+static Reference FindWithFilter(ReferenceT<ReferenceContainer> root, const char8 * const path) {
+    Reference ret;
+    ReferenceContainerFilterObjectName filter(1, ReferenceContainerFilterMode::SHALLOW, path);
+    ReferenceContainer result;
+    root->Find(result, filter);
+    if (result.Size() > 0u) {
+        ret = result.Get(result.Size() - 1u);
+    }
+    return ret;
+}
+
+bool ReferenceContainerTest::TestFind_PathIndexed() {
+    //C0 ... C39 have more than REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD elements, Sub has only one
+    ReferenceT<ReferenceContainer> root = CreateIndexTestTree(40u, 30u);
+    const char8 * const paths[] = { "C0", "C39", "C12.L0", "C12.L29", ".C25.L7", "C25.L7.", "C3.Sub.Leaf", "C38.Sub", NULL_PTR(const char8 *) };
+    bool ok = true;
+    for (uint32 i = 0u; (paths[i] != NULL_PTR(const char8 *)) && (ok); i++) {
+        Reference found = root->Find(paths[i]);
+        Reference expected = FindWithFilter(root, paths[i]);
+        ok = (found.IsValid() && (found == expected));
+    }
+    if (ok) {
+        Reference found = root->Find("C12.L29");
+        ok = (StringHelper::Compare(found->GetName(), "L29") == 0);
+    }
+    const char8 * const missing[] = { "C40", "C12.L30", "C12..L0", "C12.L0.X", "C3.Sub.Leaf.X", "", ".", "C", NULL_PTR(const char8 *) };
+    for (uint32 i = 0u; (missing[i] != NULL_PTR(const char8 *)) && (ok); i++) {
+        ok = !(root->Find(missing[i]).IsValid());
+    }
+    root->Purge();
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFind_PathRepeatedNames() {
+    ReferenceT<ReferenceContainer> root = CreateIndexTestTree(20u, 2u);
+    //A second C5 (inserted first) which does not have L1
+    ReferenceT<ReferenceContainer> repeated(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    repeated->SetName("C5");
+    ReferenceT<Object> leaf(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    leaf->SetName("L0");
+    repeated->Insert(leaf);
+    bool ok = root->Insert(repeated, 0);
+    if (ok) {
+        ok = (root->Find("C5") == repeated);
+    }
+    if (ok) {
+        ok = (root->Find("C5.L0") == leaf);
+    }
+    if (ok) {
+        Reference found = root->Find("C5.L1");
+        ok = (found.IsValid());
+        if (ok) {
+            ok = (found == FindWithFilter(root, "C5.L1"));
+        }
+    }
+    root->Purge();
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFind_PathRenamed() {
+    ReferenceT<ReferenceContainer> root = CreateIndexTestTree(20u, 2u);
+    Reference element = root->Find("C7");
+    bool ok = element.IsValid();
+    if (ok) {
+        element->SetName("Renamed");
+        ok = (root->Find("Renamed") == element);
+    }
+    if (ok) {
+        ok = (root->Find("Renamed.L1").IsValid());
+    }
+    if (ok) {
+        ok = !(root->Find("C7").IsValid());
+    }
+    if (ok) {
+        ok = root->Delete(element);
+    }
+    if (ok) {
+        ok = !(root->Find("Renamed").IsValid());
+    }
+    root->Purge();
+    return ok;
+}
+
+bool ReferenceContainerTest::TestDelete_Indexed() {
+    ReferenceT<ReferenceContainer> root = CreateIndexTestTree(30u, 2u);
+    bool ok = true;
+    for (uint32 i = 0u; (i < 30u) && (ok); i += 2u) {
+        StreamString name;
+        name.Printf("C%d", i);
+        ok = root->Delete(name.Buffer());
+    }
+    if (ok) {
+        ok = (root->Size() == 15u);
+    }
+    for (uint32 i = 0u; (i < 30u) && (ok); i++) {
+        StreamString name;
+        name.Printf("C%d.L1", i);
+        bool found = root->Find(name.Buffer()).IsValid();
+        ok = ((i % 2u) == 0u) ? (!found) : (found);
+    }
+    if (ok) {
+        ReferenceT<ReferenceContainer> container(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        container->SetName("C0");
+        ok = root->Insert(container);
+        if (ok) {
+            ok = (root->Find("C0") == container);
+        }
+    }
+    root->Purge();
+    return ok;
+}
+
+bool ReferenceContainerTest::TestFind_PathBenchmark() {
+    const uint32 numberOfContainers = 200u;
+    const uint32 numberOfLeafs = 50u;
+    const uint32 numberOfSearches = 1000u;
+    ReferenceT<ReferenceContainer> root = CreateIndexTestTree(numberOfContainers, numberOfLeafs);
+    StreamString paths[8];
+    for (uint32 i = 0u; i < 8u; i++) {
+        paths[i].Printf("C%d.L%d", ((i * 97u) % numberOfContainers), ((i * 31u) % numberOfLeafs));
+    }
+    bool ok = true;
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 n = 0u; (n < numberOfSearches) && (ok); n++) {
+        ok = FindWithFilter(root, paths[n % 8u].Buffer()).IsValid();
+    }
+    uint64 filterTicks = HighResolutionTimer::Counter() - start;
+    start = HighResolutionTimer::Counter();
+    for (uint32 n = 0u; (n < numberOfSearches) && (ok); n++) {
+        ok = root->Find(paths[n % 8u].Buffer()).IsValid();
+    }
+    uint64 indexTicks = HighResolutionTimer::Counter() - start;
+    for (uint32 i = 0u; (i < 8u) && (ok); i++) {
+        ok = (root->Find(paths[i].Buffer()) == FindWithFilter(root, paths[i].Buffer()));
+    }
+    if (ok) {
+        float64 filterTime = HighResolutionTimer::TicksToTime(filterTicks, 0u) * 1e6 / static_cast<float64>(numberOfSearches);
+        float64 indexTime = HighResolutionTimer::TicksToTime(indexTicks, 0u) * 1e6 / static_cast<float64>(numberOfSearches);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "ReferenceContainer::Find benchmark: filter %f us index %f us per search", filterTime, indexTime);
+    }
+    root->Purge();
+    return ok;
+}
+
 bool ReferenceContainerTest::TestAddDomainToken() {
     return TestIsDomainToken();
 }
@@ -1207,6 +1387,57 @@ bool ReferenceContainerTest::TestRemoveDomainToken() {
     return TestIsDomainToken();
 }
 
+bool ReferenceContainerTest::TestGetGeneration() {
+    ReferenceT<ReferenceContainer> root(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    uint32 generation = root->GetGeneration();
+    ReferenceT<ReferenceContainer> child(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    child->SetName("Child");
+    bool ok = (child->GetGeneration() > generation);
+    if (ok) {
+        ok = root->Insert(child);
+    }
+    if (ok) {
+        ok = (root->GetGeneration() > child->GetGeneration());
+        generation = root->GetGeneration();
+    }
+    if (ok) {
+        ok = root->Find("Child").IsValid();
+    }
+    if (ok) {
+        ok = (root->GetGeneration() == generation);
+    }
+    if (ok) {
+        ok = root->Delete("Child");
+    }
+    if (ok) {
+        ok = (root->GetGeneration() > generation);
+        generation = root->GetGeneration();
+    }
+    if (ok) {
+        ok = !root->Delete("Child");
+    }
+    if (ok) {
+        ok = (root->GetGeneration() == generation);
+    }
+    return ok;
+}
+
+bool ReferenceContainerTest::TestNotifyChange() {
+    ReferenceT<ReferenceContainer> root(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    uint32 generation = root->GetGeneration();
+    ReferenceContainer::NotifyChange();
+    uint32 lastChange = ReferenceContainer::GetLastChangeNotification();
+    bool ok = (lastChange > generation);
+    if (ok) {
+        ok = (root->GetGeneration() == generation);
+    }
+    if (ok) {
+        ReferenceContainer::NotifyChange();
+        ok = (ReferenceContainer::GetLastChangeNotification() > lastChange);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
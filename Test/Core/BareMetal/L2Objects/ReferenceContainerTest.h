@@ -396,6 +396,34 @@ public:
 
     bool TestDeleteWithPath();
 
+    /**
+     * @brief Tests that Find(path) resolves paths through containers which are indexed by name
+     * (more than REFERENCE_CONTAINER_NAME_INDEX_THRESHOLD elements) and through containers which are not.
+     */
+    bool TestFind_PathIndexed();
+
+    /**
+     * @brief Tests that Find(path) returns the first matching path when a level has repeated names,
+     * including when the first element with the repeated name does not lead to the path.
+     */
+    bool TestFind_PathRepeatedNames();
+
+    /**
+     * @brief Tests that elements which are renamed after being inserted in an indexed container are found by the new name.
+     */
+    bool TestFind_PathRenamed();
+
+    /**
+     * @brief Tests that elements deleted from an indexed container are no longer found.
+     */
+    bool TestDelete_Indexed();
+
+    /**
+     * @brief Benchmarks Find(path) against the filter based search. Only checks that both return the
+     * same element (timings are not asserted).
+     */
+    bool TestFind_PathBenchmark();
+
     /**
      * @brief Tests if for each of the marked nodes of \a data a new Object
      * will be created and its Reference added to the container.
@@ -503,6 +531,16 @@ public:
      */
     bool TestIsReferenceContainer();
 
+    /**
+     * @brief Tests that the GetGeneration increases with Insert and Delete, is not changed by Find and is higher for a newer container.
+     */
+    bool TestGetGeneration();
+
+    /**
+     * @brief Tests that NotifyChange updates GetLastChangeNotification without modifying the generation of existing containers.
+     */
+    bool TestNotifyChange();
+
     volatile int32 spinLock;
 
 private:
@@ -0,0 +1,355 @@
+/**
+ * @file DeflateEncoderTest.cpp
+ * @brief Source file for class DeflateEncoderTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DeflateEncoderTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "DeflateEncoderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * zlib stream of "MARTe MARTe MARTe" (verified against zlib).
+ */
+static const uint8 deflateTestCompressed[] = { 0x78u, 0x01u, 0xF2u, 0x75u, 0x0Cu, 0x0Au, 0x49u, 0x55u, 0x40u, 0x22u, 0x01u, 0x03u, 0x00u, 0x2Cu, 0xABu, 0x05u,
+        0x0Cu };
+
+/**
+ * zlib stream without data (verified against zlib).
+ */
+static const uint8 deflateTestCompressedEmpty[] = { 0x78u, 0x01u, 0x02u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u };
+
+static const uint16 inflateTestLengthBase[29] = { 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 13u, 15u, 17u, 19u, 23u, 27u, 31u, 35u, 43u, 51u, 59u, 67u, 83u, 99u,
+        115u, 131u, 163u, 195u, 227u, 258u };
+static const uint8 inflateTestLengthExtraBits[29] = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 4u, 5u, 5u,
+        5u, 5u, 0u };
+static const uint16 inflateTestDistanceBase[30] = { 1u, 2u, 3u, 4u, 5u, 7u, 9u, 13u, 17u, 25u, 33u, 49u, 65u, 97u, 129u, 193u, 257u, 385u, 513u, 769u, 1025u,
+        1537u, 2049u, 3073u, 4097u, 6145u, 8193u, 12289u, 16385u, 24577u };
+static const uint8 inflateTestDistanceExtraBits[30] = { 0u, 0u, 0u, 0u, 1u, 1u, 2u, 2u, 3u, 3u, 4u, 4u, 5u, 5u, 6u, 6u, 7u, 7u, 8u, 8u, 9u, 9u, 10u, 10u, 11u,
+        11u, 12u, 12u, 13u, 13u };
+
+/**
+ * @brief Reads bits (less significant first) from a byte array.
+ */
+class InflateTestBitReader {
+public:
+    InflateTestBitReader(const uint8 * const inputIn,
+                         const uint32 inputSizeIn) {
+        input = inputIn;
+        inputSize = inputSizeIn;
+        bitPosition = 0u;
+        ok = true;
+    }
+
+    uint32 GetBits(const uint32 numberOfBits) {
+        uint32 value = 0u;
+        for (uint32 i = 0u; (i < numberOfBits) && (ok); i++) {
+            uint32 byte = (bitPosition >> 3u);
+            ok = (byte < inputSize);
+            if (ok) {
+                value |= (((input[byte] >> (bitPosition & 7u)) & 1u) << i);
+                bitPosition++;
+            }
+        }
+        return value;
+    }
+
+    uint32 GetHuffmanBits(const uint32 code,
+                          const uint32 numberOfBits) {
+        uint32 value = code;
+        for (uint32 i = 0u; i < numberOfBits; i++) {
+            value = ((value << 1u) | GetBits(1u));
+        }
+        return value;
+    }
+
+    void AlignToByte() {
+        bitPosition = ((bitPosition + 7u) & ~7u);
+    }
+
+    const uint8 *input;
+    uint32 inputSize;
+    uint32 bitPosition;
+    bool ok;
+};
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool DeflateEncoderTest::Inflate(const uint8 * const input,
+                                 const uint32 inputSize,
+                                 uint8 * const output,
+                                 const uint32 outputCapacity,
+                                 uint32 &outputSize) {
+    InflateTestBitReader reader(input, inputSize);
+    outputSize = 0u;
+    uint32 cmf = reader.GetBits(8u);
+    uint32 flg = reader.GetBits(8u);
+    bool ok = (cmf == 0x78u);
+    if (ok) {
+        ok = ((((cmf << 8u) | flg) % 31u) == 0u);
+    }
+    bool final = false;
+    while ((ok) && (!final)) {
+        final = (reader.GetBits(1u) == 1u);
+        //Only fixed Huffman blocks are written by the DeflateEncoder.
+        ok = (reader.GetBits(2u) == 1u);
+        bool endOfBlock = false;
+        while ((ok) && (!endOfBlock)) {
+            uint32 symbol;
+            uint32 code = reader.GetHuffmanBits(0u, 7u);
+            if (code <= 23u) {
+                symbol = 256u + code;
+            }
+            else {
+                code = reader.GetHuffmanBits(code, 1u);
+                if ((code >= 0x30u) && (code <= 0xBFu)) {
+                    symbol = code - 0x30u;
+                }
+                else if ((code >= 0xC0u) && (code <= 0xC7u)) {
+                    symbol = 280u + (code - 0xC0u);
+                }
+                else {
+                    code = reader.GetHuffmanBits(code, 1u);
+                    symbol = 144u + (code - 0x190u);
+                }
+            }
+            if (symbol < 256u) {
+                ok = (outputSize < outputCapacity);
+                if (ok) {
+                    output[outputSize] = static_cast<uint8>(symbol);
+                    outputSize++;
+                }
+            }
+            else if (symbol == 256u) {
+                endOfBlock = true;
+            }
+            else {
+                ok = ((symbol - 257u) < 29u);
+                uint32 length = 0u;
+                uint32 distance = 0u;
+                if (ok) {
+                    length = inflateTestLengthBase[symbol - 257u] + reader.GetBits(inflateTestLengthExtraBits[symbol - 257u]);
+                    uint32 distanceCode = reader.GetHuffmanBits(0u, 5u);
+                    ok = (distanceCode < 30u);
+                    if (ok) {
+                        distance = inflateTestDistanceBase[distanceCode] + reader.GetBits(inflateTestDistanceExtraBits[distanceCode]);
+                    }
+                }
+                if (ok) {
+                    ok = ((distance <= outputSize) && ((outputSize + length) <= outputCapacity));
+                }
+                for (uint32 i = 0u; (i < length) && (ok); i++) {
+                    output[outputSize] = output[outputSize - distance];
+                    outputSize++;
+                }
+            }
+            if (ok) {
+                ok = reader.ok;
+            }
+        }
+    }
+    if (ok) {
+        reader.AlignToByte();
+        uint32 adler = 0u;
+        for (uint32 i = 0u; i < 4u; i++) {
+            adler = ((adler << 8u) | reader.GetBits(8u));
+        }
+        uint32 a = 1u;
+        uint32 b = 0u;
+        for (uint32 i = 0u; i < outputSize; i++) {
+            a = (a + output[i]) % 65521u;
+            b = (b + a) % 65521u;
+        }
+        ok = (reader.ok);
+        if (ok) {
+            ok = (adler == ((b << 16u) | a));
+        }
+        if (ok) {
+            ok = ((reader.bitPosition >> 3u) == inputSize);
+        }
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestConstructor() {
+    StreamString output;
+    DeflateEncoder test(output);
+    bool ok = (test.GetInputSize() == 0ull);
+    if (ok) {
+        ok = (test.GetOutputSize() == 0ull);
+    }
+    if (ok) {
+        ok = (output.Size() == 0ull);
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestWrite() {
+    StreamString output;
+    DeflateEncoder test(output);
+    const char8 * const input = "MARTe MARTe MARTe";
+    bool ok = test.Write(input, StringHelper::Length(input));
+    if (ok) {
+        ok = test.Finish();
+    }
+    if (ok) {
+        ok = (output.Size() == sizeof(deflateTestCompressed));
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Compare(output.Buffer(), &deflateTestCompressed[0], sizeof(deflateTestCompressed)) == 0;
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestWrite_Large() {
+    //Repeated text, pseudo-random bytes and a ramp of float64, so that matches, literals and window slides are all exercised.
+    const uint32 size = 300000u;
+    uint8 *input = new uint8[size];
+    uint32 seed = 12345u;
+    for (uint32 i = 0u; i < size; i++) {
+        if (i < 100000u) {
+            input[i] = static_cast<uint8>("MARTe2 real-time framework "[i % 27u]);
+        }
+        else if (i < 200000u) {
+            seed = (seed * 1103515245u) + 12345u;
+            input[i] = static_cast<uint8>(seed >> 16u);
+        }
+        else {
+            float64 value = static_cast<float64>(i / 8u) * 0.001;
+            input[i] = reinterpret_cast<uint8 *>(&value)[i % 8u];
+        }
+    }
+    StreamString output;
+    DeflateEncoder test(output);
+    bool ok = true;
+    const uint32 writeSize = 1000u;
+    for (uint32 i = 0u; (i < size) && (ok); i += writeSize) {
+        ok = test.Write(reinterpret_cast<char8 *>(&input[i]), writeSize);
+    }
+    if (ok) {
+        ok = test.Finish();
+    }
+    uint8 *decompressed = new uint8[size];
+    uint32 decompressedSize = 0u;
+    if (ok) {
+        ok = Inflate(reinterpret_cast<const uint8 *>(output.Buffer()), static_cast<uint32>(output.Size()), decompressed, size, decompressedSize);
+    }
+    if (ok) {
+        ok = (decompressedSize == size);
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(decompressed, input, size) == 0);
+    }
+    if (ok) {
+        //The text and the ramp compress well, the random data expands slightly.
+        ok = (output.Size() < (size * 2u / 3u));
+    }
+    delete[] input;
+    delete[] decompressed;
+    return ok;
+}
+
+bool DeflateEncoderTest::TestWrite_False_Finished() {
+    StreamString output;
+    DeflateEncoder test(output);
+    bool ok = test.Finish();
+    if (ok) {
+        ok = !test.Write("MARTe", 5u);
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestFinish() {
+    StreamString output;
+    DeflateEncoder test(output);
+    bool ok = test.Finish();
+    if (ok) {
+        ok = (output.Size() == sizeof(deflateTestCompressedEmpty));
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Compare(output.Buffer(), &deflateTestCompressedEmpty[0], sizeof(deflateTestCompressedEmpty)) == 0;
+    }
+    uint8 decompressed[1];
+    uint32 decompressedSize = 1u;
+    if (ok) {
+        ok = Inflate(reinterpret_cast<const uint8 *>(output.Buffer()), static_cast<uint32>(output.Size()), &decompressed[0], 1u, decompressedSize);
+    }
+    if (ok) {
+        ok = (decompressedSize == 0u);
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestFinish_False_Finished() {
+    StreamString output;
+    DeflateEncoder test(output);
+    bool ok = test.Finish();
+    if (ok) {
+        ok = !test.Finish();
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestGetInputSize() {
+    StreamString output;
+    DeflateEncoder test(output);
+    bool ok = test.Write("MARTe", 5u);
+    if (ok) {
+        ok = test.Write("MARTe", 3u);
+    }
+    if (ok) {
+        ok = (test.GetInputSize() == 8ull);
+    }
+    if (ok) {
+        ok = test.Finish();
+    }
+    if (ok) {
+        ok = (test.GetInputSize() == 8ull);
+    }
+    return ok;
+}
+
+bool DeflateEncoderTest::TestGetOutputSize() {
+    StreamString output;
+    DeflateEncoder test(output);
+    const char8 * const input = "MARTe MARTe MARTe";
+    bool ok = test.Write(input, StringHelper::Length(input));
+    if (ok) {
+        ok = test.Finish();
+    }
+    if (ok) {
+        ok = (test.GetOutputSize() == sizeof(deflateTestCompressed));
+    }
+    if (ok) {
+        ok = (test.GetOutputSize() == output.Size());
+    }
+    return ok;
+}
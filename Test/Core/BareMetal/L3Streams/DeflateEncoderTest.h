@@ -0,0 +1,109 @@
+/**
+ * @file DeflateEncoderTest.h
+ * @brief Header file for class DeflateEncoderTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class DeflateEncoderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef DEFLATEENCODERTEST_H_
+#define DEFLATEENCODERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "DeflateEncoder.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the DeflateEncoder methods.
+ */
+class DeflateEncoderTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Write method against a known compressed stream.
+     */
+    bool TestWrite();
+
+    /**
+     * @brief Tests that the data written in several calls (larger than the compression window) can be decompressed.
+     */
+    bool TestWrite_Large();
+
+    /**
+     * @brief Tests that Write fails after Finish.
+     */
+    bool TestWrite_False_Finished();
+
+    /**
+     * @brief Tests the Finish method without any data.
+     */
+    bool TestFinish();
+
+    /**
+     * @brief Tests that Finish can only be called once.
+     */
+    bool TestFinish_False_Finished();
+
+    /**
+     * @brief Tests the GetInputSize method.
+     */
+    bool TestGetInputSize();
+
+    /**
+     * @brief Tests the GetOutputSize method.
+     */
+    bool TestGetOutputSize();
+
+    /**
+     * @brief Decompresses zlib data with fixed Huffman blocks (as written by the DeflateEncoder) and verifies the Adler-32.
+     * @param[in] input the compressed data.
+     * @param[in] inputSize the size of \a input.
+     * @param[out] output where to write the decompressed data.
+     * @param[in] outputCapacity the size of \a output.
+     * @param[out] outputSize the number of decompressed bytes.
+     * @return true if the data could be decompressed and the checksum matches.
+     */
+    static bool Inflate(const uint8 * const input,
+                        const uint32 inputSize,
+                        uint8 * const output,
+                        const uint32 outputCapacity,
+                        uint32 &outputSize);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* DEFLATEENCODERTEST_H_ */
@@ -0,0 +1,748 @@
+/**
+ * @file ArenaConfigurationDatabaseTest.cpp
+ * @brief Source file for class ArenaConfigurationDatabaseTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaConfigurationDatabaseTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ArenaConfigurationDatabaseTest.h"
+#include "GlobalObjectsDatabase.h"
+#include "HighResolutionTimer.h"
+#include "JsonParser.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "XMLParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Compares two databases by printing both.
+ */
+static bool CompareDatabases(ConfigurationDatabase &cdb1,
+                             ConfigurationDatabase &cdb2) {
+    StreamString str1;
+    StreamString str2;
+    bool ok = str1.Printf("%!", cdb1);
+    if (ok) {
+        ok = str2.Printf("%!", cdb2);
+    }
+    if (ok) {
+        ok = (str1 == str2);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Databases differ:\n%s\n%s", str1.Buffer(), str2.Buffer());
+    }
+    return ok;
+}
+
+/**
+ * @brief Parses \a config both into a ConfigurationDatabase and into an ArenaConfigurationDatabase, using the
+ * StandardParser (\a parserType == 0), the JsonParser (\a parserType == 1) or the XMLParser (\a parserType == 2), and compares the results.
+ */
+static bool TestParse(const char8 * const config,
+                      const uint32 parserType) {
+    ConfigurationDatabase cdb;
+    ArenaConfigurationDatabase adb;
+    uint32 n;
+    bool ok = true;
+    for (n = 0u; (n < 2u) && (ok); n++) {
+        StreamString configStream = config;
+        ok = configStream.Seek(0LLU);
+        StructuredDataI *database = &cdb;
+        if (n == 1u) {
+            database = &adb;
+        }
+        if (ok) {
+            if (parserType == 0u) {
+                StandardParser parser(configStream, *database);
+                ok = parser.Parse();
+            }
+            else if (parserType == 1u) {
+                JsonParser parser(configStream, *database);
+                ok = parser.Parse();
+            }
+            else {
+                XMLParser parser(configStream, *database);
+                ok = parser.Parse();
+            }
+        }
+    }
+    ConfigurationDatabase copy;
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = adb.Copy(copy);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = copy.MoveToRoot();
+    }
+    if (ok) {
+        ok = CompareDatabases(cdb, copy);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool ArenaConfigurationDatabaseTest::TestConstructor() {
+    ArenaConfigurationDatabase adb;
+    bool ok = (adb.GetNumberOfChildren() == 0u);
+    if (ok) {
+        ok = (adb.GetName() == NULL);
+    }
+    if (ok) {
+        ok = (adb.GetUsedSize() > 0u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_Scalar() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.Write("A", static_cast<uint32>(10u));
+    if (ok) {
+        ok = adb.Write("B", static_cast<float64>(-2.5));
+    }
+    if (ok) {
+        ok = adb.Write("C", "ArenaString");
+    }
+    if (ok) {
+        StreamString str = "AnotherString";
+        ok = adb.Write("D", str);
+    }
+    uint32 a = 0u;
+    float64 b = 0.0;
+    StreamString c;
+    StreamString d;
+    int8 aAsInt8 = 0;
+    if (ok) {
+        ok = adb.Read("A", a);
+    }
+    if (ok) {
+        ok = adb.Read("A", aAsInt8);
+    }
+    if (ok) {
+        ok = adb.Read("B", b);
+    }
+    if (ok) {
+        ok = adb.Read("C", c);
+    }
+    if (ok) {
+        ok = adb.Read("D", d);
+    }
+    if (ok) {
+        ok = (a == 10u) && (aAsInt8 == 10) && (b == -2.5) && (c == "ArenaString") && (d == "AnotherString");
+    }
+    if (ok) {
+        ok = !adb.Read("E", a);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_Vector() {
+    ArenaConfigurationDatabase adb;
+    int32 values[4] = { 1, -2, 3, -4 };
+    bool ok = adb.Write("V", values);
+    float32 valuesRead[4] = { 0.F, 0.F, 0.F, 0.F };
+    if (ok) {
+        ok = adb.Read("V", valuesRead);
+    }
+    if (ok) {
+        ok = (valuesRead[0] == 1.F) && (valuesRead[1] == -2.F) && (valuesRead[2] == 3.F) && (valuesRead[3] == -4.F);
+    }
+    if (ok) {
+        AnyType at = adb.GetType("V");
+        ok = (at.GetNumberOfElements(0u) == 4u) && (at.GetNumberOfDimensions() == 1u);
+    }
+    if (ok) {
+        StreamString strings[2] = { "A", "BB" };
+        ok = adb.Write("S", strings);
+    }
+    StreamString stringsRead[2];
+    if (ok) {
+        ok = adb.Read("S", stringsRead);
+    }
+    if (ok) {
+        ok = (stringsRead[0] == "A") && (stringsRead[1] == "BB");
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWriteRead_Matrix() {
+    ArenaConfigurationDatabase adb;
+    uint16 values[2][3] = { { 1u, 2u, 3u }, { 4u, 5u, 6u } };
+    bool ok = adb.Write("M", values);
+    uint16 valuesRead[2][3];
+    if (ok) {
+        ok = adb.Read("M", valuesRead);
+    }
+    uint32 i;
+    uint32 j;
+    for (i = 0u; (i < 2u) && (ok); i++) {
+        for (j = 0u; (j < 3u) && (ok); j++) {
+            ok = (values[i][j] == valuesRead[i][j]);
+        }
+    }
+    if (ok) {
+        AnyType at = adb.GetType("M");
+        ok = (at.GetNumberOfElements(0u) == 3u) && (at.GetNumberOfElements(1u) == 2u) && (at.GetNumberOfDimensions() == 2u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestWrite_Overwrite() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.Write("A", 1u);
+    if (ok) {
+        ok = adb.Write("B", 2u);
+    }
+    if (ok) {
+        ok = adb.Write("A", "Overwritten");
+    }
+    StreamString a;
+    if (ok) {
+        ok = adb.Read("A", a);
+    }
+    if (ok) {
+        ok = (a == "Overwritten");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 2u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetChildName(0u), "A") == 0);
+    }
+    if (ok) {
+        ok = adb.CreateRelative("N");
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        //As in the ConfigurationDatabase, a node is replaced by a leaf with the same name
+        ok = adb.Write("N", 3u);
+    }
+    if (ok) {
+        ok = !adb.MoveAbsolute("N");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 3u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestGetType() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.Write("A", static_cast<int16>(-3));
+    if (ok) {
+        AnyType at = adb.GetType("A");
+        ok = (at.GetTypeDescriptor() == SignedInteger16Bit);
+        if (ok) {
+            ok = (*static_cast<int16 *>(at.GetDataPointer()) == -3);
+        }
+    }
+    if (ok) {
+        ok = adb.CreateRelative("N");
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = adb.GetType("N").IsVoid();
+    }
+    if (ok) {
+        ok = adb.GetType("Z").IsVoid();
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCreateAbsolute() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A.B.C");
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "C") == 0);
+    }
+    if (ok) {
+        ok = adb.Write("X", 1u);
+    }
+    if (ok) {
+        ok = adb.CreateAbsolute("A.B.D");
+    }
+    if (ok) {
+        //The last node already exists
+        ok = !adb.CreateAbsolute("A.B.C");
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 2u);
+    }
+    if (ok) {
+        //Cannot create below a leaf
+        ok = !adb.CreateAbsolute("A.B.C.X.Y");
+    }
+    if (ok) {
+        ok = !adb.CreateAbsolute("");
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCreateRelative() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A");
+    if (ok) {
+        ok = adb.CreateRelative("B.C");
+    }
+    if (ok) {
+        ok = adb.MoveToAncestor(2u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "A") == 0);
+    }
+    if (ok) {
+        ok = !adb.CreateRelative("B");
+    }
+    if (ok) {
+        ok = adb.CreateRelative("B.D");
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 2u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveAbsolute() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A.B");
+    if (ok) {
+        ok = adb.Write("L", 1u);
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("A");
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "A") == 0);
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        ok = !adb.MoveAbsolute("A.B.L");
+    }
+    if (ok) {
+        ok = !adb.MoveAbsolute("A.C");
+    }
+    if (ok) {
+        //Failed moves shall not change the current node
+        ok = (StringHelper::Compare(adb.GetName(), "B") == 0);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveRelative() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A.B.C");
+    if (ok) {
+        ok = adb.MoveAbsolute("A");
+    }
+    if (ok) {
+        ok = adb.MoveRelative("B.C");
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "C") == 0);
+    }
+    if (ok) {
+        ok = !adb.MoveRelative("B");
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "C") == 0);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveToAncestor() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A.B.C");
+    if (ok) {
+        ok = adb.MoveToAncestor(1u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "B") == 0);
+    }
+    if (ok) {
+        ok = !adb.MoveToAncestor(3u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "B") == 0);
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = (adb.GetName() == NULL);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestMoveToChild() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A");
+    if (ok) {
+        ok = adb.CreateAbsolute("B");
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = adb.Write("L", 1u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetChildName(1u), "B") == 0);
+    }
+    if (ok) {
+        ok = (adb.GetChildName(3u) == NULL);
+    }
+    if (ok) {
+        ok = adb.MoveToChild(1u);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(adb.GetName(), "B") == 0);
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        //Cannot move to a leaf
+        ok = !adb.MoveToChild(2u);
+    }
+    if (ok) {
+        ok = !adb.MoveToChild(3u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestDelete() {
+    ArenaConfigurationDatabase adb;
+    bool ok = adb.CreateAbsolute("A.B");
+    if (ok) {
+        ok = adb.Write("L", 1u);
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = adb.Write("X", 2u);
+    }
+    if (ok) {
+        ok = adb.Delete("A");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 1u);
+    }
+    if (ok) {
+        ok = !adb.MoveAbsolute("A.B");
+    }
+    if (ok) {
+        ok = !adb.Delete("A");
+    }
+    if (ok) {
+        ok = adb.Delete("X");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 0u);
+    }
+    if (ok) {
+        ok = adb.CreateAbsolute("A.B");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == 0u);
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = adb.Write("X", 3u);
+    }
+    uint32 x = 0u;
+    if (ok) {
+        ok = adb.Read("X", x);
+    }
+    if (ok) {
+        ok = (x == 3u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestManyChildren() {
+    ArenaConfigurationDatabase adb(1024u);
+    const uint32 numberOfNodes = 64u;
+    const uint32 numberOfLeafs = 64u;
+    bool ok = true;
+    uint32 i;
+    uint32 j;
+    for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+        StreamString nodeName;
+        ok = nodeName.Printf("Node%d", i);
+        if (ok) {
+            ok = adb.MoveToRoot();
+        }
+        if (ok) {
+            ok = adb.CreateRelative(nodeName.Buffer());
+        }
+        for (j = 0u; (j < numberOfLeafs) && (ok); j++) {
+            StreamString leafName;
+            ok = leafName.Printf("Leaf%d", j);
+            if (ok) {
+                ok = adb.Write(leafName.Buffer(), (i * numberOfLeafs) + j);
+            }
+        }
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == numberOfNodes);
+    }
+    for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+        StreamString nodeName;
+        ok = nodeName.Printf("Node%d", i);
+        if (ok) {
+            ok = adb.MoveAbsolute(nodeName.Buffer());
+        }
+        if (ok) {
+            ok = (adb.GetNumberOfChildren() == numberOfLeafs);
+        }
+        for (j = 0u; (j < numberOfLeafs) && (ok); j++) {
+            StreamString leafName;
+            ok = leafName.Printf("Leaf%d", j);
+            uint32 value = 0u;
+            if (ok) {
+                ok = adb.Read(leafName.Buffer(), value);
+            }
+            if (ok) {
+                ok = (value == ((i * numberOfLeafs) + j));
+            }
+            if (ok) {
+                ok = (StringHelper::Compare(adb.GetChildName(j), leafName.Buffer()) == 0);
+            }
+        }
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestCopy() {
+    ArenaConfigurationDatabase adb;
+    ConfigurationDatabase cdb;
+    ConfigurationDatabase expected;
+    bool ok = adb.CreateAbsolute("A.B");
+    if (ok) {
+        ok = expected.CreateAbsolute("A.B");
+    }
+    uint32 values[3] = { 1u, 2u, 3u };
+    if (ok) {
+        ok = adb.Write("V", values);
+    }
+    if (ok) {
+        ok = expected.Write("V", values);
+    }
+    if (ok) {
+        ok = adb.MoveToAncestor(1u);
+    }
+    if (ok) {
+        ok = expected.MoveToAncestor(1u);
+    }
+    if (ok) {
+        ok = adb.Write("S", "Str");
+    }
+    if (ok) {
+        ok = expected.Write("S", "Str");
+    }
+    if (ok) {
+        ok = adb.MoveToRoot();
+    }
+    if (ok) {
+        ok = expected.MoveToRoot();
+    }
+    if (ok) {
+        ok = adb.Copy(cdb);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = CompareDatabases(expected, cdb);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestAddToCurrentNode() {
+    ArenaConfigurationDatabase adb;
+    ReferenceT<ConfigurationDatabaseNode> node(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    return !adb.AddToCurrentNode(node);
+}
+
+bool ArenaConfigurationDatabaseTest::TestPurge() {
+    ArenaConfigurationDatabase adb(1024u);
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < 200u) && (ok); i++) {
+        StreamString name;
+        ok = name.Printf("L%d", i);
+        if (ok) {
+            ok = adb.Write(name.Buffer(), i);
+        }
+    }
+    uint32 reserved = adb.GetReservedSize();
+    if (ok) {
+        adb.Purge();
+        ok = (adb.GetNumberOfChildren() == 0u);
+    }
+    if (ok) {
+        ok = (adb.GetReservedSize() < reserved);
+    }
+    if (ok) {
+        ok = !adb.MoveAbsolute("L0");
+    }
+    if (ok) {
+        ok = adb.Write("L0", 1u);
+    }
+    return ok;
+}
+
+bool ArenaConfigurationDatabaseTest::TestParse_StandardParser() {
+    const char8 * const config = ""
+            "+A = {\n"
+            "    Class = ReferenceContainer\n"
+            "    Scalar = (uint8) 2\n"
+            "    Vector = { 1 2 3 }\n"
+            "    Matrix = { { 1.5 2 } { -3 4 } }\n"
+            "    Strings = { \"a\" \"b\" }\n"
+            "    +B = {\n"
+            "        Class = ReferenceContainer\n"
+            "        Value = \"Str\"\n"
+            "    }\n"
+            "}\n"
+            "C = 3\n";
+    return TestParse(config, 0u);
+}
+
+bool ArenaConfigurationDatabaseTest::TestParse_JsonParser() {
+    const char8 * const config = ""
+            "+A: {\n"
+            "    Class: \"ReferenceContainer\",\n"
+            "    Vector: [1, 2, 3],\n"
+            "    Matrix: [[1.5, 2], [-3, 4]],\n"
+            "    +B: {\n"
+            "        Value: \"Str\"\n"
+            "    }\n"
+            "},\n"
+            "C: 3\n";
+    return TestParse(config, 1u);
+}
+
+bool ArenaConfigurationDatabaseTest::TestParse_XMLParser() {
+    const char8 * const config = ""
+            "<+A>\n"
+            "    <Class>ReferenceContainer</Class>\n"
+            "    <Vector>{1 2 3}</Vector>\n"
+            "    <Matrix>{{1.5 2}{-3 4}}</Matrix>\n"
+            "    <+B>\n"
+            "        <Value>\"Str\"</Value>\n"
+            "    </+B>\n"
+            "</+A>\n"
+            "<C>3</C>\n";
+    return TestParse(config, 2u);
+}
+
+bool ArenaConfigurationDatabaseTest::TestParse_Large() {
+    StreamString config;
+    const uint32 numberOfSignals = 2000u;
+    bool ok = config.Printf("%s", "+DataSource = {\n    Class = ReferenceContainer\n    Signals = {\n");
+    uint32 i;
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        ok = config.Printf("        Signal%d = { Type = uint32 NumberOfElements = %d Default = { 1 2 3 } Frequency = 1000.5 }\n", i, i);
+    }
+    if (ok) {
+        ok = config.Printf("%s", "    }\n}\n");
+    }
+    ConfigurationDatabase cdb;
+    ArenaConfigurationDatabase adb;
+    uint64 cdbTicks = 0u;
+    uint64 adbTicks = 0u;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+        cdbTicks = HighResolutionTimer::Counter() - start;
+    }
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        StandardParser parser(config, adb);
+        ok = parser.Parse();
+        adbTicks = HighResolutionTimer::Counter() - start;
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("+DataSource.Signals");
+    }
+    if (ok) {
+        ok = (adb.GetNumberOfChildren() == numberOfSignals);
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("+DataSource.Signals.Signal1999");
+    }
+    uint32 numberOfElements = 0u;
+    if (ok) {
+        ok = adb.Read("NumberOfElements", numberOfElements);
+    }
+    if (ok) {
+        ok = (numberOfElements == 1999u);
+    }
+    if (ok) {
+        float64 cdbTime = static_cast<float64>(cdbTicks) * HighResolutionTimer::Period();
+        float64 adbTime = static_cast<float64>(adbTicks) * HighResolutionTimer::Period();
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Parsed %d bytes: ConfigurationDatabase %f s, ArenaConfigurationDatabase %f s (%d bytes used)",
+                            static_cast<uint32>(config.Size()), cdbTime, adbTime, adb.GetUsedSize());
+    }
+    return ok;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file ArenaConfigurationDatabaseTest.h
+ * @brief Header file for class ArenaConfigurationDatabaseTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ArenaConfigurationDatabaseTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L4CONFIGURATION_ARENACONFIGURATIONDATABASETEST_H_
+#define TEST_CORE_BAREMETAL_L4CONFIGURATION_ARENACONFIGURATIONDATABASETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ArenaConfigurationDatabase.h"
+#include "ConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the ArenaConfigurationDatabase public methods.
+ */
+class ArenaConfigurationDatabaseTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Write and Read methods with scalars and strings.
+     */
+    bool TestWriteRead_Scalar();
+
+    /**
+     * @brief Tests the Write and Read methods with vectors.
+     */
+    bool TestWriteRead_Vector();
+
+    /**
+     * @brief Tests the Write and Read methods with matrices.
+     */
+    bool TestWriteRead_Matrix();
+
+    /**
+     * @brief Tests that Write overwrites an existing leaf and keeps its position.
+     */
+    bool TestWrite_Overwrite();
+
+    /**
+     * @brief Tests the GetType method.
+     */
+    bool TestGetType();
+
+    /**
+     * @brief Tests the CreateAbsolute method.
+     */
+    bool TestCreateAbsolute();
+
+    /**
+     * @brief Tests the CreateRelative method.
+     */
+    bool TestCreateRelative();
+
+    /**
+     * @brief Tests the MoveAbsolute method.
+     */
+    bool TestMoveAbsolute();
+
+    /**
+     * @brief Tests the MoveRelative method.
+     */
+    bool TestMoveRelative();
+
+    /**
+     * @brief Tests the MoveToAncestor and MoveToRoot methods.
+     */
+    bool TestMoveToAncestor();
+
+    /**
+     * @brief Tests the MoveToChild and GetChildName methods.
+     */
+    bool TestMoveToChild();
+
+    /**
+     * @brief Tests the Delete method, including the re-creation of deleted nodes.
+     */
+    bool TestDelete();
+
+    /**
+     * @brief Tests a database with many nodes and many children per node.
+     */
+    bool TestManyChildren();
+
+    /**
+     * @brief Tests the Copy method.
+     */
+    bool TestCopy();
+
+    /**
+     * @brief Tests that AddToCurrentNode is not supported.
+     */
+    bool TestAddToCurrentNode();
+
+    /**
+     * @brief Tests that Purge removes all the nodes and releases the memory.
+     */
+    bool TestPurge();
+
+    /**
+     * @brief Tests that the StandardParser output is the same as the one of a ConfigurationDatabase.
+     */
+    bool TestParse_StandardParser();
+
+    /**
+     * @brief Tests that the JsonParser output is the same as the one of a ConfigurationDatabase.
+     */
+    bool TestParse_JsonParser();
+
+    /**
+     * @brief Tests that the XMLParser output is the same as the one of a ConfigurationDatabase.
+     */
+    bool TestParse_XMLParser();
+
+    /**
+     * @brief Tests the parsing of a large configuration and reports the time and memory with respect to a ConfigurationDatabase.
+     */
+    bool TestParse_Large();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L4CONFIGURATION_ARENACONFIGURATIONDATABASETEST_H_ */
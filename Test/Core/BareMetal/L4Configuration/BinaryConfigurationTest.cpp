@@ -0,0 +1,519 @@
+/**
+ * @file BinaryConfigurationTest.cpp
+ * @brief Source file for class BinaryConfigurationTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryConfigurationTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BinaryConfigurationTest.h"
+#include "ArenaConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Exports the root of \a source and imports it into \a destination.
+ */
+static bool ExportImport(ConfigurationDatabase &source,
+                         ConfigurationDatabase &destination) {
+    StreamString binary;
+    bool ok = source.MoveToRoot();
+    if (ok) {
+        ok = BinaryConfiguration::Export(source, binary);
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    if (ok) {
+        ok = BinaryConfiguration::Import(binary, destination);
+    }
+    if (ok) {
+        ok = destination.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * @brief Exports a small database with a node A.
+ */
+static bool CreateBinary(StreamString &binary) {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("A");
+    if (ok) {
+        ok = cdb.Write("X", 1u);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = BinaryConfiguration::Export(cdb, binary);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool BinaryConfigurationTest::TestExportImport_Scalars() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("U8", static_cast<uint8>(250u));
+    if (ok) {
+        ok = cdb.Write("I64", static_cast<int64>(-1234567890123LL));
+    }
+    if (ok) {
+        ok = cdb.Write("F32", static_cast<float32>(1.5F));
+    }
+    if (ok) {
+        ok = cdb.Write("F64", static_cast<float64>(-0.125));
+    }
+    if (ok) {
+        ok = cdb.Write("S", "String");
+    }
+    if (ok) {
+        ok = cdb.Write("Empty", "");
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = ExportImport(cdb, result);
+    }
+    if (ok) {
+        ok = (result.GetType("U8").GetTypeDescriptor() == UnsignedInteger8Bit);
+    }
+    if (ok) {
+        ok = (result.GetType("I64").GetTypeDescriptor() == SignedInteger64Bit);
+    }
+    if (ok) {
+        ok = (result.GetType("F32").GetTypeDescriptor() == Float32Bit);
+    }
+    if (ok) {
+        ok = (result.GetType("F64").GetTypeDescriptor() == Float64Bit);
+    }
+    uint8 u8 = 0u;
+    int64 i64 = 0;
+    float32 f32 = 0.F;
+    float64 f64 = 0.0;
+    StreamString s;
+    StreamString empty;
+    if (ok) {
+        ok = result.Read("U8", u8) && result.Read("I64", i64) && result.Read("F32", f32) && result.Read("F64", f64);
+    }
+    if (ok) {
+        ok = result.Read("S", s) && result.Read("Empty", empty);
+    }
+    if (ok) {
+        ok = (u8 == 250u) && (i64 == -1234567890123LL) && (f32 == 1.5F) && (f64 == -0.125) && (s == "String") && (empty.Size() == 0u);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestExportImport_Vectors() {
+    ConfigurationDatabase cdb;
+    int16 values[5] = { -1, 2, -3, 4, -5 };
+    StreamString strings[3] = { "A", "", "CCC" };
+    bool ok = cdb.Write("V", values);
+    if (ok) {
+        ok = cdb.Write("S", strings);
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = ExportImport(cdb, result);
+    }
+    if (ok) {
+        AnyType at = result.GetType("V");
+        ok = (at.GetTypeDescriptor() == SignedInteger16Bit) && (at.GetNumberOfDimensions() == 1u) && (at.GetNumberOfElements(0u) == 5u);
+    }
+    int16 valuesRead[5];
+    StreamString stringsRead[3];
+    if (ok) {
+        ok = result.Read("V", valuesRead);
+    }
+    for (uint32 i = 0u; (i < 5u) && (ok); i++) {
+        ok = (values[i] == valuesRead[i]);
+    }
+    if (ok) {
+        AnyType at = result.GetType("S");
+        ok = (at.GetNumberOfDimensions() == 1u) && (at.GetNumberOfElements(0u) == 3u);
+    }
+    if (ok) {
+        ok = result.Read("S", stringsRead);
+    }
+    for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+        ok = (strings[i] == stringsRead[i]);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestExportImport_Matrices() {
+    ConfigurationDatabase cdb;
+    float32 values[2][3] = { { 1.F, 2.F, 3.F }, { -4.F, -5.F, -6.5F } };
+    StreamString strings[3][2] = { { "a", "b" }, { "c", "d" }, { "e", "ff" } };
+    bool ok = cdb.Write("M", values);
+    if (ok) {
+        ok = cdb.Write("S", strings);
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = ExportImport(cdb, result);
+    }
+    if (ok) {
+        AnyType at = result.GetType("M");
+        ok = (at.GetTypeDescriptor() == Float32Bit) && (at.GetNumberOfDimensions() == 2u);
+        if (ok) {
+            ok = (at.GetNumberOfElements(0u) == 3u) && (at.GetNumberOfElements(1u) == 2u);
+        }
+    }
+    float32 valuesRead[2][3];
+    StreamString stringsRead[3][2];
+    if (ok) {
+        ok = result.Read("M", valuesRead);
+    }
+    for (uint32 r = 0u; (r < 2u) && (ok); r++) {
+        for (uint32 c = 0u; (c < 3u) && (ok); c++) {
+            ok = (values[r][c] == valuesRead[r][c]);
+        }
+    }
+    if (ok) {
+        ok = result.Read("S", stringsRead);
+    }
+    for (uint32 r = 0u; (r < 3u) && (ok); r++) {
+        for (uint32 c = 0u; (c < 2u) && (ok); c++) {
+            ok = (strings[r][c] == stringsRead[r][c]);
+        }
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestExportImport_Configuration() {
+    const char8 * const config = ""
+            "+A = {\n"
+            "    Class = ReferenceContainer\n"
+            "    Scalar = (uint8) 2\n"
+            "    Vector = { 1 2 3 }\n"
+            "    Matrix = { { 1.5 2 } { -3 4 } }\n"
+            "    Strings = { \"a\" \"b\" }\n"
+            "    +B = {\n"
+            "        Class = ReferenceContainer\n"
+            "        Value = \"Str\"\n"
+            "        C = {\n"
+            "            D = {\n"
+            "                E = -1\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "}\n"
+            "F = 3\n";
+    StreamString configStream = config;
+    ConfigurationDatabase cdb;
+    bool ok = configStream.Seek(0LLU);
+    if (ok) {
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = ExportImport(cdb, result);
+    }
+    StreamString expected;
+    StreamString obtained;
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = expected.Printf("%!", cdb);
+    }
+    if (ok) {
+        ok = obtained.Printf("%!", result);
+    }
+    if (ok) {
+        ok = (expected == obtained);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestExportImport_Empty() {
+    ConfigurationDatabase cdb;
+    ConfigurationDatabase result;
+    bool ok = ExportImport(cdb, result);
+    if (ok) {
+        ok = (result.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestExportImport_CurrentNode() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.CreateAbsolute("A.B");
+    if (ok) {
+        ok = cdb.Write("X", 1u);
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute("C");
+    }
+    if (ok) {
+        ok = cdb.Write("Y", 2u);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("A");
+    }
+    StreamString binary;
+    if (ok) {
+        ok = BinaryConfiguration::Export(cdb, binary);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(cdb.GetName(), "A") == 0);
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = result.CreateAbsolute("Z");
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    if (ok) {
+        ok = BinaryConfiguration::Import(binary, result);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(result.GetName(), "Z") == 0);
+    }
+    uint32 x = 0u;
+    if (ok) {
+        ok = result.MoveAbsolute("Z.B");
+    }
+    if (ok) {
+        ok = result.Read("X", x);
+    }
+    if (ok) {
+        ok = (x == 1u);
+    }
+    if (ok) {
+        ok = !result.MoveAbsolute("Z.C");
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestExportImport_ArenaConfigurationDatabase() {
+    ConfigurationDatabase cdb;
+    uint32 values[2] = { 3u, 4u };
+    bool ok = cdb.CreateAbsolute("A");
+    if (ok) {
+        ok = cdb.Write("V", values);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    StreamString binary;
+    if (ok) {
+        ok = BinaryConfiguration::Export(cdb, binary);
+    }
+    ArenaConfigurationDatabase adb;
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    if (ok) {
+        ok = BinaryConfiguration::Import(binary, adb);
+    }
+    if (ok) {
+        ok = adb.MoveAbsolute("A");
+    }
+    uint32 valuesRead[2] = { 0u, 0u };
+    if (ok) {
+        ok = adb.Read("V", valuesRead);
+    }
+    if (ok) {
+        ok = (valuesRead[0] == 3u) && (valuesRead[1] == 4u);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestImport_False_Text() {
+    StreamString config = "+A = { Class = ReferenceContainer }";
+    ConfigurationDatabase result;
+    StreamString err;
+    bool ok = config.Seek(0LLU);
+    if (ok) {
+        ok = !BinaryConfiguration::Import(config, result, &err);
+    }
+    if (ok) {
+        ok = (err.Size() > 0u);
+    }
+    if (ok) {
+        ok = (result.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestImport_False_Truncated() {
+    StreamString binary;
+    bool ok = CreateBinary(binary);
+    StreamString truncated;
+    if (ok) {
+        uint32 size = static_cast<uint32>(binary.Size()) - 1u;
+        ok = truncated.Write(binary.Buffer(), size);
+    }
+    if (ok) {
+        ok = truncated.Seek(0LLU);
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = !BinaryConfiguration::Import(truncated, result);
+    }
+    if (ok) {
+        ok = (result.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestImport_False_CRC() {
+    StreamString binary;
+    bool ok = CreateBinary(binary);
+    if (ok) {
+        //Corrupt the last byte of the payload
+        ok = binary.Seek(binary.Size() - 1LLU);
+    }
+    if (ok) {
+        const char8 corrupted = 'x';
+        uint32 size = 1u;
+        ok = binary.Write(&corrupted, size);
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = !BinaryConfiguration::Import(binary, result);
+    }
+    if (ok) {
+        ok = (result.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestImport_False_Version() {
+    StreamString binary;
+    bool ok = CreateBinary(binary);
+    if (ok) {
+        ok = binary.Seek(sizeof(uint32));
+    }
+    if (ok) {
+        uint32 version = BinaryConfiguration::VERSION + 1u;
+        uint32 size = static_cast<uint32>(sizeof(uint32));
+        ok = binary.Write(reinterpret_cast<const char8 *>(&version), size);
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = !BinaryConfiguration::Import(binary, result);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestImport_False_ExistingNode() {
+    StreamString binary;
+    bool ok = CreateBinary(binary);
+    ConfigurationDatabase result;
+    if (ok) {
+        ok = result.CreateAbsolute("A");
+    }
+    if (ok) {
+        ok = result.MoveToRoot();
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    if (ok) {
+        ok = !BinaryConfiguration::Import(binary, result);
+    }
+    if (ok) {
+        //The current node shall be restored
+        ok = (result.GetName() == NULL);
+    }
+    return ok;
+}
+
+bool BinaryConfigurationTest::TestImport_Large() {
+    StreamString config;
+    const uint32 numberOfSignals = 2000u;
+    bool ok = config.Printf("%s", "+DataSource = {\n    Class = ReferenceContainer\n    Signals = {\n");
+    for (uint32 i = 0u; (i < numberOfSignals) && (ok); i++) {
+        ok = config.Printf("        Signal%d = { Type = uint32 NumberOfElements = %d Default = { 1 2 3 } Frequency = 1000.5 }\n", i, i);
+    }
+    if (ok) {
+        ok = config.Printf("%s", "    }\n}\n");
+    }
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    ConfigurationDatabase parsed;
+    uint64 parseTicks = 0u;
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        StandardParser parser(config, parsed);
+        ok = parser.Parse();
+        parseTicks = HighResolutionTimer::Counter() - start;
+    }
+    StreamString binary;
+    if (ok) {
+        ok = parsed.MoveToRoot();
+    }
+    if (ok) {
+        ok = BinaryConfiguration::Export(parsed, binary);
+    }
+    if (ok) {
+        ok = binary.Seek(0LLU);
+    }
+    ConfigurationDatabase imported;
+    uint64 importTicks = 0u;
+    if (ok) {
+        uint64 start = HighResolutionTimer::Counter();
+        ok = BinaryConfiguration::Import(binary, imported);
+        importTicks = HighResolutionTimer::Counter() - start;
+    }
+    if (ok) {
+        ok = imported.MoveAbsolute("+DataSource.Signals.Signal1999");
+    }
+    uint32 numberOfElements = 0u;
+    if (ok) {
+        ok = imported.Read("NumberOfElements", numberOfElements);
+    }
+    if (ok) {
+        ok = (numberOfElements == 1999u);
+    }
+    if (ok) {
+        float64 parseTime = static_cast<float64>(parseTicks) * HighResolutionTimer::Period();
+        float64 importTime = static_cast<float64>(importTicks) * HighResolutionTimer::Period();
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "StandardParser: %d bytes in %f s. BinaryConfiguration::Import: %d bytes in %f s",
+                            static_cast<uint32>(config.Size()), parseTime, static_cast<uint32>(binary.Size()), importTime);
+    }
+    return ok;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file BinaryConfigurationTest.h
+ * @brief Header file for class BinaryConfigurationTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BinaryConfigurationTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L4CONFIGURATION_BINARYCONFIGURATIONTEST_H_
+#define TEST_CORE_BAREMETAL_L4CONFIGURATION_BINARYCONFIGURATIONTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BinaryConfiguration.h"
+#include "ConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the BinaryConfiguration functions.
+ */
+class BinaryConfigurationTest {
+public:
+
+    /**
+     * @brief Tests that Export and Import preserve the type of scalar leafs.
+     */
+    bool TestExportImport_Scalars();
+
+    /**
+     * @brief Tests that Export and Import preserve numeric and string vectors.
+     */
+    bool TestExportImport_Vectors();
+
+    /**
+     * @brief Tests that Export and Import preserve numeric and string matrices.
+     */
+    bool TestExportImport_Matrices();
+
+    /**
+     * @brief Tests that a parsed configuration is the same after Export and Import.
+     */
+    bool TestExportImport_Configuration();
+
+    /**
+     * @brief Tests the Export and Import of an empty database.
+     */
+    bool TestExportImport_Empty();
+
+    /**
+     * @brief Tests that Export serialises the current node and that Import writes into the current node and restores it.
+     */
+    bool TestExportImport_CurrentNode();
+
+    /**
+     * @brief Tests the Import into an ArenaConfigurationDatabase.
+     */
+    bool TestExportImport_ArenaConfigurationDatabase();
+
+    /**
+     * @brief Tests that Import fails with a textual configuration.
+     */
+    bool TestImport_False_Text();
+
+    /**
+     * @brief Tests that Import fails with a truncated binary configuration.
+     */
+    bool TestImport_False_Truncated();
+
+    /**
+     * @brief Tests that Import fails if the payload is corrupted.
+     */
+    bool TestImport_False_CRC();
+
+    /**
+     * @brief Tests that Import fails if the version is not supported.
+     */
+    bool TestImport_False_Version();
+
+    /**
+     * @brief Tests that Import fails if a node already exists in the destination.
+     */
+    bool TestImport_False_ExistingNode();
+
+    /**
+     * @brief Tests the Import of a large configuration and reports the time with respect to the StandardParser.
+     */
+    bool TestImport_Large();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L4CONFIGURATION_BINARYCONFIGURATIONTEST_H_ */
@@ -25,11 +25,13 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <math.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "HighResolutionTimer.h"
 #include "RuntimeEvaluatorTest.h"
 
 /*---------------------------------------------------------------------------*/
@@ -979,6 +981,651 @@ bool RuntimeEvaluatorTest::TestCompile(RuntimeEvaluator &evaluator, ErrorManagem
     return ok;
 }
 
+bool RuntimeEvaluatorTest::TestExecute_ThreadedMode_ConstantFolding() {
+
+    CCString rpnCode = "CONST int8 3\n"
+                       "CAST float64\n"
+                       "CAST float32\n"
+                       "READ A\n"
+                       "ADD\n"
+                       "WRITE F\n"
+    ;
+
+    RuntimeEvaluator evaluator(rpnCode);
+    float32 A = 1.5F;
+    float32 F = 0.F;
+
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetInputVariableType("A", Float32Bit);
+    }
+    if (ok) {
+        ok = evaluator.SetInputVariableMemory("A", &A);
+    }
+    if (ok) {
+        ok = evaluator.SetOutputVariableType("F", Float32Bit);
+    }
+    if (ok) {
+        ok = evaluator.SetOutputVariableMemory("F", &F);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    // CONST + 2 CAST folded in a single load
+    if (ok) {
+        ok = (evaluator.GetThreadedCodeSize() == 4u);
+    }
+    if (ok) {
+        ok = (evaluator.Execute(RuntimeEvaluator::fastMode) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (F == 4.5F);
+    }
+    if (ok) {
+        F = 0.F;
+        A = 2.5F;
+        ok = (evaluator.Execute(RuntimeEvaluator::threadedMode) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (F == 5.5F);
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecute_ThreadedMode_ConstantCastOutOfRange() {
+
+    CCString rpnCode = "CONST float64 1000\n"
+                       "CAST uint8\n"
+                       "WRITE F\n"
+    ;
+
+    RuntimeEvaluator evaluator(rpnCode);
+    uint8 F = 0u;
+
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetOutputVariableType("F", UnsignedInteger8Bit);
+    }
+    if (ok) {
+        ok = evaluator.SetOutputVariableMemory("F", &F);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    // the CAST is left to runtime
+    if (ok) {
+        ok = (evaluator.GetThreadedCodeSize() == 3u);
+    }
+    ErrorManagement::ErrorType fastRet;
+    ErrorManagement::ErrorType threadedRet;
+    uint8 fastF = 0u;
+    if (ok) {
+        fastRet = evaluator.Execute(RuntimeEvaluator::fastMode);
+        fastF = F;
+        F = 0u;
+        threadedRet = evaluator.Execute(RuntimeEvaluator::threadedMode);
+        ok = (fastRet.outOfRange);
+    }
+    if (ok) {
+        ok = (threadedRet == fastRet);
+    }
+    if (ok) {
+        ok = (F == fastF);
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecute_ThreadedMode_ConversionWrite() {
+
+    CCString rpnCode = "READ A\n"
+                       "WRITE B\n"
+                       "READ A\n"
+                       "WRITE C\n"
+    ;
+
+    RuntimeEvaluator evaluator(rpnCode);
+    int32 A = 200;
+    uint8 C = 0u;
+
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetInputVariableType("A", SignedInteger32Bit);
+    }
+    if (ok) {
+        ok = evaluator.SetInputVariableMemory("A", &A);
+    }
+    if (ok) {
+        ok = evaluator.SetOutputVariableType("B", UnsignedInteger8Bit);
+    }
+    if (ok) {
+        ok = evaluator.SetOutputVariableType("C", UnsignedInteger8Bit);
+    }
+    if (ok) {
+        ok = evaluator.SetOutputVariableMemory("C", &C);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    uint8 *B = NULL_PTR(uint8 *);
+    if (ok) {
+        B = static_cast<uint8 *>(evaluator.GetOutputVariableMemory("B"));
+        ok = (B != NULL_PTR(uint8 *));
+    }
+    if (ok) {
+        ok = (evaluator.Execute(RuntimeEvaluator::threadedMode) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = ((*B == 200u) && (C == 200u));
+    }
+    if (ok) {
+        A = 300;
+        ErrorManagement::ErrorType threadedRet = evaluator.Execute(RuntimeEvaluator::threadedMode);
+        uint8 threadedB = *B;
+        uint8 threadedC = C;
+        ErrorManagement::ErrorType fastRet = evaluator.Execute(RuntimeEvaluator::fastMode);
+        ok = (threadedRet.outOfRange);
+        if (ok) {
+            ok = (threadedRet == fastRet);
+        }
+        if (ok) {
+            ok = ((threadedB == *B) && (threadedC == C));
+        }
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecute_ThreadedMode_NotCompiled() {
+    RuntimeEvaluator evaluator("READ A\nWRITE B\n");
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ErrorManagement::ErrorType ret = evaluator.Execute(RuntimeEvaluator::threadedMode);
+        ok = (ret.internalSetupError);
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecute_ThreadedMode_Benchmark() {
+
+    CCString rpnCode = "READ x\n"
+                       "CONST float64 2\n"
+                       "MUL\n"
+                       "READ y\n"
+                       "ADD\n"
+                       "CONST int32 3\n"
+                       "CAST float64\n"
+                       "DIV\n"
+                       "WRITE t\n"
+                       "READ t\n"
+                       "READ t\n"
+                       "MUL\n"
+                       "READ k\n"
+                       "CAST float64\n"
+                       "SUB\n"
+                       "WRITE z\n"
+                       "READ k\n"
+                       "CONST int32 1\n"
+                       "ADD\n"
+                       "WRITE n\n"
+    ;
+
+    const uint32 numberOfExecutions = 100000u;
+    float64 x = 1.25;
+    float64 y = -7.5;
+    int32 k = 4;
+    float64 z[2] = { 0., 0. };
+    int32 n[2] = { 0, 0 };
+    uint64 ticks[2] = { 0u, 0u };
+    RuntimeEvaluator::executionMode modes[2] = { RuntimeEvaluator::fastMode, RuntimeEvaluator::threadedMode };
+
+    bool ok = true;
+    for (uint32 m = 0u; (m < 2u) && (ok); m++) {
+        RuntimeEvaluator evaluator(rpnCode);
+        ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+        if (ok) {
+            ok = evaluator.SetInputVariableType("x", Float64Bit);
+            ok &= evaluator.SetInputVariableMemory("x", &x);
+            ok &= evaluator.SetInputVariableType("y", Float64Bit);
+            ok &= evaluator.SetInputVariableMemory("y", &y);
+            ok &= evaluator.SetInputVariableType("k", SignedInteger32Bit);
+            ok &= evaluator.SetInputVariableMemory("k", &k);
+            ok &= evaluator.SetOutputVariableType("z", Float64Bit);
+            ok &= evaluator.SetOutputVariableMemory("z", &z[m]);
+            ok &= evaluator.SetOutputVariableType("n", SignedInteger32Bit);
+            ok &= evaluator.SetOutputVariableMemory("n", &n[m]);
+        }
+        if (ok) {
+            ok = (evaluator.Compile() == ErrorManagement::NoError);
+        }
+        uint64 start = HighResolutionTimer::Counter();
+        for (uint32 i = 0u; (i < numberOfExecutions) && (ok); i++) {
+            ok = (evaluator.Execute(modes[m]) == ErrorManagement::NoError);
+        }
+        ticks[m] = HighResolutionTimer::Counter() - start;
+    }
+    if (ok) {
+        ok = ((z[0] == z[1]) && (n[0] == n[1]) && (n[0] == 5));
+    }
+    if (ok) {
+        float64 fastTime = HighResolutionTimer::TicksToTime(ticks[0], 0u) * 1e9 / static_cast<float64>(numberOfExecutions);
+        float64 threadedTime = HighResolutionTimer::TicksToTime(ticks[1], 0u) * 1e9 / static_cast<float64>(numberOfExecutions);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "RuntimeEvaluator benchmark: fastMode %f ns threadedMode %f ns per execution", fastTime, threadedTime);
+    }
+    return ok;
+}
+
+static const uint32 batchTestSamples = 8u;
+
+/**
+ * Code used by the batch tests over arrays. x, y and z are float64, k and n int32 and a, b and f float32.
+ */
+static const char8 * const batchTestCode = "READ x\n"
+                                           "CONST float64 2\n"
+                                           "MUL\n"
+                                           "READ y\n"
+                                           "ADD\n"
+                                           "WRITE t\n"
+                                           "READ t\n"
+                                           "READ t\n"
+                                           "MUL\n"
+                                           "READ k\n"
+                                           "CAST float64\n"
+                                           "SUB\n"
+                                           "CONST float64 4\n"
+                                           "DIV\n"
+                                           "WRITE z\n"
+                                           "READ k\n"
+                                           "CONST int32 1\n"
+                                           "ADD\n"
+                                           "READ k\n"
+                                           "MUL\n"
+                                           "READ k\n"
+                                           "SUB\n"
+                                           "WRITE n\n"
+                                           "READ a\n"
+                                           "READ b\n"
+                                           "SUB\n"
+                                           "READ a\n"
+                                           "DIV\n"
+                                           "READ b\n"
+                                           "MUL\n"
+                                           "READ a\n"
+                                           "ADD\n"
+                                           "WRITE f\n";
+
+/**
+ * Sets the types and memory of the variables of batchTestCode and compiles it.
+ */
+static bool CompileBatchTestCode(RuntimeEvaluator &evaluator, float64 *x, float64 *y, int32 *k, float32 *a, float32 *b, float64 *z, int32 *n, float32 *f) {
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetInputVariableType("x", Float64Bit);
+        ok &= evaluator.SetInputVariableMemory("x", x);
+        ok &= evaluator.SetInputVariableType("y", Float64Bit);
+        ok &= evaluator.SetInputVariableMemory("y", y);
+        ok &= evaluator.SetInputVariableType("k", SignedInteger32Bit);
+        ok &= evaluator.SetInputVariableMemory("k", k);
+        ok &= evaluator.SetInputVariableType("a", Float32Bit);
+        ok &= evaluator.SetInputVariableMemory("a", a);
+        ok &= evaluator.SetInputVariableType("b", Float32Bit);
+        ok &= evaluator.SetInputVariableMemory("b", b);
+        ok &= evaluator.SetOutputVariableType("t", Float64Bit);
+        ok &= evaluator.SetOutputVariableType("z", Float64Bit);
+        ok &= evaluator.SetOutputVariableMemory("z", z);
+        ok &= evaluator.SetOutputVariableType("n", SignedInteger32Bit);
+        ok &= evaluator.SetOutputVariableMemory("n", n);
+        ok &= evaluator.SetOutputVariableType("f", Float32Bit);
+        ok &= evaluator.SetOutputVariableMemory("f", f);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_Arrays() {
+    float64 x[batchTestSamples];
+    float64 y[batchTestSamples];
+    int32 k[batchTestSamples];
+    float32 a[batchTestSamples];
+    float32 b[batchTestSamples];
+    float64 z[batchTestSamples];
+    int32 n[batchTestSamples];
+    float32 f[batchTestSamples];
+    for (uint32 i = 0u; i < batchTestSamples; i++) {
+        x[i] = 0.125 * static_cast<float64>(i);
+        y[i] = -3.0 + static_cast<float64>(i * i);
+        k[i] = static_cast<int32>(i) - 4;
+        a[i] = 1.5F + static_cast<float32>(i);
+        b[i] = 0.25F * static_cast<float32>(i);
+        z[i] = 0.;
+        n[i] = 0;
+        f[i] = 0.F;
+    }
+
+    RuntimeEvaluator batchEvaluator(batchTestCode);
+    bool ok = CompileBatchTestCode(batchEvaluator, &x[0], &y[0], &k[0], &a[0], &b[0], &z[0], &n[0], &f[0]);
+    if (ok) {
+        ok = (batchEvaluator.CompileBatch(batchTestSamples) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (batchEvaluator.GetNumberOfSamples() == batchTestSamples);
+    }
+    if (ok) {
+        // float64 MUL ADD MUL SUB DIV, int32 ADD MUL SUB and float32 SUB DIV MUL ADD
+        ok = (batchEvaluator.GetNumberOfVectorInstructions() == 12u);
+    }
+    if (ok) {
+        ok = (batchEvaluator.ExecuteBatch() == ErrorManagement::NoError);
+    }
+
+    float64 xs = 0.;
+    float64 ys = 0.;
+    int32 ks = 0;
+    float32 as = 0.F;
+    float32 bs = 0.F;
+    float64 zs = 0.;
+    int32 ns = 0;
+    float32 fs = 0.F;
+    RuntimeEvaluator evaluator(batchTestCode);
+    if (ok) {
+        ok = CompileBatchTestCode(evaluator, &xs, &ys, &ks, &as, &bs, &zs, &ns, &fs);
+    }
+    for (uint32 i = 0u; (i < batchTestSamples) && (ok); i++) {
+        xs = x[i];
+        ys = y[i];
+        ks = k[i];
+        as = a[i];
+        bs = b[i];
+        ok = (evaluator.Execute(RuntimeEvaluator::fastMode) == ErrorManagement::NoError);
+        if (ok) {
+            ok = ((zs == z[i]) && (ns == n[i]) && (fs == f[i]));
+        }
+    }
+    if (ok) {
+        // the inputs are changed and the code executed again
+        for (uint32 i = 0u; i < batchTestSamples; i++) {
+            k[i] = static_cast<int32>(i) * 3;
+        }
+        ok = (batchEvaluator.ExecuteBatch() == ErrorManagement::NoError);
+        if (ok) {
+            ks = k[batchTestSamples - 1u];
+            xs = x[batchTestSamples - 1u];
+            ys = y[batchTestSamples - 1u];
+            ok = (evaluator.Execute(RuntimeEvaluator::fastMode) == ErrorManagement::NoError);
+        }
+        if (ok) {
+            ok = ((zs == z[batchTestSamples - 1u]) && (ns == n[batchTestSamples - 1u]));
+        }
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_Broadcast() {
+    CCString rpnCode = "READ x\n"
+                       "READ g\n"
+                       "MUL\n"
+                       "CONST float64 1.5\n"
+                       "ADD\n"
+                       "WRITE z\n"
+                       "READ h\n"
+                       "WRITE m\n"
+    ;
+
+    float64 x[batchTestSamples];
+    float64 z[batchTestSamples];
+    int16 m[batchTestSamples];
+    for (uint32 i = 0u; i < batchTestSamples; i++) {
+        x[i] = static_cast<float64>(i);
+        z[i] = 0.;
+        m[i] = 0;
+    }
+    RuntimeEvaluator evaluator(rpnCode);
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetInputVariableType("x", Float64Bit);
+        ok &= evaluator.SetInputVariableMemory("x", &x[0]);
+        ok &= evaluator.SetInputVariableType("g", Float64Bit);
+        ok &= evaluator.SetInputVariableType("h", SignedInteger16Bit);
+        ok &= evaluator.SetOutputVariableType("z", Float64Bit);
+        ok &= evaluator.SetOutputVariableMemory("z", &z[0]);
+        ok &= evaluator.SetOutputVariableType("m", SignedInteger16Bit);
+        ok &= evaluator.SetOutputVariableMemory("m", &m[0]);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    float64 *g = NULL_PTR(float64 *);
+    int16 *h = NULL_PTR(int16 *);
+    if (ok) {
+        g = static_cast<float64 *>(evaluator.GetInputVariableMemory("g"));
+        h = static_cast<int16 *>(evaluator.GetInputVariableMemory("h"));
+        ok = ((g != NULL_PTR(float64 *)) && (h != NULL_PTR(int16 *)));
+    }
+    if (ok) {
+        *g = 2.0;
+        *h = -5;
+        ok = (evaluator.CompileBatch(batchTestSamples) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (evaluator.ExecuteBatch() == ErrorManagement::NoError);
+    }
+    for (uint32 i = 0u; (i < batchTestSamples) && (ok); i++) {
+        ok = ((z[i] == ((static_cast<float64>(i) * 2.0) + 1.5)) && (m[i] == -5));
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_GenericFunctions() {
+    CCString rpnCode = "READ x\n"
+                       "SIN\n"
+                       "WRITE s\n"
+                       "READ A\n"
+                       "WRITE B\n"
+                       "READ B\n"
+                       "WRITE C\n"
+    ;
+
+    float64 x[batchTestSamples];
+    float64 s[batchTestSamples];
+    int32 A[batchTestSamples];
+    uint8 C[batchTestSamples];
+    for (uint32 i = 0u; i < batchTestSamples; i++) {
+        x[i] = 0.3 * static_cast<float64>(i);
+        s[i] = 0.;
+        A[i] = static_cast<int32>(i) * 10;
+        C[i] = 0u;
+    }
+    RuntimeEvaluator evaluator(rpnCode);
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetInputVariableType("x", Float64Bit);
+        ok &= evaluator.SetInputVariableMemory("x", &x[0]);
+        ok &= evaluator.SetInputVariableType("A", SignedInteger32Bit);
+        ok &= evaluator.SetInputVariableMemory("A", &A[0]);
+        ok &= evaluator.SetOutputVariableType("s", Float64Bit);
+        ok &= evaluator.SetOutputVariableMemory("s", &s[0]);
+        ok &= evaluator.SetOutputVariableType("B", UnsignedInteger8Bit);
+        ok &= evaluator.SetOutputVariableType("C", UnsignedInteger8Bit);
+        ok &= evaluator.SetOutputVariableMemory("C", &C[0]);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (evaluator.CompileBatch(batchTestSamples) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfVectorInstructions() == 0u);
+    }
+    if (ok) {
+        ok = (evaluator.ExecuteBatch() == ErrorManagement::NoError);
+    }
+    for (uint32 i = 0u; (i < batchTestSamples) && (ok); i++) {
+        ok = ((s[i] == sin(x[i])) && (C[i] == static_cast<uint8>(A[i])));
+    }
+    if (ok) {
+        // only one of the samples does not fit in uint8
+        A[batchTestSamples / 2u] = 300;
+        ErrorManagement::ErrorType ret = evaluator.ExecuteBatch();
+        ok = (ret.outOfRange);
+        for (uint32 i = 0u; (i < batchTestSamples) && (ok); i++) {
+            if (i != (batchTestSamples / 2u)) {
+                ok = (C[i] == static_cast<uint8>(A[i]));
+            }
+        }
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_Int32Overflow() {
+    CCString rpnCode = "READ a\n"
+                       "READ b\n"
+                       "ADD\n"
+                       "WRITE c\n"
+    ;
+
+    int32 a[batchTestSamples];
+    int32 b[batchTestSamples];
+    int32 c[batchTestSamples];
+    for (uint32 i = 0u; i < batchTestSamples; i++) {
+        a[i] = static_cast<int32>(i);
+        b[i] = -static_cast<int32>(i) * 2;
+        c[i] = 0;
+    }
+    RuntimeEvaluator evaluator(rpnCode);
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ok = evaluator.SetInputVariableType("a", SignedInteger32Bit);
+        ok &= evaluator.SetInputVariableMemory("a", &a[0]);
+        ok &= evaluator.SetInputVariableType("b", SignedInteger32Bit);
+        ok &= evaluator.SetInputVariableMemory("b", &b[0]);
+        ok &= evaluator.SetOutputVariableType("c", SignedInteger32Bit);
+        ok &= evaluator.SetOutputVariableMemory("c", &c[0]);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (evaluator.CompileBatch(batchTestSamples) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfVectorInstructions() == 1u);
+    }
+    if (ok) {
+        ok = (evaluator.ExecuteBatch() == ErrorManagement::NoError);
+    }
+    for (uint32 i = 0u; (i < batchTestSamples) && (ok); i++) {
+        ok = (c[i] == -static_cast<int32>(i));
+    }
+    if (ok) {
+        a[batchTestSamples - 1u] = 2147483647;
+        b[batchTestSamples - 1u] = 1;
+        ErrorManagement::ErrorType ret = evaluator.ExecuteBatch();
+        ok = (ret.overflow);
+    }
+    if (ok) {
+        a[batchTestSamples - 1u] = (-2147483647 - 1);
+        b[batchTestSamples - 1u] = -1;
+        ErrorManagement::ErrorType ret = evaluator.ExecuteBatch();
+        ok = (ret.underflow);
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_NotCompiled() {
+    RuntimeEvaluator evaluator("READ A\nWRITE B\n");
+    bool ok = (evaluator.ExtractVariables() == ErrorManagement::NoError);
+    if (ok) {
+        ErrorManagement::ErrorType ret = evaluator.CompileBatch(batchTestSamples);
+        ok = (ret.internalSetupError);
+    }
+    if (ok) {
+        ErrorManagement::ErrorType ret = evaluator.ExecuteBatch();
+        ok = (ret.internalSetupError);
+    }
+    if (ok) {
+        ok = evaluator.SetInputVariableType("A", Float32Bit);
+        ok &= evaluator.SetOutputVariableType("B", Float32Bit);
+    }
+    if (ok) {
+        ok = (evaluator.Compile() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ErrorManagement::ErrorType ret = evaluator.CompileBatch(0u);
+        ok = (ret.parametersError);
+    }
+    if (ok) {
+        ok = (evaluator.GetNumberOfSamples() == 0u);
+    }
+    return ok;
+}
+
+bool RuntimeEvaluatorTest::TestExecuteBatch_Benchmark() {
+    const uint32 numberOfSamples = 64u;
+    const uint32 numberOfExecutions = 2000u;
+    float64 x[numberOfSamples];
+    float64 y[numberOfSamples];
+    int32 k[numberOfSamples];
+    float32 a[numberOfSamples];
+    float32 b[numberOfSamples];
+    float64 z[numberOfSamples];
+    int32 n[numberOfSamples];
+    float32 f[numberOfSamples];
+    for (uint32 i = 0u; i < numberOfSamples; i++) {
+        x[i] = 1.25 * static_cast<float64>(i);
+        y[i] = -7.5;
+        k[i] = static_cast<int32>(i);
+        a[i] = 2.F + static_cast<float32>(i);
+        b[i] = 0.5F;
+    }
+
+    RuntimeEvaluator batchEvaluator(batchTestCode);
+    bool ok = CompileBatchTestCode(batchEvaluator, &x[0], &y[0], &k[0], &a[0], &b[0], &z[0], &n[0], &f[0]);
+    if (ok) {
+        ok = (batchEvaluator.CompileBatch(numberOfSamples) == ErrorManagement::NoError);
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    for (uint32 e = 0u; (e < numberOfExecutions) && (ok); e++) {
+        ok = (batchEvaluator.ExecuteBatch() == ErrorManagement::NoError);
+    }
+    uint64 batchTicks = HighResolutionTimer::Counter() - start;
+
+    float64 xs = 0.;
+    float64 ys = 0.;
+    int32 ks = 0;
+    float32 as = 0.F;
+    float32 bs = 0.F;
+    float64 zs = 0.;
+    int32 ns = 0;
+    float32 fs = 0.F;
+    RuntimeEvaluator evaluator(batchTestCode);
+    if (ok) {
+        ok = CompileBatchTestCode(evaluator, &xs, &ys, &ks, &as, &bs, &zs, &ns, &fs);
+    }
+    start = HighResolutionTimer::Counter();
+    for (uint32 e = 0u; (e < numberOfExecutions) && (ok); e++) {
+        for (uint32 i = 0u; (i < numberOfSamples) && (ok); i++) {
+            xs = x[i];
+            ys = y[i];
+            ks = k[i];
+            as = a[i];
+            bs = b[i];
+            ok = (evaluator.Execute(RuntimeEvaluator::fastMode) == ErrorManagement::NoError);
+            if (ok) {
+                ok = ((zs == z[i]) && (ns == n[i]) && (fs == f[i]));
+            }
+        }
+    }
+    uint64 fastTicks = HighResolutionTimer::Counter() - start;
+    if (ok) {
+        float64 norm = 1e9 / static_cast<float64>(numberOfExecutions * numberOfSamples);
+        float64 fastTime = HighResolutionTimer::TicksToTime(fastTicks, 0u) * norm;
+        float64 batchTime = HighResolutionTimer::TicksToTime(batchTicks, 0u) * norm;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "RuntimeEvaluator benchmark: fastMode %f ns batch %f ns per sample", fastTime, batchTime);
+    }
+    return ok;
+}
+
 void RuntimeEvaluatorTest::SetTestInputVariable(CCString name, TypeDescriptor type, void *externalLocation, float64 expectedVarValue) {
     SetTestVariable(usedInputVariables, name, type, externalLocation, expectedVarValue);
 }
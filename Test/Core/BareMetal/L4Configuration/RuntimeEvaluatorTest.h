@@ -157,6 +157,74 @@ public:
       */
      bool TestCompile(RuntimeEvaluator &evaluator, ErrorManagement::ErrorType expectedError, uint32 expectedDataSize);
 
+     /**
+      * @brief Tests that the CAST of constants is folded in the threaded code
+      *        and that the result is the same as in fastMode.
+      */
+     bool TestExecute_ThreadedMode_ConstantFolding();
+
+     /**
+      * @brief Tests that a CAST of a constant that fails is not folded and
+      *        that the error is reported by Execute() as in fastMode.
+      */
+     bool TestExecute_ThreadedMode_ConstantCastOutOfRange();
+
+     /**
+      * @brief Tests that writes with type conversion to local and remote
+      *        variables behave as in fastMode.
+      */
+     bool TestExecute_ThreadedMode_ConversionWrite();
+
+     /**
+      * @brief Tests that Execute(threadedMode) fails if Compile() was not called.
+      */
+     bool TestExecute_ThreadedMode_NotCompiled();
+
+     /**
+      * @brief   Benchmarks the threaded code against fastMode.
+      * @details Executes the same expression a large number of times in both
+      *          modes and reports the execution times. Only checks that both
+      *          modes produce the same results (timings are not asserted).
+      */
+     bool TestExecute_ThreadedMode_Benchmark();
+
+     /**
+      * @brief Tests that ExecuteBatch() over arrays of float32, float64 and int32
+      *        samples produces the same results as fastMode sample by sample
+      *        and that the arithmetic operators are executed as vector operations.
+      */
+     bool TestExecuteBatch_Arrays();
+
+     /**
+      * @brief Tests that internal input variables and constants are broadcast
+      *        to all the samples.
+      */
+     bool TestExecuteBatch_Broadcast();
+
+     /**
+      * @brief Tests functions with no vector implementation and writes with type
+      *        conversion, including the combination of the errors of all the samples.
+      */
+     bool TestExecuteBatch_GenericFunctions();
+
+     /**
+      * @brief Tests that an int32 overflow in any of the samples is reported.
+      */
+     bool TestExecuteBatch_Int32Overflow();
+
+     /**
+      * @brief Tests that CompileBatch() fails if Compile() was not called or
+      *        if the number of samples is zero and that ExecuteBatch() fails
+      *        if CompileBatch() was not called.
+      */
+     bool TestExecuteBatch_NotCompiled();
+
+     /**
+      * @brief   Benchmarks ExecuteBatch() against one fastMode execution per sample.
+      * @details Only checks that both produce the same results (timings are not asserted).
+      */
+     bool TestExecuteBatch_Benchmark();
+
     /**
      * @brief Insert a variable in usedInputVariables so that TestExecute
      *        can load it in a RuntimeEvaluator object.
@@ -164,3 +164,22 @@ bool TokenTest::TestGetLineNumber(uint32 lineNumber) {
     Token token(0, NULL, NULL, lineNumber);
     return token.GetLineNumber() == lineNumber;
 }
+
+bool TokenTest::TestSet(const char8 * data) {
+    Token token(1u, "Description", "A longer initial token data", 1u);
+    TokenInfo tokenInfo;
+    tokenInfo.Set(2u, "Other");
+    token.Set(tokenInfo, data, 3u);
+    bool ok = (token.GetId() == 2u);
+    if (ok) {
+        ok = (StringHelper::Compare(token.GetDescription(), "Other") == 0);
+    }
+    if (ok) {
+        const char8 * const expected = (data != NULL) ? (data) : ("");
+        ok = (StringHelper::Compare(token.GetData(), expected) == 0);
+    }
+    if (ok) {
+        ok = (token.GetLineNumber() == 3u);
+    }
+    return ok;
+}
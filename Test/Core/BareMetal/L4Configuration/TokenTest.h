@@ -92,6 +92,11 @@ public:
      * @brief Tests if the function returns the correct token line number.
      */
     bool TestGetLineNumber(uint32 lineNumber);
+
+    /**
+     * @brief Tests if the Set function reinitialises the token with the new id, description, data and line number.
+     */
+    bool TestSet(const char8 * data);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -29,7 +29,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "AdvancedErrorManagement.h"
 #include "ConfigurationDatabase.h"
+#include "HighResolutionTimer.h"
 #include "IntrospectionTestHelper.h"
 #include "Object.h"
 #include "ObjectRegistryDatabase.h"
@@ -39,6 +41,57 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The types supported by GetBasicTypeArrayConverter.
+ */
+const MARTe::TypeDescriptor arrayConverterTypes[] = { MARTe::UnsignedInteger8Bit, MARTe::SignedInteger8Bit, MARTe::UnsignedInteger16Bit,
+        MARTe::SignedInteger16Bit, MARTe::UnsignedInteger32Bit, MARTe::SignedInteger32Bit, MARTe::UnsignedInteger64Bit, MARTe::SignedInteger64Bit,
+        MARTe::Float32Bit, MARTe::Float64Bit };
+
+const MARTe::uint32 numberOfArrayConverterTypes = sizeof(arrayConverterTypes) / sizeof(MARTe::TypeDescriptor);
+
+/**
+ * Values which saturate and round in the different types.
+ */
+const MARTe::float64 arrayConverterValues[] = { 0.0, 1.0, -1.0, 0.4, -0.4, 0.5, -0.5, 1.5, -1.5, 2.5, 126.7, 127.0, 127.5, 128.0, -128.0, -128.5, -129.0,
+        255.0, 255.5, 256.0, 32767.0, 32768.0, -32768.0, -32769.0, 65535.0, 65536.0, 2147483647.0, 2147483647.5, 2147483648.0, -2147483648.0,
+        -2147483649.0, 4294967295.0, 4294967296.0, 9.2e18, 9.3e18, -9.3e18, 1.8e19, 1.9e19, -1.9e19, 1e30, 3.5e38, -3.5e38, 1e300, -1e300 };
+
+const MARTe::uint32 numberOfArrayConverterValues = sizeof(arrayConverterValues) / sizeof(MARTe::float64);
+
+/**
+ * Writes the arrayConverterValues in an array of \a descriptor type (saturating to the type range).
+ * If \a addNaN, NaN and Inf are also added to the end of float arrays.
+ */
+MARTe::uint32 FillArrayConverterSource(const MARTe::TypeDescriptor &descriptor,
+                                       MARTe::char8 * const source,
+                                       const bool addNaN) {
+    using namespace MARTe;
+    uint32 byteSize = descriptor.numberOfBits / 8u;
+    uint32 n = numberOfArrayConverterValues;
+    for (uint32 i = 0u; i < numberOfArrayConverterValues; i++) {
+        float64 value = arrayConverterValues[i];
+        AnyType destinationElement(descriptor, 0u, &source[i * byteSize]);
+        (void) TypeConvert(destinationElement, value);
+    }
+    if ((addNaN) && (descriptor.type == Float)) {
+        float64 nanValue = 0.0 / 0.0;
+        float64 infValue = 1.0 / 0.0;
+        AnyType nanElement(descriptor, 0u, &source[n * byteSize]);
+        (void) TypeConvert(nanElement, nanValue);
+        n++;
+        AnyType infElement(descriptor, 0u, &source[n * byteSize]);
+        (void) TypeConvert(infElement, infValue);
+        n++;
+        AnyType minusInfElement(descriptor, 0u, &source[n * byteSize]);
+        (void) TypeConvert(minusInfElement, -infValue);
+        n++;
+    }
+    return n;
+}
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -1202,3 +1255,159 @@ bool TypeConversionTest::TestStructuredDataToStructuredData() {
 
     return destMember5 == 5;
 }
+
+bool TypeConversionTest::TestGetBasicTypeArrayConverter() {
+    const uint32 maxElements = numberOfArrayConverterValues + 3u;
+    uint64 sourceMem[maxElements];
+    uint64 destinationMem[maxElements];
+    uint64 vectorMem[maxElements];
+    uint64 expectedMem[maxElements];
+    char8 *source = reinterpret_cast<char8 *>(&sourceMem[0]);
+    char8 *destination = reinterpret_cast<char8 *>(&destinationMem[0]);
+    char8 *vector = reinterpret_cast<char8 *>(&vectorMem[0]);
+    char8 *expected = reinterpret_cast<char8 *>(&expectedMem[0]);
+
+    bool ok = true;
+    for (uint32 s = 0u; (s < numberOfArrayConverterTypes) && (ok); s++) {
+        for (uint32 d = 0u; (d < numberOfArrayConverterTypes) && (ok); d++) {
+            TypeDescriptor sourceDescriptor = arrayConverterTypes[s];
+            TypeDescriptor destinationDescriptor = arrayConverterTypes[d];
+            uint32 sourceByteSize = sourceDescriptor.numberOfBits / 8u;
+            uint32 destinationByteSize = destinationDescriptor.numberOfBits / 8u;
+            //NaN and Inf are only converted to floats (the conversion to integers is undefined)
+            uint32 n = FillArrayConverterSource(sourceDescriptor, source, (destinationDescriptor.type == Float));
+            BasicTypeArrayConverter converter = GetBasicTypeArrayConverter(destinationDescriptor, sourceDescriptor);
+            ok = (converter != NULL_PTR(BasicTypeArrayConverter));
+            bool expectedRet = true;
+            bool ret = false;
+            bool vectorRet = false;
+            if (ok) {
+                (void) MemoryOperationsHelper::Set(destination, '\0', sizeof(destinationMem));
+                (void) MemoryOperationsHelper::Set(vector, '\0', sizeof(vectorMem));
+                (void) MemoryOperationsHelper::Set(expected, '\0', sizeof(expectedMem));
+                ret = converter(destination, source, n);
+                for (uint32 i = 0u; i < n; i++) {
+                    AnyType destinationElement(destinationDescriptor, 0u, &expected[i * destinationByteSize]);
+                    AnyType sourceElement(sourceDescriptor, 0u, &source[i * sourceByteSize]);
+                    if (!TypeConvert(destinationElement, sourceElement)) {
+                        expectedRet = false;
+                    }
+                }
+                AnyType destinationVector(destinationDescriptor, 0u, vector);
+                destinationVector.SetNumberOfDimensions(1u);
+                destinationVector.SetNumberOfElements(0u, n);
+                destinationVector.SetStaticDeclared(true);
+                AnyType sourceVector(sourceDescriptor, 0u, source);
+                sourceVector.SetNumberOfDimensions(1u);
+                sourceVector.SetNumberOfElements(0u, n);
+                sourceVector.SetStaticDeclared(true);
+                vectorRet = TypeConvert(destinationVector, sourceVector);
+            }
+            if (ok) {
+                ok = (ret == expectedRet);
+            }
+            if (ok) {
+                ok = (vectorRet == expectedRet);
+            }
+            if (ok) {
+                ok = (MemoryOperationsHelper::Compare(destination, expected, n * destinationByteSize) == 0);
+            }
+            if (ok) {
+                ok = (MemoryOperationsHelper::Compare(vector, expected, n * destinationByteSize) == 0);
+            }
+        }
+    }
+    return ok;
+}
+
+bool TypeConversionTest::TestGetBasicTypeArrayConverter_Constant() {
+    TypeDescriptor constantFloat32(true, Float, 32u);
+    TypeDescriptor constantInt16(true, SignedInteger, 16u);
+    bool ok = (GetBasicTypeArrayConverter(Float32Bit, constantInt16) == GetBasicTypeArrayConverter(Float32Bit, SignedInteger16Bit));
+    if (ok) {
+        ok = (GetBasicTypeArrayConverter(constantFloat32, SignedInteger16Bit) == GetBasicTypeArrayConverter(Float32Bit, SignedInteger16Bit));
+    }
+    if (ok) {
+        ok = (GetBasicTypeArrayConverter(Float32Bit, constantFloat32) != NULL_PTR(BasicTypeArrayConverter));
+    }
+    if (ok) {
+        const int16 source[] = { -1, 2, 32767 };
+        float32 destination[3];
+        BasicTypeArrayConverter converter = GetBasicTypeArrayConverter(Float32Bit, constantInt16);
+        ok = converter(&destination[0], &source[0], 3u);
+        if (ok) {
+            ok = (destination[0] == -1.0F) && (destination[1] == 2.0F) && (destination[2] == 32767.0F);
+        }
+    }
+    return ok;
+}
+
+bool TypeConversionTest::TestGetBasicTypeArrayConverter_Unsupported() {
+    TypeDescriptor bitField(false, UnsignedInteger, 5u);
+    bool ok = (GetBasicTypeArrayConverter(Float32Bit, CharString) == NULL_PTR(BasicTypeArrayConverter));
+    if (ok) {
+        ok = (GetBasicTypeArrayConverter(CharString, Float32Bit) == NULL_PTR(BasicTypeArrayConverter));
+    }
+    if (ok) {
+        ok = (GetBasicTypeArrayConverter(Character8Bit, UnsignedInteger8Bit) == NULL_PTR(BasicTypeArrayConverter));
+    }
+    if (ok) {
+        ok = (GetBasicTypeArrayConverter(UnsignedInteger8Bit, bitField) == NULL_PTR(BasicTypeArrayConverter));
+    }
+    if (ok) {
+        ok = (GetBasicTypeArrayConverter(VoidType, VoidType) == NULL_PTR(BasicTypeArrayConverter));
+    }
+    return ok;
+}
+
+bool TypeConversionTest::TestGetBasicTypeArrayConverter_Benchmark() {
+    const uint32 numberOfElements = 1024u;
+    const uint32 numberOfRepetitions = 16u;
+    uint64 *sourceMem = new uint64[numberOfElements];
+    uint64 *destinationMem = new uint64[numberOfElements];
+    char8 *source = reinterpret_cast<char8 *>(&sourceMem[0]);
+    char8 *destination = reinterpret_cast<char8 *>(&destinationMem[0]);
+    bool ok = true;
+    for (uint32 s = 0u; (s < numberOfArrayConverterTypes) && (ok); s++) {
+        for (uint32 d = 0u; (d < numberOfArrayConverterTypes) && (ok); d++) {
+            TypeDescriptor sourceDescriptor = arrayConverterTypes[s];
+            TypeDescriptor destinationDescriptor = arrayConverterTypes[d];
+            uint32 sourceByteSize = sourceDescriptor.numberOfBits / 8u;
+            uint32 destinationByteSize = destinationDescriptor.numberOfBits / 8u;
+            //Values that are valid in all the types, so that there are no saturation warnings
+            for (uint32 i = 0u; i < numberOfElements; i++) {
+                uint8 value = static_cast<uint8>(i % 100u);
+                AnyType sourceElement(sourceDescriptor, 0u, &source[i * sourceByteSize]);
+                (void) TypeConvert(sourceElement, value);
+            }
+            BasicTypeArrayConverter converter = GetBasicTypeArrayConverter(destinationDescriptor, sourceDescriptor);
+            ok = (converter != NULL_PTR(BasicTypeArrayConverter));
+            uint64 arrayTicks = 0u;
+            uint64 elementTicks = 0u;
+            for (uint32 r = 0u; (r < numberOfRepetitions) && (ok); r++) {
+                uint64 start = HighResolutionTimer::Counter();
+                ok = converter(destination, source, numberOfElements);
+                arrayTicks += (HighResolutionTimer::Counter() - start);
+                start = HighResolutionTimer::Counter();
+                for (uint32 i = 0u; (i < numberOfElements) && (ok); i++) {
+                    AnyType destinationElement(destinationDescriptor, 0u, &destination[i * destinationByteSize]);
+                    AnyType sourceElement(sourceDescriptor, 0u, &source[i * sourceByteSize]);
+                    ok = TypeConvert(destinationElement, sourceElement);
+                }
+                elementTicks += (HighResolutionTimer::Counter() - start);
+            }
+            if (ok) {
+                float64 totalElements = static_cast<float64>(numberOfElements * numberOfRepetitions);
+                float64 arrayNs = (static_cast<float64>(arrayTicks) * HighResolutionTimer::Period() * 1e9) / totalElements;
+                float64 elementNs = (static_cast<float64>(elementTicks) * HighResolutionTimer::Period() * 1e9) / totalElements;
+                StreamString sourceName = TypeDescriptor::GetTypeNameFromTypeDescriptor(sourceDescriptor);
+                StreamString destinationName = TypeDescriptor::GetTypeNameFromTypeDescriptor(destinationDescriptor);
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "%s->%s: array %f ns/element, element by element %f ns/element", sourceName.Buffer(),
+                                    destinationName.Buffer(), arrayNs, elementNs);
+            }
+        }
+    }
+    delete[] sourceMem;
+    delete[] destinationMem;
+    return ok;
+}
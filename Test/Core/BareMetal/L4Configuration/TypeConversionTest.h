@@ -355,6 +355,29 @@ public:
      */
     bool TestStructuredDataToStructuredData();
 
+    /**
+     * @brief Tests that the GetBasicTypeArrayConverter converters (and the vector conversions that use them) give the same
+     * values and return values as the element by element conversion, for all the supported type pairs and for values
+     * which saturate and round.
+     */
+    bool TestGetBasicTypeArrayConverter();
+
+    /**
+     * @brief Tests that GetBasicTypeArrayConverter ignores the constness of the types.
+     */
+    bool TestGetBasicTypeArrayConverter_Constant();
+
+    /**
+     * @brief Tests that GetBasicTypeArrayConverter returns NULL for non supported types.
+     */
+    bool TestGetBasicTypeArrayConverter_Unsupported();
+
+    /**
+     * @brief Compares the time taken by the GetBasicTypeArrayConverter converters against the time taken by the element by element
+     * conversion, for all the supported type pairs. The results are reported as Information messages.
+     */
+    bool TestGetBasicTypeArrayConverter_Benchmark();
+
 };
 
 /*---------------------------------------------------------------------------*/
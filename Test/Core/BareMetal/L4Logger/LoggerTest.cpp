@@ -32,11 +32,33 @@
 /*---------------------------------------------------------------------------*/
 #include "Logger.h"
 #include "LoggerTest.h"
+#include "Sleep.h"
 #include "StreamString.h"
+#include "Threads.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+static const MARTe::uint32 LOGGER_TEST_N_PRODUCERS = 4u;
+static const MARTe::uint32 LOGGER_TEST_N_LOGS_PER_PRODUCER = 100u;
+
+static void LoggerTestProducer(volatile MARTe::int32 *finished) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < LOGGER_TEST_N_LOGS_PER_PRODUCER; i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing TestGetPage_MultipleProducers %d", i);
+    }
+    Atomic::Increment(finished);
+}
+
+static void LoggerTestEmpty(MARTe::Logger *logger) {
+    using namespace MARTe;
+    LoggerPage *entry = logger->GetLogEntry();
+    while (entry != NULL) {
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+}
 
 bool LoggerTest::TestConstructor() {
     using namespace MARTe;
@@ -163,6 +185,87 @@ bool LoggerTest::TestGetNumberOfLogs() {
     return ok;
 }
 
+bool LoggerTest::TestGetNumberOfDroppedLogs() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    uint32 initNumberOfDroppedLogs = logger->GetNumberOfDroppedLogs();
+    uint32 nOfPages = logger->GetNumberOfPages();
+    uint32 i;
+    bool ok = true;
+    for (i = 0u; (i < nOfPages) && (ok); i++) {
+        LoggerPage *page = logger->GetPage();
+        ok = (page != NULL);
+        if (ok) {
+            logger->AddLogEntry(page);
+        }
+    }
+    if (ok) {
+        ok = (logger->GetNumberOfDroppedLogs() == initNumberOfDroppedLogs);
+    }
+    if (ok) {
+        ok = (logger->GetPage() == NULL);
+    }
+    if (ok) {
+        ok = (logger->GetNumberOfDroppedLogs() == (initNumberOfDroppedLogs + 1u));
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Testing TestGetNumberOfDroppedLogs");
+        ok = (logger->GetNumberOfDroppedLogs() == (initNumberOfDroppedLogs + 2u));
+    }
+    uint32 nOfLogs = 0u;
+    LoggerPage *entry = logger->GetLogEntry();
+    while (entry != NULL) {
+        nOfLogs++;
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+    if (ok) {
+        ok = (nOfLogs == nOfPages);
+    }
+    return ok;
+}
+
+bool LoggerTest::TestGetPage_MultipleProducers() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    LoggerTestEmpty(logger);
+    uint32 initNumberOfDroppedLogs = logger->GetNumberOfDroppedLogs();
+    volatile int32 finished = 0;
+    uint32 i;
+    for (i = 0u; i < LOGGER_TEST_N_PRODUCERS; i++) {
+        Threads::BeginThread((ThreadFunctionType) LoggerTestProducer, const_cast<int32 *>(&finished));
+    }
+    bool ok = true;
+    for (i = 0u; (i < 500u) && (finished != static_cast<int32>(LOGGER_TEST_N_PRODUCERS)); i++) {
+        Sleep::MSec(10);
+    }
+    ok = (finished == static_cast<int32>(LOGGER_TEST_N_PRODUCERS));
+    //Other logs (e.g. warnings from Threads::BeginThread) may also be in the queue or have been dropped
+    uint32 nOfLogs = 0u;
+    uint32 nOfProducerLogs = 0u;
+    LoggerPage *entry = logger->GetLogEntry();
+    while (entry != NULL) {
+        if (StringHelper::CompareN(entry->errorStrBuffer, "Testing TestGetPage_MultipleProducers", 37u) == 0) {
+            nOfProducerLogs++;
+        }
+        nOfLogs++;
+        logger->ReturnPage(entry);
+        entry = logger->GetLogEntry();
+    }
+    if (ok) {
+        ok = (nOfLogs <= logger->GetNumberOfPages());
+    }
+    if (ok) {
+        uint32 nOfDroppedLogs = logger->GetNumberOfDroppedLogs() - initNumberOfDroppedLogs;
+        ok = ((nOfProducerLogs + nOfDroppedLogs) >= (LOGGER_TEST_N_PRODUCERS * LOGGER_TEST_N_LOGS_PER_PRODUCER));
+    }
+    if (ok) {
+        ok = (nOfProducerLogs <= (LOGGER_TEST_N_PRODUCERS * LOGGER_TEST_N_LOGS_PER_PRODUCER));
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
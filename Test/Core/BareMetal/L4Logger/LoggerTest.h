@@ -82,6 +82,16 @@ public:
      */
     bool TestLoggerErrorProcessFunction();
 
+    /**
+     * @brief Tests that the GetNumberOfDroppedLogs is incremented when all the pages are in use.
+     */
+    bool TestGetNumberOfDroppedLogs();
+
+    /**
+     * @brief Tests that logs from concurrent threads are either added or accounted as dropped.
+     */
+    bool TestGetPage_MultipleProducers();
+
 };
 
 
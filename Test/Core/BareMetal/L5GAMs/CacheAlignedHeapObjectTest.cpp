@@ -0,0 +1,271 @@
+/**
+ * @file CacheAlignedHeapObjectTest.cpp
+ * @brief Source file for class CacheAlignedHeapObjectTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CacheAlignedHeapObjectTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CacheAlignedHeapObjectTest.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "HeapManager.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class CacheAlignedHeapObjectTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    CacheAlignedHeapObjectTestGAM() :
+            GAM() {
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+
+    void *GetOutputMemory() {
+        return GetOutputSignalsMemory();
+    }
+};
+CLASS_REGISTER(CacheAlignedHeapObjectTestGAM, "1.0")
+
+static const char8 * const heapNameConfig = ""
+        "+GAMsHeap = {"
+        "    Class = CacheAlignedHeapObject"
+        "    CacheLineSize = 128"
+        "}"
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = CacheAlignedHeapObjectTestGAM"
+        "            HeapName = GAMsHeap"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = CacheAlignedHeapObjectTestGAM"
+        "            HeapName = GAMsHeap"
+        "            InputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            HeapName = GAMsHeap"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = DefaultSchedulerForTests"
+        "    }"
+        "}";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool CacheAlignedHeapObjectTest::TestConstructor() {
+    CacheAlignedHeapObject heapObject;
+    return (heapObject.GetHeap() == NULL_PTR(CacheAlignedHeap *));
+}
+
+bool CacheAlignedHeapObjectTest::TestInitialise() {
+    CacheAlignedHeapObject heapObject;
+    heapObject.SetName("CacheAlignedHeapObjectTest");
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("CacheLineSize", 128u);
+    if (ok) {
+        ok = heapObject.Initialise(cdb);
+    }
+    CacheAlignedHeap *heap = heapObject.GetHeap();
+    if (ok) {
+        ok = (heap != NULL_PTR(CacheAlignedHeap *));
+    }
+    if (ok) {
+        ok = (heap->GetCacheLineSize() == 128u);
+    }
+    if (ok) {
+        ok = (heap->GetNode() == NUMAMemory::ANY_NODE);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(heap->Name(), "CacheAlignedHeapObjectTest") == 0);
+    }
+#ifdef MULTIHEAP_SUPPORT
+    if (ok) {
+        ok = (HeapManager::FindHeap("CacheAlignedHeapObjectTest") == heap);
+    }
+#endif
+    return ok;
+}
+
+bool CacheAlignedHeapObjectTest::TestInitialise_CPUs() {
+    CacheAlignedHeapObject heapObject;
+    heapObject.SetName("CacheAlignedHeapObjectTest");
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("CPUs", 0x1u);
+    if (ok) {
+        ok = heapObject.Initialise(cdb);
+    }
+    CacheAlignedHeap *heap = heapObject.GetHeap();
+    if (ok) {
+        ok = (heap != NULL_PTR(CacheAlignedHeap *));
+    }
+    if (ok) {
+        ok = (heap->GetNode() == NUMAMemory::GetNode(ProcessorType(0x1u)));
+    }
+    if (ok) {
+        ok = (heap->GetCacheLineSize() == CacheAlignedHeap::DEFAULT_CACHE_LINE_SIZE);
+    }
+    void *ptr = NULL_PTR(void *);
+    if (ok) {
+        ptr = heap->Malloc(1000u);
+        ok = (ptr != NULL);
+    }
+    heap->Free(ptr);
+    return ok;
+}
+
+bool CacheAlignedHeapObjectTest::TestInitialise_InvalidCacheLineSize() {
+    CacheAlignedHeapObject heapObject;
+    heapObject.SetName("CacheAlignedHeapObjectTest");
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("CacheLineSize", 100u);
+    if (ok) {
+        ok = !heapObject.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (heapObject.GetHeap() == NULL_PTR(CacheAlignedHeap *));
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapObjectTest::TestInitialise_Twice() {
+    CacheAlignedHeapObject heapObject;
+    heapObject.SetName("CacheAlignedHeapObjectTest");
+    ConfigurationDatabase cdb;
+    bool ok = heapObject.Initialise(cdb);
+    if (ok) {
+        ok = !heapObject.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool CacheAlignedHeapObjectTest::TestHeapName() {
+    ConfigurationDatabase cdb;
+    StreamString configStream = heapNameConfig;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<CacheAlignedHeapObject> heapObject;
+    ReferenceT<CacheAlignedHeapObjectTestGAM> gamA;
+    ReferenceT<GAMDataSource> ddb1;
+    if (ok) {
+        heapObject = god->Find("GAMsHeap");
+        gamA = god->Find("Application1.Functions.GAMA");
+        ddb1 = god->Find("Application1.Data.DDB1");
+        ok = (heapObject.IsValid() && gamA.IsValid() && ddb1.IsValid());
+    }
+#ifdef MULTIHEAP_SUPPORT
+    CacheAlignedHeap *heap = NULL_PTR(CacheAlignedHeap *);
+    if (ok) {
+        heap = heapObject->GetHeap();
+        ok = (heap->GetNumberOfAllocations() > 0u);
+    }
+    if (ok) {
+        ok = heap->Owns(gamA->GetOutputMemory());
+    }
+    if (ok) {
+        ok = ((reinterpret_cast<uintp>(gamA->GetOutputMemory()) % heap->GetCacheLineSize()) == 0u);
+    }
+    void *signalAddress = NULL_PTR(void *);
+    if (ok) {
+        ok = ddb1->GetSignalMemoryBuffer(0u, 0u, signalAddress);
+    }
+    if (ok) {
+        ok = heap->Owns(signalAddress);
+    }
+#endif
+    //The heap object is destroyed before the GAMs and DataSources that use its memory
+    heapObject = Reference();
+    gamA = Reference();
+    ddb1 = Reference();
+    application = Reference();
+    god->Purge();
+    return ok;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file CacheAlignedHeapObjectTest.h
+ * @brief Header file for class CacheAlignedHeapObjectTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CacheAlignedHeapObjectTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L5GAMS_CACHEALIGNEDHEAPOBJECTTEST_H_
+#define TEST_CORE_BAREMETAL_L5GAMS_CACHEALIGNEDHEAPOBJECTTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CacheAlignedHeapObject.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the CacheAlignedHeapObject public methods.
+ */
+class CacheAlignedHeapObjectTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method places the heap on the node of the CPUs.
+     */
+    bool TestInitialise_CPUs();
+
+    /**
+     * @brief Tests that the Initialise method fails if the CacheLineSize is not a power of two.
+     */
+    bool TestInitialise_InvalidCacheLineSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if called twice.
+     */
+    bool TestInitialise_Twice();
+
+    /**
+     * @brief Tests that the heap can be selected with the HeapName of GAMs and DataSources.
+     */
+    bool TestHeapName();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L5GAMS_CACHEALIGNEDHEAPOBJECTTEST_H_ */
@@ -2393,3 +2393,10 @@ bool DataSourceITest::TestBrokerCopyTerminated() {
     return test.BrokerCopyTerminated();
 }
 
+bool DataSourceITest::TestSynchroniseBatch() {
+    DataSourceITestHelper test;
+    uint32 page = 0u;
+    const void *pages[] = { &page };
+    return !test.SynchroniseBatch(&pages[0], 1u, static_cast<uint32>(sizeof(uint32)));
+}
+
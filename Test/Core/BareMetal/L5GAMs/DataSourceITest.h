@@ -293,6 +293,11 @@ public:
      */
     bool TestBrokerCopyTerminated();
 
+    /**
+     * @brief Tests the default SynchroniseBatch() method.
+     */
+    bool TestSynchroniseBatch();
+
 };
 
 /*---------------------------------------------------------------------------*/
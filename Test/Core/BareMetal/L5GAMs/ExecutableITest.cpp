@@ -100,6 +100,24 @@ bool ExecutableITest::TestGetTimingSignalAddress() {
     return TestSetTimingSignalAddress();
 }
 
+bool ExecutableITest::TestSetTimingSignalNanoseconds() {
+    ExecutableITester tester;
+    bool ok = !tester.IsTimingSignalNanoseconds();
+    if (ok) {
+        tester.SetTimingSignalNanoseconds(true);
+        ok = tester.IsTimingSignalNanoseconds();
+    }
+    if (ok) {
+        tester.SetTimingSignalNanoseconds(false);
+        ok = !tester.IsTimingSignalNanoseconds();
+    }
+    return ok;
+}
+
+bool ExecutableITest::TestIsTimingSignalNanoseconds() {
+    return TestSetTimingSignalNanoseconds();
+}
+
 
 
 
@@ -68,6 +68,16 @@ public:
      */
     bool TestGetTimingSignalAddress();
 
+    /**
+     * @brief Tests the SetTimingSignalNanoseconds method.
+     */
+    bool TestSetTimingSignalNanoseconds();
+
+    /**
+     * @brief Tests the IsTimingSignalNanoseconds method.
+     */
+    bool TestIsTimingSignalNanoseconds();
+
 };
 
 /*---------------------------------------------------------------------------*/
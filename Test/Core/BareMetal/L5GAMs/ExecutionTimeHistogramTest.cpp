@@ -0,0 +1,190 @@
+/**
+ * @file ExecutionTimeHistogramTest.cpp
+ * @brief Source file for class ExecutionTimeHistogramTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeHistogramTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogramTest.h"
+#include "HighResolutionTimer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static float64 TicksToMicroSeconds(const uint64 ticks) {
+    return static_cast<float64>(ticks) * HighResolutionTimer::Period() * 1e6;
+}
+
+static bool IsClose(const float64 a,
+                    const float64 b) {
+    float64 diff = a - b;
+    if (diff < 0.0) {
+        diff = -diff;
+    }
+    float64 tolerance = b * 1e-9;
+    if (tolerance < 0.0) {
+        tolerance = -tolerance;
+    }
+    return (diff <= (tolerance + 1e-12));
+}
+
+bool ExecutionTimeHistogramTest::TestConstructor() {
+    ExecutionTimeHistogram histogram;
+    bool ok = (histogram.GetNumberOfSamples() == 0u);
+    if (ok) {
+        ok = (histogram.GetMin() == 0.0);
+    }
+    if (ok) {
+        ok = (histogram.GetMax() == 0.0);
+    }
+    if (ok) {
+        ok = (histogram.GetMean() == 0.0);
+    }
+    if (ok) {
+        ok = (histogram.GetPercentile(99.0) == 0.0);
+    }
+    for (uint32 i = 0u; (i < ExecutionTimeHistogram::NUMBER_OF_BUCKETS) && (ok); i++) {
+        ok = (histogram.GetBucketCounter(i) == 0u);
+    }
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestUpdate() {
+    ExecutionTimeHistogram histogram;
+    histogram.Update(100u);
+    histogram.Update(300u);
+    histogram.Update(200u);
+    bool ok = (histogram.GetNumberOfSamples() == 3u);
+    if (ok) {
+        ok = IsClose(histogram.GetMin(), TicksToMicroSeconds(100u));
+    }
+    if (ok) {
+        ok = IsClose(histogram.GetMax(), TicksToMicroSeconds(300u));
+    }
+    if (ok) {
+        ok = IsClose(histogram.GetMean(), TicksToMicroSeconds(200u));
+    }
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestReset() {
+    ExecutionTimeHistogram histogram;
+    histogram.Update(10u);
+    histogram.Update(1000u);
+    histogram.Reset();
+    bool ok = (histogram.GetNumberOfSamples() == 0u);
+    if (ok) {
+        ok = (histogram.GetMax() == 0.0);
+    }
+    if (ok) {
+        ok = (histogram.GetBucketCounter(ExecutionTimeHistogram::GetBucketIndex(1000u)) == 0u);
+    }
+    if (ok) {
+        histogram.Update(5u);
+        ok = IsClose(histogram.GetMin(), TicksToMicroSeconds(5u));
+    }
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetPercentile() {
+    ExecutionTimeHistogram histogram;
+    uint32 i;
+    //990 fast executions and 10 slow ones
+    for (i = 0u; i < 990u; i++) {
+        histogram.Update(7u);
+    }
+    for (i = 0u; i < 10u; i++) {
+        histogram.Update(100000u);
+    }
+    bool ok = IsClose(histogram.GetPercentile(50.0), TicksToMicroSeconds(7u));
+    if (ok) {
+        ok = IsClose(histogram.GetPercentile(99.0), TicksToMicroSeconds(7u));
+    }
+    if (ok) {
+        //The slow executions are recorded with a resolution better than 12.5%
+        float64 p999 = histogram.GetPercentile(99.9);
+        ok = (p999 >= TicksToMicroSeconds(100000u));
+        if (ok) {
+            ok = (p999 <= TicksToMicroSeconds(112500u));
+        }
+    }
+    if (ok) {
+        ok = IsClose(histogram.GetPercentile(100.0), TicksToMicroSeconds(100000u));
+    }
+    if (ok) {
+        ok = IsClose(histogram.GetPercentile(0.0), TicksToMicroSeconds(7u));
+    }
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetBucketIndex() {
+    bool ok = true;
+    uint64 value;
+    for (value = 0u; (value < 8u) && (ok); value++) {
+        ok = (ExecutionTimeHistogram::GetBucketIndex(value) == static_cast<uint32>(value));
+    }
+    uint32 lastIdx = 7u;
+    for (uint32 b = 3u; (b < 64u) && (ok); b++) {
+        value = (static_cast<uint64>(1u) << b);
+        uint32 idx = ExecutionTimeHistogram::GetBucketIndex(value);
+        ok = (idx == (lastIdx + 1u));
+        if (ok) {
+            ok = (ExecutionTimeHistogram::GetBucketUpperLimit(idx - 1u) == (value - 1u));
+        }
+        if (ok) {
+            ok = (ExecutionTimeHistogram::GetBucketIndex(ExecutionTimeHistogram::GetBucketUpperLimit(idx)) == idx);
+        }
+        lastIdx = idx + 7u;
+    }
+    if (ok) {
+        value = ~static_cast<uint64>(0u);
+        ok = (ExecutionTimeHistogram::GetBucketIndex(value) == (ExecutionTimeHistogram::NUMBER_OF_BUCKETS - 1u));
+    }
+    if (ok) {
+        ok = (ExecutionTimeHistogram::GetBucketUpperLimit(ExecutionTimeHistogram::NUMBER_OF_BUCKETS - 1u) == value);
+    }
+    return ok;
+}
+
+bool ExecutionTimeHistogramTest::TestGetBucketCounter() {
+    ExecutionTimeHistogram histogram;
+    histogram.Update(3u);
+    histogram.Update(3u);
+    histogram.Update(1000u);
+    bool ok = (histogram.GetBucketCounter(3u) == 2u);
+    if (ok) {
+        ok = (histogram.GetBucketCounter(ExecutionTimeHistogram::GetBucketIndex(1000u)) == 1u);
+    }
+    if (ok) {
+        ok = (histogram.GetBucketCounter(ExecutionTimeHistogram::NUMBER_OF_BUCKETS) == 0u);
+    }
+    return ok;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file ExecutionTimeHistogramTest.h
+ * @brief Header file for class ExecutionTimeHistogramTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ExecutionTimeHistogramTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EXECUTIONTIMEHISTOGRAMTEST_H_
+#define EXECUTIONTIMEHISTOGRAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogram.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the ExecutionTimeHistogram public methods.
+ */
+class ExecutionTimeHistogramTest {
+public:
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Update method and the GetMin, GetMax and GetMean statistics.
+     */
+    bool TestUpdate();
+
+    /**
+     * @brief Tests the Reset method.
+     */
+    bool TestReset();
+
+    /**
+     * @brief Tests the GetPercentile method.
+     */
+    bool TestGetPercentile();
+
+    /**
+     * @brief Tests that the GetBucketIndex and GetBucketUpperLimit methods are consistent over the full uint64 range.
+     */
+    bool TestGetBucketIndex();
+
+    /**
+     * @brief Tests the GetBucketCounter method.
+     */
+    bool TestGetBucketCounter();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EXECUTIONTIMEHISTOGRAMTEST_H_ */
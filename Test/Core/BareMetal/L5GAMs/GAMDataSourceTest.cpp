@@ -33,6 +33,8 @@
 #include "GAMSchedulerI.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
+#include "MemoryMapSeqlockInputBroker.h"
+#include "MemoryMapSeqlockOutputBroker.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
@@ -1786,6 +1788,99 @@ static const char8 * const config16 = ""
         "    }"
         "}";
 
+static const char8 * const config17 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = GAMDataSourceTestGAM1"
+        "            OutputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "                   Default = 2"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = GAMDataSourceTestGAM1"
+        "            InputSignals = {"
+        "               Signal0 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = GAMDataSourceTestGAM1"
+        "            OutputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMD = {"
+        "            Class = GAMDataSourceTestGAM1"
+        "            InputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = DDB1"
+        "                   Type = uint32"
+        "                   Default = 5"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            Seqlock = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "        +State2 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB GAMA GAMD GAMC}"
+        "                }"
+        "            }"
+        "        }"
+        "        +State3 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMD GAMC}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        TimingDataSource = Timings"
+        "        Class = GAMDataSourceTestScheduler1"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -2485,3 +2580,147 @@ bool GAMDataSourceTest::TestSetConfiguredDatabase_MoreThanOneProducer_Different_
     bool ret = InitialiseGAMDataSourceEnviroment(config14);
     return ret;
 }
+
+bool GAMDataSourceTest::TestGetBrokerName_Seqlock() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config17);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    if (ret) {
+        ConfigurationDatabase cdb;
+        cdb.Write("Samples", 1u);
+        cdb.Write("Frequency", -1.0f);
+        StreamString brokerName = gamDataSource->GetBrokerName(cdb, InputSignals);
+        ret = (brokerName == "MemoryMapSeqlockInputBroker");
+    }
+    if (ret) {
+        ConfigurationDatabase cdb;
+        cdb.Write("Samples", 1u);
+        cdb.Write("Frequency", -1.0f);
+        StreamString brokerName = gamDataSource->GetBrokerName(cdb, OutputSignals);
+        ret = (brokerName == "MemoryMapSeqlockOutputBroker");
+    }
+    if (ret) {
+        ConfigurationDatabase cdb;
+        cdb.Write("Samples", 1u);
+        cdb.Write("Frequency", 1.0f);
+        ret = (gamDataSource->GetBrokerName(cdb, InputSignals) == NULL_PTR(char8 *));
+    }
+    return ret;
+}
+
+bool GAMDataSourceTest::TestGetInputBrokers_Seqlock() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config17);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    ReferenceContainer inputBrokers;
+    if (ret) {
+        ret = gamDataSource->GetInputBrokers(inputBrokers, "GAMB", reinterpret_cast<void *>(0xAA));
+    }
+    if (ret) {
+        ReferenceT<MemoryMapSeqlockInputBroker> broker = inputBrokers.Get(0);
+        ret = broker.IsValid();
+    }
+    return ret;
+}
+
+bool GAMDataSourceTest::TestGetOutputBrokers_Seqlock() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config17);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    ReferenceContainer outputBrokers;
+    if (ret) {
+        ret = gamDataSource->GetOutputBrokers(outputBrokers, "GAMA", reinterpret_cast<void *>(0xAA));
+    }
+    if (ret) {
+        ReferenceT<MemoryMapSeqlockOutputBroker> broker = outputBrokers.Get(0);
+        ret = broker.IsValid();
+    }
+    return ret;
+}
+
+bool GAMDataSourceTest::TestGetSeqlockSignal() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config17);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    volatile uint32 *sequence0 = NULL_PTR(volatile uint32 *);
+    volatile uint32 *sequence1 = NULL_PTR(volatile uint32 *);
+    uint32 byteSize = 0u;
+    uint32 bufferStride = 0u;
+    if (ret) {
+        ret = gamDataSource->GetSeqlockSignal(0u, sequence0, byteSize, bufferStride);
+    }
+    if (ret) {
+        ret = (byteSize == 4u) && (bufferStride == 8u) && (*sequence0 == 0u);
+    }
+    if (ret) {
+        ret = gamDataSource->GetSeqlockSignal(1u, sequence1, byteSize, bufferStride);
+    }
+    if (ret) {
+        //Each sequence in its own cache line.
+        ret = ((sequence1 - sequence0) == 16);
+    }
+    if (ret) {
+        ret = !gamDataSource->GetSeqlockSignal(2u, sequence1, byteSize, bufferStride);
+    }
+    return ret;
+}
+
+bool GAMDataSourceTest::TestGetSeqlockSignal_False() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config2);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    volatile uint32 *sequence = NULL_PTR(volatile uint32 *);
+    uint32 byteSize = 0u;
+    uint32 bufferStride = 0u;
+    if (ret) {
+        ret = !gamDataSource->GetSeqlockSignal(0u, sequence, byteSize, bufferStride);
+    }
+    return ret;
+}
+
+bool GAMDataSourceTest::TestPrepareNextState_Seqlock() {
+    bool ret = InitialiseGAMDataSourceEnviroment(config17);
+    ReferenceT<GAMDataSource> gamDataSource;
+    if (ret) {
+        gamDataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        ret = gamDataSource.IsValid();
+    }
+    uint32 *signal1 = NULL_PTR(uint32 *);
+    if (ret) {
+        ret = gamDataSource->GetSignalMemoryBuffer(1, 0, reinterpret_cast<void *&>(signal1));
+    }
+    volatile uint32 *sequence = NULL_PTR(volatile uint32 *);
+    uint32 byteSize = 0u;
+    uint32 bufferStride = 0u;
+    if (ret) {
+        ret = gamDataSource->GetSeqlockSignal(1u, sequence, byteSize, bufferStride);
+    }
+    uint32 *signal1SecondBuffer = NULL_PTR(uint32 *);
+    if (ret) {
+        signal1SecondBuffer = reinterpret_cast<uint32 *>(&(reinterpret_cast<char8 *>(signal1)[bufferStride]));
+        //Dirty the memory
+        *signal1 = 2u;
+        *signal1SecondBuffer = 3u;
+        ret = gamDataSource->PrepareNextState("State1", "State2");
+    }
+    if (ret) {
+        //Signal has default, which shall be set in both buffers
+        ret = (*signal1 == 5u) && (*signal1SecondBuffer == 5u);
+    }
+    return ret;
+}
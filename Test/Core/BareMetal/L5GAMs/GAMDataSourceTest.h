@@ -158,6 +158,36 @@ public:
      * @brief Tests the SetConfiguredDatabase method and verifies that no error is issued if a the signal is produced by different producers in different states.
      */
     bool TestSetConfiguredDatabase_MoreThanOneProducer_Different_States();
+
+    /**
+     * @brief Tests the GetBrokerName method with Seqlock = 1.
+     */
+    bool TestGetBrokerName_Seqlock();
+
+    /**
+     * @brief Tests that the GetInputBrokers method returns a MemoryMapSeqlockInputBroker with Seqlock = 1.
+     */
+    bool TestGetInputBrokers_Seqlock();
+
+    /**
+     * @brief Tests that the GetOutputBrokers method returns a MemoryMapSeqlockOutputBroker with Seqlock = 1.
+     */
+    bool TestGetOutputBrokers_Seqlock();
+
+    /**
+     * @brief Tests the GetSeqlockSignal method.
+     */
+    bool TestGetSeqlockSignal();
+
+    /**
+     * @brief Tests that the GetSeqlockSignal method fails if Seqlock = 0.
+     */
+    bool TestGetSeqlockSignal_False();
+
+    /**
+     * @brief Tests that the PrepareNextState method sets the default value in both buffers with Seqlock = 1.
+     */
+    bool TestPrepareNextState_Seqlock();
 };
 
 /*---------------------------------------------------------------------------*/
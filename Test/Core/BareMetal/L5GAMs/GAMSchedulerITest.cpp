@@ -753,3 +753,288 @@ bool GAMSchedulerITest::TestExecuteSingleCycle_False() {
     }
     return ok;
 }
+
+bool GAMSchedulerITest::TestExecuteSingleCycle_ExecutionTimeHistograms() {
+    static StreamString config = ""
+            "$TestExecuteSingleCycle_ExecutionTimeHistograms = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = Timings"
+            "                    Alias = State1.Thread1_CycleTime"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DummyScheduler"
+            "        TimingDataSource = Timings"
+            "        ExecutionTimeHistograms = 1"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("TestExecuteSingleCycle_ExecutionTimeHistograms");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = scheduler->IsExecutionTimeHistogramsEnabled();
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    const uint32 numberOfCycles = 10u;
+    for (uint32 i = 0u; (i < numberOfCycles) && (ok); i++) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    ReferenceT<GAM1> gama;
+    if (ok) {
+        gama = app->Find("Functions.GAMA");
+        ok = gama.IsValid();
+    }
+    ExecutionTimeHistogram *histogram = NULL_PTR(ExecutionTimeHistogram *);
+    if (ok) {
+        histogram = gama->GetExecutionTimeHistogram();
+        ok = (histogram != NULL_PTR(ExecutionTimeHistogram *));
+    }
+    if (ok) {
+        ok = (histogram->GetNumberOfSamples() == numberOfCycles);
+    }
+    if (ok) {
+        ok = (histogram->GetMax() >= histogram->GetMin());
+    }
+    if (ok) {
+        ok = (scheduler->GetCycleTimeHistogram("State1", "Thread1") != NULL_PTR(const ExecutionTimeHistogram *));
+    }
+    if (ok) {
+        ok = (scheduler->GetCycleTimeHistogram("State1", "Thread2") == NULL_PTR(const ExecutionTimeHistogram *));
+    }
+    if (ok) {
+        ok = (scheduler->GetCycleTimeHistogram("State2", "Thread1") == NULL_PTR(const ExecutionTimeHistogram *));
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    return ok;
+}
+
+bool GAMSchedulerITest::TestExecuteSingleCycle_NanosecondsTimingSignals() {
+    static StreamString config = ""
+            "$TestExecuteSingleCycle_NanosecondsTimingSignals = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                SignalIn1 = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add2"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = GAM1"
+            "            InputSignals = {"
+            "                ExecTime = {"
+            "                    DataSource = Timings"
+            "                    Alias = GAMA_ExecTime"
+            "                    Type = uint64"
+            "                }"
+            "                CycleTime = {"
+            "                    DataSource = Timings"
+            "                    Alias = State1.Thread1_CycleTime"
+            "                    Type = uint64"
+            "                }"
+            "                ReadTime = {"
+            "                    DataSource = Timings"
+            "                    Alias = GAMA_ReadTime"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalOut = {"
+            "                    DataSource = DDB1"
+            "                    Alias = add1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "            Signals = {"
+            "                State1 = {"
+            "                    Thread1_CycleTime = {"
+            "                        Type = uint64"
+            "                    }"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = DummyScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    config.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = parser.Parse();
+
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase::Instance()->Purge();
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("TestExecuteSingleCycle_NanosecondsTimingSignals");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<DummyScheduler> scheduler;
+    if (ok) {
+        scheduler = app->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    ReferenceT<GAM1> gama;
+    if (ok) {
+        gama = app->Find("Functions.GAMA");
+        ok = gama.IsValid();
+    }
+    ReferenceContainer inputBrokers;
+    if (ok) {
+        ok = gama->GetInputBrokers(inputBrokers);
+    }
+    ReferenceT<ExecutableI> inputBroker;
+    if (ok) {
+        inputBroker = inputBrokers.Get(0u);
+        ok = inputBroker.IsValid();
+    }
+    if (ok) {
+        ok = (gama->IsTimingSignalNanoseconds());
+    }
+    if (ok) {
+        ok = (!inputBroker->IsTimingSignalNanoseconds());
+    }
+    ReferenceT<TimingDataSource> timings;
+    if (ok) {
+        timings = app->Find("Data.Timings");
+        ok = timings.IsValid();
+    }
+    uint32 cycleTimeIdx = 0u;
+    if (ok) {
+        ok = timings->GetSignalIndex(cycleTimeIdx, "State1.Thread1_CycleTime");
+    }
+    if (ok) {
+        ok = (timings->GetSignalType(cycleTimeIdx) == UnsignedInteger64Bit);
+    }
+    if (ok) {
+        ok = scheduler->PrepareNextState("", "State1");
+    }
+    if (ok) {
+        ok = app->StartNextStateExecution();
+    }
+    const uint32 numberOfCycles = 10u;
+    for (uint32 i = 0u; (i < numberOfCycles) && (ok); i++) {
+        ok = scheduler->ExecuteThreadCycle(0u);
+    }
+    if (ok) {
+        //The GAM is executed after the input broker, so that its time (in ns) must be at least the time of the input broker (in us)
+        uint64 execTime = *reinterpret_cast<uint64 *>(gama->GetTimingSignalAddress());
+        uint32 readTime = *inputBroker->GetTimingSignalAddress();
+        ok = (execTime >= (static_cast<uint64>(readTime) * 1000ull));
+    }
+    if (ok) {
+        ok = app->StopCurrentStateExecution();
+    }
+    return ok;
+}
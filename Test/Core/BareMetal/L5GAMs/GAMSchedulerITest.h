@@ -92,6 +92,16 @@ public:
      */
     bool TestExecuteSingleCycle_False();
 
+    /**
+     * @brief Tests that the ExecuteSingleCycle method updates the ExecutionTimeHistogram of the executables.
+     */
+    bool TestExecuteSingleCycle_ExecutionTimeHistograms();
+
+    /**
+     * @brief Tests that the ExecuteSingleCycle method writes the timing signals declared as uint64 in nano-seconds.
+     */
+    bool TestExecuteSingleCycle_NanosecondsTimingSignals();
+
 };
 
 /*---------------------------------------------------------------------------*/
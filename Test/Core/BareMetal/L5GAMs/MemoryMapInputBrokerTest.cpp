@@ -486,6 +486,61 @@ static const char8 * const config1 = ""
         "        TimingDataSource = Timings"
         "    }"
         "}";
+/**
+ * MARTe configuration structure to test the merging of contiguous copies
+ */
+static const char8 * const config2 = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapInputBrokerTestGAM1"
+        "            InputSignals = {"
+        "               Signal3 = {"
+        "                   DataSource = Drv1"
+        "                   Type = int32"
+        "                   NumberOfDimensions = 1"
+        "                   NumberOfElements = 6"
+        "                   Ranges = {{0 1} {2 3} {4 5}}"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = MemoryMapInputBrokerDataSourceTestHelper"
+        "            Signals = {"
+        "                Signal3 = {"
+        "                    Type = int32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 6"
+        "                }"
+        "            }"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = MemoryMapInputBrokerTestScheduler1"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -709,3 +764,59 @@ bool MemoryMapInputBrokerTest::TestExecute_MultiStateBuffer() {
     return ret;
 }
 
+
+bool MemoryMapInputBrokerTest::TestExecute_MergedCopies() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config2);
+    ReferenceT<MemoryMapInputBrokerDataSourceTestHelper> dataSource;
+    ReferenceT<MemoryMapInputBroker> broker;
+    ReferenceT<MemoryMapInputBrokerTestGAM1> gamA;
+    ReferenceContainer brokers;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        gamA = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gamA.IsValid();
+    }
+
+    if (ret) {
+        ret = dataSource->GetInputBrokers(brokers, "GAMA", (void *) gamA->GetInputSignalsMemory());
+    }
+    if (ret) {
+        ret = (brokers.Size() > 0u);
+    }
+    if (ret) {
+        broker = brokers.Get(0);
+        ret = broker.IsValid();
+    }
+    if (ret) {
+        ret = (broker->GetNumberOfCopies() == 3u);
+    }
+    const uint32 nBuffers = 10u;
+    uint32 b;
+    for (b = 0u; (b < nBuffers) && (ret); b++) {
+        ret = (broker->GetNumberOfMergedCopies(b) == 1u);
+    }
+    if (ret) {
+        ret = (broker->GetNumberOfMergedCopies(nBuffers) == 0u);
+    }
+    const uint32 byteSize = 24u;
+    for (b = 0u; (b < 2u) && (ret); b++) {
+        ret = broker->Execute();
+        uint8 *gamPtr = NULL_PTR(uint8 *);
+        if (ret) {
+            gamPtr = reinterpret_cast<uint8 *>(gamA->GetInputSignalMemory(0));
+        }
+        uint32 s;
+        for (s = 0u; (s < byteSize) && (ret); s++) {
+            uint32 n = (b * byteSize) + s;
+            ret = (gamPtr[s] == static_cast<uint8>(n * n));
+        }
+        if (ret) {
+            ret = dataSource->Synchronise();
+        }
+    }
+
+    return ret;
+}
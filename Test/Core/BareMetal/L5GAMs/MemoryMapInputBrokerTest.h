@@ -68,6 +68,12 @@ public:
      * @brief Tests the Execute method with a multi-state buffers.
      */
     bool TestExecute_MultiStateBuffer();
+
+    /**
+     * @brief Tests the Execute method with ranges that are contiguous both in the GAM and in the DataSourceI memory
+     * and that shall be merged into a single copy operation.
+     */
+    bool TestExecute_MergedCopies();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,616 @@
+/**
+ * @file MemoryMapSeqlockBrokerTest.cpp
+ * @brief Source file for class MemoryMapSeqlockBrokerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapSeqlockBrokerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapSeqlockBrokerTest.h"
+#include "Atomic.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "MemoryMapSeqlockInputBroker.h"
+#include "MemoryMapSeqlockOutputBroker.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which writes an incrementing counter to all the elements of all its uint32 output signals.
+ */
+class MemoryMapSeqlockBrokerTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MemoryMapSeqlockBrokerTestGAM() :
+            GAM() {
+        counter = 1u;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        bool ok = true;
+        for (uint32 n = 0u; (n < numberOfOutputSignals) && (ok); n++) {
+            uint32 byteSize = 0u;
+            ok = GetSignalByteSize(OutputSignals, n, byteSize);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(n));
+            for (uint32 e = 0u; (e < (byteSize / sizeof(uint32))) && (ok); e++) {
+                signal[e] = counter;
+            }
+        }
+        counter++;
+        return ok;
+    }
+
+    void *GetOutputSignalsMemory() {
+        return GAM::GetOutputSignalsMemory();
+    }
+
+    void *GetInputSignalsMemory() {
+        return GAM::GetInputSignalsMemory();
+    }
+
+    uint32 counter;
+};
+
+CLASS_REGISTER(MemoryMapSeqlockBrokerTestGAM, "1.0")
+
+static const char8 * const MemoryMapSeqlockBrokerTestConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapSeqlockBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = MemoryMapSeqlockBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                    Ranges = {{1, 2}}"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = MemoryMapSeqlockBrokerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            Seqlock = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB GAMC}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+static const char8 * const MemoryMapSeqlockBrokerTestConfigNoSeqlock = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapSeqlockBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = MemoryMapSeqlockBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                    Ranges = {{1, 2}}"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = MemoryMapSeqlockBrokerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            Seqlock = 0"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB GAMC}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the MemoryMapSeqlockBrokerTestConfig application.
+ */
+static bool MemoryMapSeqlockBrokerTestConfigure(const char8 * const config = MemoryMapSeqlockBrokerTestConfig) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    (void) configStream.Seek(0LLU);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the seqlock sequence, the first buffer and the buffer stride of the DDB1 signal with name \a signalName.
+ */
+static bool MemoryMapSeqlockBrokerTestGetSignal(const char8 * const signalName,
+                           volatile uint32 *&sequence,
+                           uint32 *&signal,
+                           uint32 &bufferStride) {
+    ReferenceT<GAMDataSource> dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+    bool ok = dataSource.IsValid();
+    uint32 signalIdx = 0u;
+    if (ok) {
+        ok = dataSource->GetSignalIndex(signalIdx, signalName);
+    }
+    uint32 byteSize = 0u;
+    if (ok) {
+        ok = dataSource->GetSeqlockSignal(signalIdx, sequence, byteSize, bufferStride);
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(signal));
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the first broker of the GAM with name \a gamName.
+ */
+static bool MemoryMapSeqlockBrokerTestGetBroker(const char8 * const gamName,
+                           const SignalDirection direction,
+                           ReferenceT<MemoryMapSeqlockBrokerTestGAM> &gam,
+                           ReferenceT<MemoryMapSeqlockBroker> &broker) {
+    StreamString gamPath = "Application1.Functions.";
+    gamPath += gamName;
+    gam = ObjectRegistryDatabase::Instance()->Find(gamPath.Buffer());
+    bool ok = gam.IsValid();
+    ReferenceContainer brokers;
+    if (ok) {
+        if (direction == InputSignals) {
+            ok = gam->GetInputBrokers(brokers);
+        }
+        else {
+            ok = gam->GetOutputBrokers(brokers);
+        }
+    }
+    if (ok) {
+        ok = (brokers.Size() == 1u);
+    }
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    return ok;
+}
+
+/**
+ * @brief Writer thread parameters of the TestCopyInputs_Concurrent test.
+ */
+struct MemoryMapSeqlockBrokerTestWriter {
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    ReferenceT<MemoryMapSeqlockBroker> broker;
+    volatile int32 running;
+    volatile int32 done;
+    bool ok;
+};
+
+/**
+ * @brief Executes the producer GAM and its output broker until running is cleared.
+ */
+static void MemoryMapSeqlockBrokerTestWriterCallback(MemoryMapSeqlockBrokerTestWriter * const writer) {
+    while ((writer->running == 1) && (writer->ok)) {
+        writer->ok = writer->gam->Execute();
+        if (writer->ok) {
+            writer->ok = writer->broker->Execute();
+        }
+    }
+    Atomic::Increment(&writer->done);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MemoryMapSeqlockBrokerTest::TestConstructor() {
+    MemoryMapSeqlockOutputBroker broker;
+    bool ok = (broker.GetNumberOfCopies() == 0u);
+    if (ok) {
+        ok = (broker.GetNumberOfSeqlockSignals() == 0u);
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestInit() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    ReferenceT<MemoryMapSeqlockBroker> broker;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMA", OutputSignals, gam, broker);
+    }
+    if (ok) {
+        ok = (broker->GetNumberOfSeqlockSignals() == 2u);
+    }
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMC", InputSignals, gam, broker);
+    }
+    if (ok) {
+        ok = (broker->GetNumberOfSeqlockSignals() == 3u);
+    }
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMB", OutputSignals, gam, broker);
+    }
+    if (ok) {
+        ok = (broker->GetNumberOfSeqlockSignals() == 1u);
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestInit_False_NotGAMDataSource() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    ReferenceT<DataSourceI> timings;
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    if (ok) {
+        timings = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Timings");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (timings.IsValid()) && (gam.IsValid());
+    }
+    if (ok) {
+        MemoryMapSeqlockOutputBroker broker;
+        ok = !broker.Init(OutputSignals, *(timings.operator->()), "GAMA", gam->GetOutputSignalsMemory());
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestInit_False_NoSeqlock() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure(MemoryMapSeqlockBrokerTestConfigNoSeqlock);
+    ReferenceT<GAMDataSource> dataSource;
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid()) && (gam.IsValid());
+    }
+    if (ok) {
+        MemoryMapSeqlockOutputBroker broker;
+        ok = !broker.Init(OutputSignals, *(dataSource.operator->()), "GAMA", gam->GetOutputSignalsMemory());
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestGetNumberOfSeqlockSignals() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    ReferenceT<GAMDataSource> dataSource;
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMC");
+        ok = (dataSource.IsValid()) && (gam.IsValid());
+    }
+    MemoryMapSeqlockInputBroker broker;
+    if (ok) {
+        ok = broker.Init(InputSignals, *(dataSource.operator->()), "GAMC", gam->GetInputSignalsMemory());
+    }
+    if (ok) {
+        ok = (broker.GetNumberOfSeqlockSignals() == 3u);
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestCopyOutputs() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    ReferenceT<MemoryMapSeqlockBroker> broker;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMA", OutputSignals, gam, broker);
+    }
+    volatile uint32 *sequence = NULL_PTR(volatile uint32 *);
+    uint32 *values = NULL_PTR(uint32 *);
+    uint32 bufferStride = 0u;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetSignal("Values", sequence, values, bufferStride);
+    }
+    uint32 *valuesSecondBuffer = NULL_PTR(uint32 *);
+    if (ok) {
+        valuesSecondBuffer = reinterpret_cast<uint32 *>(&(reinterpret_cast<char8 *>(values)[bufferStride]));
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = broker->Execute();
+    }
+    uint32 e;
+    if (ok) {
+        ok = (*sequence == 2u);
+    }
+    for (e = 0u; (e < 4u) && (ok); e++) {
+        ok = (values[e] == 0u) && (valuesSecondBuffer[e] == 1u);
+    }
+    if (ok) {
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = broker->Execute();
+    }
+    if (ok) {
+        ok = (*sequence == 4u);
+    }
+    for (e = 0u; (e < 4u) && (ok); e++) {
+        ok = (values[e] == 2u) && (valuesSecondBuffer[e] == 1u);
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestCopyOutputs_Ranges() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> gam;
+    ReferenceT<MemoryMapSeqlockBroker> broker;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMB", OutputSignals, gam, broker);
+    }
+    volatile uint32 *sequence = NULL_PTR(volatile uint32 *);
+    uint32 *partial = NULL_PTR(uint32 *);
+    uint32 bufferStride = 0u;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetSignal("Partial", sequence, partial, bufferStride);
+    }
+    uint32 *partialSecondBuffer = NULL_PTR(uint32 *);
+    if (ok) {
+        partialSecondBuffer = reinterpret_cast<uint32 *>(&(reinterpret_cast<char8 *>(partial)[bufferStride]));
+        partial[0] = 7u;
+        partial[3] = 9u;
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = broker->Execute();
+    }
+    if (ok) {
+        ok = (partialSecondBuffer[0] == 7u) && (partialSecondBuffer[1] == 1u) && (partialSecondBuffer[2] == 1u) && (partialSecondBuffer[3] == 9u);
+    }
+    if (ok) {
+        partialSecondBuffer[3] = 8u;
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = broker->Execute();
+    }
+    if (ok) {
+        ok = (partial[0] == 7u) && (partial[1] == 2u) && (partial[2] == 2u) && (partial[3] == 8u);
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestCopyInputs() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> producer;
+    ReferenceT<MemoryMapSeqlockBroker> outputBroker;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMA", OutputSignals, producer, outputBroker);
+    }
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> consumer;
+    ReferenceT<MemoryMapSeqlockBroker> inputBroker;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMC", InputSignals, consumer, inputBroker);
+    }
+    volatile uint32 *sequence = NULL_PTR(volatile uint32 *);
+    uint32 *counter = NULL_PTR(uint32 *);
+    uint32 bufferStride = 0u;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetSignal("Counter", sequence, counter, bufferStride);
+    }
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        ok = producer->Execute();
+        if (ok) {
+            ok = outputBroker->Execute();
+        }
+    }
+    uint32 *inputs = NULL_PTR(uint32 *);
+    if (ok) {
+        //Simulate a write in progress of the next buffer.
+        *sequence = 7u;
+        counter[0] = 100u;
+        ok = inputBroker->Execute();
+    }
+    if (ok) {
+        inputs = reinterpret_cast<uint32 *>(consumer->GetInputSignalsMemory());
+        ok = (inputs[0] == 3u);
+    }
+    for (c = 1u; (c < 5u) && (ok); c++) {
+        ok = (inputs[c] == 3u);
+    }
+    return ok;
+}
+
+bool MemoryMapSeqlockBrokerTest::TestCopyInputs_Concurrent() {
+    bool ok = MemoryMapSeqlockBrokerTestConfigure();
+    MemoryMapSeqlockBrokerTestWriter writer;
+    writer.running = 1;
+    writer.done = 0;
+    writer.ok = true;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMA", OutputSignals, writer.gam, writer.broker);
+    }
+    ReferenceT<MemoryMapSeqlockBrokerTestGAM> consumer;
+    ReferenceT<MemoryMapSeqlockBroker> inputBroker;
+    if (ok) {
+        ok = MemoryMapSeqlockBrokerTestGetBroker("GAMC", InputSignals, consumer, inputBroker);
+    }
+    if (ok) {
+        (void) Threads::BeginThread(reinterpret_cast<ThreadFunctionType>(&MemoryMapSeqlockBrokerTestWriterCallback), &writer);
+    }
+    uint32 *inputs = NULL_PTR(uint32 *);
+    if (ok) {
+        inputs = reinterpret_cast<uint32 *>(consumer->GetInputSignalsMemory());
+    }
+    uint32 lastCounter = 0u;
+    for (uint32 i = 0u; (i < 100000u) && (ok); i++) {
+        ok = inputBroker->Execute();
+        //The Counter and all the Values are written in the same cycle.
+        for (uint32 e = 1u; (e < 5u) && (ok); e++) {
+            ok = (inputs[e] == inputs[0]);
+        }
+        if (ok) {
+            ok = (inputs[0] >= lastCounter);
+            lastCounter = inputs[0];
+        }
+    }
+    writer.running = 0;
+    uint32 timeout = 0u;
+    while ((writer.done == 0) && (timeout < 100u)) {
+        Sleep::MSec(10u);
+        timeout++;
+    }
+    if (ok) {
+        ok = (writer.done == 1) && (writer.ok);
+    }
+    return ok;
+}
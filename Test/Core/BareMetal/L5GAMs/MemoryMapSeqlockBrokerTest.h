@@ -0,0 +1,98 @@
+/**
+ * @file MemoryMapSeqlockBrokerTest.h
+ * @brief Header file for class MemoryMapSeqlockBrokerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MemoryMapSeqlockBrokerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L5GAMS_MEMORYMAPSEQLOCKBROKERTEST_H_
+#define TEST_CORE_BAREMETAL_L5GAMS_MEMORYMAPSEQLOCKBROKERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapSeqlockBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the MemoryMapSeqlockBroker public methods.
+ */
+class MemoryMapSeqlockBrokerTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Init method.
+     */
+    bool TestInit();
+
+    /**
+     * @brief Tests that the Init method fails if the DataSource is not a GAMDataSource.
+     */
+    bool TestInit_False_NotGAMDataSource();
+
+    /**
+     * @brief Tests that the Init method fails if the GAMDataSource does not have Seqlock = 1.
+     */
+    bool TestInit_False_NoSeqlock();
+
+    /**
+     * @brief Tests that the GetNumberOfSeqlockSignals method counts a signal with Ranges only once.
+     */
+    bool TestGetNumberOfSeqlockSignals();
+
+    /**
+     * @brief Tests that the CopyOutputs method alternates the buffers and increments the sequence by two.
+     */
+    bool TestCopyOutputs();
+
+    /**
+     * @brief Tests that the CopyOutputs method keeps the elements which are not written by a GAM with Ranges.
+     */
+    bool TestCopyOutputs_Ranges();
+
+    /**
+     * @brief Tests that the CopyInputs method reads the last completely written buffer.
+     */
+    bool TestCopyInputs();
+
+    /**
+     * @brief Tests that the CopyInputs method never returns a torn copy while another thread is executing CopyOutputs.
+     */
+    bool TestCopyInputs_Concurrent();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L5GAMS_MEMORYMAPSEQLOCKBROKERTEST_H_ */
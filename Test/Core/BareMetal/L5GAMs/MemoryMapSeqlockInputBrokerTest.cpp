@@ -0,0 +1,265 @@
+/**
+ * @file MemoryMapSeqlockInputBrokerTest.cpp
+ * @brief Source file for class MemoryMapSeqlockInputBrokerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapSeqlockInputBrokerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapSeqlockInputBrokerTest.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which writes an incrementing counter to all the elements of all its uint32 output signals.
+ */
+class MemoryMapSeqlockInputBrokerTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MemoryMapSeqlockInputBrokerTestGAM() :
+            GAM() {
+        counter = 1u;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        bool ok = true;
+        for (uint32 n = 0u; (n < numberOfOutputSignals) && (ok); n++) {
+            uint32 numberOfElements = 0u;
+            ok = GetSignalNumberOfElements(OutputSignals, n, numberOfElements);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(n));
+            for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+                signal[e] = counter;
+            }
+        }
+        counter++;
+        return ok;
+    }
+
+    void *GetOutputSignalsMemory() {
+        return GAM::GetOutputSignalsMemory();
+    }
+
+    void *GetInputSignalsMemory() {
+        return GAM::GetInputSignalsMemory();
+    }
+
+    uint32 counter;
+};
+
+CLASS_REGISTER(MemoryMapSeqlockInputBrokerTestGAM, "1.0")
+
+static const char8 * const MemoryMapSeqlockInputBrokerTestConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapSeqlockInputBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = MemoryMapSeqlockInputBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                    Ranges = {{1, 2}}"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = MemoryMapSeqlockInputBrokerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            Seqlock = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB GAMC}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the MemoryMapSeqlockInputBrokerTestConfig application.
+ */
+static bool MemoryMapSeqlockInputBrokerTestConfigure(const char8 * const config = MemoryMapSeqlockInputBrokerTestConfig) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    (void) configStream.Seek(0LLU);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the first broker of the GAM with name \a gamName.
+ */
+static bool MemoryMapSeqlockInputBrokerTestGetBroker(const char8 * const gamName,
+                           const SignalDirection direction,
+                           ReferenceT<MemoryMapSeqlockInputBrokerTestGAM> &gam,
+                           ReferenceT<MemoryMapSeqlockBroker> &broker) {
+    StreamString gamPath = "Application1.Functions.";
+    gamPath += gamName;
+    gam = ObjectRegistryDatabase::Instance()->Find(gamPath.Buffer());
+    bool ok = gam.IsValid();
+    ReferenceContainer brokers;
+    if (ok) {
+        if (direction == InputSignals) {
+            ok = gam->GetInputBrokers(brokers);
+        }
+        else {
+            ok = gam->GetOutputBrokers(brokers);
+        }
+    }
+    if (ok) {
+        ok = (brokers.Size() == 1u);
+    }
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MemoryMapSeqlockInputBrokerTest::TestConstructor() {
+    MemoryMapSeqlockInputBroker broker;
+    return (broker.GetNumberOfCopies() == 0u);
+}
+
+bool MemoryMapSeqlockInputBrokerTest::TestExecute() {
+    bool ok = MemoryMapSeqlockInputBrokerTestConfigure();
+    ReferenceT<MemoryMapSeqlockInputBrokerTestGAM> producer;
+    ReferenceT<MemoryMapSeqlockBroker> outputBroker;
+    if (ok) {
+        ok = MemoryMapSeqlockInputBrokerTestGetBroker("GAMA", OutputSignals, producer, outputBroker);
+    }
+    ReferenceT<MemoryMapSeqlockInputBrokerTestGAM> consumer;
+    ReferenceT<MemoryMapSeqlockBroker> broker;
+    if (ok) {
+        ok = MemoryMapSeqlockInputBrokerTestGetBroker("GAMC", InputSignals, consumer, broker);
+    }
+    ReferenceT<MemoryMapSeqlockInputBroker> inputBroker;
+    if (ok) {
+        inputBroker = broker;
+        ok = inputBroker.IsValid();
+    }
+    for (uint32 c = 0u; (c < 2u) && (ok); c++) {
+        ok = producer->Execute();
+        if (ok) {
+            ok = outputBroker->Execute();
+        }
+    }
+    if (ok) {
+        ok = inputBroker->Execute();
+    }
+    if (ok) {
+        uint32 *inputs = reinterpret_cast<uint32 *>(consumer->GetInputSignalsMemory());
+        ok = (inputs[0] == 2u) && (inputs[4] == 2u);
+    }
+    return ok;
+}
@@ -0,0 +1,285 @@
+/**
+ * @file MemoryMapSeqlockOutputBrokerTest.cpp
+ * @brief Source file for class MemoryMapSeqlockOutputBrokerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapSeqlockOutputBrokerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MemoryMapSeqlockOutputBrokerTest.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which writes an incrementing counter to all the elements of all its uint32 output signals.
+ */
+class MemoryMapSeqlockOutputBrokerTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    MemoryMapSeqlockOutputBrokerTestGAM() :
+            GAM() {
+        counter = 1u;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        bool ok = true;
+        for (uint32 n = 0u; (n < numberOfOutputSignals) && (ok); n++) {
+            uint32 numberOfElements = 0u;
+            ok = GetSignalNumberOfElements(OutputSignals, n, numberOfElements);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(n));
+            for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+                signal[e] = counter;
+            }
+        }
+        counter++;
+        return ok;
+    }
+
+    void *GetOutputSignalsMemory() {
+        return GAM::GetOutputSignalsMemory();
+    }
+
+    void *GetInputSignalsMemory() {
+        return GAM::GetInputSignalsMemory();
+    }
+
+    uint32 counter;
+};
+
+CLASS_REGISTER(MemoryMapSeqlockOutputBrokerTestGAM, "1.0")
+
+static const char8 * const MemoryMapSeqlockOutputBrokerTestConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = MemoryMapSeqlockOutputBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = MemoryMapSeqlockOutputBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                    Ranges = {{1, 2}}"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMC = {"
+        "            Class = MemoryMapSeqlockOutputBrokerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Partial = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "            Seqlock = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB GAMC}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the MemoryMapSeqlockOutputBrokerTestConfig application.
+ */
+static bool MemoryMapSeqlockOutputBrokerTestConfigure(const char8 * const config = MemoryMapSeqlockOutputBrokerTestConfig) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    (void) configStream.Seek(0LLU);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the seqlock sequence, the first buffer and the buffer stride of the DDB1 signal with name \a signalName.
+ */
+static bool MemoryMapSeqlockOutputBrokerTestGetSignal(const char8 * const signalName,
+                           volatile uint32 *&sequence,
+                           uint32 *&signal,
+                           uint32 &bufferStride) {
+    ReferenceT<GAMDataSource> dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+    bool ok = dataSource.IsValid();
+    uint32 signalIdx = 0u;
+    if (ok) {
+        ok = dataSource->GetSignalIndex(signalIdx, signalName);
+    }
+    uint32 byteSize = 0u;
+    if (ok) {
+        ok = dataSource->GetSeqlockSignal(signalIdx, sequence, byteSize, bufferStride);
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, reinterpret_cast<void *&>(signal));
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the first broker of the GAM with name \a gamName.
+ */
+static bool MemoryMapSeqlockOutputBrokerTestGetBroker(const char8 * const gamName,
+                           const SignalDirection direction,
+                           ReferenceT<MemoryMapSeqlockOutputBrokerTestGAM> &gam,
+                           ReferenceT<MemoryMapSeqlockBroker> &broker) {
+    StreamString gamPath = "Application1.Functions.";
+    gamPath += gamName;
+    gam = ObjectRegistryDatabase::Instance()->Find(gamPath.Buffer());
+    bool ok = gam.IsValid();
+    ReferenceContainer brokers;
+    if (ok) {
+        if (direction == InputSignals) {
+            ok = gam->GetInputBrokers(brokers);
+        }
+        else {
+            ok = gam->GetOutputBrokers(brokers);
+        }
+    }
+    if (ok) {
+        ok = (brokers.Size() == 1u);
+    }
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool MemoryMapSeqlockOutputBrokerTest::TestConstructor() {
+    MemoryMapSeqlockOutputBroker broker;
+    return (broker.GetNumberOfCopies() == 0u);
+}
+
+bool MemoryMapSeqlockOutputBrokerTest::TestExecute() {
+    bool ok = MemoryMapSeqlockOutputBrokerTestConfigure();
+    ReferenceT<MemoryMapSeqlockOutputBrokerTestGAM> gam;
+    ReferenceT<MemoryMapSeqlockBroker> broker;
+    if (ok) {
+        ok = MemoryMapSeqlockOutputBrokerTestGetBroker("GAMA", OutputSignals, gam, broker);
+    }
+    ReferenceT<MemoryMapSeqlockOutputBroker> outputBroker;
+    if (ok) {
+        outputBroker = broker;
+        ok = outputBroker.IsValid();
+    }
+    volatile uint32 *sequence = NULL_PTR(volatile uint32 *);
+    uint32 *counter = NULL_PTR(uint32 *);
+    uint32 bufferStride = 0u;
+    if (ok) {
+        ok = MemoryMapSeqlockOutputBrokerTestGetSignal("Counter", sequence, counter, bufferStride);
+    }
+    if (ok) {
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = outputBroker->Execute();
+    }
+    if (ok) {
+        ok = (*sequence == 2u) && (counter[bufferStride / sizeof(uint32)] == 1u);
+    }
+    return ok;
+}
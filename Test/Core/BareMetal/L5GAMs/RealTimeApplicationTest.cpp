@@ -336,6 +336,98 @@ public:
 };
 CLASS_REGISTER(GAMRealTimeApplicationTestHelper1, "1.0")
 
+/**
+ * RealTimeApplicationConfigurationCacheI which keeps a copy of the databases in memory.
+ * The cache contents and the counters are static so that they survive to the ObjectRegistryDatabase purges.
+ */
+class RealTimeApplicationTestConfigurationCache: public Object, public RealTimeApplicationConfigurationCacheI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    RealTimeApplicationTestConfigurationCache() :
+            Object(),
+            RealTimeApplicationConfigurationCacheI() {
+    }
+
+    virtual ~RealTimeApplicationTestConfigurationCache() {
+    }
+
+    static void Reset() {
+        Clear();
+        numberOfLoads = 0u;
+        numberOfStores = 0u;
+    }
+
+    static void Clear() {
+        storedHash = 0u;
+        if (storedFunctions != NULL_PTR(ConfigurationDatabase *)) {
+            delete storedFunctions;
+            storedFunctions = NULL_PTR(ConfigurationDatabase *);
+        }
+        if (storedDataSources != NULL_PTR(ConfigurationDatabase *)) {
+            delete storedDataSources;
+            storedDataSources = NULL_PTR(ConfigurationDatabase *);
+        }
+    }
+
+    virtual bool Load(const uint32 configurationHash,
+                      ConfigurationDatabase &functionsDatabaseOut,
+                      ConfigurationDatabase &dataSourcesDatabaseOut) {
+        bool ok = (storedFunctions != NULL_PTR(ConfigurationDatabase *)) && (storedHash == configurationHash);
+        if (ok) {
+            ok = storedFunctions->MoveToRoot();
+        }
+        if (ok) {
+            ok = storedFunctions->Copy(functionsDatabaseOut);
+        }
+        if (ok) {
+            ok = storedDataSources->MoveToRoot();
+        }
+        if (ok) {
+            ok = storedDataSources->Copy(dataSourcesDatabaseOut);
+        }
+        if (ok) {
+            numberOfLoads++;
+        }
+        return ok;
+    }
+
+    virtual bool Store(const uint32 configurationHash,
+                       ConfigurationDatabase &functionsDatabaseIn,
+                       ConfigurationDatabase &dataSourcesDatabaseIn) {
+        Clear();
+        storedFunctions = new ConfigurationDatabase();
+        storedDataSources = new ConfigurationDatabase();
+        bool ok = functionsDatabaseIn.MoveToRoot();
+        if (ok) {
+            ok = dataSourcesDatabaseIn.MoveToRoot();
+        }
+        if (ok) {
+            ok = functionsDatabaseIn.Copy(*storedFunctions);
+        }
+        if (ok) {
+            ok = dataSourcesDatabaseIn.Copy(*storedDataSources);
+        }
+        if (ok) {
+            storedHash = configurationHash;
+            numberOfStores++;
+        }
+        return ok;
+    }
+
+    static uint32 storedHash;
+    static ConfigurationDatabase *storedFunctions;
+    static ConfigurationDatabase *storedDataSources;
+    static uint32 numberOfLoads;
+    static uint32 numberOfStores;
+};
+uint32 RealTimeApplicationTestConfigurationCache::storedHash = 0u;
+ConfigurationDatabase *RealTimeApplicationTestConfigurationCache::storedFunctions = NULL_PTR(ConfigurationDatabase *);
+ConfigurationDatabase *RealTimeApplicationTestConfigurationCache::storedDataSources = NULL_PTR(ConfigurationDatabase *);
+uint32 RealTimeApplicationTestConfigurationCache::numberOfLoads = 0u;
+uint32 RealTimeApplicationTestConfigurationCache::numberOfStores = 0u;
+CLASS_REGISTER(RealTimeApplicationTestConfigurationCache, "1.0")
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -3012,3 +3104,211 @@ bool RealTimeApplicationTest::TestCheckMultipleProducersWrites(){
     }
     return ret;
 }
+
+/**
+ * Generates a RealTimeApplication with numberOfGAMs GAM1 in one thread, where each GAM consumes the numberOfSignals outputs of the previous one.
+ */
+static void GenerateLargeConfiguration(StreamString &largeConfig,
+                                       const uint32 numberOfGAMs,
+                                       const uint32 numberOfSignals,
+                                       const bool withConfigurationCache) {
+    largeConfig = "";
+    largeConfig += "$Large = {";
+    largeConfig += "    Class = RealTimeApplication";
+    if (withConfigurationCache) {
+        largeConfig += "    +ConfigurationCache = {";
+        largeConfig += "        Class = RealTimeApplicationTestConfigurationCache";
+        largeConfig += "    }";
+    }
+    largeConfig += "    +Functions = {";
+    largeConfig += "        Class = ReferenceContainer";
+    for (uint32 i = 0u; i < numberOfGAMs; i++) {
+        uint32 previous = ((i == 0u) ? (numberOfGAMs - 1u) : (i - 1u));
+        (void) largeConfig.Printf("        +GAM%d = {", i);
+        largeConfig += "            Class = GAM1";
+        largeConfig += "            InputSignals = {";
+        for (uint32 j = 0u; j < numberOfSignals; j++) {
+            (void) largeConfig.Printf("                In%d = {", j);
+            largeConfig += "                    DataSource = DDB1";
+            largeConfig += "                    Type = uint32";
+            (void) largeConfig.Printf("                    Alias = S%d_%d", previous, j);
+            largeConfig += "                }";
+        }
+        largeConfig += "            }";
+        largeConfig += "            OutputSignals = {";
+        for (uint32 j = 0u; j < numberOfSignals; j++) {
+            (void) largeConfig.Printf("                Out%d = {", j);
+            largeConfig += "                    DataSource = DDB1";
+            largeConfig += "                    Type = uint32";
+            (void) largeConfig.Printf("                    Alias = S%d_%d", i, j);
+            largeConfig += "                }";
+        }
+        largeConfig += "            }";
+        largeConfig += "        }";
+    }
+    largeConfig += "    }";
+    largeConfig += "    +Data = {";
+    largeConfig += "        Class = ReferenceContainer";
+    largeConfig += "        DefaultDataSource = DDB1";
+    largeConfig += "        +DDB1 = {";
+    largeConfig += "            Class = GAMDataSource";
+    largeConfig += "        }";
+    largeConfig += "        +Timings = {";
+    largeConfig += "            Class = TimingDataSource";
+    largeConfig += "        }";
+    largeConfig += "    }";
+    largeConfig += "    +States = {";
+    largeConfig += "        Class = ReferenceContainer";
+    largeConfig += "        +State1 = {";
+    largeConfig += "            Class = RealTimeState";
+    largeConfig += "            +Threads = {";
+    largeConfig += "                Class = ReferenceContainer";
+    largeConfig += "                +Thread1 = {";
+    largeConfig += "                    Class = RealTimeThread";
+    largeConfig += "                    Functions = {";
+    for (uint32 i = 0u; i < numberOfGAMs; i++) {
+        (void) largeConfig.Printf(" GAM%d", i);
+    }
+    largeConfig += "                    }";
+    largeConfig += "                }";
+    largeConfig += "            }";
+    largeConfig += "        }";
+    largeConfig += "    }";
+    largeConfig += "    +Scheduler = {";
+    largeConfig += "        Class = RealTimeApplicationTestScheduler";
+    largeConfig += "        TimingDataSource = Timings";
+    largeConfig += "    }";
+    largeConfig += "}";
+}
+
+/**
+ * Initialises the ObjectRegistryDatabase with a GenerateLargeConfiguration and calls ConfigureApplication, returning the time that it took.
+ */
+static bool ConfigureLargeConfiguration(const uint32 numberOfGAMs,
+                                        const uint32 numberOfSignals,
+                                        const bool withConfigurationCache,
+                                        float64 &elapsed) {
+    StreamString largeConfig;
+    GenerateLargeConfiguration(largeConfig, numberOfGAMs, numberOfSignals, withConfigurationCache);
+    (void) largeConfig.Seek(0ull);
+    ConfigurationDatabase cdb;
+    StandardParser parser(largeConfig, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Large");
+        ok = app.IsValid();
+    }
+    uint64 start = HighResolutionTimer::Counter();
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+    }
+    return ok;
+}
+
+bool RealTimeApplicationTest::TestConfigureApplication_Benchmark() {
+    const uint32 numberOfGAMs = 400u;
+    const uint32 numberOfSignals = 10u;
+    float64 elapsed = 0.0;
+    bool ok = ConfigureLargeConfiguration(numberOfGAMs, numberOfSignals, false, elapsed);
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "ConfigureApplication of %d GAMs with %d signals each took %f s", numberOfGAMs,
+                            numberOfSignals, elapsed);
+    }
+    RealTimeApplicationTestConfigurationCache::Reset();
+    if (ok) {
+        ok = ConfigureLargeConfiguration(numberOfGAMs, numberOfSignals, true, elapsed);
+    }
+    if (ok) {
+        ok = ConfigureLargeConfiguration(numberOfGAMs, numberOfSignals, true, elapsed);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfLoads == 1u);
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "ConfigureApplication from the ConfigurationCache of %d GAMs with %d signals each took %f s",
+                            numberOfGAMs, numberOfSignals, elapsed);
+    }
+    RealTimeApplicationTestConfigurationCache::Reset();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool RealTimeApplicationTest::TestConfigureApplication_ConfigurationCache() {
+    const uint32 numberOfGAMs = 4u;
+    const uint32 numberOfSignals = 3u;
+    float64 elapsed = 0.0;
+    RealTimeApplicationTestConfigurationCache::Reset();
+    //Cache miss, the resolved configuration is stored
+    bool ok = ConfigureLargeConfiguration(numberOfGAMs, numberOfSignals, true, elapsed);
+    uint32 hash = 0u;
+    if (ok) {
+        ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Large");
+        hash = app->GetConfigurationHash();
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfLoads == 0u);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfStores == 1u);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::storedHash == hash);
+    }
+    //Cache hit, the builder is skipped
+    if (ok) {
+        ok = ConfigureLargeConfiguration(numberOfGAMs, numberOfSignals, true, elapsed);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfLoads == 1u);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfStores == 1u);
+    }
+    if (ok) {
+        ReferenceT<RealTimeApplication> app = ObjectRegistryDatabase::Instance()->Find("Large");
+        ok = (app->GetConfigurationHash() == hash);
+    }
+    if (ok) {
+        ReferenceT<GAM> gam = ObjectRegistryDatabase::Instance()->Find("Large.Functions.GAM1");
+        ok = gam.IsValid();
+        if (ok) {
+            ok = (gam->GetNumberOfInputSignals() == numberOfSignals);
+        }
+        ReferenceContainer brokers;
+        if (ok) {
+            ok = gam->GetInputBrokers(brokers);
+        }
+        if (ok) {
+            ok = (brokers.Size() > 0u);
+        }
+    }
+    if (ok) {
+        ReferenceT<DataSourceI> ddb1 = ObjectRegistryDatabase::Instance()->Find("Large.Data.DDB1");
+        ok = ddb1.IsValid();
+        if (ok) {
+            ok = (ddb1->GetNumberOfSignals() == (numberOfGAMs * numberOfSignals));
+        }
+    }
+    //A different configuration is a cache miss
+    if (ok) {
+        ok = ConfigureLargeConfiguration(numberOfGAMs + 1u, numberOfSignals, true, elapsed);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfLoads == 1u);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::numberOfStores == 2u);
+    }
+    if (ok) {
+        ok = (RealTimeApplicationTestConfigurationCache::storedHash != hash);
+    }
+    RealTimeApplicationTestConfigurationCache::Reset();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -207,6 +207,17 @@ public:
      */
     bool TestCheckMultipleProducersWrites();
 
+    /**
+     * @brief Measures the time that it takes to ConfigureApplication a large generated configuration, with and without a configuration cache.
+     */
+    bool TestConfigureApplication_Benchmark();
+
+    /**
+     * @brief Tests that ConfigureApplication stores the resolved databases in the ConfigurationCache and
+     * that a RealTimeApplication with the same configuration is configured from the ConfigurationCache.
+     */
+    bool TestConfigureApplication_ConfigurationCache();
+
 
     StreamString config;
 };
@@ -0,0 +1,599 @@
+/**
+ * @file SharedMemoryDataSourceTest.cpp
+ * @brief Source file for class SharedMemoryDataSourceTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSourceTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryDataSourceTest.h"
+#include "BrokerI.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "MemoryMapInputBroker.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "SharedMemory.h"
+#include "SharedMemoryOutputBroker.h"
+#include "SharedMemoryReader.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which writes an incrementing counter to all the elements of all its uint32 output signals.
+ */
+class SharedMemoryDataSourceTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryDataSourceTestGAM() :
+            GAM() {
+        counter = 1u;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        bool ok = true;
+        for (uint32 n = 0u; (n < numberOfOutputSignals) && (ok); n++) {
+            uint32 numberOfElements = 0u;
+            ok = GetSignalNumberOfElements(OutputSignals, n, numberOfElements);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(n));
+            for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+                signal[e] = counter;
+            }
+        }
+        counter++;
+        return ok;
+    }
+
+    void *GetOutputSignalsMemory() {
+        return GAM::GetOutputSignalsMemory();
+    }
+
+    void *GetInputSignalsMemory() {
+        return GAM::GetInputSignalsMemory();
+    }
+
+    uint32 counter;
+};
+
+CLASS_REGISTER(SharedMemoryDataSourceTestGAM, "1.0")
+
+static const char8 * const SharedMemoryDataSourceTestConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = SharedMemoryDataSourceTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = SharedMemoryDataSourceTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                CounterCopy = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +SHM = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTest\""
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+static const char8 * const SharedMemoryDataSourceTestConfigKeep = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = SharedMemoryDataSourceTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = SharedMemoryDataSourceTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                CounterCopy = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +SHM = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryDataSourceTestKeep\""
+        "            RemoveOnExit = 0"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+
+/**
+ * @brief Configures the SharedMemoryDataSourceTestConfig application.
+ */
+static bool SharedMemoryDataSourceTestConfigure(const char8 * const config = SharedMemoryDataSourceTestConfig) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    (void) configStream.Seek(0LLU);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Configures the application and executes GAMA and its SharedMemoryOutputBroker \a cycles times.
+ */
+static bool SharedMemoryDataSourceTestExecute(const uint32 cycles) {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    ReferenceT<SharedMemoryDataSourceTestGAM> gam;
+    ReferenceContainer brokers;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAMA", gam->GetOutputSignalsMemory());
+    }
+    ReferenceT<BrokerI> broker;
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    for (uint32 c = 0u; (c < cycles) && (ok); c++) {
+        ok = gam->Execute();
+        if (ok) {
+            ok = broker->Execute();
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SharedMemoryDataSourceTest::TestConstructor() {
+    SharedMemoryDataSource dataSource;
+    bool ok = (dataSource.GetNumberOfSignals() == 0u);
+    if (ok) {
+        ok = (StringHelper::Length(dataSource.GetSharedMemoryName()) == 0u);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise() {
+    SharedMemoryDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SharedMemoryName", "/MARTe2Test");
+    if (ok) {
+        ok = dataSource.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetSharedMemoryName(), "/MARTe2Test") == 0);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise_AddSlash() {
+    SharedMemoryDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SharedMemoryName", "MARTe2Test");
+    if (ok) {
+        ok = dataSource.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetSharedMemoryName(), "/MARTe2Test") == 0);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestInitialise_False_NoSharedMemoryName() {
+    SharedMemoryDataSource dataSource;
+    ConfigurationDatabase cdb;
+    return !dataSource.Initialise(cdb);
+}
+
+bool SharedMemoryDataSourceTest::TestAllocateMemory() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryDataSourceTest");
+    }
+    if (ok) {
+        ok = (reader.GetNumberOfSignals() == 2u);
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    if (ok) {
+        ok = (reader.GetSignalType(idx) == UnsignedInteger32Bit);
+    }
+    if (ok) {
+        ok = (reader.GetSignalNumberOfElements(idx) == 4u);
+    }
+    if (ok) {
+        ok = (reader.GetSignalByteSize(idx) == 16u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestAllocateMemory_False_Twice() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = !dataSource->AllocateMemory();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestGetSignalMemoryBuffer() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        ok = dataSource.IsValid();
+    }
+    uint32 counterIdx = 0u;
+    uint32 valuesIdx = 0u;
+    if (ok) {
+        ok = dataSource->GetSignalIndex(counterIdx, "Counter");
+    }
+    if (ok) {
+        ok = dataSource->GetSignalIndex(valuesIdx, "Values");
+    }
+    void *counterAddress = NULL_PTR(void *);
+    void *valuesAddress = NULL_PTR(void *);
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(counterIdx, 0u, counterAddress);
+    }
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(valuesIdx, 0u, valuesAddress);
+    }
+    if (ok) {
+        ok = (counterAddress != NULL) && (valuesAddress != NULL) && (counterAddress != valuesAddress);
+    }
+    if (ok) {
+        void *invalid = NULL_PTR(void *);
+        ok = !dataSource->GetSignalMemoryBuffer(2u, 0u, invalid);
+        if (ok) {
+            ok = !dataSource->GetSignalMemoryBuffer(counterIdx, 1u, invalid);
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestGetBrokerName() {
+    SharedMemoryDataSource dataSource;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(dataSource.GetBrokerName(cdb, InputSignals), "MemoryMapInputBroker") == 0);
+    if (ok) {
+        ok = (StringHelper::Compare(dataSource.GetBrokerName(cdb, OutputSignals), "SharedMemoryOutputBroker") == 0);
+    }
+    if (ok) {
+        ok = cdb.Write("Samples", 2u);
+    }
+    if (ok) {
+        ok = (dataSource.GetBrokerName(cdb, OutputSignals) == NULL);
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestGetInputBrokers() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    ReferenceT<SharedMemoryDataSourceTestGAM> gam;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMB");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    ReferenceContainer brokers;
+    if (ok) {
+        ok = dataSource->GetInputBrokers(brokers, "GAMB", gam->GetInputSignalsMemory());
+    }
+    if (ok) {
+        ReferenceT<MemoryMapInputBroker> broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestGetOutputBrokers() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    ReferenceT<SharedMemoryDataSourceTestGAM> gam;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    ReferenceContainer brokers;
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAMA", gam->GetOutputSignalsMemory());
+    }
+    if (ok) {
+        ReferenceT<SharedMemoryOutputBroker> broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestPrepareNextState() {
+    SharedMemoryDataSource dataSource;
+    return dataSource.PrepareNextState("State1", "State2");
+}
+
+bool SharedMemoryDataSourceTest::TestSynchronise() {
+    SharedMemoryDataSource dataSource;
+    return dataSource.Synchronise();
+}
+
+bool SharedMemoryDataSourceTest::TestBeginWrite() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        ok = dataSource.IsValid();
+    }
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryDataSourceTest");
+    }
+    uint32 value = 0u;
+    uint32 sequence = 0u;
+    if (ok) {
+        ok = reader.Read(0u, &value, sequence);
+    }
+    if (ok) {
+        ok = (sequence == 0u);
+    }
+    if (ok) {
+        dataSource->BeginWrite(0u);
+        ok = !reader.Read(0u, &value, sequence, 10u);
+        dataSource->EndWrite(0u);
+    }
+    if (ok) {
+        ok = reader.Read(0u, &value, sequence);
+    }
+    if (ok) {
+        ok = (sequence == 2u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestEndWrite() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        ok = dataSource.IsValid();
+    }
+    uint32 counterIdx = 0u;
+    if (ok) {
+        ok = dataSource->GetSignalIndex(counterIdx, "Counter");
+    }
+    void *counterAddress = NULL_PTR(void *);
+    if (ok) {
+        ok = dataSource->GetSignalMemoryBuffer(counterIdx, 0u, counterAddress);
+    }
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryDataSourceTest");
+    }
+    uint32 readerIdx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Counter", readerIdx);
+    }
+    for (uint32 i = 1u; (i < 5u) && (ok); i++) {
+        dataSource->BeginWrite(0u);
+        *reinterpret_cast<uint32 *>(counterAddress) = (i * 10u);
+        dataSource->EndWrite(0u);
+        uint32 value = 0u;
+        uint32 sequence = 0u;
+        ok = reader.Read(readerIdx, &value, sequence);
+        if (ok) {
+            ok = (value == (i * 10u)) && (sequence == (2u * i));
+        }
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestRemoveOnExit() {
+    bool ok = SharedMemoryDataSourceTestConfigure();
+    ObjectRegistryDatabase::Instance()->Purge();
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = !reader.Open("/MARTe2SharedMemoryDataSourceTest");
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestRemoveOnExit_False() {
+    bool ok = SharedMemoryDataSourceTestConfigure(SharedMemoryDataSourceTestConfigKeep);
+    ObjectRegistryDatabase::Instance()->Purge();
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryDataSourceTestKeep");
+    }
+    reader.Close();
+    if (ok) {
+        ok = SharedMemory::Remove("/MARTe2SharedMemoryDataSourceTestKeep");
+    }
+    return ok;
+}
+
+bool SharedMemoryDataSourceTest::TestExecute() {
+    bool ok = SharedMemoryDataSourceTestExecute(3u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryDataSourceTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    uint32 values[4];
+    uint32 sequence = 0u;
+    if (ok) {
+        ok = reader.Read(idx, &values[0], sequence);
+    }
+    if (ok) {
+        ok = (sequence == 6u);
+    }
+    for (uint32 e = 0u; (e < 4u) && (ok); e++) {
+        ok = (values[e] == 3u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file SharedMemoryDataSourceTest.h
+ * @brief Header file for class SharedMemoryDataSourceTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryDataSourceTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYDATASOURCETEST_H_
+#define TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYDATASOURCETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryDataSource.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the SharedMemoryDataSource public methods.
+ */
+class SharedMemoryDataSourceTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that Initialise prepends a '/' to the SharedMemoryName if missing.
+     */
+    bool TestInitialise_AddSlash();
+
+    /**
+     * @brief Tests that Initialise fails if the SharedMemoryName is not specified.
+     */
+    bool TestInitialise_False_NoSharedMemoryName();
+
+    /**
+     * @brief Tests that AllocateMemory creates a segment which describes all the signals.
+     */
+    bool TestAllocateMemory();
+
+    /**
+     * @brief Tests that AllocateMemory fails if called twice.
+     */
+    bool TestAllocateMemory_False_Twice();
+
+    /**
+     * @brief Tests that GetSignalMemoryBuffer returns distinct non-overlapping addresses for each signal.
+     */
+    bool TestGetSignalMemoryBuffer();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests that GetInputBrokers adds a MemoryMapInputBroker for a function with input signals.
+     */
+    bool TestGetInputBrokers();
+
+    /**
+     * @brief Tests that GetOutputBrokers adds a SharedMemoryOutputBroker for a function with output signals.
+     */
+    bool TestGetOutputBrokers();
+
+    /**
+     * @brief Tests the PrepareNextState method.
+     */
+    bool TestPrepareNextState();
+
+    /**
+     * @brief Tests the Synchronise method.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests that BeginWrite makes the buffer sequence odd, so that the readers cannot get a consistent copy.
+     */
+    bool TestBeginWrite();
+
+    /**
+     * @brief Tests that EndWrite publishes the data written after BeginWrite.
+     */
+    bool TestEndWrite();
+
+    /**
+     * @brief Tests that the segment is removed when the SharedMemoryDataSource is destroyed.
+     */
+    bool TestRemoveOnExit();
+
+    /**
+     * @brief Tests that the segment is kept when RemoveOnExit = 0.
+     */
+    bool TestRemoveOnExit_False();
+
+    /**
+     * @brief Tests that the values written by a GAM through the SharedMemoryOutputBroker are read by the SharedMemoryReader.
+     */
+    bool TestExecute();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYDATASOURCETEST_H_ */
@@ -0,0 +1,290 @@
+/**
+ * @file SharedMemoryOutputBrokerTest.cpp
+ * @brief Source file for class SharedMemoryOutputBrokerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryOutputBrokerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryOutputBrokerTest.h"
+#include "BrokerI.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "SharedMemory.h"
+#include "SharedMemoryDataSource.h"
+#include "SharedMemoryReader.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which writes an incrementing counter to all the elements of all its uint32 output signals.
+ */
+class SharedMemoryOutputBrokerTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryOutputBrokerTestGAM() :
+            GAM() {
+        counter = 1u;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        bool ok = true;
+        for (uint32 n = 0u; (n < numberOfOutputSignals) && (ok); n++) {
+            uint32 numberOfElements = 0u;
+            ok = GetSignalNumberOfElements(OutputSignals, n, numberOfElements);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(n));
+            for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+                signal[e] = counter;
+            }
+        }
+        counter++;
+        return ok;
+    }
+
+    void *GetOutputSignalsMemory() {
+        return GAM::GetOutputSignalsMemory();
+    }
+
+    void *GetInputSignalsMemory() {
+        return GAM::GetInputSignalsMemory();
+    }
+
+    uint32 counter;
+};
+
+CLASS_REGISTER(SharedMemoryOutputBrokerTestGAM, "1.0")
+
+static const char8 * const SharedMemoryOutputBrokerTestConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = SharedMemoryOutputBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = SharedMemoryOutputBrokerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                CounterCopy = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +SHM = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryOutputBrokerTest\""
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the SharedMemoryOutputBrokerTestConfig application.
+ */
+static bool SharedMemoryOutputBrokerTestConfigure(const char8 * const config = SharedMemoryOutputBrokerTestConfig) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    (void) configStream.Seek(0LLU);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Configures the application and executes GAMA and its SharedMemoryOutputBroker \a cycles times.
+ */
+static bool SharedMemoryOutputBrokerTestExecute(const uint32 cycles) {
+    bool ok = SharedMemoryOutputBrokerTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    ReferenceT<SharedMemoryOutputBrokerTestGAM> gam;
+    ReferenceContainer brokers;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAMA", gam->GetOutputSignalsMemory());
+    }
+    ReferenceT<BrokerI> broker;
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    for (uint32 c = 0u; (c < cycles) && (ok); c++) {
+        ok = gam->Execute();
+        if (ok) {
+            ok = broker->Execute();
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SharedMemoryOutputBrokerTest::TestConstructor() {
+    SharedMemoryOutputBroker broker;
+    return (broker.GetNumberOfCopies() == 0u);
+}
+
+bool SharedMemoryOutputBrokerTest::TestInit() {
+    bool ok = SharedMemoryOutputBrokerTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    ReferenceT<SharedMemoryOutputBrokerTestGAM> gam;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    ReferenceT<SharedMemoryOutputBroker> broker("SharedMemoryOutputBroker");
+    if (ok) {
+        ok = broker.IsValid();
+    }
+    if (ok) {
+        ok = broker->Init(OutputSignals, *(dataSource.operator->()), "GAMA", gam->GetOutputSignalsMemory());
+    }
+    if (ok) {
+        ok = (broker->GetNumberOfCopies() == 2u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryOutputBrokerTest::TestInit_False_NotSharedMemoryDataSource() {
+    bool ok = SharedMemoryOutputBrokerTestConfigure();
+    ReferenceT<GAMDataSource> dataSource;
+    ReferenceT<SharedMemoryOutputBrokerTestGAM> gam;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.DDB1");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    SharedMemoryOutputBroker broker;
+    if (ok) {
+        ok = !broker.Init(OutputSignals, *(dataSource.operator->()), "GAMA", gam->GetOutputSignalsMemory(), true);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryOutputBrokerTest::TestExecute() {
+    bool ok = SharedMemoryOutputBrokerTestExecute(5u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryOutputBrokerTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Counter", idx);
+    }
+    uint32 value = 0u;
+    uint32 sequence = 0u;
+    if (ok) {
+        ok = reader.Read(idx, &value, sequence);
+    }
+    if (ok) {
+        ok = (value == 5u) && (sequence == 10u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryOutputBrokerTest::TestExecute_False_NotInitialised() {
+    SharedMemoryOutputBroker broker;
+    return !broker.Execute();
+}
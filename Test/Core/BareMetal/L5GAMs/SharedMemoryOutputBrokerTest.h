@@ -0,0 +1,78 @@
+/**
+ * @file SharedMemoryOutputBrokerTest.h
+ * @brief Header file for class SharedMemoryOutputBrokerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryOutputBrokerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYOUTPUTBROKERTEST_H_
+#define TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYOUTPUTBROKERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryOutputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the SharedMemoryOutputBroker public methods.
+ */
+class SharedMemoryOutputBrokerTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Init method with a SharedMemoryDataSource.
+     */
+    bool TestInit();
+
+    /**
+     * @brief Tests that Init fails if the DataSourceI is not a SharedMemoryDataSource.
+     */
+    bool TestInit_False_NotSharedMemoryDataSource();
+
+    /**
+     * @brief Tests that Execute copies the GAM signals into the segment and increments the buffer sequence by two.
+     */
+    bool TestExecute();
+
+    /**
+     * @brief Tests that Execute fails if the broker was not initialised.
+     */
+    bool TestExecute_False_NotInitialised();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYOUTPUTBROKERTEST_H_ */
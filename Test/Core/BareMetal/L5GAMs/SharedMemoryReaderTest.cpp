@@ -0,0 +1,521 @@
+/**
+ * @file SharedMemoryReaderTest.cpp
+ * @brief Source file for class SharedMemoryReaderTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryReaderTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryReaderTest.h"
+#include "BrokerI.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "GAMDataSource.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "SharedMemory.h"
+#include "SharedMemoryDataSource.h"
+#include "SharedMemoryReader.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief GAM which writes an incrementing counter to all the elements of all its uint32 output signals.
+ */
+class SharedMemoryReaderTestGAM: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    SharedMemoryReaderTestGAM() :
+            GAM() {
+        counter = 1u;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+        bool ok = true;
+        for (uint32 n = 0u; (n < numberOfOutputSignals) && (ok); n++) {
+            uint32 numberOfElements = 0u;
+            ok = GetSignalNumberOfElements(OutputSignals, n, numberOfElements);
+            uint32 *signal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(n));
+            for (uint32 e = 0u; (e < numberOfElements) && (ok); e++) {
+                signal[e] = counter;
+            }
+        }
+        counter++;
+        return ok;
+    }
+
+    void *GetOutputSignalsMemory() {
+        return GAM::GetOutputSignalsMemory();
+    }
+
+    void *GetInputSignalsMemory() {
+        return GAM::GetInputSignalsMemory();
+    }
+
+    uint32 counter;
+};
+
+CLASS_REGISTER(SharedMemoryReaderTestGAM, "1.0")
+
+static const char8 * const SharedMemoryReaderTestConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = SharedMemoryReaderTestGAM"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "                Values = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 4"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = SharedMemoryReaderTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = SHM"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                CounterCopy = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +SHM = {"
+        "            Class = SharedMemoryDataSource"
+        "            SharedMemoryName = \"/MARTe2SharedMemoryReaderTest\""
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMBareScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the SharedMemoryReaderTestConfig application.
+ */
+static bool SharedMemoryReaderTestConfigure(const char8 * const config = SharedMemoryReaderTestConfig) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    (void) configStream.Seek(0LLU);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Application1");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Configures the application and executes GAMA and its SharedMemoryOutputBroker \a cycles times.
+ */
+static bool SharedMemoryReaderTestExecute(const uint32 cycles) {
+    bool ok = SharedMemoryReaderTestConfigure();
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    ReferenceT<SharedMemoryReaderTestGAM> gam;
+    ReferenceContainer brokers;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ok = (dataSource.IsValid() && gam.IsValid());
+    }
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAMA", gam->GetOutputSignalsMemory());
+    }
+    ReferenceT<BrokerI> broker;
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    for (uint32 c = 0u; (c < cycles) && (ok); c++) {
+        ok = gam->Execute();
+        if (ok) {
+            ok = broker->Execute();
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SharedMemoryReaderTest::TestConstructor() {
+    SharedMemoryReader reader;
+    bool ok = (reader.GetNumberOfSignals() == 0u);
+    if (ok) {
+        ok = (reader.GetSignalName(0u) == NULL);
+    }
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestOpen() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    if (ok) {
+        ok = (reader.GetNumberOfSignals() == 2u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestOpen_False_NotExisting() {
+    SharedMemoryReader reader;
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryReaderTestMissing");
+    return !reader.Open("/MARTe2SharedMemoryReaderTestMissing");
+}
+
+bool SharedMemoryReaderTest::TestOpen_False_InvalidMagic() {
+    uint32 size = 4096u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryReaderTestInvalid", size);
+    bool ok = (address != NULL);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = !reader.Open("/MARTe2SharedMemoryReaderTestInvalid");
+    }
+    if (ok) {
+        ok = (reader.GetNumberOfSignals() == 0u);
+    }
+    SharedMemory::Close(address, size);
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryReaderTestInvalid");
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestOpen_False_InvalidLayout() {
+    uint32 size = 4096u;
+    void *address = SharedMemory::Create("/MARTe2SharedMemoryReaderTestInvalid", size);
+    bool ok = (address != NULL);
+    if (ok) {
+        SharedMemoryDataSourceHeader *segmentHeader = reinterpret_cast<SharedMemoryDataSourceHeader *>(address);
+        segmentHeader->magic = SHARED_MEMORY_DATASOURCE_MAGIC;
+        segmentHeader->version = SHARED_MEMORY_DATASOURCE_VERSION;
+        segmentHeader->numberOfSignals = 1000u;
+        segmentHeader->numberOfStateBuffers = 1u;
+        segmentHeader->signalTableOffset = 64u;
+    }
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = !reader.Open("/MARTe2SharedMemoryReaderTestInvalid");
+    }
+    SharedMemory::Close(address, size);
+    (void) SharedMemory::Remove("/MARTe2SharedMemoryReaderTestInvalid");
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestClose() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    reader.Close();
+    if (ok) {
+        ok = (reader.GetNumberOfSignals() == 0u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetNumberOfSignals() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    if (ok) {
+        ok = (reader.GetNumberOfSignals() == 2u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalIndex() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 counterIdx = 10u;
+    uint32 valuesIdx = 10u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Counter", counterIdx);
+    }
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", valuesIdx);
+    }
+    if (ok) {
+        ok = (counterIdx < 2u) && (valuesIdx < 2u) && (counterIdx != valuesIdx);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalIndex_False() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = !reader.GetSignalIndex("Invalid", idx);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalName() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(reader.GetSignalName(idx), "Values") == 0);
+    }
+    if (ok) {
+        ok = (reader.GetSignalName(2u) == NULL);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalType() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    if (ok) {
+        ok = (reader.GetSignalType(0u) == UnsignedInteger32Bit);
+    }
+    if (ok) {
+        ok = (reader.GetSignalType(2u) == InvalidType);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalNumberOfElements() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    if (ok) {
+        ok = (reader.GetSignalNumberOfElements(idx) == 4u);
+    }
+    if (ok) {
+        ok = (reader.GetSignalNumberOfElements(2u) == 0u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalNumberOfDimensions() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    if (ok) {
+        ok = (reader.GetSignalNumberOfDimensions(idx) == 1u);
+    }
+    if (ok) {
+        ok = reader.GetSignalIndex("Counter", idx);
+    }
+    if (ok) {
+        ok = (reader.GetSignalNumberOfDimensions(idx) == 0u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestGetSignalByteSize() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    if (ok) {
+        ok = (reader.GetSignalByteSize(idx) == 16u);
+    }
+    if (ok) {
+        ok = (reader.GetSignalByteSize(2u) == 0u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestRead() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 idx = 0u;
+    if (ok) {
+        ok = reader.GetSignalIndex("Values", idx);
+    }
+    uint32 values[4] = { 0u, 0u, 0u, 0u };
+    uint32 sequence = 1u;
+    if (ok) {
+        ok = reader.Read(idx, &values[0], sequence);
+    }
+    if (ok) {
+        ok = (sequence == 4u);
+    }
+    for (uint32 e = 0u; (e < 4u) && (ok); e++) {
+        ok = (values[e] == 2u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestRead_False_InvalidSignal() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    uint32 value = 0u;
+    uint32 sequence = 0u;
+    if (ok) {
+        ok = !reader.Read(2u, &value, sequence);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool SharedMemoryReaderTest::TestRead_False_WriteOngoing() {
+    bool ok = SharedMemoryReaderTestExecute(2u);
+    SharedMemoryReader reader;
+    if (ok) {
+        ok = reader.Open("/MARTe2SharedMemoryReaderTest");
+    }
+    ReferenceT<SharedMemoryDataSource> dataSource;
+    if (ok) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.SHM");
+        ok = dataSource.IsValid();
+    }
+    uint32 value = 0u;
+    uint32 sequence = 0u;
+    if (ok) {
+        dataSource->BeginWrite(0u);
+        ok = !reader.Read(0u, &value, sequence, 5u);
+        dataSource->EndWrite(0u);
+    }
+    if (ok) {
+        ok = reader.Read(0u, &value, sequence, 5u);
+    }
+    reader.Close();
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
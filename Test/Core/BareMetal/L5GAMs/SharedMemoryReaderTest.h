@@ -0,0 +1,138 @@
+/**
+ * @file SharedMemoryReaderTest.h
+ * @brief Header file for class SharedMemoryReaderTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryReaderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYREADERTEST_H_
+#define TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYREADERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryReader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the SharedMemoryReader public methods.
+ */
+class SharedMemoryReaderTest {
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Open method on a segment created by a SharedMemoryDataSource.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that Open fails if the segment does not exist.
+     */
+    bool TestOpen_False_NotExisting();
+
+    /**
+     * @brief Tests that Open fails if the segment was not created by a SharedMemoryDataSource.
+     */
+    bool TestOpen_False_InvalidMagic();
+
+    /**
+     * @brief Tests that Open fails if the segment header describes a layout larger than the segment.
+     */
+    bool TestOpen_False_InvalidLayout();
+
+    /**
+     * @brief Tests that Close releases the segment.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests the GetNumberOfSignals method.
+     */
+    bool TestGetNumberOfSignals();
+
+    /**
+     * @brief Tests the GetSignalIndex method.
+     */
+    bool TestGetSignalIndex();
+
+    /**
+     * @brief Tests that GetSignalIndex fails for a signal that does not exist.
+     */
+    bool TestGetSignalIndex_False();
+
+    /**
+     * @brief Tests the GetSignalName method.
+     */
+    bool TestGetSignalName();
+
+    /**
+     * @brief Tests the GetSignalType method.
+     */
+    bool TestGetSignalType();
+
+    /**
+     * @brief Tests the GetSignalNumberOfElements method.
+     */
+    bool TestGetSignalNumberOfElements();
+
+    /**
+     * @brief Tests the GetSignalNumberOfDimensions method.
+     */
+    bool TestGetSignalNumberOfDimensions();
+
+    /**
+     * @brief Tests the GetSignalByteSize method.
+     */
+    bool TestGetSignalByteSize();
+
+    /**
+     * @brief Tests that Read copies the last values written by the SharedMemoryOutputBroker.
+     */
+    bool TestRead();
+
+    /**
+     * @brief Tests that Read fails for an invalid signal index.
+     */
+    bool TestRead_False_InvalidSignal();
+
+    /**
+     * @brief Tests that Read fails if the buffer is being written for all the retries.
+     */
+    bool TestRead_False_WriteOngoing();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_CORE_BAREMETAL_L5GAMS_SHAREDMEMORYREADERTEST_H_ */
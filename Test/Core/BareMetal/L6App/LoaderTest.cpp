@@ -28,6 +28,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "BinaryConfiguration.h"
 #include "CLASSMETHODREGISTER.h"
 #include "ConfigurationLoaderHashCRC.h"
 #include "Loader.h"
@@ -35,6 +36,7 @@
 #include "MessageI.h"
 #include "ObjectRegistryDatabase.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "StandardParser.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -61,6 +63,31 @@ public:
 CLASS_REGISTER(LoaderTestMessageObject1, "1.0")
 CLASS_METHOD_REGISTER(LoaderTestMessageObject1, Callback)
 
+/**
+ * @brief Parses a cdb configuration and exports it with BinaryConfiguration::Export.
+ */
+static bool LoaderTestExportBinary(const MARTe::char8 * const cdbConfig, MARTe::StreamString &binaryConfig) {
+    using namespace MARTe;
+    StreamString config = cdbConfig;
+    ConfigurationDatabase cdb;
+    bool ok = config.Seek(0LLU);
+    if (ok) {
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        binaryConfig = "";
+        ok = BinaryConfiguration::Export(cdb, binaryConfig);
+    }
+    if (ok) {
+        ok = binaryConfig.Seek(0LLU);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -145,6 +172,42 @@ bool LoaderTest::TestConfigure_Xml() {
     return ok;
 }
 
+bool LoaderTest::TestConfigure_Binary() {
+    using namespace MARTe;
+    ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    StreamString config;
+    bool ok = LoaderTestExportBinary("+A={"
+            "   Class = ReferenceContainer"
+            "   +B={"
+            "       Class = ReferenceContainer"
+            "   }"
+            "}", config);
+    ConfigurationDatabase params;
+    params.Write("Parser", "bin");
+    if (ok) {
+        ok = l->Configure(params, config);
+    }
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("A.B");
+        ok = ref.IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoaderTest::TestConfigure_False_Binary() {
+    using namespace MARTe;
+    ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    StreamString config = "+A={"
+            "   Class = ReferenceContainer"
+            "}";
+    ConfigurationDatabase params;
+    params.Write("Parser", "bin");
+    bool ok = !l->Configure(params, config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool LoaderTest::TestConfigure_False_NoParser() {
     using namespace MARTe;
     ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
@@ -539,6 +602,59 @@ bool LoaderTest::TestReconfigure_Hash() {
 }
 
 
+bool LoaderTest::TestReconfigure_Hash_Binary() {
+    using namespace MARTe;
+    ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    StreamString config;
+    bool ok = LoaderTestExportBinary(""
+            "+LoaderPostInit={"
+            "   Class = ReferenceContainer"
+            "   +Hash = {"
+            "       Class = ConfigurationLoaderHashCRC"
+            "       Key = 0x1"
+            "   }"
+            "}"
+            "+H={"
+            "   Class = ConfigurationLoaderHashCRC"
+            "   Key = 0x1"
+            "}", config);
+    ConfigurationDatabase params;
+    params.Write("Parser", "bin");
+    if (ok) {
+        ok = l->Configure(params, config);
+    }
+    if (ok) {
+        ok = LoaderTestExportBinary("+C={"
+                "   Class = ReferenceContainer"
+                "}", config);
+    }
+    ReferenceT<ConfigurationLoaderHashCRC> hasher = ObjectRegistryDatabase::Instance()->Find("H");
+    if (ok) {
+        ok = hasher.IsValid();
+    }
+    uint32 expectedHash = 0u;
+    if (ok) {
+        expectedHash = hasher->ComputeHash(config.Buffer(), config.Size());
+    }
+    if (ok) {
+        StreamString ignored;
+        ok = l->Reconfigure(config, ignored, expectedHash);
+    }
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("C");
+        ok = ref.IsValid();
+    }
+    if (ok) {
+        StreamString ignored;
+        ok = !l->Reconfigure(config, ignored, expectedHash + 1u);
+    }
+    if (ok) {
+        ok = l->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
 bool LoaderTest::TestGetLastValidConfiguration() {
     using namespace MARTe;
     ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
@@ -1055,4 +1171,166 @@ bool LoaderTest::TestGetSeed() {
     return ok;
 }
 
+bool LoaderTest::TestReconfigure_Incremental() {
+    using namespace MARTe;
+    ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    StreamString config =
+        "+LoaderPostInit={"
+        "   Class = ReferenceContainer"
+        "   +Parameters = {"
+        "       Class = ConfigurationDatabase"
+        "       Incremental = \"true\""
+        "   }"
+        "}"
+        "+A={"
+        "   Class = LoaderTestMessageObject1"
+        "}"
+        "+B={"
+        "   Class = ReferenceContainer"
+        "   +B1={"
+        "       Class = LoaderTestMessageObject1"
+        "   }"
+        "}"
+        "+C={"
+        "   Class = LoaderTestMessageObject1"
+        "}";
+    ConfigurationDatabase params;
+    params.Write("Parser", "cdb");
+    bool ok = l->Configure(params, config);
+    Reference refA = ObjectRegistryDatabase::Instance()->Find("A");
+    Reference refB = ObjectRegistryDatabase::Instance()->Find("B");
+    if (ok) {
+        ok = (refA.IsValid() && refB.IsValid());
+    }
+    config = "+A={"
+            "   Class = LoaderTestMessageObject1"
+            "}"
+            "+B={"
+            "   Class = ReferenceContainer"
+            "   +B1={"
+            "       Class = LoaderTestMessageObject1"
+            "   }"
+            "   +B2={"
+            "       Class = LoaderTestMessageObject1"
+            "   }"
+            "}"
+            "+D={"
+            "   Class = LoaderTestMessageObject1"
+            "}";
+    (void)config.Seek(0LLU);
+    if  (ok) {
+        StreamString ignored;
+        ok = l->Reconfigure(config, ignored);
+    }
+    //A did not change
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("A");
+        ok = (ref == refA);
+    }
+    //B was modified
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("B");
+        ok = ref.IsValid();
+        if (ok) {
+            ok = (ref != refB);
+        }
+    }
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("B.B2");
+        ok = ref.IsValid();
+    }
+    //C was removed
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("C");
+        ok = !ref.IsValid();
+    }
+    //D was added
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("D");
+        ok = ref.IsValid();
+    }
+    //The LoaderPostInit is left untouched
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("LoaderPostInit");
+        ok = ref.IsValid();
+    }
+    if (ok) {
+        ConfigurationDatabase cdb;
+        ok = l->GetLastValidConfiguration(cdb);
+        if (ok) {
+            ok = cdb.MoveAbsolute("+D");
+        }
+        if (ok) {
+            ok = !cdb.MoveAbsolute("+C");
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoaderTest::TestReconfigure_Incremental_ReloadLast() {
+    using namespace MARTe;
+    ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    StreamString config =
+        "+LoaderPostInit={"
+        "   Class = ReferenceContainer"
+        "   +Parameters = {"
+        "       Class = ConfigurationDatabase"
+        "       ReloadLast = \"true\""
+        "       Incremental = \"true\""
+        "   }"
+        "}"
+        "+A={"
+        "   Class = LoaderTestMessageObject1"
+        "}"
+        "+B={"
+        "   Class = LoaderTestMessageObject1"
+        "}";
+    ConfigurationDatabase params;
+    params.Write("Parser", "cdb");
+    bool ok = l->Configure(params, config);
+    config = "+A={"
+            "   Class = LoaderTestMessageObject1"
+            "}"
+            "+B={"
+            "   Class = ReferenceContainerzz"
+            "}";
+    (void)config.Seek(0LLU);
+    if  (ok) {
+        StreamString ignored;
+        ErrorManagement::ErrorType err = l->Reconfigure(config, ignored);
+        ok = err.recoverableError;
+    }
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("A");
+        ok = ref.IsValid();
+    }
+    if (ok) {
+        ReferenceT<LoaderTestMessageObject1> ref = ObjectRegistryDatabase::Instance()->Find("B");
+        ok = ref.IsValid();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoaderTest::TestLoaderPostInit_Incremental_invalid() {
+    using namespace MARTe;
+    ReferenceT<Loader> l = Reference("Loader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    StreamString config =
+        "+LoaderPostInit={"
+        "   Class = ReferenceContainer"
+        "   +Parameters = {"
+        "       Class = ConfigurationDatabase"
+        "       Incremental = \"invalid\""
+        "   }"
+        "}"
+        "+A={"
+        "   Class = LoaderTestMessageObject1"
+        "}";
+    ConfigurationDatabase params;
+    params.Write("Parser", "cdb");
+    bool ok = l->Configure(params, config);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return !ok;
+}
 
@@ -72,6 +72,16 @@ public:
      */
     bool TestConfigure_Xml();
 
+    /**
+     * @brief Tests the Configure method with the bin parser.
+     */
+    bool TestConfigure_Binary();
+
+    /**
+     * @brief Tests that the Configure method fails if the bin parser is asked to load a textual configuration.
+     */
+    bool TestConfigure_False_Binary();
+
     /**
      * @brief Tests the Configure method without specifying a parser.
      */
@@ -152,6 +162,11 @@ public:
      */
     bool TestReconfigure_Hash();
 
+    /**
+     * @brief Tests the Reconfigure method with a hash and a binary configuration.
+     */
+    bool TestReconfigure_Hash_Binary();
+
     /**
      * @brief Tests the GetLastValidConfiguration method.
      */
@@ -217,6 +232,21 @@ public:
      */
     bool TestGetSeed();
 
+    /**
+     * @brief Tests that an incremental Reconfigure only rebuilds the modified, added and removed objects.
+     */
+    bool TestReconfigure_Incremental();
+
+    /**
+     * @brief Tests that a failed incremental Reconfigure fully reloads the last valid configuration when ReloadLast is true.
+     */
+    bool TestReconfigure_Incremental_ReloadLast();
+
+    /**
+     * @brief Tests the LoaderPostInit function with Incremental=invalid.
+     */
+    bool TestLoaderPostInit_Incremental_invalid();
+
 };
 
 /*---------------------------------------------------------------------------*/
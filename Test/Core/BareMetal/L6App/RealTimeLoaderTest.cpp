@@ -612,3 +612,111 @@ bool RealTimeLoaderTest::TestStart_False_FailedRealTimeApplicationPrepareNextSta
 bool RealTimeLoaderTest::TestStop() {
     return TestStart_FirstState();
 }
+
+/**
+ * Generates a RealTimeApplication named appName, with a single state named stateName.
+ */
+static void GenerateRealTimeLoaderTestApplication(MARTe::StreamString &config,
+                                                  const MARTe::char8 * const appName,
+                                                  const MARTe::char8 * const stateName) {
+    (void) config.Printf("$%s = {", appName);
+    config += "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = RealTimeLoaderTestGAM"
+            "            OutputSignals = {"
+            "                Signal1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = RealTimeLoaderTestGAM"
+            "            InputSignals = {"
+            "                Signal1 = {"
+            "                    DataSource = DDB1"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer";
+    (void) config.Printf("        +%s = {", stateName);
+    config += "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA, GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = RealTimeLoaderTestScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+}
+
+bool RealTimeLoaderTest::TestReconfigure_Incremental() {
+    using namespace MARTe;
+    StreamString config = "+LoaderPostInit={"
+            "   Class = ReferenceContainer"
+            "   +Parameters = {"
+            "       Class = ConfigurationDatabase"
+            "       Incremental = \"true\""
+            "   }"
+            "}";
+    GenerateRealTimeLoaderTestApplication(config, "RTApp1", "State1");
+    GenerateRealTimeLoaderTestApplication(config, "RTApp2", "State1");
+    (void) config.Seek(0LLU);
+    ConfigurationDatabase params;
+    params.Write("Parser", "cdb");
+    ReferenceT<RealTimeLoader> l = Reference("RealTimeLoader", GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = l->Configure(params, config);
+    Reference app1 = ObjectRegistryDatabase::Instance()->Find("RTApp1");
+    Reference app2 = ObjectRegistryDatabase::Instance()->Find("RTApp2");
+    if (ok) {
+        ok = (app1.IsValid() && app2.IsValid());
+    }
+    config = "";
+    GenerateRealTimeLoaderTestApplication(config, "RTApp1", "State1");
+    GenerateRealTimeLoaderTestApplication(config, "RTApp2", "State2");
+    (void) config.Seek(0LLU);
+    if (ok) {
+        StreamString ignored;
+        ok = l->Reconfigure(config, ignored);
+    }
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("RTApp1");
+        ok = (ref == app1);
+    }
+    if (ok) {
+        Reference ref = ObjectRegistryDatabase::Instance()->Find("RTApp2.States.State2");
+        ok = ref.IsValid();
+    }
+    if (ok) {
+        ReferenceT<RealTimeApplication> ref = ObjectRegistryDatabase::Instance()->Find("RTApp2");
+        ok = (ref != app2);
+        if (ok) {
+            ok = ref->PrepareNextState("State2");
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
@@ -91,6 +91,11 @@ public:
      * @brief Tests the Stop method.
      */
     bool TestStop();
+
+    /**
+     * @brief Tests that an incremental Reconfigure only (re)configures the RealTimeApplication instances that were modified.
+     */
+    bool TestReconfigure_Incremental();
 };
 
 /*---------------------------------------------------------------------------*/
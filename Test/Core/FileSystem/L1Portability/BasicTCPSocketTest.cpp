@@ -927,6 +927,26 @@ bool BasicTCPSocketTest::TestIsValid() {
     return !socket.IsValid();
 }
 
+bool BasicTCPSocketTest::TestSetNoDelay() {
+
+    BasicTCPSocket socket;
+
+    if (socket.SetNoDelay(true)) {
+        return false;
+    }
+
+    socket.Open();
+
+    bool ret = socket.SetNoDelay(true);
+    if (ret) {
+        ret = socket.SetNoDelay(false);
+    }
+
+    socket.Close();
+
+    return ret;
+}
+
 bool BasicTCPSocketTest::TestOpen() {
     return TestIsValid();
 }
@@ -198,6 +198,11 @@ public:
     bool TestIsConnected(bool connect,
                          bool expected);
 
+    /**
+     * @brief Tests that the SetNoDelay function succeeds on an open socket and fails on a closed one.
+     */
+    bool TestSetNoDelay();
+
 public:
     InternetHost server;
     uint32 maxConnections;
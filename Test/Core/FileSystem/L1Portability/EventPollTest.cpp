@@ -0,0 +1,383 @@
+/**
+ * @file EventPollTest.cpp
+ * @brief Source file for class EventPollTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPollTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "BasicUDPSocket.h"
+#include "EventPollTest.h"
+#include "Sleep.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static const char8 LOCALHOST_IP[] = "127.0.0.1";
+static const uint16 EVENT_POLL_TESTING_PORT = 49160;
+static const uint16 EVENT_POLL_DUMMY_PORT_1 = 49161;
+static const uint16 EVENT_POLL_DUMMY_PORT_2 = 49162;
+
+static bool WriteToPort(const uint16 port) {
+    BasicUDPSocket writer;
+    bool ok = writer.Open();
+    if (ok) {
+        ok = writer.Connect(LOCALHOST_IP, port);
+    }
+    if (ok) {
+        uint32 size = 3u;
+        ok = writer.Write("Hey", size);
+    }
+    (void) writer.Close();
+    return ok;
+}
+
+static void ThreadWrite(const void * const) {
+    Sleep::MSec(100);
+    (void) WriteToPort(EVENT_POLL_TESTING_PORT);
+}
+
+static bool OpenReader(BasicUDPSocket &reader,
+                       const uint16 port) {
+    bool ok = reader.Open();
+    if (ok) {
+        ok = reader.Listen(port);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool EventPollTest::TestDefaultConstructor() {
+    EventPoll poll;
+    return !poll.IsValid();
+}
+
+bool EventPollTest::TestOpen() {
+    EventPoll poll;
+    bool ok = poll.Open();
+    if (ok) {
+        ok = poll.IsValid();
+    }
+    return ok;
+}
+
+bool EventPollTest::TestOpen_Twice() {
+    EventPoll poll;
+    bool ok = poll.Open();
+    if (ok) {
+        ok = !poll.Open();
+    }
+    if (ok) {
+        ok = poll.IsValid();
+    }
+    return ok;
+}
+
+bool EventPollTest::TestClose() {
+    EventPoll poll;
+    bool ok = poll.Open();
+    if (ok) {
+        ok = poll.Close();
+    }
+    if (ok) {
+        ok = !poll.IsValid();
+    }
+    //Can be reopened
+    if (ok) {
+        ok = poll.Open();
+    }
+    return ok;
+}
+
+bool EventPollTest::TestAddReadHandle() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestAddReadHandle_NotOpen() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = !poll.AddReadHandle(reader, &reader);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestAddReadHandle_SameHandle() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = !poll.AddReadHandle(reader, &reader);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestRearmReadHandle() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = WriteToPort(EVENT_POLL_TESTING_PORT);
+    }
+    void *context = NULL_PTR(void *);
+    if (ok) {
+        ok = (poll.WaitUntil(1000u, &context, 1u) == 1);
+    }
+    if (ok) {
+        ok = (poll.WaitUntil(10u, &context, 1u) == 0);
+    }
+    //The data was not read so the handle is still ready
+    if (ok) {
+        ok = poll.RearmReadHandle(reader, &reader);
+    }
+    if (ok) {
+        context = NULL_PTR(void *);
+        ok = (poll.WaitUntil(1000u, &context, 1u) == 1);
+    }
+    if (ok) {
+        ok = (context == &reader);
+    }
+    //Once the data is read the handle is no longer ready
+    if (ok) {
+        char8 buffer[32];
+        uint32 size = 32u;
+        ok = reader.Read(&buffer[0], size);
+    }
+    if (ok) {
+        ok = poll.RearmReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = (poll.WaitUntil(10u, &context, 1u) == 0);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestRemoveReadHandle() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = poll.RemoveReadHandle(reader);
+    }
+    if (ok) {
+        ok = WriteToPort(EVENT_POLL_TESTING_PORT);
+    }
+    void *context = NULL_PTR(void *);
+    if (ok) {
+        ok = (poll.WaitUntil(10u, &context, 1u) == 0);
+    }
+    //Can be added again
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = (poll.WaitUntil(1000u, &context, 1u) == 1);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestRemoveReadHandle_NotAdded() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = !poll.RemoveReadHandle(reader);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestWaitUntil() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    ThreadIdentifier tid = InvalidThreadIdentifier;
+    if (ok) {
+        tid = Threads::BeginThread(&ThreadWrite, NULL_PTR(void *));
+    }
+    void *contexts[4] = { NULL_PTR(void *), NULL_PTR(void *), NULL_PTR(void *), NULL_PTR(void *) };
+    if (ok) {
+        ok = (poll.WaitUntil(2000u, &contexts[0], 4u) == 1);
+    }
+    if (ok) {
+        ok = (contexts[0] == &reader);
+    }
+    if (tid != InvalidThreadIdentifier) {
+        while (Threads::IsAlive(tid)) {
+            Sleep::MSec(1);
+        }
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestWaitUntil_Timeout() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    void *context = NULL_PTR(void *);
+    if (ok) {
+        ok = (poll.WaitUntil(50u, &context, 1u) == 0);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestWaitUntil_OneShot() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = WriteToPort(EVENT_POLL_TESTING_PORT);
+    }
+    void *context = NULL_PTR(void *);
+    if (ok) {
+        ok = (poll.WaitUntil(1000u, &context, 1u) == 1);
+    }
+    if (ok) {
+        ok = WriteToPort(EVENT_POLL_TESTING_PORT);
+    }
+    if (ok) {
+        ok = (poll.WaitUntil(50u, &context, 1u) == 0);
+    }
+    (void) reader.Close();
+    return ok;
+}
+
+bool EventPollTest::TestWaitUntil_SeveralHandles() {
+    EventPoll poll;
+    BasicUDPSocket reader;
+    BasicUDPSocket dummy1;
+    BasicUDPSocket dummy2;
+    bool ok = OpenReader(reader, EVENT_POLL_TESTING_PORT);
+    if (ok) {
+        ok = OpenReader(dummy1, EVENT_POLL_DUMMY_PORT_1);
+    }
+    if (ok) {
+        ok = OpenReader(dummy2, EVENT_POLL_DUMMY_PORT_2);
+    }
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(dummy1, &dummy1);
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(reader, &reader);
+    }
+    if (ok) {
+        ok = poll.AddReadHandle(dummy2, &dummy2);
+    }
+    if (ok) {
+        ok = WriteToPort(EVENT_POLL_TESTING_PORT);
+    }
+    void *contexts[3] = { NULL_PTR(void *), NULL_PTR(void *), NULL_PTR(void *) };
+    if (ok) {
+        ok = (poll.WaitUntil(1000u, &contexts[0], 3u) == 1);
+    }
+    if (ok) {
+        ok = (contexts[0] == &reader);
+    }
+    (void) reader.Close();
+    (void) dummy1.Close();
+    (void) dummy2.Close();
+    return ok;
+}
+
+bool EventPollTest::TestWaitUntil_InvalidParameters() {
+    EventPoll poll;
+    void *context = NULL_PTR(void *);
+    bool ok = (poll.WaitUntil(10u, &context, 1u) == -1);
+    if (ok) {
+        ok = poll.Open();
+    }
+    if (ok) {
+        ok = (poll.WaitUntil(10u, NULL_PTR(void **), 1u) == -1);
+    }
+    if (ok) {
+        ok = (poll.WaitUntil(10u, &context, 0u) == -1);
+    }
+    return ok;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file EventPollTest.h
+ * @brief Header file for class EventPollTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class EventPollTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef EVENTPOLLTEST_H_
+#define EVENTPOLLTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "EventPoll.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the EventPoll public methods.
+ */
+class EventPollTest {
+
+public:
+
+    /**
+     * @brief Tests the default constructor.
+     * @return True if IsValid() returns false.
+     */
+    bool TestDefaultConstructor();
+
+    /**
+     * @brief Tests the Open method.
+     * @return True if Open returns true and IsValid() returns true.
+     */
+    bool TestOpen();
+
+    /**
+     * @brief Tests that the Open method fails if the EventPoll is already open.
+     * @return True if the second Open returns false.
+     */
+    bool TestOpen_Twice();
+
+    /**
+     * @brief Tests the Close method.
+     * @return True if Close returns true and IsValid() returns false.
+     */
+    bool TestClose();
+
+    /**
+     * @brief Tests the AddReadHandle method.
+     * @return True if AddReadHandle returns true.
+     */
+    bool TestAddReadHandle();
+
+    /**
+     * @brief Tests that the AddReadHandle method fails if the EventPoll is not open.
+     * @return True if AddReadHandle returns false.
+     */
+    bool TestAddReadHandle_NotOpen();
+
+    /**
+     * @brief Tests that the AddReadHandle method fails if the handle was already added.
+     * @return True if AddReadHandle returns true the first time and false the second time.
+     */
+    bool TestAddReadHandle_SameHandle();
+
+    /**
+     * @brief Tests that RearmReadHandle restarts the monitoring of a handle returned by WaitUntil.
+     * @return True if the handle is returned again by WaitUntil after being rearmed.
+     */
+    bool TestRearmReadHandle();
+
+    /**
+     * @brief Tests that the RemoveReadHandle method stops the monitoring of a handle.
+     * @return True if WaitUntil times out after the handle was removed, even if there is data to be read.
+     */
+    bool TestRemoveReadHandle();
+
+    /**
+     * @brief Tests that the RemoveReadHandle method fails if the handle was not added.
+     * @return True if RemoveReadHandle returns false.
+     */
+    bool TestRemoveReadHandle_NotAdded();
+
+    /**
+     * @brief Tests that WaitUntil returns the context of the handle which is ready to be read.
+     * @return True if WaitUntil returns 1 and the context of the handle which was written by another thread.
+     */
+    bool TestWaitUntil();
+
+    /**
+     * @brief Tests that WaitUntil returns 0 if no handle is ready to be read.
+     * @return True if WaitUntil returns 0.
+     */
+    bool TestWaitUntil_Timeout();
+
+    /**
+     * @brief Tests that a handle returned by WaitUntil is not returned again until rearmed.
+     * @return True if the second WaitUntil returns 0 even if the data was not read.
+     */
+    bool TestWaitUntil_OneShot();
+
+    /**
+     * @brief Tests that WaitUntil only returns the contexts of the handles which are ready to be read.
+     * @return True if WaitUntil returns the context of the only handle (out of three) which was written.
+     */
+    bool TestWaitUntil_SeveralHandles();
+
+    /**
+     * @brief Tests that WaitUntil fails with invalid parameters.
+     * @return True if WaitUntil returns -1 when not open or when contexts is NULL or maxContexts is 0.
+     */
+    bool TestWaitUntil_InvalidParameters();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* EVENTPOLLTEST_H_ */
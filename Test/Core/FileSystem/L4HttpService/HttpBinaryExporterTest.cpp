@@ -0,0 +1,389 @@
+/**
+ * @file HttpBinaryExporterTest.cpp
+ * @brief Source file for class HttpBinaryExporterTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpBinaryExporterTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "DeflateEncoderTest.h"
+#include "Endianity.h"
+#include "HttpBinaryExporterTest.h"
+#include "HttpChunkedStream.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+#include "TCPSocket.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Header of the variables added by HttpBinaryExporterTestAddVariables.
+ */
+static const char8 * const httpBinaryExporterTestHeader = "{\"Variables\": ["
+        "{\"Name\": \"Time\", \"Type\": \"uint32\", \"NumberOfDimensions\": 0, \"NumberOfElements\": [], \"Offset\": 0, \"Size\": 4}, "
+        "{\"Name\": \"Values\", \"Type\": \"float32\", \"NumberOfDimensions\": 1, \"NumberOfElements\": [4], \"Offset\": 4, \"Size\": 16}, "
+        "{\"Name\": \"Matrix\", \"Type\": \"int16\", \"NumberOfDimensions\": 2, \"NumberOfElements\": [3, 2], \"Offset\": 20, \"Size\": 12}]}";
+
+/**
+ * Variables used by the tests.
+ */
+static uint32 httpBinaryExporterTestTime = 7u;
+static float32 httpBinaryExporterTestValues[4] = { 1.5F, -2.0F, 3.25F, 0.0F };
+static int16 httpBinaryExporterTestMatrix[2][3] = { { 1, -2, 3 }, { -4, 5, -6 } };
+
+/**
+ * Adds the test variables to the exporter.
+ */
+static bool HttpBinaryExporterTestAddVariables(HttpBinaryExporter &exporter) {
+    bool ok = exporter.AddVariable("Time", httpBinaryExporterTestTime);
+    if (ok) {
+        ok = exporter.AddVariable("Values", httpBinaryExporterTestValues);
+    }
+    if (ok) {
+        ok = exporter.AddVariable("Matrix", httpBinaryExporterTestMatrix);
+    }
+    return ok;
+}
+
+/**
+ * Removes the chunk encoding (size in hexadecimal, CRLF, data, CRLF) from the body of the reply.
+ */
+static bool HttpBinaryExporterTestDechunk(const char8 * const chunked,
+                                          const uint32 chunkedSize,
+                                          StreamString &body) {
+    bool ok = true;
+    bool done = false;
+    uint32 idx = 0u;
+    while ((ok) && (!done)) {
+        uint32 chunkSize = 0u;
+        bool sizeRead = false;
+        while ((ok) && (!sizeRead)) {
+            ok = (idx < chunkedSize);
+            if (ok) {
+                char8 c = chunked[idx];
+                idx++;
+                if ((c >= '0') && (c <= '9')) {
+                    chunkSize = (chunkSize * 16u) + static_cast<uint32>(c - '0');
+                }
+                else if ((c >= 'A') && (c <= 'F')) {
+                    chunkSize = (chunkSize * 16u) + static_cast<uint32>(c - 'A') + 10u;
+                }
+                else if ((c >= 'a') && (c <= 'f')) {
+                    chunkSize = (chunkSize * 16u) + static_cast<uint32>(c - 'a') + 10u;
+                }
+                else {
+                    ok = (c == '\r');
+                    sizeRead = true;
+                }
+            }
+        }
+        if (ok) {
+            //\n + data + \r\n
+            ok = ((idx + 1u + chunkSize + 2u) <= chunkedSize);
+        }
+        if (ok) {
+            idx++;
+            uint32 size = chunkSize;
+            ok = body.Write(&chunked[idx], size);
+            idx += chunkSize + 2u;
+            done = (chunkSize == 0u);
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool HttpBinaryExporterTest::TestConstructor() {
+    HttpBinaryExporter exporter;
+    return (exporter.GetNumberOfVariables() == 0u);
+}
+
+bool HttpBinaryExporterTest::TestAddVariable() {
+    HttpBinaryExporter exporter;
+    bool ok = HttpBinaryExporterTestAddVariables(exporter);
+    if (ok) {
+        ok = (exporter.GetNumberOfVariables() == 3u);
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestAddVariable_False_Type() {
+    HttpBinaryExporter exporter;
+    const char8 * const value = "MARTe";
+    bool ok = !exporter.AddVariable("String", value);
+    if (ok) {
+        ok = (exporter.GetNumberOfVariables() == 0u);
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestAddVariable_False_Dimensions() {
+    HttpBinaryExporter exporter;
+    AnyType value(httpBinaryExporterTestMatrix);
+    value.SetNumberOfDimensions(3u);
+    bool ok = !exporter.AddVariable("Matrix", value);
+    if (ok) {
+        ok = (exporter.GetNumberOfVariables() == 0u);
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestAddVariables() {
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("Time", httpBinaryExporterTestTime);
+    if (ok) {
+        ok = cdb.Write("Name", "MARTe");
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute("Node");
+    }
+    if (ok) {
+        ok = cdb.Write("Values", httpBinaryExporterTestValues);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    HttpBinaryExporter exporter;
+    if (ok) {
+        ok = exporter.AddVariables(cdb);
+    }
+    if (ok) {
+        ok = (exporter.GetNumberOfVariables() == 2u);
+    }
+    StreamString header;
+    if (ok) {
+        ok = exporter.GetHeader(header);
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(header.Buffer(), "\"Name\": \"Time\", \"Type\": \"uint32\"") != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(header.Buffer(), "\"Name\": \"Node.Values\", \"Type\": \"float32\"") != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(header.Buffer(), "\"Name\": \"Name\"") == NULL_PTR(const char8 *));
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestGetNumberOfVariables() {
+    HttpBinaryExporter exporter;
+    bool ok = (exporter.GetNumberOfVariables() == 0u);
+    if (ok) {
+        ok = exporter.AddVariable("Time", httpBinaryExporterTestTime);
+    }
+    if (ok) {
+        ok = (exporter.GetNumberOfVariables() == 1u);
+    }
+    if (ok) {
+        ok = !exporter.AddVariable("String", "MARTe");
+    }
+    if (ok) {
+        ok = (exporter.GetNumberOfVariables() == 1u);
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestGetHeader() {
+    HttpBinaryExporter exporter;
+    StreamString header;
+    bool ok = exporter.GetHeader(header);
+    if (ok) {
+        ok = (header == "{\"Variables\": []}");
+    }
+    if (ok) {
+        ok = HttpBinaryExporterTestAddVariables(exporter);
+    }
+    if (ok) {
+        header = "";
+        ok = exporter.GetHeader(header);
+    }
+    if (ok) {
+        ok = (header == httpBinaryExporterTestHeader);
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestExport() {
+    return TestExport(NULL_PTR(const char8 *), false);
+}
+
+bool HttpBinaryExporterTest::TestExport_Deflate() {
+    return TestExport("gzip, deflate", true);
+}
+
+bool HttpBinaryExporterTest::TestExport_False_Stream() {
+    HttpBinaryExporter exporter;
+    TCPSocket stream;
+    HttpProtocol protocol(stream);
+    bool ok = HttpBinaryExporterTestAddVariables(exporter);
+    if (ok) {
+        ok = !exporter.Export(stream, protocol);
+    }
+    return ok;
+}
+
+bool HttpBinaryExporterTest::TestExport(const char8 * const acceptEncoding,
+                                        const bool compressed) {
+    TCPSocket server;
+    bool ok = server.Open();
+    if (ok) {
+        ok = server.Listen(10004u, 10);
+    }
+    HttpChunkedStream client;
+    if (ok) {
+        ok = client.Open();
+    }
+    if (ok) {
+        ok = client.Connect("127.0.0.1", 10004u);
+    }
+    TCPSocket serverSide;
+    if (ok) {
+        ok = (server.WaitConnection(1000u, &serverSide) != NULL_PTR(BasicTCPSocket *));
+    }
+    HttpProtocol protocol(client);
+    if (ok) {
+        ok = protocol.CreateAbsolute("OutputOptions");
+    }
+    if ((ok) && (acceptEncoding != NULL_PTR(const char8 *))) {
+        ok = protocol.CreateAbsolute("InputOptions");
+        if (ok) {
+            ok = protocol.Write("Accept-Encoding", acceptEncoding);
+        }
+    }
+    HttpBinaryExporter exporter;
+    if (ok) {
+        ok = HttpBinaryExporterTestAddVariables(exporter);
+    }
+    if (ok) {
+        ok = exporter.Export(client, protocol);
+    }
+    if (ok) {
+        ok = client.Flush();
+    }
+    if (ok) {
+        ok = client.FinalChunk();
+    }
+    //Read the reply until the final chunk
+    StreamString reply;
+    bool done = false;
+    while ((ok) && (!done)) {
+        char8 buffer[256];
+        uint32 size = static_cast<uint32>(sizeof(buffer));
+        ok = serverSide.Read(&buffer[0], size, 1000u);
+        if (ok) {
+            ok = (size > 0u);
+        }
+        if (ok) {
+            ok = reply.Write(&buffer[0], size);
+        }
+        if (ok) {
+            done = (reply.Size() >= 5u);
+        }
+        if (done) {
+            done = (StringHelper::Compare(&reply.Buffer()[reply.Size() - 5u], "0\r\n\r\n") == 0);
+        }
+    }
+    const char8 *body = NULL_PTR(const char8 *);
+    if (ok) {
+        body = StringHelper::SearchString(reply.Buffer(), "\r\n\r\n");
+        ok = (body != NULL_PTR(const char8 *));
+    }
+    StreamString httpHeader;
+    if (ok) {
+        body += 4u;
+        uint32 httpHeaderSize = static_cast<uint32>(body - reply.Buffer());
+        ok = httpHeader.Write(reply.Buffer(), httpHeaderSize);
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(httpHeader.Buffer(), "Content-Type: application/octet-stream") != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        bool hasEncoding = (StringHelper::SearchString(httpHeader.Buffer(), "Content-Encoding: deflate") != NULL_PTR(const char8 *));
+        ok = (hasEncoding == compressed);
+    }
+    StreamString content;
+    if (ok) {
+        ok = HttpBinaryExporterTestDechunk(body, static_cast<uint32>(reply.Size() - httpHeader.Size()), content);
+    }
+    uint8 decoded[1024];
+    uint32 decodedSize = 0u;
+    if (ok) {
+        if (compressed) {
+            ok = DeflateEncoderTest::Inflate(reinterpret_cast<const uint8 *>(content.Buffer()), static_cast<uint32>(content.Size()), &decoded[0],
+                                             static_cast<uint32>(sizeof(decoded)), decodedSize);
+        }
+        else {
+            decodedSize = static_cast<uint32>(content.Size());
+            ok = (decodedSize <= static_cast<uint32>(sizeof(decoded)));
+            if (ok) {
+                ok = MemoryOperationsHelper::Copy(&decoded[0], content.Buffer(), decodedSize);
+            }
+        }
+    }
+    //Size of the header (little-endian), header and data
+    uint32 headerSize = StringHelper::Length(httpBinaryExporterTestHeader);
+    uint32 dataSize = 32u;
+    if (ok) {
+        ok = (decodedSize == (4u + headerSize + dataSize));
+    }
+    if (ok) {
+        uint32 receivedHeaderSize = static_cast<uint32>(decoded[0]) | (static_cast<uint32>(decoded[1]) << 8u) | (static_cast<uint32>(decoded[2]) << 16u)
+                | (static_cast<uint32>(decoded[3]) << 24u);
+        ok = (receivedHeaderSize == headerSize);
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&decoded[4], httpBinaryExporterTestHeader, headerSize) == 0);
+    }
+    uint8 expectedData[32];
+    if (ok) {
+        uint32 time = httpBinaryExporterTestTime;
+        Endianity::ToLittleEndian(time);
+        ok = MemoryOperationsHelper::Copy(&expectedData[0], &time, 4u);
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            float32 value = httpBinaryExporterTestValues[i];
+            Endianity::ToLittleEndian(value);
+            ok = MemoryOperationsHelper::Copy(&expectedData[4u + (i * 4u)], &value, 4u);
+        }
+        for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+            int16 value = httpBinaryExporterTestMatrix[i / 3u][i % 3u];
+            Endianity::ToLittleEndian(value);
+            ok = MemoryOperationsHelper::Copy(&expectedData[20u + (i * 2u)], &value, 2u);
+        }
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&decoded[4u + headerSize], &expectedData[0], dataSize) == 0);
+    }
+    (void) serverSide.Close();
+    (void) client.Close();
+    (void) server.Close();
+    return ok;
+}
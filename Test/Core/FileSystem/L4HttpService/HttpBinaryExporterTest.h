@@ -0,0 +1,115 @@
+/**
+ * @file HttpBinaryExporterTest.h
+ * @brief Header file for class HttpBinaryExporterTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpBinaryExporterTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef HTTPBINARYEXPORTERTEST_H_
+#define HTTPBINARYEXPORTERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "HttpBinaryExporter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the HttpBinaryExporter public methods.
+ */
+class HttpBinaryExporterTest {
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the AddVariable method with scalars, vectors and matrices.
+     */
+    bool TestAddVariable();
+
+    /**
+     * @brief Tests that AddVariable fails with a non numeric type.
+     */
+    bool TestAddVariable_False_Type();
+
+    /**
+     * @brief Tests that AddVariable fails with more than two dimensions.
+     */
+    bool TestAddVariable_False_Dimensions();
+
+    /**
+     * @brief Tests the AddVariables method with nested nodes and leafs which cannot be exported.
+     */
+    bool TestAddVariables();
+
+    /**
+     * @brief Tests the GetNumberOfVariables method.
+     */
+    bool TestGetNumberOfVariables();
+
+    /**
+     * @brief Tests the GetHeader method.
+     */
+    bool TestGetHeader();
+
+    /**
+     * @brief Tests the Export method without compression.
+     */
+    bool TestExport();
+
+    /**
+     * @brief Tests the Export method when the client accepts the deflate encoding.
+     */
+    bool TestExport_Deflate();
+
+    /**
+     * @brief Tests that the Export method fails if the stream is not an HttpChunkedStream.
+     */
+    bool TestExport_False_Stream();
+
+private:
+
+    /**
+     * @brief Exports three variables through a socket and verifies the reply.
+     * @param[in] acceptEncoding the Accept-Encoding of the request (NULL if not set).
+     * @param[in] compressed true if the reply is expected to be compressed.
+     * @return true if the reply is the expected one.
+     */
+    bool TestExport(const char8 * const acceptEncoding,
+                    const bool compressed);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* HTTPBINARYEXPORTERTEST_H_ */
@@ -97,4 +97,25 @@ bool HttpDataExportITest::TestGetAsText() {
     return ok;
 }
 
-	
+bool HttpDataExportITest::TestGetAsBinary() {
+    using namespace MARTe;
+    bool ok = true;
+    TCPSocket server;
+    server.Open();
+    server.Listen(10002, 10);
+    HttpDataExportI httpDataExportI;
+    HttpChunkedStream httpChunkedStream;
+    httpChunkedStream.Open();
+    httpChunkedStream.Connect("127.0.0.1", 10002);
+    HttpProtocol hprotocol(httpChunkedStream);
+    hprotocol.CreateAbsolute("OutputOptions");
+    ok = httpDataExportI.GetAsBinary(httpChunkedStream, hprotocol);
+    httpChunkedStream.Close();
+    server.Close();
+    StreamString str;
+    ok &= hprotocol.MoveAbsolute("OutputOptions");
+    ok &= hprotocol.Read("Connection", str);
+    ok &= (str == "close");
+    ok &= !httpChunkedStream.IsChunkMode();
+    return ok;
+}
@@ -52,6 +52,11 @@ public:
      * @brief Tests the GetAsText method.
      */
     bool TestGetAsText();
+
+    /**
+     * @brief Tests the GetAsBinary method.
+     */
+    bool TestGetAsBinary();
 };
 
 /*---------------------------------------------------------------------------*/
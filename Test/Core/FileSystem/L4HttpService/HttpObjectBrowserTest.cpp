@@ -1368,3 +1368,314 @@ bool HttpObjectBrowserTest::TestGetAsText_Realm_False() {
     d.Delete();
     return ok;
 }
+
+bool HttpObjectBrowserTest::TestInitialise_False_ResponseCacheSize() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("Root", ".");
+    cdb.Write("ResponseCache", 1);
+    cdb.Write("ResponseCacheSize", 0);
+
+    ReferenceT<HttpObjectBrowser> httpObjectBrowser(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = !httpObjectBrowser->Initialise(cdb);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpObjectBrowserTest::TestGetAsStructuredData_ResponseCache() {
+    using namespace MARTe;
+    StreamString cfg = ""
+            "+HttpService1 = {\n"
+            "    Class = HttpService\n"
+            "    Port = 9094\n"
+            "    Timeout = 0\n"
+            "    AcceptTimeout = 100"
+            "    MinNumberOfThreads = 1\n"
+            "    MaxNumberOfThreads = 8\n"
+            "    ListenMaxConnections = 255\n"
+            "    IsTextMode = 0\n"
+            "    WebRoot = HttpObjectBrowser1\n"
+            "}\n"
+            "+RC1 = {\n"
+            "    Class = ReferenceContainer\n"
+            "    +AChild = {\n"
+            "         Class = ReferenceContainer\n"
+            "    }\n"
+            "}\n"
+            "+HttpObjectBrowser1 = {\n"
+            "    Class = HttpObjectBrowser\n"
+            "    Root = \"RC1\"\n"
+            "    ResponseCache = 1\n"
+            "}\n";
+
+    cfg.Seek(0LLU);
+    StreamString err;
+    ConfigurationDatabase cdb;
+    StandardParser parser(cfg, cdb, &err);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<HttpService> service = ObjectRegistryDatabase::Instance()->Find("HttpService1");
+    ReferenceT<HttpObjectBrowser> browser = ObjectRegistryDatabase::Instance()->Find("HttpObjectBrowser1");
+    ReferenceT<ReferenceContainer> aChild = ObjectRegistryDatabase::Instance()->Find("RC1.AChild");
+    ok = (service.IsValid() && browser.IsValid() && aChild.IsValid());
+
+    if (ok) {
+        ok = service->Start();
+    }
+    HttpClient test;
+    test.SetServerAddress("127.0.0.1");
+    test.SetServerPort(9094);
+    test.SetServerUri("AChild");
+    HttpProtocol *clientProtocol = test.GetHttpProtocol();
+    //First request. Exported and stored in the cache.
+    StreamString reply;
+    if (ok) {
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    StreamString etag1;
+    if (ok) {
+        ok = (clientProtocol->GetHttpCommand() == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = clientProtocol->MoveAbsolute("InputOptions");
+    }
+    if (ok) {
+        ok = clientProtocol->Read("ETag", etag1);
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(reply.Buffer(), "\"Name\": \"AChild\"") != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = (browser->GetNumberOfCachedResponses() == 1u);
+    }
+    //Same request with the ETag. Shall reply with a Not Modified.
+    if (ok) {
+        ok = clientProtocol->MoveAbsolute("OutputOptions");
+    }
+    if (ok) {
+        ok = clientProtocol->Write("If-None-Match", etag1.Buffer());
+    }
+    if (ok) {
+        reply = "";
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ok) {
+        ok = (clientProtocol->GetHttpCommand() == HttpDefinition::HSHCReplyNotModified);
+    }
+    if (ok) {
+        ok = (reply.Size() == 0u);
+    }
+    //Modify the container. The ETag shall change and the new content shall be exported.
+    if (ok) {
+        ReferenceT<ReferenceContainer> newChild(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        newChild->SetName("ANewChild");
+        ok = aChild->Insert(newChild);
+    }
+    if (ok) {
+        reply = "";
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    StreamString etag2;
+    if (ok) {
+        ok = (clientProtocol->GetHttpCommand() == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = clientProtocol->MoveAbsolute("InputOptions");
+    }
+    if (ok) {
+        ok = clientProtocol->Read("ETag", etag2);
+    }
+    if (ok) {
+        ok = !(etag1 == etag2);
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(reply.Buffer(), "ANewChild") != NULL_PTR(const char8 *));
+    }
+    //Notify a change. The ETag shall change again and the stale reply shall be replaced.
+    if (ok) {
+        ReferenceContainer::NotifyChange();
+        ok = clientProtocol->MoveAbsolute("OutputOptions");
+    }
+    if (ok) {
+        ok = clientProtocol->Write("If-None-Match", etag2.Buffer());
+    }
+    if (ok) {
+        reply = "";
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    StreamString etag3;
+    if (ok) {
+        ok = (clientProtocol->GetHttpCommand() == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = clientProtocol->MoveAbsolute("InputOptions");
+    }
+    if (ok) {
+        ok = clientProtocol->Read("ETag", etag3);
+    }
+    if (ok) {
+        ok = !(etag2 == etag3);
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(reply.Buffer(), "ANewChild") != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = (browser->GetNumberOfCachedResponses() == 1u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpObjectBrowserTest::TestGetAsStructuredData_ResponseCache_Disabled() {
+    using namespace MARTe;
+    StreamString cfg = ""
+            "+HttpService1 = {\n"
+            "    Class = HttpService\n"
+            "    Port = 9094\n"
+            "    Timeout = 0\n"
+            "    AcceptTimeout = 100"
+            "    MinNumberOfThreads = 1\n"
+            "    MaxNumberOfThreads = 8\n"
+            "    ListenMaxConnections = 255\n"
+            "    IsTextMode = 0\n"
+            "    WebRoot = HttpObjectBrowser1\n"
+            "}\n"
+            "+RC1 = {\n"
+            "    Class = ReferenceContainer\n"
+            "    +AChild = {\n"
+            "         Class = ReferenceContainer\n"
+            "    }\n"
+            "}\n"
+            "+HttpObjectBrowser1 = {\n"
+            "    Class = HttpObjectBrowser\n"
+            "    Root = \"RC1\"\n"
+            "}\n";
+
+    cfg.Seek(0LLU);
+    StreamString err;
+    ConfigurationDatabase cdb;
+    StandardParser parser(cfg, cdb, &err);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<HttpService> service = ObjectRegistryDatabase::Instance()->Find("HttpService1");
+    ReferenceT<HttpObjectBrowser> browser = ObjectRegistryDatabase::Instance()->Find("HttpObjectBrowser1");
+    ok = (service.IsValid() && browser.IsValid());
+
+    if (ok) {
+        ok = service->Start();
+    }
+    HttpClient test;
+    test.SetServerAddress("127.0.0.1");
+    test.SetServerPort(9094);
+    test.SetServerUri("AChild");
+    HttpProtocol *clientProtocol = test.GetHttpProtocol();
+    StreamString reply;
+    if (ok) {
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ok) {
+        ok = (clientProtocol->GetHttpCommand() == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = clientProtocol->MoveAbsolute("InputOptions");
+    }
+    if (ok) {
+        StreamString etag;
+        ok = !clientProtocol->Read("ETag", etag);
+    }
+    if (ok) {
+        ok = (browser->GetNumberOfCachedResponses() == 0u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpObjectBrowserTest::TestGetAsStructuredData_ResponseCache_Eviction() {
+    using namespace MARTe;
+    StreamString cfg = ""
+            "+HttpService1 = {\n"
+            "    Class = HttpService\n"
+            "    Port = 9094\n"
+            "    Timeout = 0\n"
+            "    AcceptTimeout = 100"
+            "    MinNumberOfThreads = 1\n"
+            "    MaxNumberOfThreads = 8\n"
+            "    ListenMaxConnections = 255\n"
+            "    IsTextMode = 0\n"
+            "    WebRoot = HttpObjectBrowser1\n"
+            "}\n"
+            "+RC1 = {\n"
+            "    Class = ReferenceContainer\n"
+            "    +AChild = {\n"
+            "         Class = ReferenceContainer\n"
+            "    }\n"
+            "    +BChild = {\n"
+            "         Class = ReferenceContainer\n"
+            "    }\n"
+            "}\n"
+            "+HttpObjectBrowser1 = {\n"
+            "    Class = HttpObjectBrowser\n"
+            "    Root = \"RC1\"\n"
+            "    ResponseCache = 1\n"
+            "    ResponseCacheSize = 1\n"
+            "}\n";
+
+    cfg.Seek(0LLU);
+    StreamString err;
+    ConfigurationDatabase cdb;
+    StandardParser parser(cfg, cdb, &err);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<HttpService> service = ObjectRegistryDatabase::Instance()->Find("HttpService1");
+    ReferenceT<HttpObjectBrowser> browser = ObjectRegistryDatabase::Instance()->Find("HttpObjectBrowser1");
+    ok = (service.IsValid() && browser.IsValid());
+
+    if (ok) {
+        ok = service->Start();
+    }
+    HttpClient test;
+    test.SetServerAddress("127.0.0.1");
+    test.SetServerPort(9094);
+    const char8 * const paths[] = { "AChild", "BChild", "AChild" };
+    for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+        StreamString reply;
+        StreamString expectedName;
+        test.SetServerUri(paths[i]);
+        ok = test.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+        if (ok) {
+            ok = expectedName.Printf("\"Name\": \"%s\"", paths[i]);
+        }
+        if (ok) {
+            ok = (StringHelper::SearchString(reply.Buffer(), expectedName.Buffer()) != NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            ok = (browser->GetNumberOfCachedResponses() == 1u);
+        }
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
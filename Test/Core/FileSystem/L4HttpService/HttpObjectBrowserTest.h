@@ -160,6 +160,26 @@ public:
      * @brief Test the GetAsText with a realm which does not authorise the resource.
      */
     bool TestGetAsText_Realm_False();
+
+    /**
+     * @brief Test the Initialise with a ResponseCacheSize = 0.
+     */
+    bool TestInitialise_False_ResponseCacheSize();
+
+    /**
+     * @brief Test the GetAsStructuredData with the ResponseCache enabled: ETag, Not Modified replies and invalidation by Insert and NotifyChange.
+     */
+    bool TestGetAsStructuredData_ResponseCache();
+
+    /**
+     * @brief Test that the GetAsStructuredData does not reply with an ETag when the ResponseCache is not enabled.
+     */
+    bool TestGetAsStructuredData_ResponseCache_Disabled();
+
+    /**
+     * @brief Test that the oldest cached reply is evicted when the ResponseCacheSize is reached.
+     */
+    bool TestGetAsStructuredData_ResponseCache_Eviction();
 };
 
 /*---------------------------------------------------------------------------*/
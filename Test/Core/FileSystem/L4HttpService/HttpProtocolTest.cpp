@@ -99,6 +99,7 @@ HttpProtocolTest::HttpProtocolTest() {
     command = 0;
     isKeepAlive = false;
     textMode = 0;
+    binaryMode = 0;
 }
 
 HttpProtocolTest::~HttpProtocolTest() {
@@ -2630,6 +2631,95 @@ bool HttpProtocolTest::TestTextMode(int8 textMode) {
     return ret;
 }
 
+static void clientJobGetBinaryMode(HttpProtocolTest &tt) {
+    //tells to the main process that the thread begins
+
+    InternetHost source(5554, "127.0.0.1");
+    InternetHost destination(5555, "127.0.0.1");
+
+    TCPSocket socket;
+
+    socket.SetSource(source);
+    socket.SetDestination(destination);
+    socket.Open();
+    tt.eventSem.Wait();
+    tt.eventSem.Reset();
+    bool ret = socket.Connect("127.0.0.1", 5555);
+    if (ret) {
+        socket.Printf("GET /docs/index.html?BinaryMode=%d", tt.binaryMode);
+        socket.Printf("%s", " HTTP/1.1\n");
+        socket.Printf("%s", "Host: www.nowhere123.com\n");
+        socket.Printf("%s", "Accept-Encoding: gzip, deflate\n");
+        socket.Printf("%s", "\n");
+        socket.Flush();
+    }
+    tt.eventSem.Post();
+    socket.Close();
+    Threads::EndThread();
+}
+
+bool HttpProtocolTest::TestBinaryMode(int8 binaryMode) {
+    this->binaryMode = binaryMode;
+    InternetHost source(5554, "127.0.0.1");
+    InternetHost destination(5555, "127.0.0.1");
+
+    TCPSocket socket;
+    socket.SetSource(source);
+    socket.SetDestination(destination);
+
+    socket.Open();
+    socket.Listen(5555, 255);
+    eventSem.Reset();
+    Threads::BeginThread((ThreadFunctionType) clientJobGetBinaryMode, this);
+    TCPSocket newSocket;
+
+    eventSem.Post();
+
+    socket.WaitConnection(TTInfiniteWait, &newSocket);
+
+    HttpProtocol test(newSocket);
+
+    bool ret = test.BinaryMode() == -1;
+
+    ret &= test.ReadHeader();
+    eventSem.Wait();
+
+    ret &= test.BinaryMode() == binaryMode;
+    ret &= (test.TextMode() == -1);
+    ret &= test.AcceptsEncoding("deflate");
+
+    newSocket.Close();
+    socket.Close();
+
+    return ret;
+}
+
+bool HttpProtocolTest::TestAcceptsEncoding(const char8 * const acceptEncoding, const char8 * const encoding, const bool expected) {
+    TCPSocket socket;
+    HttpProtocol test(socket);
+    bool ret = test.CreateAbsolute("InputOptions");
+    if (ret) {
+        ret = test.Write("Accept-Encoding", acceptEncoding);
+    }
+    if (ret) {
+        ret = (test.AcceptsEncoding(encoding) == expected);
+    }
+    return ret;
+}
+
+bool HttpProtocolTest::TestAcceptsEncoding_NoAcceptEncoding() {
+    TCPSocket socket;
+    HttpProtocol test(socket);
+    bool ret = !test.AcceptsEncoding("deflate");
+    if (ret) {
+        ret = test.CreateAbsolute("InputOptions");
+    }
+    if (ret) {
+        ret = !test.AcceptsEncoding("deflate");
+    }
+    return ret;
+}
+
 bool HttpProtocolTest::TestReadHeader_False_FailGetLine() {
 
     InternetHost source(5554, "127.0.0.1");
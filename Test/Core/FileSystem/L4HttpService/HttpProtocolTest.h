@@ -287,6 +287,21 @@ public:
      */
     bool TestTextMode(int8 textMode);
 
+    /**
+     * @brief Tests the BinaryMode method.
+     */
+    bool TestBinaryMode(int8 binaryMode);
+
+    /**
+     * @brief Tests the AcceptsEncoding method.
+     */
+    bool TestAcceptsEncoding(const char8 * const acceptEncoding, const char8 * const encoding, const bool expected);
+
+    /**
+     * @brief Tests that the AcceptsEncoding method returns false if the request has no Accept-Encoding.
+     */
+    bool TestAcceptsEncoding_NoAcceptEncoding();
+
     /**
      * @brief Tests the ReadHeader method that fails if
      * no data is sent by the host.
@@ -320,6 +335,8 @@ public:
 
     int8 textMode;
 
+    int8 binaryMode;
+
 };
 
 /*---------------------------------------------------------------------------*/
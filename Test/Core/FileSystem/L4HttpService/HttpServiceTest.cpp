@@ -37,6 +37,7 @@
 #include "HttpDefinition.h"
 #include "HttpProtocol.h"
 #include "HttpRealmI.h"
+#include "HighResolutionTimer.h"
 #include "HttpServiceTest.h"
 #include "JsonPrinter.h"
 
@@ -672,6 +673,113 @@ const char8 *config = ""
         "     }"
         "}";
 
+/**
+ * Helper function to start an HttpService serving the HttpServiceTestClassTest1 in Application.WebRoot.Test1.
+ */
+static bool StartHttpServiceEnvironment(const uint8 eventDriven,
+                                        const uint32 listenMaxConnections,
+                                        ReferenceT<HttpService> &service) {
+    StreamString configStream;
+    (void) configStream.Printf("%s", ""
+                               "$Application = {"
+                               "   Class = ReferenceContainer"
+                               "   +WebRoot = {"
+                               "       Class = HttpObjectBrowser"
+                               "       Root = \".\""
+                               "       +Test1 = {"
+                               "           Class = HttpServiceTestClassTest1"
+                               "       }"
+                               "   }"
+                               "   +HttpServerTest = {"
+                               "       Class = HttpService"
+                               "       WebRoot = \"Application.WebRoot\""
+                               "       Port = 9094"
+                               "       Timeout = 0"
+                               "       AcceptTimeout = 100"
+                               "       MaxNumberOfThreads = 100"
+                               "       MinNumberOfThreads = 1"
+                               "       NumberOfWorkers = 2");
+    (void) configStream.Printf(" EventDriven = %u ListenMaxConnections = %u } }", eventDriven, listenMaxConnections);
+    configStream.Seek(0);
+    ConfigurationDatabase cdb;
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    if (ok) {
+        service = god->Find("Application.HttpServerTest");
+        ok = service.IsValid();
+    }
+    if (ok) {
+        ok = (service->Start() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
+/**
+ * Expected reply to a GET /Test1/
+ */
+static const char8 * const HTTP_SERVICE_TEST1_REPLY = ""
+        "20\r\n"
+        "<html><head><TITLE>HttpServiceTe\r\n"
+        "20\r\n"
+        "stClassTest1</TITLE></head><BODY\r\n"
+        "20\r\n"
+        " BGCOLOR=\"#ffffff\"><H1>HttpServi\r\n"
+        "20\r\n"
+        "ceTestClassTest1</H1><UL></UL></\r\n"
+        "C\r\n"
+        "BODY></html>\r\n"
+        "0\r\n\r\n";
+
+/**
+ * Waits (up to 2 s) for the service to have \a nOfConnections open connections.
+ */
+static bool WaitForNumberOfConnections(ReferenceT<HttpService> service,
+                                       const uint32 nOfConnections) {
+    uint32 i;
+    bool ok = false;
+    for (i = 0u; (i < 200u) && (!ok); i++) {
+        ok = (service->GetNumberOfConnections() == nOfConnections);
+        if (!ok) {
+            Sleep::MSec(10);
+        }
+    }
+    return ok;
+}
+
+/**
+ * Parameters of each client thread of the TestClientService_Benchmark.
+ */
+struct HttpServiceTestBenchmarkClient {
+    uint32 nOfRequests;
+    uint64 totalTicks;
+    bool ok;
+    volatile int32 done;
+};
+
+static void HttpServiceTestBenchmarkClientThread(const void * const params) {
+    HttpServiceTestBenchmarkClient *client = static_cast<HttpServiceTestBenchmarkClient *>(const_cast<void *>(params));
+    HttpClient httpClient;
+    httpClient.SetServerAddress("127.0.0.1");
+    httpClient.SetServerPort(9094);
+    httpClient.SetServerUri("Test1");
+    uint32 i;
+    for (i = 0u; (i < client->nOfRequests) && (client->ok); i++) {
+        StreamString readOut;
+        uint64 start = HighResolutionTimer::Counter();
+        client->ok = httpClient.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+        client->totalTicks += (HighResolutionTimer::Counter() - start);
+        if (client->ok) {
+            client->ok = (readOut == HTTP_SERVICE_TEST1_REPLY);
+        }
+    }
+    Atomic::Increment(&client->done);
+}
+
 HttpServiceTest::HttpServiceTest() {
 }
 
@@ -1738,3 +1846,268 @@ bool HttpServiceTest::TestClientService_NoMoreThreads() {
     ObjectRegistryDatabase::Instance()->Purge();
     return ret;
 }
+
+bool HttpServiceTest::TestInitialise_EventDriven() {
+    ReferenceT<HttpService> service;
+    bool ret = StartHttpServiceEnvironment(1u, 255u, service);
+    if (ret) {
+        ret = service->IsEventDriven();
+    }
+    if (ret) {
+        ret = (service->GetNumberOfWorkers() == 2u);
+    }
+    if (ret) {
+        ret = (service->GetMinimumNumberOfPoolThreads() == 2u);
+    }
+    if (ret) {
+        ret = (service->GetNumberOfConnections() == 0u);
+    }
+    if (service.IsValid()) {
+        if (service->Stop() != ErrorManagement::NoError) {
+            ret = false;
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestInitialise_EventDriven_DefaultNumberOfWorkers() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("Port", 9094);
+    if (ret) {
+        ret = cdb.Write("WebRoot", "WebRoot");
+    }
+    if (ret) {
+        ret = cdb.Write("Timeout", 0);
+    }
+    if (ret) {
+        ret = cdb.Write("EventDriven", 1);
+    }
+    HttpService httpserver;
+    if (ret) {
+        ret = httpserver.Initialise(cdb);
+    }
+    if (ret) {
+        ret = httpserver.IsEventDriven();
+    }
+    if (ret) {
+        ret = (httpserver.GetNumberOfWorkers() == 2u);
+    }
+    if (ret) {
+        ret = (httpserver.GetMinimumNumberOfPoolThreads() == 2u);
+    }
+    return ret;
+}
+
+bool HttpServiceTest::TestInitialise_EventDriven_FalseZeroWorkers() {
+    ConfigurationDatabase cdb;
+    bool ret = cdb.Write("Port", 9094);
+    if (ret) {
+        ret = cdb.Write("WebRoot", "WebRoot");
+    }
+    if (ret) {
+        ret = cdb.Write("EventDriven", 1);
+    }
+    if (ret) {
+        ret = cdb.Write("NumberOfWorkers", 0);
+    }
+    HttpService httpserver;
+    if (ret) {
+        ret = !httpserver.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventDriven_KeepAlive() {
+    ReferenceT<HttpService> service;
+    bool ret = StartHttpServiceEnvironment(1u, 255u, service);
+
+    TCPSocket socket;
+    if (ret) {
+        ret = socket.Open();
+    }
+    if (ret) {
+        ret = socket.Connect("127.0.0.1", 9094);
+    }
+    uint32 i;
+    for (i = 0u; (i < 3u) && (ret); i++) {
+        HttpProtocol stream(socket);
+        socket.Printf("%s", "GET /Test1/ HTTP/1.1\r\n");
+        socket.Printf("%s", "Host: localhost:9094\r\n");
+        socket.Printf("%s", "Accept: text/html\r\n");
+        socket.Printf("%s", "Connection: keep-alive\r\n\r\n");
+        socket.Flush();
+
+        ret = stream.ReadHeader();
+        StreamString respBody;
+        if (ret) {
+            ret = stream.CompleteReadOperation(&respBody, 1000);
+        }
+        if (ret) {
+            ret = (respBody == HTTP_SERVICE_TEST1_REPLY);
+        }
+        //The same connection is used for all the requests
+        if (ret) {
+            ret = (service->GetNumberOfConnections() == 1u);
+        }
+    }
+    (void) socket.Close();
+    if (ret) {
+        ret = WaitForNumberOfConnections(service, 0u);
+    }
+    if (service.IsValid()) {
+        if (service->Stop() != ErrorManagement::NoError) {
+            ret = false;
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventDriven_ManyClients() {
+    ReferenceT<HttpService> service;
+    bool ret = StartHttpServiceEnvironment(1u, 255u, service);
+
+    const uint32 nOfClients = 16u;
+    {
+        HttpClient clients[nOfClients];
+        uint32 i;
+        for (i = 0u; i < nOfClients; i++) {
+            clients[i].SetServerAddress("127.0.0.1");
+            clients[i].SetServerPort(9094);
+            clients[i].SetServerUri("Test1");
+        }
+        //Interleave the requests of the keep-alive clients, so that all the connections are open at the same time
+        uint32 n;
+        for (n = 0u; (n < 2u) && (ret); n++) {
+            for (i = 0u; (i < nOfClients) && (ret); i++) {
+                StreamString readOut;
+                ret = clients[i].HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+                if (ret) {
+                    ret = (readOut == HTTP_SERVICE_TEST1_REPLY);
+                }
+            }
+        }
+        if (ret) {
+            ret = (service->GetNumberOfConnections() == nOfClients);
+        }
+        if (ret) {
+            ret = (service->GetNumberOfActiveThreads() == 2u);
+        }
+    }
+    //The clients were destroyed
+    if (ret) {
+        ret = WaitForNumberOfConnections(service, 0u);
+    }
+    if (service.IsValid()) {
+        if (service->Stop() != ErrorManagement::NoError) {
+            ret = false;
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_EventDriven_TooManyConnections() {
+    ReferenceT<HttpService> service;
+    bool ret = StartHttpServiceEnvironment(1u, 2u, service);
+
+    HttpClient test1;
+    HttpClient test2;
+    test1.SetServerAddress("127.0.0.1");
+    test1.SetServerPort(9094);
+    test1.SetServerUri("Test1");
+    test2.SetServerAddress("127.0.0.1");
+    test2.SetServerPort(9094);
+    test2.SetServerUri("Test1");
+    if (ret) {
+        StreamString readOut;
+        ret = test1.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ret) {
+        StreamString readOut;
+        ret = test2.HttpExchange(readOut, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    TCPSocket socket;
+    if (ret) {
+        ret = socket.Open();
+    }
+    if (ret) {
+        ret = socket.Connect("127.0.0.1", 9094);
+    }
+    if (ret) {
+        HttpProtocol stream(socket);
+        ret = stream.ReadHeader();
+        if (ret) {
+            ret = (stream.GetHttpCommand() == HttpDefinition::HSHCReplyTooManyRequests);
+        }
+    }
+    (void) socket.Close();
+    if (ret) {
+        ret = (service->GetNumberOfConnections() == 2u);
+    }
+    if (service.IsValid()) {
+        if (service->Stop() != ErrorManagement::NoError) {
+            ret = false;
+        }
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HttpServiceTest::TestClientService_Benchmark() {
+    const uint32 nOfRequests = 20u;
+    const uint32 maxNOfClients = 16u;
+    const uint32 nOfClientsTests[] = { 1u, 4u, maxNOfClients };
+    const uint32 nOfTests = static_cast<uint32>(sizeof(nOfClientsTests) / sizeof(nOfClientsTests[0]));
+    bool ret = true;
+    uint8 eventDriven;
+    for (eventDriven = 0u; (eventDriven < 2u) && (ret); eventDriven++) {
+        uint32 t;
+        for (t = 0u; (t < nOfTests) && (ret); t++) {
+            ReferenceT<HttpService> service;
+            ret = StartHttpServiceEnvironment(eventDriven, 255u, service);
+            const uint32 nOfClients = nOfClientsTests[t];
+            HttpServiceTestBenchmarkClient clients[maxNOfClients];
+            uint32 i;
+            for (i = 0u; i < nOfClients; i++) {
+                clients[i].nOfRequests = nOfRequests;
+                clients[i].totalTicks = 0u;
+                clients[i].ok = true;
+                clients[i].done = 0;
+            }
+            uint64 start = HighResolutionTimer::Counter();
+            for (i = 0u; (i < nOfClients) && (ret); i++) {
+                ret = (Threads::BeginThread(&HttpServiceTestBenchmarkClientThread, &clients[i]) != InvalidThreadIdentifier);
+                if (!ret) {
+                    clients[i].done = 1;
+                }
+            }
+            for (i = 0u; i < nOfClients; i++) {
+                while (clients[i].done == 0) {
+                    Sleep::MSec(1);
+                }
+            }
+            float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+            uint64 totalTicks = 0u;
+            for (i = 0u; (i < nOfClients) && (ret); i++) {
+                ret = clients[i].ok;
+                totalTicks += clients[i].totalTicks;
+            }
+            if (ret) {
+                float64 nOfExchanges = static_cast<float64>(nOfClients * nOfRequests);
+                float64 requestsPerSecond = nOfExchanges / elapsed;
+                float64 meanLatency = (static_cast<float64>(totalTicks) * HighResolutionTimer::Period() * 1e6) / nOfExchanges;
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "HttpService EventDriven = %u clients = %u: %f requests/s mean latency = %f us",
+                                    eventDriven, nOfClients, requestsPerSecond, meanLatency);
+            }
+            if (service.IsValid()) {
+                if (service->Stop() != ErrorManagement::NoError) {
+                    ret = false;
+                }
+            }
+            ObjectRegistryDatabase::Instance()->Purge();
+        }
+    }
+    return ret;
+}
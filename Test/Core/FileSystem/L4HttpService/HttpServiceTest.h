@@ -165,6 +165,43 @@ public:
      */
     bool TestClientService_NoMoreThreads();
 
+    /**
+     * @brief Tests the Initialise method in event-driven mode.
+     */
+    bool TestInitialise_EventDriven();
+
+    /**
+     * @brief Tests the Initialise method in event-driven mode without specifying the NumberOfWorkers.
+     */
+    bool TestInitialise_EventDriven_DefaultNumberOfWorkers();
+
+    /**
+     * @brief Tests that the Initialise method fails in event-driven mode with NumberOfWorkers = 0.
+     */
+    bool TestInitialise_EventDriven_FalseZeroWorkers();
+
+    /**
+     * @brief Tests that in event-driven mode several requests are served on the same keep-alive connection
+     * and that the connection is released when closed by the client.
+     */
+    bool TestClientService_EventDriven_KeepAlive();
+
+    /**
+     * @brief Tests that in event-driven mode many more keep-alive connections than workers are served.
+     */
+    bool TestClientService_EventDriven_ManyClients();
+
+    /**
+     * @brief Tests that in event-driven mode the connections above ListenMaxConnections are refused with HSHCReplyTooManyRequests.
+     */
+    bool TestClientService_EventDriven_TooManyConnections();
+
+    /**
+     * @brief Benchmarks the requests/s and latency of the thread-per-connection and of the event-driven modes for 1, 4 and 16 concurrent keep-alive clients.
+     * @details The results are reported as Information and are not verified (only that all the requests succeed).
+     */
+    bool TestClientService_Benchmark();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,591 @@
+/**
+ * @file HttpStreamDataSourceTest.cpp
+ * @brief Source file for class HttpStreamDataSourceTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpStreamDataSourceTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "HttpClient.h"
+#include "HttpService.h"
+#include "HttpStreamDataSource.h"
+#include "HttpStreamDataSourceTest.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Dummy scheduler for the tests
+ */
+class HttpStreamDataSourceTestScheduler: public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    HttpStreamDataSourceTestScheduler() {
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+};
+CLASS_REGISTER(HttpStreamDataSourceTestScheduler, "1.0")
+
+/**
+ * Dummy GAM for the tests
+ */
+class HttpStreamDataSourceTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    HttpStreamDataSourceTestGAM() {
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+};
+CLASS_REGISTER(HttpStreamDataSourceTestGAM, "1.0")
+
+/**
+ * Application with a GAM writing two signals into an HttpStreamDataSource and an HttpService to browse it (the PARAMETERS are replaced).
+ */
+static const MARTe::char8 * const httpStreamTestApplication = ""
+        "+HttpStreamTestService = {"
+        "    Class = HttpService"
+        "    Port = 9098"
+        "    ChunkSize = 1024"
+        "    Timeout = 0"
+        "    AcceptTimeout = 100"
+        "    MinNumberOfThreads = 1"
+        "    MaxNumberOfThreads = 8"
+        "    ListenMaxConnections = 255"
+        "    IsTextMode = 1"
+        "    WebRoot = HttpStreamTestBrowser"
+        "}"
+        "+HttpStreamTestBrowser = {"
+        "    Class = HttpObjectBrowser"
+        "    Root = \"/\""
+        "}"
+        "$RTApp = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = HttpStreamDataSourceTestGAM"
+        "            OutputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = Stream"
+        "                    Type = uint32"
+        "                }"
+        "                Signal2 = {"
+        "                    DataSource = Stream"
+        "                    Type = int16"
+        "                    NumberOfElements = 3"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = Stream"
+        "        +Stream = {"
+        "            Class = HttpStreamDataSource"
+        "            PARAMETERS"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = HttpStreamDataSourceTestScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Configures the test application with the HttpStreamDataSource \a parameters, sets the signals and starts the HttpService.
+ */
+static bool InitialiseHttpStreamTestApplication(const MARTe::char8 * const parameters,
+                                                MARTe::ReferenceT<MARTe::HttpStreamDataSource> &stream,
+                                                MARTe::ReferenceT<MARTe::HttpService> &service) {
+    using namespace MARTe;
+    StreamString templateConfig = httpStreamTestApplication;
+    StreamString config;
+    const char8 * const parametersToken = StringHelper::SearchString(templateConfig.Buffer(), "PARAMETERS");
+    bool ok = (parametersToken != NULL_PTR(const char8 *));
+    if (ok) {
+        uint32 prefixSize = static_cast<uint32>(parametersToken - templateConfig.Buffer());
+        ok = config.Write(templateConfig.Buffer(), prefixSize);
+    }
+    if (ok) {
+        ok = config.Printf("%s%s", parameters, &parametersToken[StringHelper::Length("PARAMETERS")]);
+    }
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("RTApp");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        stream = ObjectRegistryDatabase::Instance()->Find("RTApp.Data.Stream");
+        ok = stream.IsValid();
+    }
+    void *signal1 = NULL_PTR(void *);
+    void *signal2 = NULL_PTR(void *);
+    if (ok) {
+        ok = stream->GetSignalMemoryBuffer(0u, 0u, signal1);
+    }
+    if (ok) {
+        ok = stream->GetSignalMemoryBuffer(1u, 0u, signal2);
+    }
+    if (ok) {
+        *reinterpret_cast<uint32 *>(signal1) = 7u;
+        int16 *signal2Values = reinterpret_cast<int16 *>(signal2);
+        signal2Values[0] = 1;
+        signal2Values[1] = -2;
+        signal2Values[2] = 3;
+        ok = stream->Synchronise();
+    }
+    if (ok) {
+        service = ObjectRegistryDatabase::Instance()->Find("HttpStreamTestService");
+        ok = service.IsValid();
+    }
+    if (ok) {
+        ok = service->Start();
+    }
+    return ok;
+}
+
+/**
+ * @brief Requests 20 events from the HttpStreamDataSource (used to keep a stream active).
+ */
+static void HttpStreamDataSourceTestClientThread(const void * const params) {
+    using namespace MARTe;
+    HttpClient client;
+    client.SetServerAddress("127.0.0.1");
+    client.SetServerPort(9098);
+    client.SetServerUri("RTApp/Data/Stream?NumberOfEvents=20");
+    StreamString reply;
+    (void) client.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 5000u);
+}
+
+/**
+ * The first event expected after InitialiseHttpStreamTestApplication.
+ */
+static const MARTe::char8 * const httpStreamTestEvent = "id: 1\ndata: {\"Signal1\": 7,\"Signal2\": [ 1, -2, 3 ] }\n\n";
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool HttpStreamDataSourceTest::TestConstructor() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    bool ok = (test.GetNumberOfSnapshots() == 0u);
+    if (ok) {
+        ok = (test.GetNumberOfStreams() == 0u);
+    }
+    if (ok) {
+        uint32 numberOfSnapshots;
+        uint8 snapshot;
+        ok = !test.GetSnapshot(&snapshot, numberOfSnapshots);
+    }
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestInitialise() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("PublishDecimation", 2u);
+    if (ok) {
+        ok = cdb.Write("StreamPeriod", 10u);
+    }
+    if (ok) {
+        ok = cdb.Write("MaxNumberOfStreams", 1u);
+    }
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestInitialise_False_PublishDecimation() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("PublishDecimation", 0u);
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestInitialise_False_StreamPeriod() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("StreamPeriod", 0u);
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestInitialise_False_MaxNumberOfStreams() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("MaxNumberOfStreams", 0u);
+    if (ok) {
+        ok = !test.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestGetBrokerName() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    ConfigurationDatabase cdb;
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    if (ok) {
+        ok = (test.GetBrokerName(cdb, InputSignals) == NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = cdb.Write("Samples", 2u);
+    }
+    if (ok) {
+        ok = (test.GetBrokerName(cdb, OutputSignals) == NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = cdb.Delete("Samples");
+    }
+    if (ok) {
+        ok = cdb.Write("Frequency", 10.0F);
+    }
+    if (ok) {
+        ok = (test.GetBrokerName(cdb, OutputSignals) == NULL_PTR(const char8 *));
+    }
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestGetInputBrokers() {
+    using namespace MARTe;
+    HttpStreamDataSource test;
+    ReferenceContainer inputBrokers;
+    return !test.GetInputBrokers(inputBrokers, "GAMA", NULL_PTR(void *));
+}
+
+bool HttpStreamDataSourceTest::TestGetOutputBrokers() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("", stream, service);
+    if (ok) {
+        ok = (stream->GetNumberOfSignals() == 2u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestSynchronise() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("PublishDecimation = 3", stream, service);
+    //The first Synchronise in InitialiseHttpStreamTestApplication does not publish.
+    if (ok) {
+        ok = (stream->GetNumberOfSnapshots() == 0u);
+    }
+    if (ok) {
+        ok = stream->Synchronise();
+    }
+    if (ok) {
+        ok = (stream->GetNumberOfSnapshots() == 0u);
+    }
+    if (ok) {
+        ok = stream->Synchronise();
+    }
+    if (ok) {
+        ok = (stream->GetNumberOfSnapshots() == 1u);
+    }
+    for (uint32 i = 0u; (i < 6u) && (ok); i++) {
+        ok = stream->Synchronise();
+    }
+    if (ok) {
+        ok = (stream->GetNumberOfSnapshots() == 3u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestGetSnapshot() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("", stream, service);
+    //Signal1 (uint32) followed by Signal2 (3 x int16)
+    uint8 snapshot[10];
+    uint32 numberOfSnapshots = 0u;
+    if (ok) {
+        ok = stream->GetSnapshot(&snapshot[0], numberOfSnapshots);
+    }
+    if (ok) {
+        ok = (numberOfSnapshots == 1u);
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<uint32 *>(&snapshot[0]) == 7u);
+    }
+    if (ok) {
+        ok = (reinterpret_cast<int16 *>(&snapshot[4])[1] == -2);
+    }
+    //Change the signal without publishing. The snapshot shall not change.
+    void *signal1 = NULL_PTR(void *);
+    if (ok) {
+        ok = stream->GetSignalMemoryBuffer(0u, 0u, signal1);
+    }
+    if (ok) {
+        *reinterpret_cast<uint32 *>(signal1) = 8u;
+        ok = stream->GetSnapshot(&snapshot[0], numberOfSnapshots);
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<uint32 *>(&snapshot[0]) == 7u);
+    }
+    if (ok) {
+        ok = stream->Synchronise();
+    }
+    if (ok) {
+        ok = stream->GetSnapshot(&snapshot[0], numberOfSnapshots);
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<uint32 *>(&snapshot[0]) == 8u);
+    }
+    if (ok) {
+        ok = (numberOfSnapshots == 2u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestGetAsStructuredData() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("", stream, service);
+    HttpClient client;
+    client.SetServerAddress("127.0.0.1");
+    client.SetServerPort(9098);
+    client.SetServerUri("RTApp/Data/Stream?TextMode=0");
+    StreamString reply;
+    if (ok) {
+        ok = client.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ok) {
+        ok = (client.GetHttpProtocol()->GetHttpCommand() == HttpDefinition::HSHCReplyOK);
+    }
+    if (ok) {
+        ok = (StringHelper::SearchString(reply.Buffer(), "{\"Signal1\": 7,\"Signal2\": [ 1, -2, 3 ] }") != NULL_PTR(const char8 *));
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestGetAsText() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("StreamPeriod = 10", stream, service);
+    HttpClient client;
+    client.SetServerAddress("127.0.0.1");
+    client.SetServerPort(9098);
+    client.SetServerUri("RTApp/Data/Stream?NumberOfEvents=3");
+    StreamString reply;
+    if (ok) {
+        ok = client.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    HttpProtocol *clientProtocol = client.GetHttpProtocol();
+    if (ok) {
+        ok = (clientProtocol->GetHttpCommand() == HttpDefinition::HSHCReplyOK);
+    }
+    StreamString contentType;
+    if (ok) {
+        ok = clientProtocol->MoveAbsolute("InputOptions");
+    }
+    if (ok) {
+        ok = clientProtocol->Read("Content-Type", contentType);
+    }
+    if (ok) {
+        ok = (contentType == "text/event-stream");
+    }
+    //Count the events (the raw chunked body is returned by the HttpClient).
+    uint32 numberOfEvents = 0u;
+    const char8 *event = reply.Buffer();
+    while ((ok) && (event != NULL_PTR(const char8 *))) {
+        event = StringHelper::SearchString(event, httpStreamTestEvent);
+        if (event != NULL_PTR(const char8 *)) {
+            numberOfEvents++;
+            event = &event[1];
+        }
+    }
+    if (ok) {
+        ok = (numberOfEvents == 3u);
+    }
+    if (ok) {
+        ok = (stream->GetNumberOfStreams() == 0u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestGetAsText_TooManyStreams() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("StreamPeriod = 50 MaxNumberOfStreams = 1", stream, service);
+    if (ok) {
+        ok = (Threads::BeginThread((ThreadFunctionType) HttpStreamDataSourceTestClientThread, NULL) != InvalidThreadIdentifier);
+    }
+    uint32 timeout = 0u;
+    while ((ok) && (stream->GetNumberOfStreams() == 0u)) {
+        Sleep::MSec(10u);
+        timeout++;
+        ok = (timeout < 200u);
+    }
+    HttpClient client;
+    client.SetServerAddress("127.0.0.1");
+    client.SetServerPort(9098);
+    client.SetServerUri("RTApp/Data/Stream?NumberOfEvents=1");
+    StreamString reply;
+    if (ok) {
+        ok = client.HttpExchange(reply, HttpDefinition::HSHCGet, NULL, 1000u);
+    }
+    if (ok) {
+        ok = (client.GetHttpProtocol()->GetHttpCommand() == HttpDefinition::HSHCReplyTooManyRequests);
+    }
+    timeout = 0u;
+    while ((ok) && (stream->GetNumberOfStreams() > 0u)) {
+        Sleep::MSec(10u);
+        timeout++;
+        ok = (timeout < 500u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool HttpStreamDataSourceTest::TestPurge() {
+    using namespace MARTe;
+    ReferenceT<HttpStreamDataSource> stream;
+    ReferenceT<HttpService> service;
+    bool ok = InitialiseHttpStreamTestApplication("StreamPeriod = 1000", stream, service);
+    if (ok) {
+        ok = (Threads::BeginThread((ThreadFunctionType) HttpStreamDataSourceTestClientThread, NULL) != InvalidThreadIdentifier);
+    }
+    uint32 timeout = 0u;
+    while ((ok) && (stream->GetNumberOfStreams() == 0u)) {
+        Sleep::MSec(10u);
+        timeout++;
+        ok = (timeout < 200u);
+    }
+    //Without the Purge the stream would last 20 seconds.
+    if (ok) {
+        ReferenceContainer purgeList;
+        stream->Purge(purgeList);
+    }
+    timeout = 0u;
+    while ((ok) && (stream->GetNumberOfStreams() > 0u)) {
+        Sleep::MSec(10u);
+        timeout++;
+        ok = (timeout < 300u);
+    }
+    if (ok) {
+        ok = service->Stop();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
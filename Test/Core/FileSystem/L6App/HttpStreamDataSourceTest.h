@@ -0,0 +1,120 @@
+/**
+ * @file HttpStreamDataSourceTest.h
+ * @brief Header file for class HttpStreamDataSourceTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class HttpStreamDataSourceTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L6APP_HTTPSTREAMDATASOURCETEST_H_
+#define L6APP_HTTPSTREAMDATASOURCETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the HttpStreamDataSource public methods.
+ */
+class HttpStreamDataSourceTest {
+
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails if PublishDecimation = 0.
+     */
+    bool TestInitialise_False_PublishDecimation();
+
+    /**
+     * @brief Tests that the Initialise method fails if StreamPeriod = 0.
+     */
+    bool TestInitialise_False_StreamPeriod();
+
+    /**
+     * @brief Tests that the Initialise method fails if MaxNumberOfStreams = 0.
+     */
+    bool TestInitialise_False_MaxNumberOfStreams();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests that the GetInputBrokers method returns false.
+     */
+    bool TestGetInputBrokers();
+
+    /**
+     * @brief Tests that an application with output signals is correctly configured.
+     */
+    bool TestGetOutputBrokers();
+
+    /**
+     * @brief Tests that the Synchronise method publishes a snapshot every PublishDecimation calls.
+     */
+    bool TestSynchronise();
+
+    /**
+     * @brief Tests the GetSnapshot method.
+     */
+    bool TestGetSnapshot();
+
+    /**
+     * @brief Tests that the GetAsStructuredData replies with the last snapshot.
+     */
+    bool TestGetAsStructuredData();
+
+    /**
+     * @brief Tests that the GetAsText streams NumberOfEvents server-sent events.
+     */
+    bool TestGetAsText();
+
+    /**
+     * @brief Tests that the GetAsText replies with a 429 if MaxNumberOfStreams are already active.
+     */
+    bool TestGetAsText_TooManyStreams();
+
+    /**
+     * @brief Tests that the active streams end when the DataSource is purged.
+     */
+    bool TestPurge();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L6APP_HTTPSTREAMDATASOURCETEST_H_ */
@@ -0,0 +1,479 @@
+/**
+ * @file RealTimeApplicationConfigurationFileCacheTest.cpp
+ * @brief Source file for class RealTimeApplicationConfigurationFileCacheTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeApplicationConfigurationFileCacheTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Directory.h"
+#include "GAM.h"
+#include "GAMSchedulerI.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "RealTimeApplicationConfigurationFileCache.h"
+#include "RealTimeApplicationConfigurationFileCacheTest.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static const MARTe::char8 * const fileCacheTestFile = "/tmp/RealTimeApplicationConfigurationFileCacheTest.cache";
+
+/**
+ * Dummy scheduler for the tests
+ */
+class RealTimeApplicationConfigurationFileCacheTestScheduler: public MARTe::GAMSchedulerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    RealTimeApplicationConfigurationFileCacheTestScheduler() {
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StartNextStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual MARTe::ErrorManagement::ErrorType StopCurrentStateExecution() {
+        return MARTe::ErrorManagement::NoError;
+    }
+
+    virtual void CustomPrepareNextState() {
+    }
+};
+CLASS_REGISTER(RealTimeApplicationConfigurationFileCacheTestScheduler, "1.0")
+
+/**
+ * Dummy GAM for the tests
+ */
+class RealTimeApplicationConfigurationFileCacheTestGAM: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    RealTimeApplicationConfigurationFileCacheTestGAM() {
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+};
+CLASS_REGISTER(RealTimeApplicationConfigurationFileCacheTestGAM, "1.0")
+
+static const MARTe::char8 * const fileCacheTestApplication = ""
+        "$RTApp = {"
+        "    Class = RealTimeApplication"
+        "    +ConfigurationCache = {"
+        "        Class = RealTimeApplicationConfigurationFileCache"
+        "        File = \"/tmp/RealTimeApplicationConfigurationFileCacheTest.cache\""
+        "    }"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = RealTimeApplicationConfigurationFileCacheTestGAM"
+        "            OutputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                }"
+        "                Signal2 = {"
+        "                    DataSource = DDB1"
+        "                    Type = float32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = RealTimeApplicationConfigurationFileCacheTestGAM"
+        "            InputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    NumberOfElements = 4"
+        "                    Ranges = {{1 2}}"
+        "                }"
+        "                Signal2 = {"
+        "                    DataSource = DDB1"
+        "                    Type = float32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA, GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeApplicationConfigurationFileCacheTestScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+static bool InitialiseFileCacheTestApplication(MARTe::ReferenceT<MARTe::RealTimeApplication> &app) {
+    using namespace MARTe;
+    StreamString config = fileCacheTestApplication;
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb);
+    bool ok = config.Seek(0LLU);
+    if (ok) {
+        ok = parser.Parse();
+    }
+    if (ok) {
+        ObjectRegistryDatabase::Instance()->Purge();
+        ok = ObjectRegistryDatabase::Instance()->Initialise(cdb);
+    }
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("RTApp");
+        ok = app.IsValid();
+    }
+    return ok;
+}
+
+static bool InitialiseFileCache(MARTe::RealTimeApplicationConfigurationFileCache &cache,
+                                const MARTe::char8 * const fileName) {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("File", fileName);
+    if (ok) {
+        ok = cache.Initialise(cdb);
+    }
+    return ok;
+}
+
+static bool CreateDatabases(MARTe::ConfigurationDatabase &functionsDatabase,
+                            MARTe::ConfigurationDatabase &dataSourcesDatabase) {
+    using namespace MARTe;
+    bool ok = functionsDatabase.CreateAbsolute("Functions.0");
+    if (ok) {
+        ok = functionsDatabase.Write("QualifiedName", "GAMA");
+    }
+    if (ok) {
+        ok = functionsDatabase.CreateRelative("Signals.InputSignals.0");
+    }
+    if (ok) {
+        ok = functionsDatabase.Write("QualifiedName", "Signal1");
+    }
+    if (ok) {
+        ok = functionsDatabase.Write("ByteSize", 8u);
+    }
+    if (ok) {
+        uint32 byteOffsetT[2][2] = { { 0u, 4u }, { 8u, 4u } };
+        Matrix<uint32> byteOffset(&byteOffsetT[0][0], 2u, 2u);
+        ok = functionsDatabase.Write("ByteOffset", byteOffset);
+    }
+    if (ok) {
+        ok = functionsDatabase.MoveToRoot();
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.CreateAbsolute("Data.0");
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.Write("QualifiedName", "Drv1");
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.CreateRelative("Signals.0");
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.Write("Type", "float32");
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.Write("Frequency", -1.5F);
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.CreateRelative("States");
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.MoveToRoot();
+    }
+    return ok;
+}
+
+static bool VerifyDatabases(MARTe::ConfigurationDatabase &functionsDatabase,
+                            MARTe::ConfigurationDatabase &dataSourcesDatabase) {
+    using namespace MARTe;
+    bool ok = functionsDatabase.MoveAbsolute("Functions.0");
+    StreamString str;
+    if (ok) {
+        ok = functionsDatabase.Read("QualifiedName", str);
+    }
+    if (ok) {
+        ok = (str == "GAMA");
+    }
+    if (ok) {
+        ok = functionsDatabase.MoveRelative("Signals.InputSignals.0");
+    }
+    uint32 byteSize = 0u;
+    if (ok) {
+        ok = functionsDatabase.Read("ByteSize", byteSize);
+    }
+    if (ok) {
+        ok = (byteSize == 8u);
+    }
+    if (ok) {
+        uint32 byteOffsetT[2][2];
+        Matrix<uint32> byteOffset(&byteOffsetT[0][0], 2u, 2u);
+        ok = functionsDatabase.Read("ByteOffset", byteOffset);
+        if (ok) {
+            ok = (byteOffsetT[0][0] == 0u) && (byteOffsetT[0][1] == 4u) && (byteOffsetT[1][0] == 8u) && (byteOffsetT[1][1] == 4u);
+        }
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.MoveAbsolute("Data.0.Signals.0");
+    }
+    if (ok) {
+        str = "";
+        ok = dataSourcesDatabase.Read("Type", str);
+    }
+    if (ok) {
+        ok = (str == "float32");
+    }
+    float32 frequency = 0.F;
+    if (ok) {
+        ok = dataSourcesDatabase.Read("Frequency", frequency);
+    }
+    if (ok) {
+        ok = (frequency == -1.5F);
+    }
+    if (ok) {
+        ok = dataSourcesDatabase.MoveRelative("States");
+    }
+    if (ok) {
+        ok = (dataSourcesDatabase.GetNumberOfChildren() == 0u);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestConstructor() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    return true;
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestInitialise() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    return InitialiseFileCache(test, fileCacheTestFile);
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestInitialise_NoFile() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    ConfigurationDatabase cdb;
+    return !test.Initialise(cdb);
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestStore() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    bool ok = InitialiseFileCache(test, fileCacheTestFile);
+    ConfigurationDatabase functionsDatabase;
+    ConfigurationDatabase dataSourcesDatabase;
+    if (ok) {
+        ok = CreateDatabases(functionsDatabase, dataSourcesDatabase);
+    }
+    if (ok) {
+        ok = test.Store(0x12345678u, functionsDatabase, dataSourcesDatabase);
+    }
+    ConfigurationDatabase functionsDatabaseLoaded;
+    ConfigurationDatabase dataSourcesDatabaseLoaded;
+    if (ok) {
+        ok = test.Load(0x12345678u, functionsDatabaseLoaded, dataSourcesDatabaseLoaded);
+    }
+    if (ok) {
+        ok = VerifyDatabases(functionsDatabaseLoaded, dataSourcesDatabaseLoaded);
+    }
+    Directory toDelete(fileCacheTestFile);
+    (void) toDelete.Delete();
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestStore_InvalidFile() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    bool ok = InitialiseFileCache(test, "/this/directory/does/not/exist/RealTimeApplicationConfigurationFileCacheTest.cache");
+    ConfigurationDatabase functionsDatabase;
+    ConfigurationDatabase dataSourcesDatabase;
+    if (ok) {
+        ok = CreateDatabases(functionsDatabase, dataSourcesDatabase);
+    }
+    if (ok) {
+        ok = !test.Store(1u, functionsDatabase, dataSourcesDatabase);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestLoad() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    bool ok = InitialiseFileCache(test, fileCacheTestFile);
+    ConfigurationDatabase functionsDatabase;
+    ConfigurationDatabase dataSourcesDatabase;
+    if (ok) {
+        ok = CreateDatabases(functionsDatabase, dataSourcesDatabase);
+    }
+    if (ok) {
+        ok = test.Store(7u, functionsDatabase, dataSourcesDatabase);
+    }
+    //Store again to verify that the previous contents are replaced
+    if (ok) {
+        ok = test.Store(8u, functionsDatabase, dataSourcesDatabase);
+    }
+    ConfigurationDatabase functionsDatabaseLoaded;
+    ConfigurationDatabase dataSourcesDatabaseLoaded;
+    if (ok) {
+        RealTimeApplicationConfigurationFileCache test2;
+        ok = InitialiseFileCache(test2, fileCacheTestFile);
+        if (ok) {
+            ok = test2.Load(8u, functionsDatabaseLoaded, dataSourcesDatabaseLoaded);
+        }
+    }
+    if (ok) {
+        ok = VerifyDatabases(functionsDatabaseLoaded, dataSourcesDatabaseLoaded);
+    }
+    Directory toDelete(fileCacheTestFile);
+    (void) toDelete.Delete();
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestLoad_WrongHash() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    bool ok = InitialiseFileCache(test, fileCacheTestFile);
+    ConfigurationDatabase functionsDatabase;
+    ConfigurationDatabase dataSourcesDatabase;
+    if (ok) {
+        ok = CreateDatabases(functionsDatabase, dataSourcesDatabase);
+    }
+    if (ok) {
+        ok = test.Store(7u, functionsDatabase, dataSourcesDatabase);
+    }
+    if (ok) {
+        ConfigurationDatabase functionsDatabaseLoaded;
+        ConfigurationDatabase dataSourcesDatabaseLoaded;
+        ok = !test.Load(6u, functionsDatabaseLoaded, dataSourcesDatabaseLoaded);
+    }
+    Directory toDelete(fileCacheTestFile);
+    (void) toDelete.Delete();
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestLoad_NoFile() {
+    using namespace MARTe;
+    RealTimeApplicationConfigurationFileCache test;
+    bool ok = InitialiseFileCache(test, fileCacheTestFile);
+    Directory toDelete(fileCacheTestFile);
+    (void) toDelete.Delete();
+    if (ok) {
+        ConfigurationDatabase functionsDatabaseLoaded;
+        ConfigurationDatabase dataSourcesDatabaseLoaded;
+        ok = !test.Load(7u, functionsDatabaseLoaded, dataSourcesDatabaseLoaded);
+    }
+    return ok;
+}
+
+bool RealTimeApplicationConfigurationFileCacheTest::TestRealTimeApplication() {
+    using namespace MARTe;
+    Directory toDelete(fileCacheTestFile);
+    (void) toDelete.Delete();
+    //The first configuration stores the databases
+    ReferenceT<RealTimeApplication> app;
+    bool ok = InitialiseFileCacheTestApplication(app);
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    uint32 hash = 0u;
+    if (ok) {
+        hash = app->GetConfigurationHash();
+        ok = (hash != 0u);
+    }
+    ConfigurationDatabase functionsDatabase;
+    ConfigurationDatabase dataSourcesDatabase;
+    if (ok) {
+        RealTimeApplicationConfigurationFileCache test;
+        ok = InitialiseFileCache(test, fileCacheTestFile);
+        if (ok) {
+            ok = test.Load(hash, functionsDatabase, dataSourcesDatabase);
+        }
+    }
+    //The loaded databases are sufficient to configure the application
+    if (ok) {
+        ok = InitialiseFileCacheTestApplication(app);
+    }
+    if (ok) {
+        ok = (app->GetConfigurationHash() == hash);
+    }
+    if (ok) {
+        ok = app->ConfigureApplication(functionsDatabase, dataSourcesDatabase);
+    }
+    if (ok) {
+        ReferenceT<GAM> gamB = ObjectRegistryDatabase::Instance()->Find("RTApp.Functions.GAMB");
+        ok = gamB.IsValid();
+        uint32 byteSize = 0u;
+        if (ok) {
+            ok = gamB->GetSignalByteSize(InputSignals, 0u, byteSize);
+        }
+        if (ok) {
+            ok = (byteSize == 8u);
+        }
+    }
+    //And ConfigureApplication also works from the cache
+    if (ok) {
+        ok = InitialiseFileCacheTestApplication(app);
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    (void) toDelete.Delete();
+    return ok;
+}
+
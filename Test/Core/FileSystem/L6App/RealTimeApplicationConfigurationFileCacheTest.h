@@ -0,0 +1,96 @@
+/**
+ * @file RealTimeApplicationConfigurationFileCacheTest.h
+ * @brief Header file for class RealTimeApplicationConfigurationFileCacheTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeApplicationConfigurationFileCacheTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef L6APP_REALTIMEAPPLICATIONCONFIGURATIONFILECACHETEST_H_
+#define L6APP_REALTIMEAPPLICATIONCONFIGURATIONFILECACHETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the RealTimeApplicationConfigurationFileCache public methods.
+ */
+class RealTimeApplicationConfigurationFileCacheTest {
+
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails if the File is not specified.
+     */
+    bool TestInitialise_NoFile();
+
+    /**
+     * @brief Tests that the Store method writes databases which are loaded back by the Load method.
+     */
+    bool TestStore();
+
+    /**
+     * @brief Tests that the Store method fails if the File cannot be written.
+     */
+    bool TestStore_InvalidFile();
+
+    /**
+     * @brief Tests the Load method.
+     */
+    bool TestLoad();
+
+    /**
+     * @brief Tests that the Load method fails if the databases were stored with another hash.
+     */
+    bool TestLoad_WrongHash();
+
+    /**
+     * @brief Tests that the Load method fails if the File does not exist.
+     */
+    bool TestLoad_NoFile();
+
+    /**
+     * @brief Tests that the databases stored by a RealTimeApplication can be loaded back and used to configure a RealTimeApplication.
+     */
+    bool TestRealTimeApplication();
+};
+
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* L6APP_REALTIMEAPPLICATIONCONFIGURATIONFILECACHETEST_H_ */
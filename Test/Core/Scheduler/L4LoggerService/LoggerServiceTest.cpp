@@ -61,6 +61,33 @@ public:
 };
 CLASS_REGISTER(LoggerConsumerITest, "1.0")
 
+/**
+ * A dummy logger that waits for the report of dropped logs
+ */
+class LoggerConsumerIDroppedTest: public MARTe::Object, public MARTe::LoggerConsumerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+    LoggerConsumerIDroppedTest() : Object() {
+        ok = false;
+    }
+
+    virtual ~LoggerConsumerIDroppedTest() {
+
+    }
+
+    virtual void ConsumeLogMessage(MARTe::LoggerPage *logPage) {
+        if (logPage->errorInfo.header.errorType == MARTe::ErrorManagement::Warning) {
+            MARTe::StreamString err = logPage->errorStrBuffer;
+            if (err.Locate("log messages were lost") >= 0) {
+                ok = true;
+            }
+        }
+    }
+
+    bool ok;
+};
+CLASS_REGISTER(LoggerConsumerIDroppedTest, "1.0")
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -138,6 +165,17 @@ bool LoggerServiceTest::TestInitialise_False_NumberOfLoggerPages_Zero() {
     return !test.Initialise(cdb);
 }
 
+bool LoggerServiceTest::TestInitialise_False_NumberOfLogsPerBatch_Zero() {
+    using namespace MARTe;
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x2);
+    cdb.Write("NumberOfLogsPerBatch", 0);
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    test.Insert(consumer);
+    return !test.Initialise(cdb);
+}
+
 bool LoggerServiceTest::TestInitialise_False_NoConsumers() {
     using namespace MARTe;
     LoggerService test;
@@ -172,6 +210,19 @@ bool LoggerServiceTest::TestGetStackSize() {
     return TestInitialise();
 }
 
+bool LoggerServiceTest::TestGetNumberOfLogsPerBatch() {
+    using namespace MARTe;
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    cdb.Write("NumberOfLogsPerBatch", 4);
+    ReferenceT<LoggerConsumerITest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    bool ok = test.Insert(consumer);
+    ok &= test.Initialise(cdb);
+    ok &= (test.GetNumberOfLogsPerBatch() == 4u);
+    return ok;
+}
+
 bool LoggerServiceTest::TestExecute() {
     using namespace MARTe;
     LoggerService test;
@@ -204,3 +255,35 @@ bool LoggerServiceTest::TestExecute() {
     return ok;
 }
 
+bool LoggerServiceTest::TestExecute_DroppedLogs() {
+    using namespace MARTe;
+    Logger *logger = Logger::Instance();
+    uint32 nOfPages = logger->GetNumberOfPages();
+    uint32 i;
+    //Fill all the pages so that the last messages are dropped
+    for (i = 0u; i < (nOfPages + 3u); i++) {
+        REPORT_ERROR_STATIC(ErrorManagement::Debug, "LoggerService TestExecute_DroppedLogs");
+    }
+    bool ok = (logger->GetNumberOfLogs() == nOfPages);
+    LoggerService test;
+    ConfigurationDatabase cdb;
+    cdb.Write("CPUs", 0x1);
+    cdb.Write("NumberOfLogsPerBatch", 4);
+    ReferenceT<LoggerConsumerIDroppedTest> consumer(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    if (ok) {
+        ok = test.Insert(consumer);
+    }
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        uint32 maxWait = 2000;
+        ok = consumer->ok;
+        for (i = 0; (i < maxWait) && (!ok); i++) {
+            ok = consumer->ok;
+            Sleep::Sec(1e-3);
+        }
+    }
+    return ok;
+}
+
@@ -71,6 +71,11 @@ public:
      */
     bool TestInitialise_False_NumberOfLoggerPages_Zero();
 
+    /**
+     * @brief Tests the initialise method with a zero number of logs per batch.
+     */
+    bool TestInitialise_False_NumberOfLogsPerBatch_Zero();
+
     /**
      * @brief Tests the initialise method without adding any consumer.
      */
@@ -86,6 +91,11 @@ public:
      */
     bool TestExecute();
 
+    /**
+     * @brief Tests that the Execute method reports the number of logs dropped by the Logger.
+     */
+    bool TestExecute_DroppedLogs();
+
     /**
      * @brief Tests the GetNumberOfLogPages method.
      */
@@ -100,6 +110,11 @@ public:
      * @brief Tests the GetStackSize method.
      */
     bool TestGetStackSize();
+
+    /**
+     * @brief Tests the GetNumberOfLogsPerBatch method.
+     */
+    bool TestGetNumberOfLogsPerBatch();
 };
 
 /*---------------------------------------------------------------------------*/
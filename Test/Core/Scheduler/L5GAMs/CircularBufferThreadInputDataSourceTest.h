@@ -218,6 +218,12 @@ public:
      */
     bool TestSynchronise_SleepTime();
 
+    /**
+     * @brief Tests the CircularBufferThreadInputDataSource::Synchronise method
+     * when the BlockingSynchronise parameter is set.
+     */
+    bool TestSynchronise_BlockingSynchronise();
+
     /**
      * @brief Tests the CircularBufferThreadInputDataSource::GetInputOffset
      * method.
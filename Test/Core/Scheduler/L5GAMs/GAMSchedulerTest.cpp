@@ -70,6 +70,41 @@ public:
 };
 CLASS_REGISTER(GAMSchedulerTestGAMFalse, "1.0")
 
+/**
+ * @brief GAM which counts its executions and stores the last non-zero StateSwitchTime.
+ */
+class GAMSchedulerTestGAMSwitchTime: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    GAMSchedulerTestGAMSwitchTime() {
+        numberOfExecutions = 0u;
+        stateSwitchTime = 0u;
+    }
+
+    virtual ~GAMSchedulerTestGAMSwitchTime() {
+
+    }
+
+    virtual bool Setup() {
+        return true;
+    }
+
+    virtual bool Execute() {
+        uint64 switchTime = *static_cast<uint64 *>(GetInputSignalMemory(0u));
+        if (switchTime > 0u) {
+            stateSwitchTime = switchTime;
+        }
+        numberOfExecutions++;
+        return true;
+    }
+
+    volatile uint32 numberOfExecutions;
+
+    volatile uint64 stateSwitchTime;
+};
+CLASS_REGISTER(GAMSchedulerTestGAMSwitchTime, "1.0")
+
 static StreamString configFull = ""
         "+StateMachine = {"
         "    Class = StateMachine"
@@ -1091,6 +1126,122 @@ static StreamString configSimple = ""
         "    }"
         "}";
 
+static StreamString configPrebuilt = ""
+        "$Fibonacci = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = GAM1"
+        "            InputSignals = {"
+        "                SignalIn1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    Alias = add1"
+        "                    Default = 1"
+        "                }"
+        "                SignalIn2 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    Alias = add3"
+        "                    Default = 3"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                SignalOut = {"
+        "                    DataSource = DDB1"
+        "                    Alias = add1"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = GAM1"
+        "            InputSignals = {"
+        "                SignalIn1 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    Alias = add3"
+        "                    Default = 3"
+        "                }"
+        "                SignalIn2 = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                    Alias = add1"
+        "                    Default = 1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                SignalOut = {"
+        "                    DataSource = DDB1"
+        "                    Alias = add3"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMS1 = {"
+        "            Class = GAMSchedulerTestGAMSwitchTime"
+        "            InputSignals = {"
+        "                StateSwitchTime = {"
+        "                    DataSource = Timings"
+        "                    Type = uint64"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMS2 = {"
+        "            Class = GAMSchedulerTestGAMSwitchTime"
+        "            InputSignals = {"
+        "                StateSwitchTime = {"
+        "                    DataSource = Timings"
+        "                    Type = uint64"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA, GAMS1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "        +State2 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMS2, GAMA, GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "        PrebuiltThreadPools = 1"
+        "    }"
+        "}";
+
 static StreamString configSimpleOneMessage = ""
         "$Fibonacci = {"
         "    Class = RealTimeApplication"
@@ -1655,3 +1806,176 @@ bool GAMSchedulerTest::TestStartNextStateExecution_False_PrepareNextState() {
 bool GAMSchedulerTest::TestStopCurrentStateExecution() {
     return TestStartNextStateExecution();
 }
+
+bool GAMSchedulerTest::TestInitialise_PrebuiltThreadPools() {
+    ConfigurationDatabase cdb;
+    cdb.Write("TimingDataSource", "Timings");
+    GAMScheduler test;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = !test.IsPrebuiltThreadPools();
+    }
+    if (ok) {
+        GAMScheduler testPrebuilt;
+        cdb.Write("PrebuiltThreadPools", 1u);
+        ok = testPrebuilt.Initialise(cdb);
+        if (ok) {
+            ok = testPrebuilt.IsPrebuiltThreadPools();
+        }
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestPrebuiltThreadPools() {
+    bool ok = Init(configPrebuilt);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    //The threads of both states (2 + 1) are created and parked
+    uint32 numberOfThreads = Threads::NumberOfThreads();
+    if (ok) {
+        ok = (numberOfThreads == (numOfThreadsBefore + 3u));
+    }
+    ReferenceT<GAMSchedulerTestGAMSwitchTime> gams1 = app->Find("Functions.GAMS1");
+    ReferenceT<GAMSchedulerTestGAMSwitchTime> gams2 = app->Find("Functions.GAMS2");
+    if (ok) {
+        ok = (gams1.IsValid() && gams2.IsValid());
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = (gams1->numberOfExecutions == 0u) && (gams2->numberOfExecutions == 0u);
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = (app->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = (gams1->numberOfExecutions > 0u) && (gams2->numberOfExecutions == 0u);
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State2");
+    }
+    if (ok) {
+        ok = (app->StopCurrentStateExecution() == ErrorManagement::NoError);
+    }
+    uint32 state1Executions = 0u;
+    if (ok) {
+        state1Executions = gams1->numberOfExecutions;
+        ok = (app->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = (gams1->numberOfExecutions == state1Executions) && (gams2->numberOfExecutions > 0u);
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() == numberOfThreads);
+    }
+    //Back to the first state without StopCurrentStateExecution
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = (app->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = (gams1->numberOfExecutions > state1Executions);
+    }
+    if (ok) {
+        ok = (app->StopCurrentStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() == numberOfThreads);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestPrebuiltThreadPools_StateSwitchTime() {
+    bool ok = Init(configPrebuilt);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    ReferenceT<GAMScheduler> sched = app->Find("Scheduler");
+    ReferenceT<GAMSchedulerTestGAMSwitchTime> gams2 = app->Find("Functions.GAMS2");
+    if (ok) {
+        ok = (sched.IsValid() && gams2.IsValid());
+    }
+    if (ok) {
+        ok = (sched->GetLastStateSwitchTime() == 0u);
+    }
+    if (ok) {
+        ok = app->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = (app->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = app->PrepareNextState("State2");
+    }
+    if (ok) {
+        ok = (app->StopCurrentStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        ok = (app->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        ok = (sched->GetLastStateSwitchTime() > 0u);
+    }
+    if (ok) {
+        //The signal is declared as uint64 => nano-seconds
+        HighResolutionTimerConverter converter;
+        ok = (gams2->stateSwitchTime == converter.TicksToNanoseconds(sched->GetLastStateSwitchTime()));
+    }
+    if (ok) {
+        ok = (app->StopCurrentStateExecution() == ErrorManagement::NoError);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    while (Threads::NumberOfThreads() > numOfThreadsBefore) {
+        Sleep::MSec(10);
+    }
+    return ok;
+}
+
+bool GAMSchedulerTest::TestPrebuiltThreadPools_Purge() {
+    bool ok = Init(configPrebuilt);
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ObjectRegistryDatabase::Instance()->Find("Fibonacci");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() > numOfThreadsBefore);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    uint32 timeout = 100u;
+    while ((Threads::NumberOfThreads() > numOfThreadsBefore) && (timeout > 0u)) {
+        Sleep::MSec(10);
+        timeout--;
+    }
+    if (ok) {
+        ok = (Threads::NumberOfThreads() == numOfThreadsBefore);
+    }
+    return ok;
+}
@@ -119,6 +119,27 @@ public:
      * @brief Tests that the purge kills all threads
      */
     bool TestPurge();
+
+    /**
+     * @brief Tests the Initialise method with PrebuiltThreadPools = 1.
+     */
+    bool TestInitialise_PrebuiltThreadPools();
+
+    /**
+     * @brief Tests that with PrebuiltThreadPools = 1 the threads of all the states are created by ConfigureApplication, that only the
+     * threads of the current state execute and that no threads are created in a state transition.
+     */
+    bool TestPrebuiltThreadPools();
+
+    /**
+     * @brief Tests that with PrebuiltThreadPools = 1 the duration of the state switch is written in the StateSwitchTime signal.
+     */
+    bool TestPrebuiltThreadPools_StateSwitchTime();
+
+    /**
+     * @brief Tests that with PrebuiltThreadPools = 1 the purge kills all the parked threads.
+     */
+    bool TestPrebuiltThreadPools_Purge();
 };
 
 /*---------------------------------------------------------------------------*/
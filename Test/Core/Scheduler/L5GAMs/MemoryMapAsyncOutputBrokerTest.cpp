@@ -128,6 +128,8 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         expectedSignal = NULL;
         counter = 0;
         memoryOK = true;
+        batchSynchronise = 0u;
+        numberOfBatches = 0u;
     }
 
     virtual ~MemoryMapAsyncOutputBrokerDataSourceTestHelper() {
@@ -148,6 +150,7 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         data.Read("NumberOfBuffers", numberOfBuffers);
         data.Read("CPUMask", cpuMask);
         data.Read("StackSize", stackSize);
+        data.Read("BatchSynchronise", batchSynchronise);
         AnyType signalAT = data.GetType("ExpectedSignal");
         numberOfExecutes = signalAT.GetNumberOfElements(0);
         expectedSignal = new uint32[numberOfExecutes];
@@ -226,6 +229,7 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         broker = ReferenceT<MARTe::MemoryMapAsyncOutputBroker>("MemoryMapAsyncOutputBroker");
         bool ret = broker.IsValid();
         if (ret) {
+            broker->SetBatchSynchronise(batchSynchronise == 1u);
             ret = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, cpuMask, stackSize);
         }
         if (ret) {
@@ -253,6 +257,31 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
         return memoryOK;
     }
 
+    //Check that each page and the last sample in memory are as expected
+    virtual bool SynchroniseBatch(const void * const * const pages, const MARTe::uint32 numberOfPages, const MARTe::uint32 pageSize) {
+        using namespace MARTe;
+        memoryOK &= (pageSize == (totalNumberOfSignalElements * sizeof(uint32)));
+        uint32 p;
+        //The pages written after the last expected sample (i.e. to force the flushing) are not counted.
+        for (p = 0u; (p < numberOfPages) && (memoryOK) && (counter < numberOfExecutes); p++) {
+            const uint32 *page32 = reinterpret_cast<const uint32 *>(pages[p]);
+            uint32 n;
+            for (n = 0u; (n < totalNumberOfSignalElements) && (memoryOK); n++) {
+                memoryOK = (page32[n] == expectedSignal[counter]);
+            }
+            counter++;
+        }
+        if (memoryOK) {
+            uint32 *signalMemory32 = reinterpret_cast<uint32 *>(signalMemory);
+            uint32 n;
+            for (n = 0u; n < totalNumberOfSignalElements; n++) {
+                memoryOK &= (signalMemory32[n] == expectedSignal[counter - 1u]);
+            }
+        }
+        numberOfBatches++;
+        return memoryOK;
+    }
+
     bool Flush() {
         return broker->Flush();
     }
@@ -275,6 +304,8 @@ MemoryMapAsyncOutputBrokerDataSourceTestHelper    () {
     MARTe::ReferenceT<MARTe::MemoryMapAsyncOutputBroker> broker;
     bool memoryOK;
     void *signalMemory;
+    MARTe::uint32 batchSynchronise;
+    MARTe::uint32 numberOfBatches;
 };
 CLASS_REGISTER(MemoryMapAsyncOutputBrokerDataSourceTestHelper, "1.0")
 
@@ -363,7 +394,7 @@ static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool
  *  and then it verifies that the broker correctly propagates this signal to the DataSource.
  */
 static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32 *signalToGenerate, MARTe::uint32 toGenerateNumberOfElements,
-                                MARTe::uint32 numberOfBuffers, MARTe::uint32 sleepMSec = 10) {
+                                MARTe::uint32 numberOfBuffers, MARTe::uint32 sleepMSec = 10, bool batchSynchronise = false) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -382,6 +413,9 @@ static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32
     cdb.Write("ExpectedSignal", signalV);
     cdb.Delete("NumberOfBuffers");
     cdb.Write("NumberOfBuffers", numberOfBuffers);
+    if (batchSynchronise) {
+        cdb.Write("BatchSynchronise", 1u);
+    }
     cdb.MoveToRoot();
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
 
@@ -447,6 +481,9 @@ static bool TestExecute_Buffers(const MARTe::char8 * const config, MARTe::uint32
     if (ok) {
         ok = dataSource->memoryOK;
     }
+    if (ok) {
+        ok = (batchSynchronise == (dataSource->numberOfBatches > 0u));
+    }
     if (ok) {
         ok = dataSource->Flush();
     }
@@ -874,6 +911,21 @@ bool MemoryMapAsyncOutputBrokerTest::TestExecute_1_Buffer() {
     return TestExecute_Buffers(config1, signalToGenerate, sizeof(signalToGenerate) / sizeof(uint32), 1, 100);
 }
 
+bool MemoryMapAsyncOutputBrokerTest::TestExecute_N_Buffers_BatchSynchronise() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3,
+            4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+
+    return TestExecute_Buffers(config1, signalToGenerate, sizeof(signalToGenerate) / sizeof(uint32), 10, 1, true);
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestExecute_1_Buffer_BatchSynchronise() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3 };
+
+    return TestExecute_Buffers(config1, signalToGenerate, sizeof(signalToGenerate) / sizeof(uint32), 1, 100, true);
+}
+
 bool MemoryMapAsyncOutputBrokerTest::TestGetCPUMask() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -1132,3 +1184,23 @@ bool MemoryMapAsyncOutputBrokerTest::TestIsIgnoringBufferOverrun() {
 bool MemoryMapAsyncOutputBrokerTest::TestSetIgnoreBufferOverrun() {
     return TestIsIgnoringBufferOverrun();
 }
+
+bool MemoryMapAsyncOutputBrokerTest::TestIsBatchSynchronising() {
+    using namespace MARTe;
+    MemoryMapAsyncOutputBroker broker;
+
+    bool ok = !broker.IsBatchSynchronising();
+    if (ok) {
+        broker.SetBatchSynchronise(true);
+        ok = broker.IsBatchSynchronising();
+    }
+    if (ok) {
+        broker.SetBatchSynchronise(false);
+        ok = !broker.IsBatchSynchronising();
+    }
+    return ok;
+}
+
+bool MemoryMapAsyncOutputBrokerTest::TestSetBatchSynchronise() {
+    return TestIsBatchSynchronising();
+}
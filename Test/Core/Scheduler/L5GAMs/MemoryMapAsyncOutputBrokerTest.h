@@ -80,6 +80,16 @@ public:
      */
     bool TestExecute_1_Buffer();
 
+    /**
+     * @brief Tests the Execute method with N buffers flushed with DataSourceI::SynchroniseBatch.
+     */
+    bool TestExecute_N_Buffers_BatchSynchronise();
+
+    /**
+     * @brief Tests the Execute method with 1 buffer flushed with DataSourceI::SynchroniseBatch.
+     */
+    bool TestExecute_1_Buffer_BatchSynchronise();
+
     /**
      * @brief Tests that a buffer overrun is detected.
      */
@@ -110,6 +120,16 @@ public:
      */
     bool TestSetIgnoreBufferOverrun();
 
+    /**
+     * @brief Tests the IsBatchSynchronising method.
+     */
+    bool TestIsBatchSynchronising();
+
+    /**
+     * @brief Tests the SetBatchSynchronise method.
+     */
+    bool TestSetBatchSynchronise();
+
     /**
      * @brief Tests the TestSetIgnoreBufferOverrun method.
      */
@@ -117,6 +117,10 @@ public:
             }
 
         }
+        else {
+            //Do not trigger on the extra cycles that are used to force the flushing of the BufferLoop
+            *triggerOut = 0u;
+        }
         counter++;
         return true;
     }
@@ -407,7 +411,7 @@ static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool
  */
 static bool TestExecute_PreTriggerBuffers_PostTriggerBuffers(const MARTe::char8 * const config, MARTe::uint8* triggerToGenerate, MARTe::uint32 *signalToGenerate, MARTe::uint32 toGenerateNumberOfElements, MARTe::uint8* expectedTrigger,
                                                              MARTe::uint32* expectedSignal, MARTe::uint32 expectedNumberOfElements, MARTe::uint32 preTriggerBuffers, MARTe::uint32 postTriggerBuffers, MARTe::uint32 numberOfBuffers,
-                                                             MARTe::uint32 sleepMSec = 10) {
+                                                             MARTe::uint32 sleepMSec = 10, bool checkCounters = false) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -502,6 +506,36 @@ static bool TestExecute_PreTriggerBuffers_PostTriggerBuffers(const MARTe::char8
     if (ok) {
         ok = dataSource->memoryOK;
     }
+    if (ok && checkCounters) {
+        MemoryMapAsyncTriggerOutputBroker *broker = dataSource->broker;
+        //The extra cycle above also writes a page
+        ok = (broker->GetPagesWritten() == (gam->numberOfExecutes + 1u));
+        if (ok) {
+            ok = (broker->GetPagesFlushed() == dataSource->numberOfExecutes);
+        }
+        if (ok) {
+            ok = (broker->GetPagesDropped() == 0u);
+        }
+        if (ok) {
+            ok = (broker->GetMaxBacklog() > 0u);
+        }
+        if (ok) {
+            ok = (broker->GetMaxBacklog() <= numberOfBuffers);
+        }
+        //The BufferLoop is sleeping between cycles, so it must have been woken at least once, but never more than once per page
+        if (ok) {
+            ok = (broker->GetConsumerWakeUps() > 0u);
+        }
+        if (ok) {
+            ok = (broker->GetConsumerWakeUps() <= broker->GetPagesWritten());
+        }
+        if (ok) {
+            ok = (broker->GetMaxConsumerLatency() > 0u);
+        }
+        if (ok) {
+            ok = (broker->GetMaxConsumerLatency() >= broker->GetLastConsumerLatency());
+        }
+    }
 
     godb->Purge();
     return ok;
@@ -1400,6 +1434,16 @@ bool MemoryMapAsyncTriggerOutputBrokerTest::TestExecute_1_PreTriggerBuffers_0_Po
     return TestExecute_PreTriggerBuffers_PostTriggerBuffers(config0, triggerToGenerate, signalToGenerate, sizeof(triggerToGenerate) / sizeof(uint8), expectedTrigger, expectedSignal, sizeof(expectedTrigger) / sizeof(uint8), 1, 0, 10);
 }
 
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestExecute_Counters() {
+    using namespace MARTe;
+    uint8 triggerToGenerate[] = { 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0 };
+    uint32 signalToGenerate[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 8, 7, 6, 5 };
+    uint8 expectedTrigger[] = { 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0 };
+    uint32 expectedSignal[] = { 1, 2, 3, 4, 5, 6, 8, 9, 8, 7, 6, 5 };
+
+    return TestExecute_PreTriggerBuffers_PostTriggerBuffers(config1, triggerToGenerate, signalToGenerate, sizeof(triggerToGenerate) / sizeof(uint8), expectedTrigger, expectedSignal, sizeof(expectedTrigger) / sizeof(uint8), 1, 1, 10, 10, true);
+}
+
 bool MemoryMapAsyncTriggerOutputBrokerTest::TestExecute_1_PreTriggerBuffers_1_PostTriggerBuffers() {
     using namespace MARTe;
     uint8 triggerToGenerate[] = { 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0 };
@@ -1855,6 +1899,114 @@ bool MemoryMapAsyncTriggerOutputBrokerTest::TestExecute_Buffer_Overrun() {
     return ok;
 }
 
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestGetPagesDropped() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = config9;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<MemoryMapAsyncTriggerOutputBrokerDataSourceTestHelper> dataSource;
+    if (ok) {
+        dataSource = application->Find("Data.Drv1");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+
+    ReferenceContainer brokers;
+    char8 *fakeMem = new char8[1024];
+    uint32 n;
+    for (n = 0u; n < 1024; n++) {
+        fakeMem[n] = 1;
+    }
+    ReferenceT<MemoryMapAsyncTriggerOutputBroker> broker;
+    if (ok) {
+        ok = dataSource->GetOutputBrokers(brokers, "GAM1", fakeMem);
+    }
+    if (ok) {
+        broker = brokers.Get(0);
+        ok = broker.IsValid();
+    }
+    if (ok) {
+        ok = (broker->GetPagesDropped() == 0u);
+    }
+    if (ok) {
+        uint32 nOfTries = 20u;
+        bool overrun = false;
+        while ((!overrun) && (nOfTries > 0u)) {
+            overrun = !broker->Execute();
+            nOfTries--;
+        }
+        ok = overrun;
+    }
+    if (ok) {
+        ok = (broker->GetPagesDropped() > 0u);
+    }
+    if (ok) {
+        ok = (broker->GetPagesWritten() > 0u);
+    }
+    delete[] fakeMem;
+
+    god->Purge();
+    return ok;
+}
+
+bool MemoryMapAsyncTriggerOutputBrokerTest::TestExportData() {
+    using namespace MARTe;
+    MemoryMapAsyncTriggerOutputBroker broker;
+    broker.SetName("Broker");
+    ConfigurationDatabase cdb;
+    bool ok = broker.ExportData(cdb);
+    const char8 * const counterNames[] = { "PagesWritten", "PagesFlushed", "PagesDropped", "MaxBacklog", "ConsumerWakeUps" };
+    uint32 n;
+    for (n = 0u; (n < 5u) && (ok); n++) {
+        uint32 value = 1u;
+        ok = cdb.Read(counterNames[n], value);
+        if (ok) {
+            ok = (value == 0u);
+        }
+    }
+    float64 latency = 1.0;
+    if (ok) {
+        ok = cdb.Read("LastConsumerLatency", latency);
+    }
+    if (ok) {
+        ok = (latency == 0.0);
+    }
+    if (ok) {
+        latency = 1.0;
+        ok = cdb.Read("MaxConsumerLatency", latency);
+    }
+    if (ok) {
+        ok = (latency == 0.0);
+    }
+    StreamString className;
+    if (ok) {
+        ok = cdb.Read("Class", className);
+    }
+    if (ok) {
+        ok = (className == "MemoryMapAsyncTriggerOutputBroker");
+    }
+    return ok;
+}
+
 bool MemoryMapAsyncTriggerOutputBrokerTest::TestGetStackSize() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
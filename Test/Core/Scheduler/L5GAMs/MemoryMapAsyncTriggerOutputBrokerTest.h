@@ -200,6 +200,22 @@ public:
      */
     bool TestFlushAllTriggers();
 
+    /**
+     * @brief Tests that the GetPagesWritten, GetPagesFlushed, GetMaxBacklog, GetConsumerWakeUps, GetLastConsumerLatency and GetMaxConsumerLatency
+     * counters are updated by the Execute and BufferLoop methods.
+     */
+    bool TestExecute_Counters();
+
+    /**
+     * @brief Tests the GetPagesDropped method after a buffer overrun.
+     */
+    bool TestGetPagesDropped();
+
+    /**
+     * @brief Tests the ExportData method.
+     */
+    bool TestExportData();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,105 @@
+/**
+ * @file ArenaHeapGTest.cpp
+ * @brief Source file for class ArenaHeapGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ArenaHeapGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "ArenaHeapTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestConstructor) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestConstructor_SmallChunkSize) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestConstructor_SmallChunkSize());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestMalloc) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestMalloc());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestMalloc_Zero) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Zero());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestMalloc_LargeBlock) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_LargeBlock());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestFree) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestRealloc_InPlace) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_InPlace());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestRealloc_Copy) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_Copy());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestRealloc_NULL) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_NULL());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestRealloc_NotOwned) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_NotOwned());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestDuplicate) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestOwns) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestOwns());
+}
+
+TEST(BareMetal_L1Portability_ArenaHeapGTest,TestRelease) {
+    ArenaHeapTest test;
+    ASSERT_TRUE(test.TestRelease());
+}
@@ -160,3 +160,27 @@ TEST(BareMetal_L1Portability_AtomicGTest,SubTest) {
     ASSERT_TRUE(subTest.TestSub());
 }
 
+
+TEST(BareMetal_L1Portability_AtomicGTest,LoadAcquireStoreReleaseTest_UInt32) {
+    uint32 testValue = 0xA5A5A5A5u;
+    AtomicTest<uint32> loadStoreTest(testValue);
+    ASSERT_TRUE(loadStoreTest.TestLoadAcquireStoreRelease());
+}
+
+TEST(BareMetal_L1Portability_AtomicGTest,LoadAcquireStoreReleaseTest_UInt8) {
+    uint8 testValue = 0xA5u;
+    AtomicTest<uint8> loadStoreTest(testValue);
+    ASSERT_TRUE(loadStoreTest.TestLoadAcquireStoreRelease());
+}
+
+TEST(BareMetal_L1Portability_AtomicGTest,CompareAndSwapTest_UInt32) {
+    uint32 testValue = 0xA5A5A5A5u;
+    AtomicTest<uint32> casTest(testValue);
+    ASSERT_TRUE(casTest.TestCompareAndSwap());
+}
+
+TEST(BareMetal_L1Portability_AtomicGTest,MemoryFenceTest_UInt32) {
+    uint32 testValue = 0xA5A5A5A5u;
+    AtomicTest<uint32> fenceTest(testValue);
+    ASSERT_TRUE(fenceTest.TestMemoryFence());
+}
@@ -0,0 +1,135 @@
+/**
+ * @file CacheAlignedHeapGTest.cpp
+ * @brief Source file for class CacheAlignedHeapGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CacheAlignedHeapGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "CacheAlignedHeapTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestConstructor) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestConstructor_InvalidCacheLineSize) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestConstructor_InvalidCacheLineSize());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestMalloc_Alignment) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Alignment());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestMalloc_Padding) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Padding());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestMalloc_ZeroSize) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_ZeroSize());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestMalloc_Node) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestMalloc_Node());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestFree) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestFree());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestRealloc) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestRealloc());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestRealloc_InPlace) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_InPlace());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestRealloc_Null) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_Null());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestRealloc_ZeroSize) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestRealloc_ZeroSize());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestDuplicate) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestDuplicate_String) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestDuplicate_String());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestFirstLastAddress) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestFirstLastAddress());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestOwns) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestOwns());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestOwns_OtherHeap) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestOwns_OtherHeap());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestName) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestName());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestGetNumberOfAllocations) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestGetNumberOfAllocations());
+}
+
+TEST(BareMetal_L1Portability_CacheAlignedHeapGTest,TestRelease) {
+    CacheAlignedHeapTest test;
+    ASSERT_TRUE(test.TestRelease());
+}
@@ -155,3 +155,43 @@ TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestRecursive) {
     FastPollingMutexSemTest mutextest;
     ASSERT_TRUE(mutextest.TestRecursive());
 }
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestSetAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestSetAdaptive());
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockAdaptiveWithInfiniteTimeout) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockAdaptive(32, TTInfiniteWait));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockAdaptiveWithFiniteTimeout) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockAdaptive(32, 10000000));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockAdaptiveWithFiniteTimeout_External) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockAdaptiveExternal(32, 10000000));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockAdaptiveWithSmallFiniteTimeoutToFail) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_FALSE(mutextest.TestFastLockAdaptive(32, 1));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastTryLockAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastTryLockAdaptive(32));
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastLockErrorCodeAdaptive) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastLockErrorCodeAdaptive());
+}
+
+TEST(BareMetal_L1Portability_FastPollingMutexSemGTest,TestFastUnLockAdaptiveWakesWaiter) {
+    FastPollingMutexSemTest mutextest;
+    ASSERT_TRUE(mutextest.TestFastUnLockAdaptiveWakesWaiter());
+}
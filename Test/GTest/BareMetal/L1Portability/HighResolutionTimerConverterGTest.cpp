@@ -0,0 +1,100 @@
+/**
+ * @file HighResolutionTimerConverterGTest.cpp
+ * @brief Source file for class HighResolutionTimerConverterGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HighResolutionTimerConverterGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HighResolutionTimerConverterTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestDefaultConstructor) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestDefaultConstructor());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestConstructor_Frequency) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestConstructor_Frequency());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestInstance) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestInstance());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestTicksToNanoseconds) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestTicksToNanoseconds());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestTicksToMicroseconds) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestTicksToMicroseconds());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestMicrosecondsToTicks) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestMicrosecondsToTicks());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestExactMultiples) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestExactMultiples());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestLargeValues) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestLargeValues());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestSaturation) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestSaturation());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestZeroFrequency) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestZeroFrequency());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestHighResolutionTimerTicksToNanoseconds) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestHighResolutionTimerTicksToNanoseconds());
+}
+
+TEST(BareMetal_L1Portability_HighResolutionTimerConverterGTest,TestHighResolutionTimerTicksToMicroseconds) {
+    HighResolutionTimerConverterTest test;
+    ASSERT_TRUE(test.TestHighResolutionTimerTicksToMicroseconds());
+}
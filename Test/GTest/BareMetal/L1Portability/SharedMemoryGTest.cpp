@@ -0,0 +1,75 @@
+/**
+ * @file SharedMemoryGTest.cpp
+ * @brief Source file for class SharedMemoryGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "SharedMemoryTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestCreate) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestCreate());
+}
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestOpen) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen());
+}
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestOpen_ReadOnly) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen_ReadOnly());
+}
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestOpen_False_NotExisting) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestOpen_False_NotExisting());
+}
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestClose) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestClose());
+}
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestRemove) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestRemove());
+}
+
+TEST(BareMetal_L1Portability_SharedMemoryGTest,TestRemove_False) {
+    SharedMemoryTest test;
+    ASSERT_TRUE(test.TestRemove_False());
+}
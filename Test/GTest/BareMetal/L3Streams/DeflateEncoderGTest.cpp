@@ -0,0 +1,86 @@
+/**
+ * @file DeflateEncoderGTest.cpp
+ * @brief Source file for class DeflateEncoderGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class DeflateEncoderGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "MARTe2UTest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+
+#include "DeflateEncoderTest.h"
+
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestConstructor) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestWrite) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestWrite());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestWrite_Large) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestWrite_Large());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestWrite_False_Finished) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestWrite_False_Finished());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestFinish) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestFinish());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestFinish_False_Finished) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestFinish_False_Finished());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestGetInputSize) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestGetInputSize());
+}
+
+TEST(BareMetal_L3Streams_DeflateEncoderGTest,TestGetOutputSize) {
+    DeflateEncoderTest test;
+    ASSERT_TRUE(test.TestGetOutputSize());
+}
@@ -0,0 +1,105 @@
+/**
+ * @file BinaryConfigurationGTest.cpp
+ * @brief Source file for class BinaryConfigurationGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class BinaryConfigurationGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "BinaryConfigurationTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_Scalars) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_Scalars());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_Vectors) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_Vectors());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_Matrices) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_Matrices());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_Configuration) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_Configuration());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_Empty) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_Empty());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_CurrentNode) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_CurrentNode());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestExportImport_ArenaConfigurationDatabase) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestExportImport_ArenaConfigurationDatabase());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestImport_False_Text) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestImport_False_Text());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestImport_False_Truncated) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestImport_False_Truncated());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestImport_False_CRC) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestImport_False_CRC());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestImport_False_Version) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestImport_False_Version());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestImport_False_ExistingNode) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestImport_False_ExistingNode());
+}
+
+TEST(BareMetal_L4Configuration_BinaryConfigurationGTest,TestImport_Large) {
+    BinaryConfigurationTest test;
+    ASSERT_TRUE(test.TestImport_Large());
+}
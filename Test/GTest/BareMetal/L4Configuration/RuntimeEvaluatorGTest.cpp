@@ -349,6 +349,149 @@ TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_FastMode_Faile
     ASSERT_TRUE(evaluatorTest.TestExecute(rpnCode, ErrorManagement::InternalSetupError));
 }
 
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_FailedStackNotEmpty) {
+    
+    RuntimeEvaluatorTest evaluatorTest;
+    CCString rpnCode = "READ A\n"
+                       "READ B\n"
+                       "WRITE ret1\n"
+    ;
+    
+    float32 A = 10;
+    float32 B = 10;
+    float32 ret1;
+    
+    evaluatorTest.SetTestInputVariable("A", Float32Bit, &A, 0);
+    evaluatorTest.SetTestInputVariable("B", Float32Bit, &B, 0);
+    
+    evaluatorTest.SetTestOutputVariable("ret1", Float32Bit, &ret1, 20);
+    
+    ASSERT_TRUE(evaluatorTest.TestExecute(rpnCode, ErrorManagement::InternalSetupError, RuntimeEvaluator::threadedMode));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_AllExternalVariables) {
+    
+    RuntimeEvaluatorTest evaluatorTest;
+    CCString rpnCode = "READ v1\n"
+                       "READ t2\n"
+                       "READ t1\n"
+                       "SUB\n"
+                       "DIV\n"
+                       "WRITE a\n"
+                       "READ v1\n"
+                       "CONST float32 2\n"
+                       "POW\n"
+                       "CONST float32 2\n"
+                       "READ a\n"
+                       "CONST float32 2\n"
+                       "POW\n"
+                       "MUL\n"
+                       "DIV\n"
+                       "WRITE x2\n"
+                       "READ m\n"
+                       "READ a\n"
+                       "MUL\n"
+                       "WRITE F\n"
+    ;
+    
+    float32 v1 = 22.5;
+    float32 m  = 9;
+    float32 t1 = 3.5;
+    float32 t2 = 8;
+    float32 F;
+    
+    evaluatorTest.SetTestInputVariable("v1", Float32Bit, &v1, 0);
+    evaluatorTest.SetTestInputVariable("m",  Float32Bit, &m,  0);
+    evaluatorTest.SetTestInputVariable("t1", Float32Bit, &t1, 0);
+    evaluatorTest.SetTestInputVariable("t2", Float32Bit, &t2, 0);
+    
+    evaluatorTest.SetTestOutputVariable("F", Float32Bit, &F, 45);
+    
+    ASSERT_TRUE(evaluatorTest.TestExecute(rpnCode, ErrorManagement::NoError, RuntimeEvaluator::threadedMode));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_AllInternalVariables) {
+    
+    RuntimeEvaluatorTest evaluatorTest;
+    CCString rpnCode = "READ v1\n"
+                       "READ t2\n"
+                       "READ t1\n"
+                       "SUB\n"
+                       "DIV\n"
+                       "WRITE a\n"
+                       "READ m\n"
+                       "READ a\n"
+                       "MUL\n"
+                       "WRITE F\n"
+    ;
+    
+    float32 F;
+    
+    evaluatorTest.SetTestInputVariable("v1", Float32Bit, NULL, 22.5);
+    evaluatorTest.SetTestInputVariable("m",  Float32Bit, NULL, 9);
+    evaluatorTest.SetTestInputVariable("t1", Float32Bit, NULL, 3.5);
+    evaluatorTest.SetTestInputVariable("t2", Float32Bit, NULL, 8);
+    
+    evaluatorTest.SetTestOutputVariable("F", Float32Bit, &F, 45);
+    
+    ASSERT_TRUE(evaluatorTest.TestExecute(rpnCode, ErrorManagement::NoError, RuntimeEvaluator::threadedMode));
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_ConstantFolding) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecute_ThreadedMode_ConstantFolding());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_ConstantCastOutOfRange) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecute_ThreadedMode_ConstantCastOutOfRange());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_ConversionWrite) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecute_ThreadedMode_ConversionWrite());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_NotCompiled) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecute_ThreadedMode_NotCompiled());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_ThreadedMode_Benchmark) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecute_ThreadedMode_Benchmark());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_Arrays) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_Arrays());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_Broadcast) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_Broadcast());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_GenericFunctions) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_GenericFunctions());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_Int32Overflow) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_Int32Overflow());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_NotCompiled) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_NotCompiled());
+}
+
+TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecuteBatch_Benchmark) {
+    RuntimeEvaluatorTest evaluatorTest;
+    ASSERT_TRUE(evaluatorTest.TestExecuteBatch_Benchmark());
+}
+
 TEST(BareMetal_L4Configuration_RuntimeEvaluatorGTest, TestExecute_SafeMode_FailedStackNotEmpty) {
     
     RuntimeEvaluatorTest evaluatorTest;
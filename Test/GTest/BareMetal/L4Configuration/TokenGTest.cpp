@@ -129,6 +129,21 @@ TEST(BareMetal_L4Configuration_TokenGTest,TestGetLineNumber_0) {
     ASSERT_TRUE(tokenTest.TestGetLineNumber(0));
 }
 
+TEST(BareMetal_L4Configuration_TokenGTest,TestSet) {
+    TokenTest tokenTest;
+    ASSERT_TRUE(tokenTest.TestSet("Hello"));
+}
+
+TEST(BareMetal_L4Configuration_TokenGTest,TestSet_LongerData) {
+    TokenTest tokenTest;
+    ASSERT_TRUE(tokenTest.TestSet("A token data which is longer than the initial one"));
+}
+
+TEST(BareMetal_L4Configuration_TokenGTest,TestSet_NULL) {
+    TokenTest tokenTest;
+    ASSERT_TRUE(tokenTest.TestSet(NULL));
+}
+
 TEST(BareMetal_L4Configuration_TokenGTest,TestAssignOperator) {
     TokenTest tokenTest;
     ASSERT_TRUE(tokenTest.TestAssignOperator(1, "Hello", "World", 1));
@@ -5448,3 +5448,23 @@ TEST(BareMetal_L4Configuration_TypeConversionGTest,TestTypeConvertPointerMatrix_
 
     ASSERT_TRUE(myTypeConversionTest.TestTypeConvertPointerMatrix(table));
 }
+
+TEST(BareMetal_L4Configuration_TypeConversionGTest,TestGetBasicTypeArrayConverter) {
+    TypeConversionTest myTypeConversionTest;
+    ASSERT_TRUE(myTypeConversionTest.TestGetBasicTypeArrayConverter());
+}
+
+TEST(BareMetal_L4Configuration_TypeConversionGTest,TestGetBasicTypeArrayConverter_Constant) {
+    TypeConversionTest myTypeConversionTest;
+    ASSERT_TRUE(myTypeConversionTest.TestGetBasicTypeArrayConverter_Constant());
+}
+
+TEST(BareMetal_L4Configuration_TypeConversionGTest,TestGetBasicTypeArrayConverter_Unsupported) {
+    TypeConversionTest myTypeConversionTest;
+    ASSERT_TRUE(myTypeConversionTest.TestGetBasicTypeArrayConverter_Unsupported());
+}
+
+TEST(BareMetal_L4Configuration_TypeConversionGTest,TestGetBasicTypeArrayConverter_Benchmark) {
+    TypeConversionTest myTypeConversionTest;
+    ASSERT_TRUE(myTypeConversionTest.TestGetBasicTypeArrayConverter_Benchmark());
+}
@@ -80,3 +80,13 @@ TEST(BareMetal_L4Logger_LoggerGTest,TestLoggerErrorProcessFunction) {
     LoggerTest target;
     ASSERT_TRUE(target.TestLoggerErrorProcessFunction());
 }
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetNumberOfDroppedLogs) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetNumberOfDroppedLogs());
+}
+
+TEST(BareMetal_L4Logger_LoggerGTest,TestGetPage_MultipleProducers) {
+    LoggerTest target;
+    ASSERT_TRUE(target.TestGetPage_MultipleProducers());
+}
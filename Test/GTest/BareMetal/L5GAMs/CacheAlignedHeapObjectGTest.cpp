@@ -0,0 +1,70 @@
+/**
+ * @file CacheAlignedHeapObjectGTest.cpp
+ * @brief Source file for class CacheAlignedHeapObjectGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CacheAlignedHeapObjectGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "CacheAlignedHeapObjectTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L5GAMs_CacheAlignedHeapObjectGTest,TestConstructor) {
+    CacheAlignedHeapObjectTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_CacheAlignedHeapObjectGTest,TestInitialise) {
+    CacheAlignedHeapObjectTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L5GAMs_CacheAlignedHeapObjectGTest,TestInitialise_CPUs) {
+    CacheAlignedHeapObjectTest test;
+    ASSERT_TRUE(test.TestInitialise_CPUs());
+}
+
+TEST(BareMetal_L5GAMs_CacheAlignedHeapObjectGTest,TestInitialise_InvalidCacheLineSize) {
+    CacheAlignedHeapObjectTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidCacheLineSize());
+}
+
+TEST(BareMetal_L5GAMs_CacheAlignedHeapObjectGTest,TestInitialise_Twice) {
+    CacheAlignedHeapObjectTest test;
+    ASSERT_TRUE(test.TestInitialise_Twice());
+}
+
+TEST(BareMetal_L5GAMs_CacheAlignedHeapObjectGTest,TestHeapName) {
+    CacheAlignedHeapObjectTest test;
+    ASSERT_TRUE(test.TestHeapName());
+}
@@ -283,3 +283,8 @@ TEST(BareMetal_L5GAMs_DataSourceIGTest,TestBrokerCopyTerminated) {
     ASSERT_TRUE(test.TestBrokerCopyTerminated());
 }
 
+TEST(BareMetal_L5GAMs_DataSourceIGTest,TestSynchroniseBatch) {
+    DataSourceITest test;
+    ASSERT_TRUE(test.TestSynchroniseBatch());
+}
+
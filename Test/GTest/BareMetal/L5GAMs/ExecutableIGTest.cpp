@@ -63,3 +63,13 @@ TEST(BareMetal_L5GAMs_ExecutableIGTest,TestSetTimingSignalAddress) {
     ASSERT_TRUE(test.TestSetTimingSignalAddress());
 }
 
+TEST(BareMetal_L5GAMs_ExecutableIGTest,TestSetTimingSignalNanoseconds) {
+    ExecutableITest test;
+    ASSERT_TRUE(test.TestSetTimingSignalNanoseconds());
+}
+
+TEST(BareMetal_L5GAMs_ExecutableIGTest,TestIsTimingSignalNanoseconds) {
+    ExecutableITest test;
+    ASSERT_TRUE(test.TestIsTimingSignalNanoseconds());
+}
+
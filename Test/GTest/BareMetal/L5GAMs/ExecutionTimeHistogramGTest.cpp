@@ -0,0 +1,70 @@
+/**
+ * @file ExecutionTimeHistogramGTest.cpp
+ * @brief Source file for class ExecutionTimeHistogramGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ExecutionTimeHistogramGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ExecutionTimeHistogramTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L5GAMs_ExecutionTimeHistogramGTest,TestConstructor) {
+    ExecutionTimeHistogramTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionTimeHistogramGTest,TestUpdate) {
+    ExecutionTimeHistogramTest test;
+    ASSERT_TRUE(test.TestUpdate());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionTimeHistogramGTest,TestReset) {
+    ExecutionTimeHistogramTest test;
+    ASSERT_TRUE(test.TestReset());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionTimeHistogramGTest,TestGetPercentile) {
+    ExecutionTimeHistogramTest test;
+    ASSERT_TRUE(test.TestGetPercentile());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionTimeHistogramGTest,TestGetBucketIndex) {
+    ExecutionTimeHistogramTest test;
+    ASSERT_TRUE(test.TestGetBucketIndex());
+}
+
+TEST(BareMetal_L5GAMs_ExecutionTimeHistogramGTest,TestGetBucketCounter) {
+    ExecutionTimeHistogramTest test;
+    ASSERT_TRUE(test.TestGetBucketCounter());
+}
@@ -153,3 +153,33 @@ TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestSetConfiguredDatabase_MoreThanOnePr
     GAMDataSourceTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_MoreThanOneProducer_Different_States());
 }
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestGetBrokerName_Seqlock) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName_Seqlock());
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestGetInputBrokers_Seqlock) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputBrokers_Seqlock());
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestGetOutputBrokers_Seqlock) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestGetOutputBrokers_Seqlock());
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestGetSeqlockSignal) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestGetSeqlockSignal());
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestGetSeqlockSignal_False) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestGetSeqlockSignal_False());
+}
+
+TEST(BareMetal_L5GAMs_GAMDataSourceGTest,TestPrepareNextState_Seqlock) {
+    GAMDataSourceTest test;
+    ASSERT_TRUE(test.TestPrepareNextState_Seqlock());
+}
@@ -75,3 +75,13 @@ TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_False) {
     GAMSchedulerITest test;
     ASSERT_TRUE(test.TestExecuteSingleCycle_False());
 }
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_ExecutionTimeHistograms) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExecuteSingleCycle_ExecutionTimeHistograms());
+}
+
+TEST(BareMetal_L5GAMs_GAMSchedulerIGTest,TestExecuteSingleCycle_NanosecondsTimingSignals) {
+    GAMSchedulerITest test;
+    ASSERT_TRUE(test.TestExecuteSingleCycle_NanosecondsTimingSignals());
+}
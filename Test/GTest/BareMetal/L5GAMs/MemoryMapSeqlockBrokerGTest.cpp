@@ -0,0 +1,85 @@
+/**
+ * @file MemoryMapSeqlockBrokerGTest.cpp
+ * @brief Source file for class MemoryMapSeqlockBrokerGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MemoryMapSeqlockBrokerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "MemoryMapSeqlockBrokerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestConstructor) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestInit) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestInit());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestInit_False_NotGAMDataSource) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestInit_False_NotGAMDataSource());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestInit_False_NoSeqlock) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestInit_False_NoSeqlock());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestGetNumberOfSeqlockSignals) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestGetNumberOfSeqlockSignals());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestCopyOutputs) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestCopyOutputs());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestCopyOutputs_Ranges) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestCopyOutputs_Ranges());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestCopyInputs) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestCopyInputs());
+}
+
+TEST(BareMetal_L5GAMs_MemoryMapSeqlockBrokerGTest,TestCopyInputs_Concurrent) {
+    MemoryMapSeqlockBrokerTest test;
+    ASSERT_TRUE(test.TestCopyInputs_Concurrent());
+}
@@ -174,3 +174,12 @@ TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestCheckMultipleProducersWrites)
     ASSERT_TRUE(test.TestCheckMultipleProducersWrites());
 }
 
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestConfigureApplication_Benchmark) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestConfigureApplication_Benchmark());
+}
+
+TEST(BareMetal_L5GAMs_RealTimeApplicationGTest,TestConfigureApplication_ConfigurationCache) {
+    RealTimeApplicationTest test;
+    ASSERT_TRUE(test.TestConfigureApplication_ConfigurationCache());
+}
@@ -0,0 +1,125 @@
+/**
+ * @file SharedMemoryDataSourceGTest.cpp
+ * @brief Source file for class SharedMemoryDataSourceGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryDataSourceGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "SharedMemoryDataSourceTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestConstructor) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise_AddSlash) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_AddSlash());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestInitialise_False_NoSharedMemoryName) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NoSharedMemoryName());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestAllocateMemory) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestAllocateMemory_False_Twice) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestAllocateMemory_False_Twice());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestGetSignalMemoryBuffer) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestGetSignalMemoryBuffer());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestGetBrokerName) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestGetInputBrokers) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputBrokers());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestGetOutputBrokers) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestGetOutputBrokers());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestPrepareNextState) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestPrepareNextState());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestSynchronise) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestBeginWrite) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestBeginWrite());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestEndWrite) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestEndWrite());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestRemoveOnExit) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestRemoveOnExit());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestRemoveOnExit_False) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestRemoveOnExit_False());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryDataSourceGTest,TestExecute) {
+    SharedMemoryDataSourceTest test;
+    ASSERT_TRUE(test.TestExecute());
+}
@@ -0,0 +1,125 @@
+/**
+ * @file SharedMemoryReaderGTest.cpp
+ * @brief Source file for class SharedMemoryReaderGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryReaderGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "SharedMemoryReaderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestConstructor) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestOpen) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestOpen());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestOpen_False_NotExisting) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestOpen_False_NotExisting());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestOpen_False_InvalidMagic) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestOpen_False_InvalidMagic());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestOpen_False_InvalidLayout) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestOpen_False_InvalidLayout());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestClose) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestClose());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetNumberOfSignals) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetNumberOfSignals());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalIndex) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalIndex());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalIndex_False) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalIndex_False());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalName) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalName());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalType) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalType());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalNumberOfElements) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalNumberOfElements());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalNumberOfDimensions) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalNumberOfDimensions());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestGetSignalByteSize) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestGetSignalByteSize());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestRead) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestRead());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestRead_False_InvalidSignal) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestRead_False_InvalidSignal());
+}
+
+TEST(BareMetal_L5GAMs_SharedMemoryReaderGTest,TestRead_False_WriteOngoing) {
+    SharedMemoryReaderTest test;
+    ASSERT_TRUE(test.TestRead_False_WriteOngoing());
+}
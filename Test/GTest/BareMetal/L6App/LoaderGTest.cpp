@@ -63,6 +63,16 @@ TEST(BareMetal_L6App_LoaderGTest,TestConfigure_Xml) {
     ASSERT_TRUE(test.TestConfigure_Xml());
 }
 
+TEST(BareMetal_L6App_LoaderGTest,TestConfigure_Binary) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestConfigure_Binary());
+}
+
+TEST(BareMetal_L6App_LoaderGTest,TestConfigure_False_Binary) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestConfigure_False_Binary());
+}
+
 TEST(BareMetal_L6App_LoaderGTest,TestConfigure_False_BadParser) {
     LoaderTest test;
     ASSERT_TRUE(test.TestConfigure_False_BadParser());
@@ -148,6 +158,11 @@ TEST(BareMetal_L6App_LoaderGTest,TestReconfigure_Hash) {
     ASSERT_TRUE(test.TestReconfigure_Hash());
 }
 
+TEST(BareMetal_L6App_LoaderGTest,TestReconfigure_Hash_Binary) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestReconfigure_Hash_Binary());
+}
+
 TEST(BareMetal_L6App_LoaderGTest,TestGetLastValidConfiguration) {
     LoaderTest test;
     ASSERT_TRUE(test.TestGetLastValidConfiguration());
@@ -213,4 +228,18 @@ TEST(BareMetal_L6App_LoaderGTest,TestGetSeed) {
     ASSERT_TRUE(test.TestGetSeed());
 }
 
+TEST(BareMetal_L6App_LoaderGTest,TestReconfigure_Incremental) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestReconfigure_Incremental());
+}
+
+TEST(BareMetal_L6App_LoaderGTest,TestReconfigure_Incremental_ReloadLast) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestReconfigure_Incremental_ReloadLast());
+}
+
+TEST(BareMetal_L6App_LoaderGTest,TestLoaderPostInit_Incremental_invalid) {
+    LoaderTest test;
+    ASSERT_TRUE(test.TestLoaderPostInit_Incremental_invalid());
+}
 
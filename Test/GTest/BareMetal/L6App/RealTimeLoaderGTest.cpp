@@ -88,3 +88,8 @@ TEST(BareMetal_L6App_RealTimeLoaderGTest,TestStop) {
     ASSERT_TRUE(test.TestStop());
 }
 
+TEST(BareMetal_L6App_RealTimeLoaderGTest,TestReconfigure_Incremental) {
+    RealTimeLoaderTest test;
+    ASSERT_TRUE(test.TestReconfigure_Incremental());
+}
+
@@ -219,5 +219,10 @@ TEST(FileSystem_L1Portability_BasicTCPSocketGTest,TestIsConnected) {
     ASSERT_TRUE(basicTCPSocketTest.TestIsConnected(false, false));
 }
 
+TEST(FileSystem_L1Portability_BasicTCPSocketGTest,TestSetNoDelay) {
+    BasicTCPSocketTest basicTCPSocketTest;
+    ASSERT_TRUE(basicTCPSocketTest.TestSetNoDelay());
+}
+
 
 
@@ -0,0 +1,116 @@
+/**
+ * @file EventPollGTest.cpp
+ * @brief Source file for class EventPollGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class EventPollGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "EventPollTest.h"
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestDefaultConstructor) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestDefaultConstructor());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestOpen) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestOpen());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestOpen_Twice) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestOpen_Twice());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestClose) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestClose());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestAddReadHandle) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestAddReadHandle());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestAddReadHandle_NotOpen) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestAddReadHandle_NotOpen());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestAddReadHandle_SameHandle) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestAddReadHandle_SameHandle());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestRearmReadHandle) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestRearmReadHandle());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestRemoveReadHandle) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestRemoveReadHandle());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestRemoveReadHandle_NotAdded) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestRemoveReadHandle_NotAdded());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestWaitUntil) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestWaitUntil());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestWaitUntil_Timeout) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestWaitUntil_Timeout());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestWaitUntil_OneShot) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestWaitUntil_OneShot());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestWaitUntil_SeveralHandles) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestWaitUntil_SeveralHandles());
+}
+
+TEST(FileSystem_L1Portability_EventPollGTest, TestWaitUntil_InvalidParameters) {
+    EventPollTest myTest;
+    ASSERT_TRUE(myTest.TestWaitUntil_InvalidParameters());
+}
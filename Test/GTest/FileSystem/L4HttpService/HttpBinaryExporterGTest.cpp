@@ -0,0 +1,90 @@
+/**
+ * @file HttpBinaryExporterGTest.cpp
+ * @brief Source file for class HttpBinaryExporterGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpBinaryExporterGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+#include "HttpBinaryExporterTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestConstructor) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestAddVariable) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestAddVariable());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestAddVariable_False_Type) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestAddVariable_False_Type());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestAddVariable_False_Dimensions) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestAddVariable_False_Dimensions());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestAddVariables) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestAddVariables());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestGetNumberOfVariables) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestGetNumberOfVariables());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestGetHeader) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestGetHeader());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestExport) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestExport());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestExport_Deflate) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestExport_Deflate());
+}
+
+TEST(FileSystem_L4HttpService_HttpBinaryExporterGTest, TestExport_False_Stream) {
+    HttpBinaryExporterTest test;
+    ASSERT_TRUE(test.TestExport_False_Stream());
+}
@@ -53,3 +53,8 @@ TEST(FileSystem_L4HttpService_HttpDataExportIGTest, TestGetAsText) {
     HttpDataExportITest test;
     ASSERT_TRUE(test.TestGetAsText());
 }
+
+TEST(FileSystem_L4HttpService_HttpDataExportIGTest, TestGetAsBinary) {
+    HttpDataExportITest test;
+    ASSERT_TRUE(test.TestGetAsBinary());
+}
@@ -162,3 +162,23 @@ TEST(FileSystem_L4HttpService_HttpObjectBrowserGTest, TestGetAsText_Realm_False)
     HttpObjectBrowserTest test;
     ASSERT_TRUE(test.TestGetAsText_Realm_False());
 }
+
+TEST(FileSystem_L4HttpService_HttpObjectBrowserGTest, TestInitialise_False_ResponseCacheSize) {
+    HttpObjectBrowserTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ResponseCacheSize());
+}
+
+TEST(FileSystem_L4HttpService_HttpObjectBrowserGTest, TestGetAsStructuredData_ResponseCache) {
+    HttpObjectBrowserTest test;
+    ASSERT_TRUE(test.TestGetAsStructuredData_ResponseCache());
+}
+
+TEST(FileSystem_L4HttpService_HttpObjectBrowserGTest, TestGetAsStructuredData_ResponseCache_Disabled) {
+    HttpObjectBrowserTest test;
+    ASSERT_TRUE(test.TestGetAsStructuredData_ResponseCache_Disabled());
+}
+
+TEST(FileSystem_L4HttpService_HttpObjectBrowserGTest, TestGetAsStructuredData_ResponseCache_Eviction) {
+    HttpObjectBrowserTest test;
+    ASSERT_TRUE(test.TestGetAsStructuredData_ResponseCache_Eviction());
+}
@@ -264,6 +264,56 @@ TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestTextMode_False) {
     ASSERT_TRUE(test.TestTextMode(1));
 }
 
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestBinaryMode_True) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestBinaryMode(1));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestBinaryMode_False) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestBinaryMode(0));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("gzip, deflate", "deflate", true));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_NoCase) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("GZIP, Deflate", "deflate", true));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_Quality) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("gzip;q=1.0, deflate;q=0.5", "deflate", true));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_Wildcard) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("*", "deflate", true));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_False_NotListed) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("gzip, br", "deflate", false));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_False_Prefix) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("deflatex", "deflate", false));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_False_QualityZero) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding("*, deflate;q=0", "deflate", false));
+}
+
+TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestAcceptsEncoding_False_NoAcceptEncoding) {
+    HttpProtocolTest test;
+    ASSERT_TRUE(test.TestAcceptsEncoding_NoAcceptEncoding());
+}
+
 TEST(FileSystem_L4HttpService_HttpProtocolGTest, TestReadHeader_False_FailGetLine) {
     HttpProtocolTest test;
     ASSERT_TRUE(test.TestReadHeader_False_FailGetLine());
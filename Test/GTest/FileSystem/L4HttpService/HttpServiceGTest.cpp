@@ -149,3 +149,38 @@ TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_NoMoreThreads)
     HttpServiceTest test;
     ASSERT_TRUE(test.TestClientService_NoMoreThreads());
 }
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_EventDriven) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_EventDriven());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_EventDriven_DefaultNumberOfWorkers) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_EventDriven_DefaultNumberOfWorkers());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestInitialise_EventDriven_FalseZeroWorkers) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestInitialise_EventDriven_FalseZeroWorkers());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventDriven_KeepAlive) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventDriven_KeepAlive());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventDriven_ManyClients) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventDriven_ManyClients());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_EventDriven_TooManyConnections) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_EventDriven_TooManyConnections());
+}
+
+TEST(FileSystem_L4HttpService_HttpServiceGTest, TestClientService_Benchmark) {
+    HttpServiceTest test;
+    ASSERT_TRUE(test.TestClientService_Benchmark());
+}
@@ -0,0 +1,109 @@
+/**
+ * @file HttpStreamDataSourceGTest.cpp
+ * @brief Source file for class HttpStreamDataSourceGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class HttpStreamDataSourceGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "HttpStreamDataSourceTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestConstructor) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestInitialise) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestInitialise_False_PublishDecimation) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_PublishDecimation());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestInitialise_False_StreamPeriod) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_StreamPeriod());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestInitialise_False_MaxNumberOfStreams) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MaxNumberOfStreams());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetBrokerName) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetInputBrokers) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetInputBrokers());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetOutputBrokers) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetOutputBrokers());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestSynchronise) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetSnapshot) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetSnapshot());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetAsStructuredData) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetAsStructuredData());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetAsText) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetAsText());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestGetAsText_TooManyStreams) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestGetAsText_TooManyStreams());
+}
+
+TEST(FileSystem_L6App_HttpStreamDataSourceGTest,TestPurge) {
+    HttpStreamDataSourceTest test;
+    ASSERT_TRUE(test.TestPurge());
+}
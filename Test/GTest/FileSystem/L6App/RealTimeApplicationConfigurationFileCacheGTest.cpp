@@ -0,0 +1,85 @@
+/**
+ * @file RealTimeApplicationConfigurationFileCacheGTest.cpp
+ * @brief Source file for class RealTimeApplicationConfigurationFileCacheGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeApplicationConfigurationFileCacheGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "MARTe2UTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeApplicationConfigurationFileCacheTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestConstructor) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestInitialise) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestInitialise_NoFile) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestInitialise_NoFile());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestStore) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestStore());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestStore_InvalidFile) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestStore_InvalidFile());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestLoad) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestLoad());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestLoad_WrongHash) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestLoad_WrongHash());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestLoad_NoFile) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestLoad_NoFile());
+}
+
+TEST(FileSystem_L6App_RealTimeApplicationConfigurationFileCacheGTest,TestRealTimeApplication) {
+    RealTimeApplicationConfigurationFileCacheTest test;
+    ASSERT_TRUE(test.TestRealTimeApplication());
+}
+
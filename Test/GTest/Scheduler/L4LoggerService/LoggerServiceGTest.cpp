@@ -80,6 +80,11 @@ TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestInitialise_False_NumberOfL
     ASSERT_TRUE(target.TestInitialise_False_NumberOfLoggerPages_Zero());
 }
 
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestInitialise_False_NumberOfLogsPerBatch_Zero) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestInitialise_False_NumberOfLogsPerBatch_Zero());
+}
+
 TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestGetCPUMask) {
     LoggerServiceTest target;
     ASSERT_TRUE(target.TestGetCPUMask());
@@ -95,7 +100,17 @@ TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestGetStackSize) {
     ASSERT_TRUE(target.TestGetStackSize());
 }
 
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestGetNumberOfLogsPerBatch) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestGetNumberOfLogsPerBatch());
+}
+
 TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestExecute) {
     LoggerServiceTest target;
     ASSERT_TRUE(target.TestExecute());
 }
+
+TEST(Scheduler_L4LoggerService_LoggerServiceGTest,TestExecute_DroppedLogs) {
+    LoggerServiceTest target;
+    ASSERT_TRUE(target.TestExecute_DroppedLogs());
+}
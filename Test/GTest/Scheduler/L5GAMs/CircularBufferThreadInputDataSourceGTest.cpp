@@ -105,6 +105,11 @@ TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_S
     ASSERT_TRUE(test.TestSynchronise_SleepTime());
 }
 
+TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestSynchronise_BlockingSynchronise) {
+    CircularBufferThreadInputDataSourceTest test;
+    ASSERT_TRUE(test.TestSynchronise_BlockingSynchronise());
+}
+
 TEST(Scheduler_L5GAMs_CircularBufferThreadInputDataSourceGTest,TestGetBrokerName) {
     CircularBufferThreadInputDataSourceTest test;
     ASSERT_TRUE(test.TestGetBrokerName());
@@ -92,3 +92,23 @@ TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestInitialise_False_MoreThanOneErrorMes
     GAMSchedulerTest test;
     ASSERT_TRUE(test.TestInitialise_False_MoreThanOneErrorMessage());
 }
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestInitialise_PrebuiltThreadPools) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestInitialise_PrebuiltThreadPools());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestPrebuiltThreadPools) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestPrebuiltThreadPools());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestPrebuiltThreadPools_StateSwitchTime) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestPrebuiltThreadPools_StateSwitchTime());
+}
+
+TEST(Scheduler_L5GAMs_GAMSchedulerGTest,TestPrebuiltThreadPools_Purge) {
+    GAMSchedulerTest test;
+    ASSERT_TRUE(test.TestPrebuiltThreadPools_Purge());
+}
@@ -78,6 +78,16 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_N_Buffers) {
     ASSERT_TRUE(test.TestExecute_N_Buffers());
 }
 
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_N_Buffers_BatchSynchronise) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_N_Buffers_BatchSynchronise());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_1_Buffer_BatchSynchronise) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_1_Buffer_BatchSynchronise());
+}
+
 TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestExecute_Buffer_Overrun) {
     MemoryMapAsyncOutputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_Buffer_Overrun());
@@ -107,3 +117,13 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestSetIgnoreBufferOverrun
     MemoryMapAsyncOutputBrokerTest test;
     ASSERT_TRUE(test.TestSetIgnoreBufferOverrun());
 }
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestIsBatchSynchronising) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestIsBatchSynchronising());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncOutputBrokerGTest,TestSetBatchSynchronise) {
+    MemoryMapAsyncOutputBrokerTest test;
+    ASSERT_TRUE(test.TestSetBatchSynchronise());
+}
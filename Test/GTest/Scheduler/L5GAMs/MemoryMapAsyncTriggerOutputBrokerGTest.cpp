@@ -197,3 +197,18 @@ TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestExecute_N_PreTr
     MemoryMapAsyncTriggerOutputBrokerTest test;
     ASSERT_TRUE(test.TestExecute_N_PreTriggerBuffers_N_PostTriggerBuffers_PreTriggerIncludesBeforeZero());
 }
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestExecute_Counters) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Counters());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestGetPagesDropped) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestGetPagesDropped());
+}
+
+TEST(Scheduler_L5GAMs_MemoryMapAsyncTriggerOutputBrokerGTest,TestExportData) {
+    MemoryMapAsyncTriggerOutputBrokerTest test;
+    ASSERT_TRUE(test.TestExportData());
+}